@@ -23,16 +23,9 @@
 // Touch screen pins (XPT2046 resistive touch)
 #define TOUCH_CS 33
 
-// Fonts
+// Fonts - only the GLCD font is used (size-1 text). Larger text is drawn
+// with the pre-rendered smooth fonts in src/fonts_data.cpp.
 #define LOAD_GLCD
-#define LOAD_FONT2
-#define LOAD_FONT4
-#define LOAD_FONT6
-#define LOAD_FONT7
-#define LOAD_FONT8
-#define LOAD_GFXFF
-
-#define SMOOTH_FONT
 
 // SPI frequency
 #define SPI_FREQUENCY  40000000
@@ -0,0 +1,136 @@
+#include "addresses.h"
+#include "crypto/base58.h"
+#include "parallel.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char SUBADDR_DOMAIN[] = "SubAddr";  // Hashed with its NUL, as in Monero
+static const char YADA_CHAIN_DOMAIN[] = "yada-chain";
+
+static int hexNibble(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+static void putU32(uint8_t* p, uint32_t v) {
+  for (int i = 0; i < 4; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static bool isPrimary(const AddressContext& ctx, uint32_t index) {
+  return index == 0 && (ctx.coin == ADDR_COIN_YDA || ctx.account == 0);
+}
+
+// ---- Salvium workers: index is a slot in the batch ----
+
+// D = B + m*G and C = a*D; for the primary address B and a*G
+static void subaddressPoints(void* arg, size_t slot, int thread) {
+  (void)thread;
+  AddressContext& ctx = *(AddressContext*)arg;
+  if (isPrimary(ctx, ctx.first + (uint32_t)slot)) {
+    ctx.points[2 * slot] = ctx.spendPoint;
+    ge_scalarmult_base(ctx.points[2 * slot + 1], ctx.viewSecret);
+    return;
+  }
+  uint8_t m[32];
+  subaddressScalar(m, ctx.viewSecret, ctx.account, ctx.first + (uint32_t)slot);
+
+  ge_p3& D = ctx.points[2 * slot];
+  ge_scalarmult_base(D, m);
+  ge_add(D, D, ctx.spendPub);
+  ge_scalarmult_signed(ctx.points[2 * slot + 1], ctx.viewDigits, D);
+}
+
+static void subaddressEncode(void* arg, size_t slot, int thread) {
+  (void)thread;
+  AddressContext& ctx = *(AddressContext*)arg;
+  uint64_t prefix = isPrimary(ctx, ctx.first + (uint32_t)slot) ? SAL_ADDRESS_PREFIX : SAL_SUBADDRESS_PREFIX;
+  addressEncode(ctx.out[slot], prefix, ctx.encoded[2 * slot], ctx.encoded[2 * slot + 1]);
+}
+
+// ---- Public API ----
+
+void subaddressScalar(uint8_t m[32], const uint8_t viewSecret[32], uint32_t account, uint32_t index) {
+  uint8_t data[sizeof(SUBADDR_DOMAIN) + 32 + 8];
+  memcpy(data, SUBADDR_DOMAIN, sizeof(SUBADDR_DOMAIN));
+  memcpy(data + sizeof(SUBADDR_DOMAIN), viewSecret, 32);
+  putU32(data + sizeof(SUBADDR_DOMAIN) + 32, account);
+  putU32(data + sizeof(SUBADDR_DOMAIN) + 36, index);
+  hash_to_scalar(data, sizeof(data), m);
+  memwipe(data, sizeof(data));
+}
+
+void addressEncode(char out[ADDR_MAX_LEN + 1], uint64_t prefix, const uint8_t spend[32], const uint8_t view[32]) {
+  uint8_t raw[10 + 64 + 4];
+  size_t n = write_varint(raw, prefix);
+  memcpy(raw + n, spend, 32);
+  memcpy(raw + n + 32, view, 32);
+  n += 64;
+  uint8_t checksum[32];
+  keccak256(raw, n, checksum);
+  memcpy(raw + n, checksum, 4);
+  base58_encode(out, raw, n + 4);
+}
+
+bool addressesBegin(AddressContext& ctx, AddressCoin coin, uint32_t account) {
+  memset(&ctx, 0, sizeof(ctx));
+  ctx.coin = coin;
+  ctx.account = account;
+
+  if (coin == ADDR_COIN_YDA) {
+    const char* hex = wallet.yadacoinAddress + 3;
+    if (strlen(wallet.yadacoinAddress) != WALLET_YDA_ADDR_LEN) return false;
+    for (int i = 0; i < 32; i++) {
+      int hi = hexNibble(hex[2 * i]);
+      int lo = hi < 0 ? -1 : hexNibble(hex[2 * i + 1]);
+      if (lo < 0) return false;
+      ctx.seed[i] = (uint8_t)((hi << 4) | lo);
+    }
+    return true;
+  }
+
+  uint8_t b[32];
+  walletSalviumSpendKey(b);
+  derive_view_key(ctx.viewSecret, b);
+  ge_scalarmult_base(ctx.spendPoint, b);
+  memwipe(b, sizeof(b));
+  ge_to_cached(ctx.spendPub, ctx.spendPoint);
+  sc_recode_signed(ctx.viewDigits, ctx.viewSecret);
+  return true;
+}
+
+void addressesDerive(AddressContext& ctx, uint32_t first, int count) {
+  if (count > ADDR_BATCH) count = ADDR_BATCH;
+  ctx.first = first;
+  ctx.count = count;
+
+  if (ctx.coin == ADDR_COIN_YDA) {
+    for (int k = 0; k < count; k++) {
+      uint32_t index = first + (uint32_t)k;
+      if (isPrimary(ctx, index)) {
+        memcpy(ctx.out[k], wallet.yadacoinAddress, WALLET_YDA_ADDR_LEN + 1);
+        continue;
+      }
+      KeccakState st;
+      uint8_t le[4], h[32];
+      putU32(le, index);
+      keccak_init(st);
+      keccak_update(st, (const uint8_t*)YADA_CHAIN_DOMAIN, sizeof(YADA_CHAIN_DOMAIN) - 1);
+      keccak_update(st, ctx.seed, 32);
+      keccak_update(st, le, 4);
+      keccak_final(st, h);
+      memcpy(ctx.out[k], "YDA", 3);
+      for (int i = 0; i < 32; i++) snprintf(ctx.out[k] + 3 + 2 * i, 3, "%02x", h[i]);
+    }
+    return;
+  }
+
+  parallelFor(count, subaddressPoints, &ctx);
+  ge_tobytes_batch(ctx.encoded, ctx.points, ctx.zinv, ctx.scratch, 2 * count);
+  parallelFor(count, subaddressEncode, &ctx);
+}
+
+void addressesEnd(AddressContext& ctx) {
+  memwipe(&ctx, sizeof(ctx));
+}
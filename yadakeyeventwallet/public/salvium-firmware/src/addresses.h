@@ -0,0 +1,69 @@
+#pragma once
+
+#include "crypto/cryptonote.h"
+#include "wallet.h"
+
+// ==================== ADDRESS RANGES ====================
+//
+// Lazily derived receive addresses beyond the primary one, for the streamed
+// GET_ADDRESSES:<coin>:<from>:<count> export and the on-screen list.
+//
+// Salvium: CryptoNote subaddresses (account, index) of the wallet keys,
+//   m = Hs("SubAddr\0" || a || account || index)
+//   D = B + m*G, C = a*D
+// encoded as base58(varint(SAL_SUBADDRESS_PREFIX) || D || C || checksum).
+// (0, 0) is the primary address, B and A = a*G under SAL_ADDRESS_PREFIX,
+// the one shown on the Receive screen (addressEncode, also used by the
+// derived-data cache).
+//
+// YadaCoin: a key chain off the stored address; index 0 is that address and
+// index i is "YDA" + hex(Keccak("yada-chain" || seed || i)).
+//
+// addressesDerive fills up to ADDR_BATCH addresses per call, split across
+// cores with parallelFor and encoded with a single field inversion.
+
+#define ADDR_BATCH            8
+#define ADDR_MAX_LEN          99         // "SaLvs..." subaddress
+#define ADDR_MAX_RANGE        10000      // Per GET_ADDRESSES request
+#define SAL_ADDRESS_PREFIX    0x3ef318   // "SaLv"
+#define SAL_SUBADDRESS_PREFIX 0xf5ef318  // "SaLvs"
+
+enum AddressCoin { ADDR_COIN_YDA, ADDR_COIN_SAL };
+
+struct AddressContext {
+  AddressCoin coin;
+  uint32_t account;
+  uint32_t first;  // Index of out[0] in the current batch
+  int count;
+  // Salvium: view secret (plain and recoded) and the public spend key
+  uint8_t viewSecret[32];
+  int8_t viewDigits[64];
+  ge_p3 spendPoint;
+  ge_cached spendPub;
+  // YadaCoin chain seed
+  uint8_t seed[32];
+  // Per batch: D and C of each subaddress, then the encoded result
+  ge_p3 points[2 * ADDR_BATCH];
+  fe zinv[2 * ADDR_BATCH];
+  fe scratch[2 * ADDR_BATCH];
+  uint8_t encoded[2 * ADDR_BATCH][32];
+  char out[ADDR_BATCH][ADDR_MAX_LEN + 1];
+};
+
+// m above, also what the scanner adds to b for an output to a subaddress
+void subaddressScalar(uint8_t m[32], const uint8_t viewSecret[32], uint32_t account, uint32_t index);
+
+// base58(varint(prefix) || spend || view || Keccak checksum), 99 chars for
+// both Salvium prefixes
+void addressEncode(char out[ADDR_MAX_LEN + 1], uint64_t prefix, const uint8_t spend[32], const uint8_t view[32]);
+
+// Load the keys for coin/account from the wallet arena. False if the wallet
+// holds no usable key for that coin.
+bool addressesBegin(AddressContext& ctx, AddressCoin coin, uint32_t account);
+
+// Derive count (<= ADDR_BATCH) consecutive addresses starting at first into
+// ctx.out[0..count)
+void addressesDerive(AddressContext& ctx, uint32_t first, int count);
+
+// Wipe the keys
+void addressesEnd(AddressContext& ctx);
@@ -0,0 +1,115 @@
+#include "amount.h"
+#include <string.h>
+
+#define EXPONENT_MAX 64  // Anything larger is out of range for an int64 anyway
+
+static bool isDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+// ---- Parsing ----
+
+bool amountParse(const char* s, uint8_t decimals, int64_t& out) {
+  if (decimals > AMOUNT_DECIMALS_MAX) return false;
+
+  // Mantissa digits, then where the point is, then the exponent
+  const char* digits = s;
+  int whole = 0, fraction = 0;
+  for (; isDigit(*s); s++) whole++;
+  if (whole == 0) return false;
+  if (*s == '.') {
+    s++;
+    for (; isDigit(*s); s++) fraction++;
+    if (fraction == 0) return false;
+  }
+  int exponent = 0;
+  if (*s == 'e' || *s == 'E') {
+    s++;
+    bool negative = *s == '-';
+    if (*s == '-' || *s == '+') s++;
+    if (!isDigit(*s)) return false;
+    for (; isDigit(*s); s++) {
+      if (exponent > EXPONENT_MAX) return false;
+      exponent = exponent * 10 + (*s - '0');
+    }
+    if (negative) exponent = -exponent;
+  }
+  if (*s != '\0') return false;
+
+  // Each digit's power of ten in atomic units; the first one past the
+  // units digit only rounds, the rest are cut
+  const int64_t max = INT64_MAX;
+  int64_t v = 0;
+  bool roundUp = false;
+  int power = whole - 1 + exponent + decimals;
+  for (int k = 0; k < whole + fraction; k++, power--) {
+    int d = digits[k < whole ? k : k + 1] - '0';  // Skip the point
+    if (power >= 0) {
+      if (v > (max - d) / 10) return false;
+      v = v * 10 + d;
+    } else {
+      if (power == -1) roundUp = d >= 5;
+      break;
+    }
+  }
+  for (; power >= 0; power--) {  // Zeros the exponent added after the digits
+    if (v > max / 10) return false;
+    v *= 10;
+  }
+  if (roundUp) {
+    if (v == max) return false;
+    v++;
+  }
+  out = v;
+  return true;
+}
+
+// ---- Formatting ----
+
+// places < 0: as many as needed, trailing zeros dropped
+static int render(char* out, size_t size, int64_t atomic, uint8_t decimals, int places) {
+  char text[AMOUNT_TEXT_MAX + AMOUNT_DECIMALS_MAX];
+  int len = 0;
+  if (decimals > AMOUNT_DECIMALS_MAX) {
+    text[len++] = '?';
+  } else {
+    // Digits least significant first, padded so there is a units digit
+    char digits[20 + AMOUNT_DECIMALS_MAX];
+    int n = 0;
+    uint64_t a = atomic < 0 ? 0 - (uint64_t)atomic : (uint64_t)atomic;
+    do {
+      digits[n++] = (char)('0' + a % 10);
+      a /= 10;
+    } while (a);
+    while (n <= decimals) digits[n++] = '0';
+
+    if (atomic < 0) text[len++] = '-';
+    for (int i = n - 1; i >= decimals; i--) text[len++] = digits[i];
+
+    // Fraction digit j is digits[decimals - 1 - j]
+    int shown = places;
+    if (shown < 0) {
+      shown = decimals;
+      while (shown > 0 && digits[decimals - shown] == '0') shown--;
+    }
+    if (shown > 0) {
+      text[len++] = '.';
+      for (int j = 0; j < shown; j++) text[len++] = j < decimals ? digits[decimals - 1 - j] : '0';
+    }
+  }
+
+  if (size > 0) {
+    size_t copy = (size_t)len < size ? (size_t)len : size - 1;
+    memcpy(out, text, copy);
+    out[copy] = '\0';
+  }
+  return len;
+}
+
+int amountFormat(char* out, size_t size, int64_t atomic, uint8_t decimals) {
+  return render(out, size, atomic, decimals, -1);
+}
+
+int amountFormatFixed(char* out, size_t size, int64_t atomic, uint8_t decimals, uint8_t places) {
+  return render(out, size, atomic, decimals, places > AMOUNT_DECIMALS_MAX ? AMOUNT_DECIMALS_MAX : places);
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==================== AMOUNTS ====================
+//
+// Amounts are int64 atomic units everywhere (balances, reviewed outputs,
+// history); decimals is the coin's atomicDecimals (coins.h). Text is only
+// converted at the edges, in fixed point: no float, no heap, and output
+// goes into the caller's buffer.
+
+#define AMOUNT_DECIMALS_MAX 18  // 10^18 still fits an int64
+#define AMOUNT_TEXT_MAX     42  // Sign, 19 digits, point, 18 decimals, NUL and slack
+
+// Decimal text to atomic units, rounded half up past decimals places.
+// Accepts "12", "12.5" and an exponent as JavaScript prints small or large
+// numbers ("5e-7", "1.5e+21"). No sign; false on anything else or overflow.
+bool amountParse(const char* s, uint8_t decimals, int64_t& out);
+
+// The formatters return the length of the whole text, like snprintf; out
+// is cut to size and always terminated.
+
+// "12.5" from 1250000000 at 8 decimals; trailing zeros dropped
+int amountFormat(char* out, size_t size, int64_t atomic, uint8_t decimals);
+
+// Exactly places decimals, cut (not rounded) so a balance never shows
+// more than there is: "12.5000" at 4 places
+int amountFormatFixed(char* out, size_t size, int64_t atomic, uint8_t decimals, uint8_t places);
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <type_traits>
+
+#include "addresses.h"
+#include "amount.h"
+#include "derived.h"
+#include "history.h"
+#include "keystore.h"
+#include "wallet.h"
+
+// ==================== COIN REGISTRY ====================
+//
+// Every chain the wallet holds is one traits struct: its ticker, how its
+// amounts print and count, where its address and balance live in the wallet
+// arena and which address, history and QR slots belong to it. Coins lists them; a
+// coin's index there is its AddressCoin and HistoryCoin value too.
+//
+// Serial commands resolve the ticker once (coinFind, an integer compare per
+// coin) and hand the index to withCoin, which calls a generic lambda with
+// the traits type. Everything past that point is instantiated per coin, so
+// there are no string compares or switches on the coin below the parser.
+// Per-coin behaviour that is more than a constant (signing) is an overload
+// on the traits type in main.cpp; a coin without one does not compile.
+
+#define COIN_NONE       -1
+#define COIN_TICKER_MAX 4  // Chars, packed into a uint32_t tag
+
+// Ticker packed little-endian, so "YDA" compares as one integer
+constexpr uint32_t coinTag(const char* s, size_t len) {
+  uint32_t tag = 0;
+  for (size_t i = 0; i < len && i < COIN_TICKER_MAX; i++) tag |= (uint32_t)(uint8_t)s[i] << (8 * i);
+  return tag;
+}
+
+constexpr size_t coinLength(const char* s) {
+  return *s ? 1 + coinLength(s + 1) : 0;
+}
+
+struct YadaCoin {
+  static constexpr const char* ticker = "YDA";
+  static constexpr const char* name = "YadaCoin";
+  static constexpr uint32_t tag = coinTag(ticker, coinLength(ticker));
+  static constexpr int decimals = 4;  // Shown on the balance screen
+  static constexpr uint8_t atomicDecimals = 8;  // 1 YDA = 10^8 atomic units
+  static constexpr AddressCoin addressCoin = ADDR_COIN_YDA;
+  static constexpr HistoryCoin historyCoin = HISTORY_COIN_YDA;
+  static constexpr DerivedQr qr = DERIVED_QR_YADACOIN;
+  static constexpr int qrVersion = DERIVED_QR_VERSION_YDA;
+  static constexpr int assets = 1;
+  static constexpr KeyRecord addressRecord = KEY_YDA_ADDRESS;  // Set by ROTATE_KEY
+  static char* address() { return wallet.yadacoinAddress; }
+  static WalletBalance* balances() { return &wallet.yadacoinBalance; }
+  static bool setAddress(const char* addr) { return walletSetYadaAddress(addr); }
+};
+
+struct Salvium {
+  static constexpr const char* ticker = "SAL";
+  static constexpr const char* name = "Salvium";
+  static constexpr uint32_t tag = coinTag(ticker, coinLength(ticker));
+  static constexpr int decimals = 6;
+  static constexpr uint8_t atomicDecimals = 8;
+  static constexpr AddressCoin addressCoin = ADDR_COIN_SAL;
+  static constexpr HistoryCoin historyCoin = HISTORY_COIN_SAL;
+  static constexpr DerivedQr qr = DERIVED_QR_SALVIUM;
+  static constexpr int qrVersion = DERIVED_QR_VERSION_SAL;
+  static constexpr int assets = WALLET_SAL_ASSETS;
+  static constexpr KeyRecord addressRecord = KEY_SAL_ADDRESS;
+  static char* address() { return wallet.salviumAddress; }
+  static WalletBalance* balances() { return wallet.salviumBalances; }
+  static bool setAddress(const char* addr) { return walletSetSalviumAddress(addr); }
+};
+
+template <class... Cs>
+struct CoinList {
+  static constexpr int count = sizeof...(Cs);
+  static constexpr uint32_t tags[] = {Cs::tag...};
+  static constexpr const char* tickers[] = {Cs::ticker...};
+  static constexpr const char* names[] = {Cs::name...};
+
+  template <class C>
+  static constexpr int indexOf() {
+    int index = COIN_NONE, i = 0;
+    ((index = (index == COIN_NONE && std::is_same<C, Cs>::value) ? i : index, i++), ...);
+    return index;
+  }
+
+  // f(C{}) for the coin at index; false if there is none
+  template <class F>
+  static bool dispatch(int index, F&& f) {
+    int i = 0;
+    return ((index == i++ ? (f(Cs{}), true) : false) || ...);
+  }
+};
+
+using Coins = CoinList<YadaCoin, Salvium>;
+#define COIN_COUNT Coins::count
+
+template <class C>
+constexpr int coinIndex() {
+  return Coins::indexOf<C>();
+}
+
+template <class... Cs>
+constexpr bool coinsConsistent(CoinList<Cs...>) {
+  bool ok = true;
+  int i = 0;
+  ((ok = ok && Cs::addressCoin == i && Cs::historyCoin == i && coinLength(Cs::ticker) <= COIN_TICKER_MAX, i++),
+   ...);
+  return ok;
+}
+static_assert(coinsConsistent(Coins{}), "coin order must match AddressCoin and HistoryCoin");
+
+// Index of the coin whose ticker is the len chars at s, or COIN_NONE
+inline int coinFind(const char* s, size_t len) {
+  if (len == 0 || len > COIN_TICKER_MAX) return COIN_NONE;
+  uint32_t tag = coinTag(s, len);
+  for (int i = 0; i < COIN_COUNT; i++) {
+    if (Coins::tags[i] == tag) return i;
+  }
+  return COIN_NONE;
+}
+
+template <class F>
+inline bool withCoin(int index, F&& f) {
+  return Coins::dispatch(index, f);
+}
+
+// Ticker of a packed tag, NUL terminated
+inline void coinTagText(uint32_t tag, char out[COIN_TICKER_MAX + 1]) {
+  for (int i = 0; i <= COIN_TICKER_MAX; i++) out[i] = i < COIN_TICKER_MAX ? (char)(tag >> (8 * i)) : '\0';
+}
+
+// Balance slot of an asset of C; slot 0 is the coin's own. With create, a
+// missing asset gets a free slot. nullptr if absent or the slots are full.
+template <class C>
+inline WalletBalance* coinBalance(uint32_t asset, bool create) {
+  WalletBalance* slots = C::balances();
+  if (asset == C::tag) return &slots[0];
+  WalletBalance* unused = nullptr;
+  for (int i = 1; i < C::assets; i++) {
+    if (slots[i].asset == asset) return &slots[i];
+    if (!unused && slots[i].asset == 0) unused = &slots[i];
+  }
+  return create ? unused : nullptr;
+}
+
+// "12.3456 YDA": the coin's display decimals, cut from atomic units
+template <class C>
+inline int coinFormat(char* out, size_t size, int64_t atomic) {
+  int n = amountFormatFixed(out, size, atomic, C::atomicDecimals, C::decimals);
+  if (n > 0 && (size_t)n < size) n += snprintf(out + n, size - n, " %s", C::ticker);
+  return n;
+}
+
+inline const char* coinTicker(int index) {
+  return index >= 0 && index < COIN_COUNT ? Coins::tickers[index] : "?";
+}
+
+inline const char* coinName(int index) {
+  return index >= 0 && index < COIN_COUNT ? Coins::names[index] : "?";
+}
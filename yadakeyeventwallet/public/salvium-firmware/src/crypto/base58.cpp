@@ -0,0 +1,83 @@
+#include "base58.h"
+#include <string.h>
+
+static const char ALPHABET[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+#define FULL_BLOCK_SIZE         8
+#define FULL_ENCODED_BLOCK_SIZE 11
+
+// Encoded size of a block of 0..8 bytes
+static const uint8_t ENCODED_BLOCK_SIZES[] = {0, 2, 3, 5, 6, 7, 9, 10, 11};
+
+static void encodeBlock(char* out, const uint8_t* block, size_t len) {
+  uint64_t num = 0;
+  for (size_t i = 0; i < len; i++) num = (num << 8) | block[i];
+
+  // Fixed width, most significant digit first, padded with '1'
+  for (int i = ENCODED_BLOCK_SIZES[len] - 1; i >= 0; i--) {
+    out[i] = ALPHABET[num % 58];
+    num /= 58;
+  }
+}
+
+size_t base58_encoded_size(size_t len) {
+  return (len / FULL_BLOCK_SIZE) * FULL_ENCODED_BLOCK_SIZE + ENCODED_BLOCK_SIZES[len % FULL_BLOCK_SIZE];
+}
+
+size_t base58_encode(char* out, const uint8_t* data, size_t len) {
+  size_t full = len / FULL_BLOCK_SIZE;
+  for (size_t i = 0; i < full; i++) {
+    encodeBlock(out + i * FULL_ENCODED_BLOCK_SIZE, data + i * FULL_BLOCK_SIZE, FULL_BLOCK_SIZE);
+  }
+  size_t rest = len % FULL_BLOCK_SIZE;
+  if (rest) encodeBlock(out + full * FULL_ENCODED_BLOCK_SIZE, data + full * FULL_BLOCK_SIZE, rest);
+
+  size_t n = base58_encoded_size(len);
+  out[n] = '\0';
+  return n;
+}
+
+// Byte count of a block encoded as n characters, or -1
+static int decodedBlockSize(size_t n) {
+  for (int len = 0; len <= FULL_BLOCK_SIZE; len++) {
+    if (ENCODED_BLOCK_SIZES[len] == n) return len;
+  }
+  return -1;
+}
+
+static bool decodeBlock(uint8_t* out, const char* in, size_t n, int len) {
+  uint64_t num = 0;
+  for (size_t i = 0; i < n; i++) {
+    const char* at = strchr(ALPHABET, in[i]);
+    if (!in[i] || !at) return false;
+    uint64_t digit = (uint64_t)(at - ALPHABET);
+    if (num > (UINT64_MAX - digit) / 58) return false;
+    num = num * 58 + digit;
+  }
+  if (len < FULL_BLOCK_SIZE && (num >> (8 * len)) != 0) return false;
+  for (int i = len - 1; i >= 0; i--) {
+    out[i] = (uint8_t)num;
+    num >>= 8;
+  }
+  return true;
+}
+
+size_t base58_decode(uint8_t* out, size_t size, const char* in, size_t len) {
+  size_t full = len / FULL_ENCODED_BLOCK_SIZE;
+  size_t rest = len % FULL_ENCODED_BLOCK_SIZE;
+  int restBytes = decodedBlockSize(rest);
+  if (restBytes < 0) return 0;
+  size_t total = full * FULL_BLOCK_SIZE + restBytes;
+  if (total > size) return 0;
+
+  for (size_t i = 0; i < full; i++) {
+    if (!decodeBlock(out + i * FULL_BLOCK_SIZE, in + i * FULL_ENCODED_BLOCK_SIZE, FULL_ENCODED_BLOCK_SIZE,
+                     FULL_BLOCK_SIZE)) {
+      return 0;
+    }
+  }
+  if (rest && !decodeBlock(out + full * FULL_BLOCK_SIZE, in + full * FULL_ENCODED_BLOCK_SIZE, rest, restBytes)) {
+    return 0;
+  }
+  return total;
+}
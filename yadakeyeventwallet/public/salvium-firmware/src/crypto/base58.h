@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==================== CRYPTONOTE BASE58 ====================
+//
+// Block base58 as used for Monero/Salvium addresses: every 8 input bytes
+// become exactly 11 characters, and a final partial block of n bytes becomes
+// a fixed number of characters, so the output length depends only on len.
+
+// Characters written for len input bytes (without the NUL)
+size_t base58_encoded_size(size_t len);
+
+// out needs base58_encoded_size(len) + 1 bytes. Returns the length written.
+size_t base58_encode(char* out, const uint8_t* data, size_t len);
+
+// The len characters at in back to bytes, into out (room for size). Returns
+// the byte count, or 0 on a bad character, length or block value.
+size_t base58_decode(uint8_t* out, size_t size, const char* in, size_t len);
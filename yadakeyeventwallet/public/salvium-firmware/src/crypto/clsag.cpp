@@ -0,0 +1,224 @@
+#include "clsag.h"
+#include "random.h"
+#include <string.h>
+
+// Domain separators, zero padded to a full 32-byte key as in Monero
+static const char DOMAIN_ROUND[] = "CLSAG_round";
+static const char DOMAIN_AGG_0[] = "CLSAG_agg_0";
+static const char DOMAIN_AGG_1[] = "CLSAG_agg_1";
+
+static void absorbDomain(KeccakState& st, const char* domain) {
+  uint8_t key[32] = {0};
+  memcpy(key, domain, strlen(domain));
+  keccak_init(st);
+  keccak_update(st, key, sizeof(key));
+}
+
+static void absorbRing(KeccakState& st, int n, const uint8_t P[][32], const uint8_t C[][32]) {
+  for (int k = 0; k < n; k++) keccak_update(st, P[k], 32);
+  for (int k = 0; k < n; k++) keccak_update(st, C[k], 32);
+}
+
+// mu_P, mu_C: domain | P | C | I | D/8 | C_offset
+static void aggregationHashes(uint8_t muP[32], uint8_t muC[32], int n, const uint8_t P[][32],
+                              const uint8_t C[][32], const uint8_t Coffset[32], const ClsagSignature& sig) {
+  KeccakState st;
+  const char* domains[2] = {DOMAIN_AGG_0, DOMAIN_AGG_1};
+  uint8_t* outs[2] = {muP, muC};
+  for (int k = 0; k < 2; k++) {
+    absorbDomain(st, domains[k]);
+    absorbRing(st, n, P, C);
+    keccak_update(st, sig.I, 32);
+    keccak_update(st, sig.D, 32);
+    keccak_update(st, Coffset, 32);
+    keccak_final(st, outs[k]);
+    sc_reduce32(outs[k]);
+  }
+}
+
+// c = Hs(prefix | L | R)
+static void roundChallenge(uint8_t c[32], const KeccakState& prefix, const ge_p3& L, const ge_p3& R) {
+  KeccakState st = prefix;
+  uint8_t buf[32];
+  ge_tobytes(buf, L);
+  keccak_update(st, buf, 32);
+  ge_tobytes(buf, R);
+  keccak_update(st, buf, 32);
+  keccak_final(st, c);
+  sc_reduce32(c);
+}
+
+// L = s*G + cP*P + cC*C and R = s*H + cP*I + cC*D, all public
+static void roundPoints(ge_p3& L, ge_p3& R, const uint8_t s[32], const uint8_t cP[32], const uint8_t cC[32],
+                        const ge_table& Ptab, const ge_table& Ctab, const ge_table& Htab,
+                        const ge_table& Itab, const ge_table& Dtab) {
+  const uint8_t* scalars[3] = {s, cP, cC};
+  const ge_table* left[3] = {&ge_base_table(), &Ptab, &Ctab};
+  const ge_table* right[3] = {&Htab, &Itab, &Dtab};
+  ge_multiscalarmult_vartime(L, scalars, left, 3);
+  ge_multiscalarmult_vartime(R, scalars, right, 3);
+}
+
+// Seeded with the key, message, ring, real index and commitment data, so a
+// different input or message never repeats a nonce
+void clsagDrawNonces(ClsagContext& ctx, const uint8_t secret[32]) {
+  NonceStream ns;
+  nonceBegin(ns, secret);
+  nonceAbsorb(ns, ctx.message, 32);
+  nonceAbsorb(ns, &ctx.n, 1);
+  nonceAbsorb(ns, &ctx.l, 1);
+  for (int k = 0; k < ctx.n; k++) {
+    nonceAbsorb(ns, ctx.P[k], 32);
+    nonceAbsorb(ns, ctx.C[k], 32);
+  }
+  nonceAbsorb(ns, ctx.Coffset, 32);
+  nonceAbsorb(ns, ctx.z, 32);
+
+  nonceScalar(ns, ctx.a);
+  for (int k = 0; k < ctx.n; k++) {
+    if (k != ctx.l) nonceScalar(ns, ctx.sig.s[k]);
+  }
+  nonceEnd(ns);
+}
+
+bool clsagPrecomputeMember(ClsagContext& ctx, int i) {
+  ge_p3 C, offset;
+  ge_cached offsetCached;
+  if (!ge_frombytes_vartime(ctx.Pp[i], ctx.P[i])) return false;
+  if (!ge_frombytes_vartime(C, ctx.C[i])) return false;
+  if (!ge_frombytes_vartime(offset, ctx.Coffset)) return false;
+  ge_to_cached(offsetCached, offset);
+  ge_sub(ctx.Cp[i], C, offsetCached);
+  hash_to_ec(ctx.Hp[i], ctx.P[i]);
+  return true;
+}
+
+bool clsagBegin(ClsagContext& ctx, ClsagScratch& scratch) {
+  uint8_t expect[32], actual[32];
+  ge_p3 t;
+  const int l = ctx.l;
+
+  // p and z must open the real member: P[l] = p*G, C[l] - C_offset = z*G
+  ge_scalarmult_base(t, ctx.p);
+  ge_tobytes(actual, t);
+  if (memcmp(actual, ctx.P[l], 32) != 0) return false;
+  ge_scalarmult_base(t, ctx.z);
+  ge_tobytes(actual, t);
+  ge_tobytes(expect, ctx.Cp[l]);
+  if (memcmp(actual, expect, 32) != 0) return false;
+
+  // I = p*H, D = z*H
+  ge_table& Htab = scratch.t[0];
+  ge_table_build(Htab, ctx.Hp[l]);
+  ge_scalarmult_table(t, ctx.p, Htab);
+  ge_tobytes(ctx.sig.I, t);
+  ge_table_build(ctx.Itab, t);
+  ge_scalarmult_table(t, ctx.z, Htab);
+  ge_table_build(ctx.Dtab, t);
+  ge_scalarmult(t, SC_INV_EIGHT, t);
+  ge_tobytes(ctx.sig.D, t);
+
+  aggregationHashes(ctx.muP, ctx.muC, ctx.n, ctx.P, ctx.C, ctx.Coffset, ctx.sig);
+
+  absorbDomain(ctx.roundPrefix, DOMAIN_ROUND);
+  absorbRing(ctx.roundPrefix, ctx.n, ctx.P, ctx.C);
+  keccak_update(ctx.roundPrefix, ctx.Coffset, 32);
+  keccak_update(ctx.roundPrefix, ctx.message, 32);
+
+  // Initial challenge from a*G, a*H
+  ge_p3 aG, aH;
+  ge_scalarmult_base(aG, ctx.a);
+  ge_scalarmult_table(aH, ctx.a, Htab);
+  roundChallenge(ctx.c, ctx.roundPrefix, aG, aH);
+
+  ctx.i = (l + 1) % ctx.n;
+  if (ctx.i == 0) memcpy(ctx.sig.c1, ctx.c, 32);
+  return true;
+}
+
+bool clsagRound(ClsagContext& ctx, ClsagScratch& scratch) {
+  if (ctx.i == ctx.l) return true;
+
+  const int i = ctx.i;
+  uint8_t cP[32], cC[32];
+  sc_mul(cP, ctx.muP, ctx.c);
+  sc_mul(cC, ctx.muC, ctx.c);
+
+  ge_table_build(scratch.t[0], ctx.Pp[i]);
+  ge_table_build(scratch.t[1], ctx.Cp[i]);
+  ge_table_build(scratch.t[2], ctx.Hp[i]);
+
+  ge_p3 L, R;
+  roundPoints(L, R, ctx.sig.s[i], cP, cC, scratch.t[0], scratch.t[1], scratch.t[2], ctx.Itab, ctx.Dtab);
+  roundChallenge(ctx.c, ctx.roundPrefix, L, R);
+
+  ctx.i = (i + 1) % ctx.n;
+  if (ctx.i == 0) memcpy(ctx.sig.c1, ctx.c, 32);
+  return ctx.i == ctx.l;
+}
+
+void clsagFinish(ClsagContext& ctx) {
+  // s[l] = a - c*(mu_P*p + mu_C*z)
+  uint8_t pmu[32], w[32];
+  sc_mul(pmu, ctx.muP, ctx.p);
+  sc_muladd(w, ctx.muC, ctx.z, pmu);
+  sc_mulsub(ctx.sig.s[ctx.l], ctx.c, w, ctx.a);
+
+  memwipe(pmu, sizeof(pmu));
+  memwipe(w, sizeof(w));
+  memwipe(ctx.p, sizeof(ctx.p));
+  memwipe(ctx.z, sizeof(ctx.z));
+  memwipe(ctx.a, sizeof(ctx.a));
+}
+
+bool clsagVerify(const uint8_t message[32], int n, const uint8_t P[][32], const uint8_t C[][32],
+                 const uint8_t Coffset[32], const ClsagSignature& sig) {
+  static const uint8_t IDENTITY[32] = {1};
+  if (n < 1 || n > CLSAG_MAX_RING) return false;
+  if (!sc_check(sig.c1)) return false;
+  for (int k = 0; k < n; k++) {
+    if (!sc_check(sig.s[k])) return false;
+  }
+  if (memcmp(sig.I, IDENTITY, 32) == 0) return false;
+
+  ge_p3 I, D, offset, t;
+  ge_cached offsetCached;
+  if (!ge_frombytes_vartime(I, sig.I)) return false;
+  if (!ge_frombytes_vartime(D, sig.D)) return false;
+  if (!ge_frombytes_vartime(offset, Coffset)) return false;
+  ge_mul8(D, D);
+  ge_to_cached(offsetCached, offset);
+
+  ge_table Itab, Dtab, Ptab, Ctab, Htab;
+  ge_table_build(Itab, I);
+  ge_table_build(Dtab, D);
+
+  uint8_t muP[32], muC[32], c[32], cP[32], cC[32];
+  aggregationHashes(muP, muC, n, P, C, Coffset, sig);
+
+  KeccakState prefix;
+  absorbDomain(prefix, DOMAIN_ROUND);
+  absorbRing(prefix, n, P, C);
+  keccak_update(prefix, Coffset, 32);
+  keccak_update(prefix, message, 32);
+
+  memcpy(c, sig.c1, 32);
+  for (int i = 0; i < n; i++) {
+    sc_mul(cP, muP, c);
+    sc_mul(cC, muC, c);
+
+    if (!ge_frombytes_vartime(t, P[i])) return false;
+    ge_table_build(Ptab, t);
+    ge_p3 H;
+    hash_to_ec(H, P[i]);
+    ge_table_build(Htab, H);
+    if (!ge_frombytes_vartime(t, C[i])) return false;
+    ge_sub(t, t, offsetCached);
+    ge_table_build(Ctab, t);
+
+    ge_p3 L, R;
+    roundPoints(L, R, sig.s[i], cP, cC, Ptab, Ctab, Htab, Itab, Dtab);
+    roundChallenge(c, prefix, L, R);
+  }
+  return memcmp(c, sig.c1, 32) == 0;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "cryptonote.h"
+
+// ==================== CLSAG RING SIGNATURES ====================
+//
+// Monero-compatible CLSAG (rctSigs.cpp CLSAG_Gen / CLSAG_Ver), split into
+// resumable phases so a signing job can spread the work over several steps
+// and across cores:
+//
+//   clsagPrecomputeMember  per ring member: decompress P and C, C - C_offset,
+//                          Hp(P). Members are independent.
+//   clsagBegin             per input: key image, commitment key image,
+//                          aggregation hashes, the initial challenge
+//   clsagRound             per input: one decoy iteration (hash chain, so
+//                          sequential within a ring)
+//   clsagFinish            per input: closing response, wipes secrets
+//
+// Different inputs never share state, so any phase may run for different
+// inputs on different threads at the same time. Nonces are derived up front
+// by clsagDrawNonces, in input order, so the result does not depend on which
+// thread ran which step.
+
+#define CLSAG_MAX_RING 16
+
+struct ClsagSignature {
+  uint8_t s[CLSAG_MAX_RING][32];
+  uint8_t c1[32];
+  uint8_t I[32];   // Key image
+  uint8_t D[32];   // Commitment key image * 1/8
+};
+
+// Per-thread temporaries (window tables are too big for the loop task stack)
+struct ClsagScratch {
+  ge_table t[3];
+};
+
+struct ClsagContext {
+  // Public input
+  const uint8_t* message;         // 32-byte pre-signature hash
+  uint8_t n;                      // Ring size
+  uint8_t l;                      // Real index
+  uint8_t P[CLSAG_MAX_RING][32];  // Output keys
+  uint8_t C[CLSAG_MAX_RING][32];  // Output commitments
+  uint8_t Coffset[32];            // Pseudo-output commitment
+
+  // Secrets: one-time key and commitment mask difference
+  uint8_t p[32];
+  uint8_t z[32];
+
+  // Nonces: alpha and the decoy responses (sig.s[i], i != l)
+  uint8_t a[32];
+
+  // Precomputed
+  ge_p3 Pp[CLSAG_MAX_RING];
+  ge_p3 Cp[CLSAG_MAX_RING];       // C[i] - Coffset
+  ge_p3 Hp[CLSAG_MAX_RING];       // Hp(P[i])
+  ge_table Itab;
+  ge_table Dtab;
+  uint8_t muP[32];
+  uint8_t muC[32];
+  KeccakState roundPrefix;        // Absorbed domain|P|C|Coffset|message
+
+  // Ring walk
+  uint8_t c[32];
+  uint8_t i;
+  bool failed;
+
+  ClsagSignature sig;
+};
+
+// alpha and the decoy responses, derived from secret (the private spend key)
+// and the loaded input as in random.h; call once the public input is set
+void clsagDrawNonces(ClsagContext& ctx, const uint8_t secret[32]);
+
+// False if a point does not decompress
+bool clsagPrecomputeMember(ClsagContext& ctx, int i);
+
+// False if p or z do not open the real ring member
+bool clsagBegin(ClsagContext& ctx, ClsagScratch& scratch);
+
+// Returns true once the walk has come back round to the real index
+bool clsagRound(ClsagContext& ctx, ClsagScratch& scratch);
+
+void clsagFinish(ClsagContext& ctx);
+
+// Full verification against the public ring. Vartime, uses ~10 KB of stack.
+bool clsagVerify(const uint8_t message[32], int n, const uint8_t P[][32], const uint8_t C[][32],
+                 const uint8_t Coffset[32], const ClsagSignature& sig);
@@ -0,0 +1,232 @@
+#include "cryptonote.h"
+#include <string.h>
+#include "random.h"
+
+// Montgomery-curve constants for ge_fromfe (A = 486662)
+static const uint8_t FE_MA[32] = {  // -A
+  0xe7, 0x92, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+};
+static const uint8_t FE_MA2[32] = {  // -A^2
+  0xc9, 0xe3, 0x3d, 0xdb, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+};
+static const uint8_t FE_FFFB1[32] = {  // sqrt(-2A(A+2))
+  0xff, 0xbd, 0xe3, 0xcd, 0x8a, 0x96, 0x58, 0xdd, 0x72, 0x8c, 0xd5, 0x46, 0x57, 0xfb, 0x6b, 0x2e,
+  0x1c, 0xe6, 0x04, 0xbe, 0xc8, 0x3a, 0x56, 0xdf, 0xe8, 0xe4, 0x29, 0x25, 0x10, 0x04, 0x8e, 0x01,
+};
+static const uint8_t FE_FFFB2[32] = {  // sqrt(2A(A+2))
+  0x0d, 0x65, 0x83, 0x9f, 0x7c, 0x9b, 0x21, 0x2d, 0x20, 0x08, 0xa9, 0xfb, 0xb9, 0xfc, 0x21, 0xae,
+  0x41, 0xa0, 0xe9, 0x3f, 0x48, 0xae, 0x2b, 0x6e, 0x09, 0xd3, 0xa5, 0xfb, 0xf5, 0xe1, 0xf9, 0x32,
+};
+static const uint8_t FE_FFFB3[32] = {  // sqrt(-sqrt(-1)A(A+2))
+  0x66, 0x2c, 0x30, 0x17, 0x87, 0x7d, 0x1b, 0x58, 0x29, 0x42, 0x96, 0xa5, 0x4e, 0xff, 0x24, 0x40,
+  0xed, 0xa2, 0x0d, 0x3f, 0x40, 0x46, 0x95, 0xb8, 0xef, 0x08, 0xc2, 0x14, 0x0d, 0x11, 0x4a, 0x67,
+};
+static const uint8_t FE_FFFB4[32] = {  // sqrt(sqrt(-1)A(A+2))
+  0x67, 0x6e, 0x4c, 0x49, 0xfc, 0xe6, 0xc2, 0x7a, 0xb6, 0xb5, 0xc0, 0x5e, 0xf7, 0x03, 0xb9, 0x11,
+  0xd1, 0xbc, 0x08, 0x81, 0x77, 0x0b, 0x3f, 0xd9, 0x06, 0x24, 0x98, 0xef, 0xfc, 0x0c, 0xbc, 0x65,
+};
+static const uint8_t FE_SQRTM1[32] = {
+  0xb0, 0xa0, 0x0e, 0x4a, 0x27, 0x1b, 0xee, 0xc4, 0x78, 0xe4, 0x2f, 0xad, 0x06, 0x18, 0x43, 0x2f,
+  0xa7, 0xd7, 0xfb, 0x3d, 0x99, 0x00, 0x4d, 0x2b, 0x0b, 0xdf, 0xc1, 0x4f, 0x80, 0x24, 0x83, 0x2b,
+};
+
+void memwipe(void* ptr, size_t len) {
+  volatile uint8_t* p = (volatile uint8_t*)ptr;
+  while (len--) *p++ = 0;
+}
+
+size_t write_varint(uint8_t* out, uint64_t value) {
+  size_t n = 0;
+  while (value >= 0x80) {
+    out[n++] = (uint8_t)(value & 0x7F) | 0x80;
+    value >>= 7;
+  }
+  out[n++] = (uint8_t)value;
+  return n;
+}
+
+void hash_to_scalar(const uint8_t* data, size_t len, uint8_t out[32]) {
+  keccak256(data, len, out);
+  sc_reduce32(out);
+}
+
+// (u / v)^((p + 3) / 8) = u * v^3 * (u * v^7)^((p - 5) / 8)
+static void fe_divpowm1(fe r, const fe u, const fe v) {
+  fe v3, uv7;
+  fe_sq(v3, v);
+  fe_mul(v3, v3, v);
+  fe_sq(uv7, v3);
+  fe_mul(uv7, uv7, v);
+  fe_mul(uv7, uv7, u);
+  fe_pow22523(uv7, uv7);
+  fe_mul(r, uv7, v3);
+  fe_mul(r, r, u);
+}
+
+// Monero's ge_fromfe_frombytes_vartime: maps 32 hash bytes to a curve point
+// (Elligator-style, via the Montgomery form). Output in extended coordinates.
+static void ge_fromfe_frombytes_vartime(ge_p3& r, const uint8_t s[32]) {
+  fe u, v, w, x, y, z, rX, rY, rZ, c;
+  int sign;
+
+  fe_frombytes_full(u, s);
+  fe_sq(v, u);
+  fe_add(v, v, v);            // 2u^2
+  fe_1(w);
+  fe_add(w, v, w);            // w = 2u^2 + 1
+  fe_sq(x, w);
+  fe_frombytes(c, FE_MA2);
+  fe_mul(y, c, v);
+  fe_add(x, x, y);            // x = w^2 - 2A^2u^2
+  fe_divpowm1(rX, w, x);      // (w / x)^((p + 3) / 8)
+  fe_sq(y, rX);
+  fe_mul(x, y, x);
+  fe_sub(y, w, x);
+  fe_frombytes(z, FE_MA);
+
+  if (fe_isnonzero(y)) {
+    fe_add(y, w, x);
+    if (fe_isnonzero(y)) {
+      // w / x is not a square: use the sqrt(-1) branch
+      fe_frombytes(c, FE_SQRTM1);
+      fe_mul(x, x, c);
+      fe_sub(y, w, x);
+      fe_frombytes(c, fe_isnonzero(y) ? FE_FFFB3 : FE_FFFB4);
+      fe_mul(rX, rX, c);
+      sign = 1;              // z = -A
+    } else {
+      fe_frombytes(c, FE_FFFB1);
+      fe_mul(rX, rX, c);
+      fe_mul(rX, rX, u);
+      fe_mul(z, z, v);       // z = -2Au^2
+      sign = 0;
+    }
+  } else {
+    fe_frombytes(c, FE_FFFB2);
+    fe_mul(rX, rX, c);
+    fe_mul(rX, rX, u);
+    fe_mul(z, z, v);
+    sign = 0;
+  }
+
+  if (fe_isnegative(rX) != sign) fe_neg(rX, rX);
+
+  fe_add(rZ, z, w);
+  fe_sub(rY, z, w);
+  fe_mul(rX, rX, rZ);
+
+  // Projective (X:Y:Z) to extended (XZ : YZ : Z^2 : XY)
+  fe_mul(r.X, rX, rZ);
+  fe_mul(r.Y, rY, rZ);
+  fe_sq(r.Z, rZ);
+  fe_mul(r.T, rX, rY);
+}
+
+void hash_to_ec(ge_p3& r, const uint8_t pub[32]) {
+  uint8_t h[32];
+  ge_p3 p;
+  keccak256(pub, 32, h);
+  ge_fromfe_frombytes_vartime(p, h);
+  ge_mul8(r, p);
+}
+
+void secret_to_public(uint8_t pub[32], const uint8_t sec[32]) {
+  ge_p3 p;
+  ge_scalarmult_base(p, sec);
+  ge_tobytes(pub, p);
+}
+
+void derive_view_key(uint8_t view[32], const uint8_t spend[32]) {
+  keccak256(spend, 32, view);
+  sc_reduce32(view);
+}
+
+bool generate_key_derivation(uint8_t derivation[32], const uint8_t txPub[32], const uint8_t viewSec[32]) {
+  ge_p3 r, p;
+  if (!ge_frombytes_vartime(r, txPub)) return false;
+  ge_scalarmult(p, viewSec, r);
+  ge_mul8(p, p);
+  ge_tobytes(derivation, p);
+  return true;
+}
+
+void derivation_to_scalar(uint8_t out[32], const uint8_t derivation[32], uint32_t index) {
+  uint8_t buf[32 + 10];
+  memcpy(buf, derivation, 32);
+  size_t len = 32 + write_varint(buf + 32, index);
+  hash_to_scalar(buf, len, out);
+}
+
+void derive_secret_key(uint8_t out[32], const uint8_t derivation[32], uint32_t index, const uint8_t spendSec[32]) {
+  uint8_t s[32];
+  derivation_to_scalar(s, derivation, index);
+  sc_add(out, s, spendSec);
+  memwipe(s, sizeof(s));
+}
+
+bool derive_public_key(uint8_t out[32], const uint8_t derivation[32], uint32_t index, const uint8_t spendPub[32]) {
+  ge_p3 b, sG;
+  ge_cached bc;
+  uint8_t s[32];
+  if (!ge_frombytes_vartime(b, spendPub)) return false;
+  derivation_to_scalar(s, derivation, index);
+  ge_scalarmult_base(sG, s);
+  ge_to_cached(bc, b);
+  ge_add(sG, sG, bc);
+  ge_tobytes(out, sG);
+  return true;
+}
+
+void generate_key_image(uint8_t image[32], const uint8_t pub[32], const uint8_t sec[32]) {
+  ge_p3 hp, ki;
+  hash_to_ec(hp, pub);
+  ge_scalarmult(ki, sec, hp);
+  ge_tobytes(image, ki);
+}
+
+// c = Hs(hash || P || k*G), r = k - c*x
+void generate_signature(uint8_t sig[64], const uint8_t hash[32], const uint8_t pub[32], const uint8_t sec[32]) {
+  NonceStream ns;
+  uint8_t k[32], buf[96];
+  nonceBegin(ns, sec);
+  nonceAbsorb(ns, hash, 32);
+  nonceScalar(ns, k);
+  nonceEnd(ns);
+
+  ge_p3 kG;
+  ge_scalarmult_base(kG, k);
+  memcpy(buf, hash, 32);
+  memcpy(buf + 32, pub, 32);
+  ge_tobytes(buf + 64, kG);
+  hash_to_scalar(buf, sizeof(buf), sig);
+  sc_mulsub(sig + 32, sig, sec, k);
+  memwipe(k, sizeof(k));
+}
+
+static bool sc_canonical(const uint8_t s[32]) {
+  uint8_t t[32];
+  memcpy(t, s, 32);
+  sc_reduce32(t);
+  return memcmp(t, s, 32) == 0;
+}
+
+// Accept if c == Hs(hash || P || c*P + r*G)
+bool check_signature(const uint8_t sig[64], const uint8_t hash[32], const uint8_t pub[32]) {
+  ge_p3 p, cP, rG;
+  ge_cached rc;
+  if (!sc_canonical(sig) || !sc_canonical(sig + 32)) return false;
+  if (!ge_frombytes_vartime(p, pub)) return false;
+  ge_scalarmult(cP, sig, p);
+  ge_scalarmult_base(rG, sig + 32);
+  ge_to_cached(rc, rG);
+  ge_add(cP, cP, rc);
+
+  uint8_t buf[96], c[32];
+  memcpy(buf, hash, 32);
+  memcpy(buf + 32, pub, 32);
+  ge_tobytes(buf + 64, cP);
+  hash_to_scalar(buf, sizeof(buf), c);
+  return memcmp(c, sig, 32) == 0;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "ed25519.h"
+#include "keccak.h"
+
+// ==================== CRYPTONOTE KEY OPERATIONS ====================
+//
+// Monero/Salvium key derivation on top of the ed25519 primitives. Names follow
+// the reference implementation (crypto.cpp) so the call sites read the same.
+
+// Hs(data) = keccak(data) mod l
+void hash_to_scalar(const uint8_t* data, size_t len, uint8_t out[32]);
+
+// Hp(P) = 8 * ge_fromfe(keccak(P)), the point used for key images
+void hash_to_ec(ge_p3& r, const uint8_t pub[32]);
+
+// pub = sec * G
+void secret_to_public(uint8_t pub[32], const uint8_t sec[32]);
+
+// View key from spend key: sc_reduce32(keccak(spend))
+void derive_view_key(uint8_t view[32], const uint8_t spend[32]);
+
+// D = 8 * a * R. Returns false if R is not a valid point.
+bool generate_key_derivation(uint8_t derivation[32], const uint8_t txPub[32], const uint8_t viewSec[32]);
+
+// Hs(D || varint(index))
+void derivation_to_scalar(uint8_t out[32], const uint8_t derivation[32], uint32_t index);
+
+// x = Hs(D || index) + b
+void derive_secret_key(uint8_t out[32], const uint8_t derivation[32], uint32_t index, const uint8_t spendSec[32]);
+
+// P = Hs(D || index) * G + B
+bool derive_public_key(uint8_t out[32], const uint8_t derivation[32], uint32_t index, const uint8_t spendPub[32]);
+
+// I = x * Hp(P)
+void generate_key_image(uint8_t image[32], const uint8_t pub[32], const uint8_t sec[32]);
+
+// Schnorr signature (c, r) over a 32-byte hash, as generate_signature /
+// check_signature in the reference implementation. The nonce is derived
+// (random.h) from the secret and the hash, hedged with DRBG output.
+void generate_signature(uint8_t sig[64], const uint8_t hash[32], const uint8_t pub[32], const uint8_t sec[32]);
+bool check_signature(const uint8_t sig[64], const uint8_t hash[32], const uint8_t pub[32]);
+
+// CryptoNote varint (7 bits per byte, little endian). Returns bytes written.
+size_t write_varint(uint8_t* out, uint64_t value);
+
+// Best-effort wipe that the optimizer will not drop
+void memwipe(void* ptr, size_t len);
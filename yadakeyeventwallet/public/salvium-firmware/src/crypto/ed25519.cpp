@@ -0,0 +1,731 @@
+#include "ed25519.h"
+#include <string.h>
+
+// ==================== CONSTANTS ====================
+
+static const uint8_t D_BYTES[32] = {
+  0xa3, 0x78, 0x59, 0x13, 0xca, 0x4d, 0xeb, 0x75, 0xab, 0xd8, 0x41, 0x41, 0x4d, 0x0a, 0x70, 0x00,
+  0x98, 0xe8, 0x79, 0x77, 0x79, 0x40, 0xc7, 0x8c, 0x73, 0xfe, 0x6f, 0x2b, 0xee, 0x6c, 0x03, 0x52,
+};
+static const uint8_t D2_BYTES[32] = {
+  0x59, 0xf1, 0xb2, 0x26, 0x94, 0x9b, 0xd6, 0xeb, 0x56, 0xb1, 0x83, 0x82, 0x9a, 0x14, 0xe0, 0x00,
+  0x30, 0xd1, 0xf3, 0xee, 0xf2, 0x80, 0x8e, 0x19, 0xe7, 0xfc, 0xdf, 0x56, 0xdc, 0xd9, 0x06, 0x24,
+};
+static const uint8_t SQRTM1_BYTES[32] = {
+  0xb0, 0xa0, 0x0e, 0x4a, 0x27, 0x1b, 0xee, 0xc4, 0x78, 0xe4, 0x2f, 0xad, 0x06, 0x18, 0x43, 0x2f,
+  0xa7, 0xd7, 0xfb, 0x3d, 0x99, 0x00, 0x4d, 0x2b, 0x0b, 0xdf, 0xc1, 0x4f, 0x80, 0x24, 0x83, 0x2b,
+};
+// Compressed base point, y = 4/5
+static const uint8_t BASE_BYTES[32] = {
+  0x58, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+};
+// l - 1, used to negate scalars
+static const uint8_t SC_L_MINUS_1[32] = {
+  0xec, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+};
+static const uint8_t SC_ONE[32] = {1};
+static const uint8_t SC_ZERO[32] = {0};
+
+const uint8_t SC_INV_EIGHT[32] = {
+  0x79, 0x2f, 0xdc, 0xe2, 0x29, 0xe5, 0x06, 0x61, 0xd0, 0xda, 0x1c, 0x7d, 0xb3, 0x9d, 0xd3, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+};
+
+static fe feD;
+static fe feD2;
+static fe feSqrtM1;
+static ge_p3 baseP3;
+static ge_table baseTable;
+
+// ==================== FIELD ====================
+
+// Limb i holds 26 bits when i is even and 25 when odd, starting at bit pos[i]
+static const uint8_t limbPos[10] = {0, 26, 51, 77, 102, 128, 153, 179, 204, 230};
+
+static inline int limbBits(int i) {
+  return (i & 1) ? 25 : 26;
+}
+
+// Signed carry of wide limbs into a loosely reduced element
+static void fe_carry(fe h, int64_t t[10]) {
+  for (int i = 0; i < 10; i++) {
+    int bits = limbBits(i);
+    int64_t carry = (t[i] + ((int64_t)1 << (bits - 1))) >> bits;
+    t[i] -= carry * ((int64_t)1 << bits);
+    if (i < 9) {
+      t[i + 1] += carry;
+    } else {
+      t[0] += carry * 19;
+    }
+  }
+  int64_t carry = (t[0] + ((int64_t)1 << 25)) >> 26;
+  t[0] -= carry * ((int64_t)1 << 26);
+  t[1] += carry;
+
+  for (int i = 0; i < 10; i++) h[i] = (int32_t)t[i];
+}
+
+void fe_0(fe h) {
+  memset(h, 0, sizeof(fe));
+}
+
+void fe_1(fe h) {
+  fe_0(h);
+  h[0] = 1;
+}
+
+void fe_copy(fe h, const fe f) {
+  memcpy(h, f, sizeof(fe));
+}
+
+void fe_add(fe h, const fe f, const fe g) {
+  int64_t t[10];
+  for (int i = 0; i < 10; i++) t[i] = (int64_t)f[i] + g[i];
+  fe_carry(h, t);
+}
+
+void fe_sub(fe h, const fe f, const fe g) {
+  int64_t t[10];
+  for (int i = 0; i < 10; i++) t[i] = (int64_t)f[i] - g[i];
+  fe_carry(h, t);
+}
+
+void fe_neg(fe h, const fe f) {
+  for (int i = 0; i < 10; i++) h[i] = -f[i];
+}
+
+// Schoolbook product, unrolled. Odd limbs sit half a bit off the radix, so
+// odd x odd terms are doubled; terms past 2^255 fold back times 19. Inputs
+// must be carried (|limb| <= 2^26), which every function here guarantees.
+void fe_mul(fe h, const fe f, const fe g) {
+  int32_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+  int32_t f5 = f[5], f6 = f[6], f7 = f[7], f8 = f[8], f9 = f[9];
+  int32_t g0 = g[0], g1 = g[1], g2 = g[2], g3 = g[3], g4 = g[4];
+  int32_t g5 = g[5], g6 = g[6], g7 = g[7], g8 = g[8], g9 = g[9];
+  int32_t g1_19 = 19 * g1, g2_19 = 19 * g2, g3_19 = 19 * g3, g4_19 = 19 * g4, g5_19 = 19 * g5;
+  int32_t g6_19 = 19 * g6, g7_19 = 19 * g7, g8_19 = 19 * g8, g9_19 = 19 * g9;
+  int32_t f1_2 = 2 * f1, f3_2 = 2 * f3, f5_2 = 2 * f5, f7_2 = 2 * f7, f9_2 = 2 * f9;
+  int64_t t[10];
+  t[0] = (int64_t)f0 * g0 + (int64_t)f1_2 * g9_19 + (int64_t)f2 * g8_19 + (int64_t)f3_2 * g7_19
+       + (int64_t)f4 * g6_19 + (int64_t)f5_2 * g5_19 + (int64_t)f6 * g4_19
+       + (int64_t)f7_2 * g3_19 + (int64_t)f8 * g2_19 + (int64_t)f9_2 * g1_19;
+  t[1] = (int64_t)f0 * g1 + (int64_t)f1 * g0 + (int64_t)f2 * g9_19 + (int64_t)f3 * g8_19
+       + (int64_t)f4 * g7_19 + (int64_t)f5 * g6_19 + (int64_t)f6 * g5_19
+       + (int64_t)f7 * g4_19 + (int64_t)f8 * g3_19 + (int64_t)f9 * g2_19;
+  t[2] = (int64_t)f0 * g2 + (int64_t)f1_2 * g1 + (int64_t)f2 * g0 + (int64_t)f3_2 * g9_19
+       + (int64_t)f4 * g8_19 + (int64_t)f5_2 * g7_19 + (int64_t)f6 * g6_19
+       + (int64_t)f7_2 * g5_19 + (int64_t)f8 * g4_19 + (int64_t)f9_2 * g3_19;
+  t[3] = (int64_t)f0 * g3 + (int64_t)f1 * g2 + (int64_t)f2 * g1 + (int64_t)f3 * g0
+       + (int64_t)f4 * g9_19 + (int64_t)f5 * g8_19 + (int64_t)f6 * g7_19
+       + (int64_t)f7 * g6_19 + (int64_t)f8 * g5_19 + (int64_t)f9 * g4_19;
+  t[4] = (int64_t)f0 * g4 + (int64_t)f1_2 * g3 + (int64_t)f2 * g2 + (int64_t)f3_2 * g1
+       + (int64_t)f4 * g0 + (int64_t)f5_2 * g9_19 + (int64_t)f6 * g8_19
+       + (int64_t)f7_2 * g7_19 + (int64_t)f8 * g6_19 + (int64_t)f9_2 * g5_19;
+  t[5] = (int64_t)f0 * g5 + (int64_t)f1 * g4 + (int64_t)f2 * g3 + (int64_t)f3 * g2
+       + (int64_t)f4 * g1 + (int64_t)f5 * g0 + (int64_t)f6 * g9_19
+       + (int64_t)f7 * g8_19 + (int64_t)f8 * g7_19 + (int64_t)f9 * g6_19;
+  t[6] = (int64_t)f0 * g6 + (int64_t)f1_2 * g5 + (int64_t)f2 * g4 + (int64_t)f3_2 * g3
+       + (int64_t)f4 * g2 + (int64_t)f5_2 * g1 + (int64_t)f6 * g0
+       + (int64_t)f7_2 * g9_19 + (int64_t)f8 * g8_19 + (int64_t)f9_2 * g7_19;
+  t[7] = (int64_t)f0 * g7 + (int64_t)f1 * g6 + (int64_t)f2 * g5 + (int64_t)f3 * g4
+       + (int64_t)f4 * g3 + (int64_t)f5 * g2 + (int64_t)f6 * g1
+       + (int64_t)f7 * g0 + (int64_t)f8 * g9_19 + (int64_t)f9 * g8_19;
+  t[8] = (int64_t)f0 * g8 + (int64_t)f1_2 * g7 + (int64_t)f2 * g6 + (int64_t)f3_2 * g5
+       + (int64_t)f4 * g4 + (int64_t)f5_2 * g3 + (int64_t)f6 * g2
+       + (int64_t)f7_2 * g1 + (int64_t)f8 * g0 + (int64_t)f9_2 * g9_19;
+  t[9] = (int64_t)f0 * g9 + (int64_t)f1 * g8 + (int64_t)f2 * g7 + (int64_t)f3 * g6
+       + (int64_t)f4 * g5 + (int64_t)f5 * g4 + (int64_t)f6 * g3
+       + (int64_t)f7 * g2 + (int64_t)f8 * g1 + (int64_t)f9 * g0;
+  fe_carry(h, t);
+}
+
+// Same as fe_mul(h, f, f) with the symmetric terms merged
+void fe_sq(fe h, const fe f) {
+  int32_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+  int32_t f5 = f[5], f6 = f[6], f7 = f[7], f8 = f[8], f9 = f[9];
+  int32_t f0_2 = 2 * f0, f1_2 = 2 * f1, f2_2 = 2 * f2, f3_2 = 2 * f3, f4_2 = 2 * f4;
+  int32_t f5_2 = 2 * f5, f6_2 = 2 * f6, f7_2 = 2 * f7, f8_2 = 2 * f8;
+  int32_t f6_19 = 19 * f6, f7_19 = 19 * f7, f8_19 = 19 * f8, f9_19 = 19 * f9;
+  int32_t f5_38 = 38 * f5, f7_38 = 38 * f7, f9_38 = 38 * f9;
+  int64_t t[10];
+  t[0] = (int64_t)f0 * f0 + (int64_t)f1_2 * f9_38 + (int64_t)f2_2 * f8_19
+       + (int64_t)f3_2 * f7_38 + (int64_t)f4_2 * f6_19 + (int64_t)f5 * f5_38;
+  t[1] = (int64_t)f0_2 * f1 + (int64_t)f2_2 * f9_19 + (int64_t)f3_2 * f8_19
+       + (int64_t)f4_2 * f7_19 + (int64_t)f5_2 * f6_19;
+  t[2] = (int64_t)f0_2 * f2 + (int64_t)f1_2 * f1 + (int64_t)f3_2 * f9_38
+       + (int64_t)f4_2 * f8_19 + (int64_t)f5_2 * f7_38 + (int64_t)f6 * f6_19;
+  t[3] = (int64_t)f0_2 * f3 + (int64_t)f1_2 * f2 + (int64_t)f4_2 * f9_19
+       + (int64_t)f5_2 * f8_19 + (int64_t)f6_2 * f7_19;
+  t[4] = (int64_t)f0_2 * f4 + (int64_t)f1_2 * f3_2 + (int64_t)f2 * f2
+       + (int64_t)f5_2 * f9_38 + (int64_t)f6_2 * f8_19 + (int64_t)f7 * f7_38;
+  t[5] = (int64_t)f0_2 * f5 + (int64_t)f1_2 * f4 + (int64_t)f2_2 * f3
+       + (int64_t)f6_2 * f9_19 + (int64_t)f7_2 * f8_19;
+  t[6] = (int64_t)f0_2 * f6 + (int64_t)f1_2 * f5_2 + (int64_t)f2_2 * f4
+       + (int64_t)f3_2 * f3 + (int64_t)f7_2 * f9_38 + (int64_t)f8 * f8_19;
+  t[7] = (int64_t)f0_2 * f7 + (int64_t)f1_2 * f6 + (int64_t)f2_2 * f5
+       + (int64_t)f3_2 * f4 + (int64_t)f8_2 * f9_19;
+  t[8] = (int64_t)f0_2 * f8 + (int64_t)f1_2 * f7_2 + (int64_t)f2_2 * f6
+       + (int64_t)f3_2 * f5_2 + (int64_t)f4 * f4 + (int64_t)f9 * f9_38;
+  t[9] = (int64_t)f0_2 * f9 + (int64_t)f1_2 * f8 + (int64_t)f2_2 * f7
+       + (int64_t)f3_2 * f6 + (int64_t)f4_2 * f5;
+  fe_carry(h, t);
+}
+
+static void fe_sqn(fe h, const fe f, int n) {
+  fe_sq(h, f);
+  for (int i = 1; i < n; i++) fe_sq(h, h);
+}
+
+// z^(2^250 - 1), shared prefix of the inversion and square root chains.
+// Also returns z^11 for the inversion tail.
+static void fe_pow2_250_1(fe out, fe z11, const fe z) {
+  fe z2, z9, t, z2_5_0, z2_10_0, z2_20_0, z2_50_0, z2_100_0;
+
+  fe_sq(z2, z);              // 2
+  fe_sqn(t, z2, 2);          // 8
+  fe_mul(z9, t, z);          // 9
+  fe_mul(z11, z9, z2);       // 11
+  fe_sq(t, z11);             // 22
+  fe_mul(z2_5_0, t, z9);     // 2^5 - 1
+  fe_sqn(t, z2_5_0, 5);
+  fe_mul(z2_10_0, t, z2_5_0);
+  fe_sqn(t, z2_10_0, 10);
+  fe_mul(z2_20_0, t, z2_10_0);
+  fe_sqn(t, z2_20_0, 20);
+  fe_mul(t, t, z2_20_0);     // 2^40 - 1
+  fe_sqn(t, t, 10);
+  fe_mul(z2_50_0, t, z2_10_0);
+  fe_sqn(t, z2_50_0, 50);
+  fe_mul(z2_100_0, t, z2_50_0);
+  fe_sqn(t, z2_100_0, 100);
+  fe_mul(t, t, z2_100_0);    // 2^200 - 1
+  fe_sqn(t, t, 50);
+  fe_mul(out, t, z2_50_0);   // 2^250 - 1
+}
+
+// z^(p - 2) = z^(2^255 - 21)
+void fe_invert(fe out, const fe z) {
+  fe t, z11;
+  fe_pow2_250_1(t, z11, z);
+  fe_sqn(t, t, 5);
+  fe_mul(out, t, z11);
+}
+
+// z^((p - 5) / 8) = z^(2^252 - 3)
+void fe_pow22523(fe out, const fe z) {
+  fe t, z11;
+  fe_pow2_250_1(t, z11, z);
+  fe_sqn(t, t, 2);
+  fe_mul(out, t, z);
+}
+
+void fe_cmov(fe f, const fe g, unsigned int b) {
+  int32_t mask = -(int32_t)b;
+  for (int i = 0; i < 10; i++) f[i] ^= (f[i] ^ g[i]) & mask;
+}
+
+static void fe_load(fe h, const uint8_t s[32], bool useTopBit) {
+  int64_t t[10];
+  for (int i = 0; i < 10; i++) {
+    int pos = limbPos[i];
+    uint64_t v = 0;
+    for (int b = 0; b < 5 && (pos >> 3) + b < 32; b++) {
+      v |= (uint64_t)s[(pos >> 3) + b] << (8 * b);
+    }
+    t[i] = (int64_t)((v >> (pos & 7)) & ((1u << limbBits(i)) - 1));
+  }
+  if (useTopBit && (s[31] & 0x80)) t[0] += 19;
+  fe_carry(h, t);
+}
+
+void fe_frombytes(fe h, const uint8_t s[32]) {
+  fe_load(h, s, false);
+}
+
+void fe_frombytes_full(fe h, const uint8_t s[32]) {
+  fe_load(h, s, true);
+}
+
+void fe_tobytes(uint8_t s[32], const fe f) {
+  int64_t h[10];
+  for (int i = 0; i < 10; i++) h[i] = f[i];
+
+  // q = floor(h / p), either 0 or 1 for a loosely reduced input
+  int64_t q = (19 * h[9] + ((int64_t)1 << 24)) >> 25;
+  for (int i = 0; i < 10; i++) q = (h[i] + q) >> limbBits(i);
+  h[0] += 19 * q;
+
+  for (int i = 0; i < 9; i++) {
+    int64_t carry = h[i] >> limbBits(i);
+    h[i + 1] += carry;
+    h[i] -= carry * ((int64_t)1 << limbBits(i));
+  }
+  h[9] &= (1 << 25) - 1;
+
+  memset(s, 0, 32);
+  for (int i = 0; i < 10; i++) {
+    int pos = limbPos[i];
+    uint64_t v = (uint64_t)h[i] << (pos & 7);
+    for (int b = 0; b < 5 && (pos >> 3) + b < 32; b++) {
+      s[(pos >> 3) + b] |= (uint8_t)(v >> (8 * b));
+    }
+  }
+}
+
+int fe_isnegative(const fe f) {
+  uint8_t s[32];
+  fe_tobytes(s, f);
+  return s[0] & 1;
+}
+
+int fe_isnonzero(const fe f) {
+  uint8_t s[32];
+  fe_tobytes(s, f);
+  uint8_t acc = 0;
+  for (int i = 0; i < 32; i++) acc |= s[i];
+  return acc != 0;
+}
+
+void fe_batch_invert(fe* out, const fe* in, fe* scratch, size_t count) {
+  if (count == 0) return;
+
+  // scratch[i] = in[0] * ... * in[i]
+  fe_copy(scratch[0], in[0]);
+  for (size_t i = 1; i < count; i++) fe_mul(scratch[i], scratch[i - 1], in[i]);
+
+  fe acc;
+  fe_invert(acc, scratch[count - 1]);
+  for (size_t i = count - 1; i > 0; i--) {
+    fe t;
+    fe_mul(t, acc, scratch[i - 1]);   // 1 / in[i]
+    fe_mul(acc, acc, in[i]);          // 1 / (in[0] * ... * in[i-1])
+    fe_copy(out[i], t);
+  }
+  fe_copy(out[0], acc);
+}
+
+// ==================== GROUP ====================
+
+void ge_identity(ge_p3& r) {
+  fe_0(r.X);
+  fe_1(r.Y);
+  fe_1(r.Z);
+  fe_0(r.T);
+}
+
+void ge_to_cached(ge_cached& r, const ge_p3& p) {
+  fe_add(r.YplusX, p.Y, p.X);
+  fe_sub(r.YminusX, p.Y, p.X);
+  fe_copy(r.Z, p.Z);
+  fe_mul(r.T2d, p.T, feD2);
+}
+
+// add-2008-hwcd-3, complete for ed25519
+void ge_add(ge_p3& r, const ge_p3& p, const ge_cached& q) {
+  fe a, b, c, d, e, f, g, h;
+  fe_sub(a, p.Y, p.X);
+  fe_mul(a, a, q.YminusX);
+  fe_add(b, p.Y, p.X);
+  fe_mul(b, b, q.YplusX);
+  fe_mul(c, p.T, q.T2d);
+  fe_mul(d, p.Z, q.Z);
+  fe_add(d, d, d);
+  fe_sub(e, b, a);
+  fe_sub(f, d, c);
+  fe_add(g, d, c);
+  fe_add(h, b, a);
+  fe_mul(r.X, e, f);
+  fe_mul(r.Y, g, h);
+  fe_mul(r.Z, f, g);
+  fe_mul(r.T, e, h);
+}
+
+void ge_sub(ge_p3& r, const ge_p3& p, const ge_cached& q) {
+  fe a, b, c, d, e, f, g, h;
+  fe_sub(a, p.Y, p.X);
+  fe_mul(a, a, q.YplusX);
+  fe_add(b, p.Y, p.X);
+  fe_mul(b, b, q.YminusX);
+  fe_mul(c, p.T, q.T2d);
+  fe_mul(d, p.Z, q.Z);
+  fe_add(d, d, d);
+  fe_sub(e, b, a);
+  fe_add(f, d, c);
+  fe_sub(g, d, c);
+  fe_add(h, b, a);
+  fe_mul(r.X, e, f);
+  fe_mul(r.Y, g, h);
+  fe_mul(r.Z, f, g);
+  fe_mul(r.T, e, h);
+}
+
+// dbl-2008-hwcd with a = -1
+void ge_dbl(ge_p3& r, const ge_p3& p) {
+  fe a, b, c, e, f, g, h;
+  fe_sq(a, p.X);
+  fe_sq(b, p.Y);
+  fe_sq(c, p.Z);
+  fe_add(c, c, c);
+  fe_add(e, p.X, p.Y);
+  fe_sq(e, e);
+  fe_sub(e, e, a);
+  fe_sub(e, e, b);   // 2XY
+  fe_sub(g, b, a);   // -A + B
+  fe_sub(f, g, c);
+  fe_add(h, a, b);
+  fe_neg(h, h);      // -A - B
+  fe_mul(r.X, e, f);
+  fe_mul(r.Y, g, h);
+  fe_mul(r.Z, f, g);
+  fe_mul(r.T, e, h);
+}
+
+void ge_mul8(ge_p3& r, const ge_p3& p) {
+  ge_dbl(r, p);
+  ge_dbl(r, r);
+  ge_dbl(r, r);
+}
+
+static bool fe_equal(const fe f, const fe g) {
+  fe d;
+  fe_sub(d, f, g);
+  return !fe_isnonzero(d);
+}
+
+bool ge_frombytes_vartime(ge_p3& r, const uint8_t s[32]) {
+  fe u, v, v3, vxx, check;
+
+  fe_frombytes(r.Y, s);
+  fe_1(r.Z);
+  fe_sq(u, r.Y);
+  fe_mul(v, u, feD);
+  fe_sub(u, u, r.Z);   // y^2 - 1
+  fe_add(v, v, r.Z);   // d*y^2 + 1
+
+  // x = u * v^3 * (u * v^7)^((p - 5) / 8)
+  fe_sq(v3, v);
+  fe_mul(v3, v3, v);
+  fe_sq(r.X, v3);
+  fe_mul(r.X, r.X, v);
+  fe_mul(r.X, r.X, u);
+  fe_pow22523(r.X, r.X);
+  fe_mul(r.X, r.X, v3);
+  fe_mul(r.X, r.X, u);
+
+  fe_sq(vxx, r.X);
+  fe_mul(vxx, vxx, v);
+  if (!fe_equal(vxx, u)) {
+    fe_add(check, vxx, u);
+    if (fe_isnonzero(check)) return false;
+    fe_mul(r.X, r.X, feSqrtM1);
+  }
+
+  int sign = s[31] >> 7;
+  if (fe_isnegative(r.X) != sign) {
+    if (!fe_isnonzero(r.X)) return false;
+    fe_neg(r.X, r.X);
+  }
+
+  fe_mul(r.T, r.X, r.Y);
+  return true;
+}
+
+void ge_tobytes(uint8_t s[32], const ge_p3& p) {
+  fe zinv, x, y;
+  fe_invert(zinv, p.Z);
+  fe_mul(x, p.X, zinv);
+  fe_mul(y, p.Y, zinv);
+  fe_tobytes(s, y);
+  s[31] ^= fe_isnegative(x) << 7;
+}
+
+// Encode many points with one field inversion
+void ge_tobytes_batch(uint8_t (*s)[32], const ge_p3* p, fe* zinv, fe* scratch, size_t count) {
+  for (size_t i = 0; i < count; i++) fe_copy(zinv[i], p[i].Z);
+  fe_batch_invert(zinv, zinv, scratch, count);
+  for (size_t i = 0; i < count; i++) {
+    fe x, y;
+    fe_mul(x, p[i].X, zinv[i]);
+    fe_mul(y, p[i].Y, zinv[i]);
+    fe_tobytes(s[i], y);
+    s[i][31] ^= fe_isnegative(x) << 7;
+  }
+}
+
+const ge_p3& ge_base() {
+  return baseP3;
+}
+
+void ge_table_build(ge_table& table, const ge_p3& p) {
+  ge_p3 acc;
+  ge_identity(acc);
+  ge_to_cached(table.entry[0], acc);
+  ge_to_cached(table.entry[1], p);
+  acc = p;
+  for (int i = 2; i < 16; i++) {
+    ge_add(acc, acc, table.entry[1]);
+    ge_to_cached(table.entry[i], acc);
+  }
+}
+
+static void cached_cmov(ge_cached& t, const ge_cached& u, unsigned int b) {
+  fe_cmov(t.YplusX, u.YplusX, b);
+  fe_cmov(t.YminusX, u.YminusX, b);
+  fe_cmov(t.Z, u.Z, b);
+  fe_cmov(t.T2d, u.T2d, b);
+}
+
+// 4-bit fixed window, most significant nibble first. Every entry of the
+// table is touched for every window so the access pattern is secret independent.
+void ge_scalarmult_table(ge_p3& r, const uint8_t a[32], const ge_table& table) {
+  ge_identity(r);
+  for (int i = 63; i >= 0; i--) {
+    unsigned int nibble = (a[i >> 1] >> (4 * (i & 1))) & 15;
+    if (i != 63) {
+      ge_dbl(r, r);
+      ge_dbl(r, r);
+      ge_dbl(r, r);
+      ge_dbl(r, r);
+    }
+    ge_cached t = table.entry[0];
+    for (unsigned int k = 1; k < 16; k++) {
+      cached_cmov(t, table.entry[k], ((nibble ^ k) - 1) >> 31);
+    }
+    ge_add(r, r, t);
+  }
+}
+
+void ge_scalarmult(ge_p3& r, const uint8_t a[32], const ge_p3& p) {
+  ge_table table;
+  ge_table_build(table, p);
+  ge_scalarmult_table(r, a, table);
+}
+
+void ge_scalarmult_base(ge_p3& r, const uint8_t a[32]) {
+  ge_scalarmult_table(r, a, baseTable);
+}
+
+// Digits in -8..8 with a = sum(e[i] * 16^i). a must be reduced (top bit clear).
+void sc_recode_signed(int8_t e[64], const uint8_t a[32]) {
+  for (int i = 0; i < 32; i++) {
+    e[2 * i] = a[i] & 15;
+    e[2 * i + 1] = (a[i] >> 4) & 15;
+  }
+  int8_t carry = 0;
+  for (int i = 0; i < 63; i++) {
+    e[i] += carry;
+    carry = (e[i] + 8) >> 4;
+    e[i] -= carry << 4;
+  }
+  e[63] += carry;
+}
+
+// Constant-time pick of digit * P from the 1P..8P table
+static void signed_select(ge_cached& t, const ge_cached table[8], int8_t digit) {
+  unsigned int negative = (uint8_t)digit >> 7;
+  unsigned int absolute = (unsigned int)(digit - ((-(int)negative & digit) << 1));
+
+  fe_1(t.YplusX);
+  fe_1(t.YminusX);
+  fe_1(t.Z);
+  fe_0(t.T2d);
+  for (unsigned int k = 0; k < 8; k++) {
+    cached_cmov(t, table[k], ((absolute ^ (k + 1)) - 1) >> 31);
+  }
+
+  // -P swaps Y+X with Y-X and negates T
+  ge_cached minus;
+  fe_copy(minus.YplusX, t.YminusX);
+  fe_copy(minus.YminusX, t.YplusX);
+  fe_copy(minus.Z, t.Z);
+  fe_neg(minus.T2d, t.T2d);
+  cached_cmov(t, minus, negative);
+}
+
+// Half-size table (1P..8P) and the point-independent recoding done once by
+// the caller; for one secret scalar applied to many points.
+void ge_scalarmult_signed(ge_p3& r, const int8_t e[64], const ge_p3& p) {
+  ge_cached table[8];
+  ge_p3 acc = p;
+  ge_to_cached(table[0], p);
+  for (int k = 1; k < 8; k++) {
+    ge_add(acc, acc, table[0]);
+    ge_to_cached(table[k], acc);
+  }
+
+  ge_identity(r);
+  for (int i = 63; i >= 0; i--) {
+    if (i != 63) {
+      ge_dbl(r, r);
+      ge_dbl(r, r);
+      ge_dbl(r, r);
+      ge_dbl(r, r);
+    }
+    ge_cached t;
+    signed_select(t, table, e[i]);
+    ge_add(r, r, t);
+  }
+}
+
+const ge_table& ge_base_table() {
+  return baseTable;
+}
+
+// Straus: one shared chain of doublings, one table lookup per scalar per
+// window. Branches on the nibbles, so public scalars only.
+void ge_multiscalarmult_vartime(ge_p3& r, const uint8_t* const* scalars, const ge_table* const* tables, int count) {
+  ge_identity(r);
+  for (int i = 63; i >= 0; i--) {
+    if (i != 63) {
+      ge_dbl(r, r);
+      ge_dbl(r, r);
+      ge_dbl(r, r);
+      ge_dbl(r, r);
+    }
+    for (int k = 0; k < count; k++) {
+      unsigned int nibble = (scalars[k][i >> 1] >> (4 * (i & 1))) & 15;
+      if (nibble) ge_add(r, r, tables[k]->entry[nibble]);
+    }
+  }
+}
+
+void ed25519_init() {
+  fe_frombytes(feD, D_BYTES);
+  fe_frombytes(feD2, D2_BYTES);
+  fe_frombytes(feSqrtM1, SQRTM1_BYTES);
+  ge_frombytes_vartime(baseP3, BASE_BYTES);
+  ge_table_build(baseTable, baseP3);
+}
+
+// ==================== SCALARS ====================
+//
+// Scalars are handled as 21-bit signed limbs. l = 2^252 + c, so a limb at
+// 2^(21*k), k >= 12, folds down as -c * 2^(21*(k-12)); -c in 21-bit limbs is
+// below.
+
+static const int64_t minusC[6] = {666643, 470296, 654183, -997805, 136657, -683901};
+
+static void sc_load(int64_t out[12], const uint8_t s[32]) {
+  for (int i = 0; i < 12; i++) {
+    int pos = 21 * i;
+    uint64_t v = 0;
+    for (int b = 0; b < 4 && (pos >> 3) + b < 32; b++) {
+      v |= (uint64_t)s[(pos >> 3) + b] << (8 * b);
+    }
+    // The top limb keeps every remaining bit (up to 25)
+    uint64_t mask = (i == 11) ? 0x1FFFFFF : 0x1FFFFF;
+    out[i] = (int64_t)((v >> (pos & 7)) & mask);
+  }
+}
+
+static inline void sc_fold(int64_t t[24], int k) {
+  for (int j = 0; j < 6; j++) t[k - 12 + j] += t[k] * minusC[j];
+  t[k] = 0;
+}
+
+static inline void sc_carry_centered(int64_t t[24], int i) {
+  int64_t carry = (t[i] + (1 << 20)) >> 21;
+  t[i + 1] += carry;
+  t[i] -= carry * (1 << 21);
+}
+
+static inline void sc_carry_floor(int64_t t[24], int i) {
+  int64_t carry = t[i] >> 21;
+  t[i + 1] += carry;
+  t[i] -= carry * (1 << 21);
+}
+
+// Reduce 24 carried limbs mod l and pack into 32 bytes
+static void sc_reduce_limbs(uint8_t out[32], int64_t t[24]) {
+  for (int k = 23; k >= 18; k--) sc_fold(t, k);
+  for (int i = 6; i <= 16; i++) sc_carry_centered(t, i);
+  for (int k = 17; k >= 12; k--) sc_fold(t, k);
+  for (int i = 0; i <= 11; i++) sc_carry_centered(t, i);
+  sc_fold(t, 12);
+  for (int i = 0; i <= 11; i++) sc_carry_floor(t, i);
+  sc_fold(t, 12);
+  for (int i = 0; i <= 10; i++) sc_carry_floor(t, i);
+
+  memset(out, 0, 32);
+  for (int i = 0; i < 12; i++) {
+    int pos = 21 * i;
+    uint64_t v = (uint64_t)t[i] << (pos & 7);
+    for (int b = 0; b < 4 && (pos >> 3) + b < 32; b++) {
+      out[(pos >> 3) + b] |= (uint8_t)(v >> (8 * b));
+    }
+  }
+}
+
+void sc_reduce64(uint8_t out[32], const uint8_t s[64]) {
+  int64_t t[24];
+  for (int i = 0; i < 24; i++) {
+    int pos = 21 * i;
+    uint64_t v = 0;
+    for (int b = 0; b < 5 && (pos >> 3) + b < 64; b++) {
+      v |= (uint64_t)s[(pos >> 3) + b] << (8 * b);
+    }
+    uint64_t mask = (i == 23) ? 0x1FFFFFFF : 0x1FFFFF;
+    t[i] = (int64_t)((v >> (pos & 7)) & mask);
+  }
+  sc_reduce_limbs(out, t);
+}
+
+void sc_reduce32(uint8_t s[32]) {
+  uint8_t wide[64] = {0};
+  memcpy(wide, s, 32);
+  sc_reduce64(s, wide);
+}
+
+void sc_muladd(uint8_t s[32], const uint8_t a[32], const uint8_t b[32], const uint8_t c[32]) {
+  int64_t al[12], bl[12], cl[12];
+  sc_load(al, a);
+  sc_load(bl, b);
+  sc_load(cl, c);
+
+  int64_t t[24] = {0};
+  for (int i = 0; i < 12; i++) {
+    for (int j = 0; j < 12; j++) t[i + j] += al[i] * bl[j];
+    t[i] += cl[i];
+  }
+  for (int i = 0; i < 23; i++) sc_carry_centered(t, i);
+  sc_reduce_limbs(s, t);
+}
+
+void sc_mulsub(uint8_t s[32], const uint8_t a[32], const uint8_t b[32], const uint8_t c[32]) {
+  uint8_t negB[32];
+  sc_muladd(negB, b, SC_L_MINUS_1, SC_ZERO);
+  sc_muladd(s, a, negB, c);
+}
+
+void sc_mul(uint8_t s[32], const uint8_t a[32], const uint8_t b[32]) {
+  sc_muladd(s, a, b, SC_ZERO);
+}
+
+void sc_add(uint8_t s[32], const uint8_t a[32], const uint8_t b[32]) {
+  sc_muladd(s, a, SC_ONE, b);
+}
+
+void sc_sub(uint8_t s[32], const uint8_t a[32], const uint8_t b[32]) {
+  sc_muladd(s, b, SC_L_MINUS_1, a);
+}
+
+bool sc_check(const uint8_t s[32]) {
+  // Compare against l from the most significant byte down
+  static const uint8_t L[32] = {
+    0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  };
+  for (int i = 31; i >= 0; i--) {
+    if (s[i] < L[i]) return true;
+    if (s[i] > L[i]) return false;
+  }
+  return false;
+}
+
+bool sc_iszero(const uint8_t s[32]) {
+  uint8_t acc = 0;
+  for (int i = 0; i < 32; i++) acc |= s[i];
+  return acc == 0;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==================== ED25519 PRIMITIVES ====================
+//
+// Portable field, group and scalar arithmetic for CryptoNote (ref10 layout:
+// radix 2^25.5 field elements, extended twisted Edwards points, scalars mod l).
+// Only 32x32->64 multiplies are used, so the same code runs on the ESP32 and
+// under the native build. Functions taking secret scalars are constant time;
+// *_vartime functions and point decompression only ever see public data.
+
+typedef int32_t fe[10];
+
+// Extended coordinates: x = X/Z, y = Y/Z, x*y = T/Z
+struct ge_p3 {
+  fe X, Y, Z, T;
+};
+
+// Addition-ready form of a point
+struct ge_cached {
+  fe YplusX, YminusX, Z, T2d;
+};
+
+// Window table for 4-bit fixed-window scalar multiplication: 0*P .. 15*P
+struct ge_table {
+  ge_cached entry[16];
+};
+
+// Build the constant tables (base point, curve constants). Call once at boot
+// before any other function here, and before starting worker tasks.
+void ed25519_init();
+
+// ---- Field ----
+void fe_0(fe h);
+void fe_1(fe h);
+void fe_copy(fe h, const fe f);
+void fe_add(fe h, const fe f, const fe g);
+void fe_sub(fe h, const fe f, const fe g);
+void fe_neg(fe h, const fe f);
+void fe_mul(fe h, const fe f, const fe g);
+void fe_sq(fe h, const fe f);
+void fe_invert(fe out, const fe z);
+void fe_pow22523(fe out, const fe z);
+void fe_cmov(fe f, const fe g, unsigned int b);
+void fe_frombytes(fe h, const uint8_t s[32]);        // Ignores bit 255
+void fe_frombytes_full(fe h, const uint8_t s[32]);   // Uses all 256 bits, mod p
+void fe_tobytes(uint8_t s[32], const fe h);
+int fe_isnegative(const fe f);
+int fe_isnonzero(const fe f);
+
+// Invert many elements with a single field inversion (Montgomery's trick).
+// scratch must hold count elements; out may alias in. Zero inputs are not allowed.
+void fe_batch_invert(fe* out, const fe* in, fe* scratch, size_t count);
+
+// ---- Group ----
+void ge_identity(ge_p3& r);
+void ge_to_cached(ge_cached& r, const ge_p3& p);
+void ge_add(ge_p3& r, const ge_p3& p, const ge_cached& q);
+void ge_sub(ge_p3& r, const ge_p3& p, const ge_cached& q);
+void ge_dbl(ge_p3& r, const ge_p3& p);
+void ge_mul8(ge_p3& r, const ge_p3& p);
+bool ge_frombytes_vartime(ge_p3& r, const uint8_t s[32]);
+void ge_tobytes(uint8_t s[32], const ge_p3& p);
+// zinv and scratch must hold count elements
+void ge_tobytes_batch(uint8_t (*s)[32], const ge_p3* p, fe* zinv, fe* scratch, size_t count);
+const ge_p3& ge_base();
+
+void ge_table_build(ge_table& table, const ge_p3& p);
+void ge_scalarmult_table(ge_p3& r, const uint8_t a[32], const ge_table& table);
+void ge_scalarmult(ge_p3& r, const uint8_t a[32], const ge_p3& p);
+void ge_scalarmult_base(ge_p3& r, const uint8_t a[32]);
+const ge_table& ge_base_table();
+
+// Fixed scalar, many points: recode once, then multiply each point (constant time)
+void sc_recode_signed(int8_t e[64], const uint8_t a[32]);
+void ge_scalarmult_signed(ge_p3& r, const int8_t e[64], const ge_p3& p);
+
+// r = sum(scalars[k] * P_k) for public scalars, sharing the doublings
+void ge_multiscalarmult_vartime(ge_p3& r, const uint8_t* const* scalars, const ge_table* const* tables, int count);
+
+// ---- Scalars mod l ----
+void sc_reduce32(uint8_t s[32]);                       // In place
+void sc_reduce64(uint8_t out[32], const uint8_t s[64]);
+void sc_muladd(uint8_t s[32], const uint8_t a[32], const uint8_t b[32], const uint8_t c[32]);  // a*b + c
+void sc_mulsub(uint8_t s[32], const uint8_t a[32], const uint8_t b[32], const uint8_t c[32]);  // c - a*b
+void sc_mul(uint8_t s[32], const uint8_t a[32], const uint8_t b[32]);
+void sc_add(uint8_t s[32], const uint8_t a[32], const uint8_t b[32]);
+void sc_sub(uint8_t s[32], const uint8_t a[32], const uint8_t b[32]);
+bool sc_check(const uint8_t s[32]);   // Canonical (< l)
+bool sc_iszero(const uint8_t s[32]);
+
+extern const uint8_t SC_INV_EIGHT[32];
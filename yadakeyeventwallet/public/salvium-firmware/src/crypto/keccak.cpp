@@ -0,0 +1,100 @@
+#include "keccak.h"
+#include <string.h>
+
+#define KECCAK_RATE 136  // 1088-bit rate for a 256-bit digest
+
+static const uint64_t roundConstants[24] = {
+  0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+  0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+  0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+  0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+  0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+  0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+  0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+  0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL,
+};
+
+static const uint8_t rotations[24] = {
+  1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14,
+  27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44,
+};
+
+static const uint8_t piLanes[24] = {
+  10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4,
+  15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1,
+};
+
+static inline uint64_t rotl64(uint64_t x, int n) {
+  return (x << n) | (x >> (64 - n));
+}
+
+static void keccakf(uint64_t a[25]) {
+  uint64_t bc[5];
+  for (int round = 0; round < 24; round++) {
+    // Theta
+    for (int i = 0; i < 5; i++) {
+      bc[i] = a[i] ^ a[i + 5] ^ a[i + 10] ^ a[i + 15] ^ a[i + 20];
+    }
+    for (int i = 0; i < 5; i++) {
+      uint64_t t = bc[(i + 4) % 5] ^ rotl64(bc[(i + 1) % 5], 1);
+      for (int j = 0; j < 25; j += 5) a[j + i] ^= t;
+    }
+
+    // Rho and pi
+    uint64_t t = a[1];
+    for (int i = 0; i < 24; i++) {
+      int j = piLanes[i];
+      uint64_t tmp = a[j];
+      a[j] = rotl64(t, rotations[i]);
+      t = tmp;
+    }
+
+    // Chi
+    for (int j = 0; j < 25; j += 5) {
+      for (int i = 0; i < 5; i++) bc[i] = a[j + i];
+      for (int i = 0; i < 5; i++) {
+        a[j + i] ^= (~bc[(i + 1) % 5]) & bc[(i + 2) % 5];
+      }
+    }
+
+    // Iota
+    a[0] ^= roundConstants[round];
+  }
+}
+
+// Lanes are little-endian regardless of host byte order
+static inline void xorByte(uint64_t a[25], int pos, uint8_t b) {
+  a[pos >> 3] ^= (uint64_t)b << (8 * (pos & 7));
+}
+
+void keccak_init(KeccakState& st) {
+  memset(st.a, 0, sizeof(st.a));
+  st.pos = 0;
+}
+
+void keccak_update(KeccakState& st, const uint8_t* data, size_t len) {
+  while (len--) {
+    xorByte(st.a, st.pos++, *data++);
+    if (st.pos == KECCAK_RATE) {
+      keccakf(st.a);
+      st.pos = 0;
+    }
+  }
+}
+
+void keccak_final(KeccakState& st, uint8_t out[32]) {
+  xorByte(st.a, st.pos, 0x01);
+  xorByte(st.a, KECCAK_RATE - 1, 0x80);
+  keccakf(st.a);
+  for (int i = 0; i < 32; i++) {
+    out[i] = (uint8_t)(st.a[i >> 3] >> (8 * (i & 7)));
+  }
+  memset(st.a, 0, sizeof(st.a));
+}
+
+void keccak256(const uint8_t* data, size_t len, uint8_t out[32]) {
+  KeccakState st;
+  keccak_init(st);
+  keccak_update(st, data, len);
+  keccak_final(st, out);
+}
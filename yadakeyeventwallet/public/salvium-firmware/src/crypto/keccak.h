@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Keccak-256 with the original (pre-SHA3) 0x01 padding, as used by CryptoNote
+// for cn_fast_hash, Hs() and address checksums.
+
+struct KeccakState {
+  uint64_t a[25];
+  uint8_t pos;  // Bytes absorbed into the current block
+};
+
+void keccak_init(KeccakState& st);
+void keccak_update(KeccakState& st, const uint8_t* data, size_t len);
+void keccak_final(KeccakState& st, uint8_t out[32]);
+
+// One-shot cn_fast_hash
+void keccak256(const uint8_t* data, size_t len, uint8_t out[32]);
@@ -0,0 +1,243 @@
+#include "random.h"
+#include "cryptonote.h"
+#include <string.h>
+
+#ifdef ARDUINO
+#include <esp_system.h>
+#else
+#include <stdio.h>
+#include <stdlib.h>
+#endif
+
+// SP 800-90B cutoffs for H = 4 bits per byte, alpha = 2^-20
+#define HEALTH_RCT_CUTOFF    6    // 1 + ceil(20 / H)
+#define HEALTH_APT_WINDOW    512
+#define HEALTH_APT_CUTOFF    62
+
+static const char RESEED_DOMAIN[] = "drbg-reseed-v1";
+static const char NONCE_DOMAIN[] = "nonce-v1";
+
+static RandomSource source = nullptr;
+static uint8_t key[32];
+static uint8_t pool[RANDOM_POOL_BYTES];
+static size_t poolUsed = RANDOM_POOL_BYTES;  // Empty until the first refill
+static uint32_t sinceReseed = 0;
+static uint32_t reseeds = 0;
+static uint32_t generated = 0;
+static uint8_t lastSample[32];
+static bool seeded = false;
+static bool healthy = false;
+
+static void platformSource(void* buf, size_t len) {
+#ifdef ARDUINO
+  esp_fill_random(buf, len);
+#else
+  static FILE* urandom = nullptr;
+  if (!urandom) urandom = fopen("/dev/urandom", "rb");
+  if (!urandom || fread(buf, 1, len, urandom) != len) {
+    fprintf(stderr, "[RNG] /dev/urandom unavailable\n");
+    abort();
+  }
+#endif
+}
+
+// ---- ChaCha20 (RFC 8439 block function, zero nonce) ----
+
+static inline uint32_t rotl(uint32_t v, int n) {
+  return (v << n) | (v >> (32 - n));
+}
+
+#define QUARTER(a, b, c, d)                   \
+  a += b; d ^= a; d = rotl(d, 16);            \
+  c += d; b ^= c; b = rotl(b, 12);            \
+  a += b; d ^= a; d = rotl(d, 8);             \
+  c += d; b ^= c; b = rotl(b, 7);
+
+static uint32_t load32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void store32(uint8_t* p, uint32_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+}
+
+// Blocks 0..blocks-1 of the keystream
+static void chachaStream(uint8_t* out, uint32_t blocks, const uint8_t k[32]) {
+  uint32_t in[16], x[16];
+  in[0] = 0x61707865;
+  in[1] = 0x3320646e;
+  in[2] = 0x79622d32;
+  in[3] = 0x6b206574;
+  for (int i = 0; i < 8; i++) in[4 + i] = load32(k + 4 * i);
+  in[13] = in[14] = in[15] = 0;
+  for (uint32_t b = 0; b < blocks; b++, out += 64) {
+    in[12] = b;
+    memcpy(x, in, sizeof(x));
+    for (int round = 0; round < 10; round++) {
+      QUARTER(x[0], x[4], x[8], x[12]);
+      QUARTER(x[1], x[5], x[9], x[13]);
+      QUARTER(x[2], x[6], x[10], x[14]);
+      QUARTER(x[3], x[7], x[11], x[15]);
+      QUARTER(x[0], x[5], x[10], x[15]);
+      QUARTER(x[1], x[6], x[11], x[12]);
+      QUARTER(x[2], x[7], x[8], x[13]);
+      QUARTER(x[3], x[4], x[9], x[14]);
+    }
+    for (int i = 0; i < 16; i++) store32(out + 4 * i, x[i] + in[i]);
+  }
+  memwipe(x, sizeof(x));
+  memwipe(in, sizeof(in));
+}
+
+// ---- Health tests ----
+
+static bool repetitionCount(const uint8_t* data, size_t len) {
+  size_t run = 1;
+  for (size_t i = 1; i < len; i++) {
+    run = data[i] == data[i - 1] ? run + 1 : 1;
+    if (run >= HEALTH_RCT_CUTOFF) return false;
+  }
+  return true;
+}
+
+static bool adaptiveProportion(const uint8_t* data, size_t len) {
+  for (size_t start = 0; start + HEALTH_APT_WINDOW <= len; start += HEALTH_APT_WINDOW) {
+    int count = 0;
+    for (size_t i = start; i < start + HEALTH_APT_WINDOW; i++) {
+      if (data[i] == data[start]) count++;
+    }
+    if (count >= HEALTH_APT_CUTOFF) return false;
+  }
+  return true;
+}
+
+// ---- DRBG ----
+
+// key = H(domain || key || sample || reseed count)
+static void reseed() {
+  if (!source) source = platformSource;
+  uint8_t sample[32], count[4];
+  source(sample, sizeof(sample));
+  if (seeded && (memcmp(sample, lastSample, 32) == 0 || !repetitionCount(sample, 32))) healthy = false;
+  memcpy(lastSample, sample, 32);
+  store32(count, reseeds);
+
+  KeccakState st;
+  keccak_init(st);
+  keccak_update(st, (const uint8_t*)RESEED_DOMAIN, sizeof(RESEED_DOMAIN) - 1);
+  keccak_update(st, key, 32);
+  keccak_update(st, sample, 32);
+  keccak_update(st, count, 4);
+  keccak_final(st, key);
+  memwipe(&st, sizeof(st));
+  memwipe(sample, sizeof(sample));
+
+  // Output buffered under the old key is dropped
+  memset(pool, 0, sizeof(pool));
+  poolUsed = RANDOM_POOL_BYTES;
+  sinceReseed = 0;
+  reseeds++;
+  seeded = true;
+}
+
+// First block rekeys, the rest is output
+static void refill() {
+  if (!seeded || sinceReseed >= RANDOM_RESEED_BYTES) reseed();
+  chachaStream(pool, RANDOM_POOL_BYTES / 64, key);
+  memcpy(key, pool, 32);
+  memset(pool, 0, 64);
+  poolUsed = 64;
+}
+
+bool randomBegin(RandomSource src) {
+  source = src ? src : platformSource;
+  uint8_t sample[RANDOM_HEALTH_BYTES];
+  source(sample, sizeof(sample));
+  healthy = repetitionCount(sample, sizeof(sample)) && adaptiveProportion(sample, sizeof(sample));
+  keccak256(sample, sizeof(sample), key);  // The tested sample seeds too
+  memwipe(sample, sizeof(sample));
+  bool passed = healthy;
+
+  seeded = false;
+  reseed();
+  return passed && healthy;
+}
+
+bool randomHealthy() {
+  return healthy;
+}
+
+void randomReseed() {
+  reseed();
+}
+
+void randomBytes(uint8_t* out, size_t len) {
+  while (len > 0) {
+    if (poolUsed == RANDOM_POOL_BYTES) refill();
+    size_t n = RANDOM_POOL_BYTES - poolUsed;
+    if (n > len) n = len;
+    // pool is static, so clearing what was handed out is not a dead store
+    memcpy(out, pool + poolUsed, n);
+    memset(pool + poolUsed, 0, n);
+    poolUsed += n;
+    out += n;
+    len -= n;
+    sinceReseed += n;
+    generated += n;
+  }
+}
+
+void randomScalar(uint8_t out[32]) {
+  uint8_t wide[64];
+  randomBytes(wide, sizeof(wide));
+  sc_reduce64(out, wide);
+  memwipe(wide, sizeof(wide));
+}
+
+void randomStats(uint32_t& reseedCount, uint32_t& bytes) {
+  reseedCount = reseeds;
+  bytes = generated;
+}
+
+// ---- Signature nonces ----
+
+void nonceBegin(NonceStream& ns, const uint8_t secret[32]) {
+  memset(&ns, 0, sizeof(ns));
+  keccak_init(ns.st);
+  keccak_update(ns.st, (const uint8_t*)NONCE_DOMAIN, sizeof(NONCE_DOMAIN) - 1);
+  keccak_update(ns.st, secret, 32);
+}
+
+void nonceAbsorb(NonceStream& ns, const uint8_t* data, size_t len) {
+  keccak_update(ns.st, data, len);
+}
+
+// k_i = reduce(H(key || i || 0) || H(key || i || 1))
+void nonceScalar(NonceStream& ns, uint8_t out[32]) {
+  if (!ns.keyed) {
+    uint8_t hedge[32];
+    randomBytes(hedge, sizeof(hedge));
+    keccak_update(ns.st, hedge, sizeof(hedge));
+    keccak_final(ns.st, ns.key);
+    memwipe(hedge, sizeof(hedge));
+    memwipe(&ns.st, sizeof(ns.st));
+    ns.keyed = true;
+  }
+  uint8_t block[37], wide[64];
+  memcpy(block, ns.key, 32);
+  store32(block + 32, ns.counter++);
+  for (int half = 0; half < 2; half++) {
+    block[36] = (uint8_t)half;
+    keccak256(block, sizeof(block), wide + 32 * half);
+  }
+  sc_reduce64(out, wide);
+  memwipe(block, sizeof(block));
+  memwipe(wide, sizeof(wide));
+}
+
+void nonceEnd(NonceStream& ns) {
+  memwipe(&ns, sizeof(ns));
+}
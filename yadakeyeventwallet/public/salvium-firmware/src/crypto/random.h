@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "keccak.h"
+
+// ==================== RANDOMNESS ====================
+//
+// A ChaCha20 DRBG seeded from an entropy source: the hardware RNG on the
+// ESP32 (esp_fill_random), the OS CSPRNG under the native build. Output is
+// generated RANDOM_POOL_BYTES at a time and the first 32 bytes of each
+// refill become the next key, so earlier output cannot be recomputed from
+// the state (fast key erasure). The key is reseeded from the source every
+// RANDOM_RESEED_BYTES of output and on randomReseed(), so batch signing and
+// key generation draw at memory speed instead of the hardware RNG's
+// per-word rate.
+//
+// randomBegin() runs start-up health tests on the source (SP 800-90B
+// repetition count and adaptive proportion, assuming 4 bits of entropy per
+// byte) and every reseed repeats a stuck-output check. The tests catch a
+// stuck or biased source, not a weak one: the ESP32 RNG only mixes in true
+// entropy while the radio or the bootloader's SAR ADC source is running.
+//
+// Only call from one task at a time.
+
+#define RANDOM_POOL_BYTES    512            // Keystream per refill, multiple of 64
+#define RANDOM_RESEED_BYTES  (64u * 1024u)  // Output between source reseeds
+#define RANDOM_HEALTH_BYTES  1024           // Source bytes sampled by randomBegin
+
+typedef void (*RandomSource)(void* buf, size_t len);
+
+// Test and seed from source. False if the health tests failed; the DRBG is
+// still seeded, but nothing secret should be generated from it. Without a
+// call the first draw seeds from the platform default, untested.
+bool randomBegin(RandomSource source);
+bool randomHealthy();
+
+// Mix fresh source bytes into the key now (before generating long-term keys)
+void randomReseed();
+
+void randomBytes(uint8_t* out, size_t len);
+
+// Uniform scalar mod l (64 random bytes reduced)
+void randomScalar(uint8_t out[32]);
+
+// Reseeds and bytes generated since boot
+void randomStats(uint32_t& reseeds, uint32_t& bytes);
+
+// ---- Signature nonces ----
+//
+// RFC 6979-style derivation: nonces are a function of the secret key and
+// everything absorbed about what is signed, hedged with 32 DRBG bytes as
+// RFC 6979 section 3.6 allows. Different messages never share a nonce even
+// if the DRBG repeats itself, and a fault on one signing run does not give
+// a second run the same nonces.
+
+struct NonceStream {
+  KeccakState st;
+  uint8_t key[32];
+  uint32_t counter;
+  bool keyed;
+};
+
+void nonceBegin(NonceStream& ns, const uint8_t secret[32]);
+void nonceAbsorb(NonceStream& ns, const uint8_t* data, size_t len);
+
+// Next nonce scalar; the first call closes absorption
+void nonceScalar(NonceStream& ns, uint8_t out[32]);
+void nonceEnd(NonceStream& ns);
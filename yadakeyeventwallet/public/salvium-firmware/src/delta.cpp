@@ -0,0 +1,166 @@
+#include "delta.h"
+#include <string.h>
+#include "crypto/keccak.h"
+
+#define STAGE_OP      0
+#define STAGE_ARG     1
+#define STAGE_LITERAL 2
+
+#define COPY_CHUNK 256  // Bytes moved per read/write call
+
+static const char* statusNames[] = {"RUNNING", "DONE", "MALFORMED", "READ_FAILED", "WRITE_FAILED"};
+
+static uint32_t load32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void store32(uint8_t* p, uint32_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+}
+
+bool deltaParseHeader(const uint8_t in[DELTA_HEADER_BYTES], DeltaHeader& header) {
+  if (memcmp(in, DELTA_MAGIC, 4) != 0) return false;
+  header.window = load32(in + 4);
+  header.oldSize = load32(in + 8);
+  header.newSize = load32(in + 12);
+  memcpy(header.oldSha, in + 16, 32);
+  memcpy(header.newSha, in + 48, 32);
+  memcpy(header.signature, in + 80, 64);
+  return header.window >= 1 && header.window <= DELTA_WINDOW;
+}
+
+void deltaWriteHeader(uint8_t out[DELTA_HEADER_BYTES], const DeltaHeader& header) {
+  memcpy(out, DELTA_MAGIC, 4);
+  store32(out + 4, header.window);
+  store32(out + 8, header.oldSize);
+  store32(out + 12, header.newSize);
+  memcpy(out + 16, header.oldSha, 32);
+  memcpy(out + 48, header.newSha, 32);
+  memcpy(out + 80, header.signature, 64);
+}
+
+void deltaSignedHash(const DeltaHeader& header, uint8_t out[32]) {
+  uint8_t buf[DELTA_HEADER_BYTES];
+  deltaWriteHeader(buf, header);
+  keccak256(buf, DELTA_SIGNED_BYTES, out);
+}
+
+void deltaBegin(DeltaPatcher& p, const DeltaHeader& header, DeltaReadOld readOld, DeltaWriteNew writeNew,
+                void* ctx) {
+  p.readOld = readOld;
+  p.writeNew = writeNew;
+  p.ctx = ctx;
+  p.window = header.window;
+  p.oldSize = header.oldSize;
+  p.newSize = header.newSize;
+  p.written = 0;
+  p.oldEnd = 0;
+  p.stage = STAGE_OP;
+  p.shift = 0;
+  p.varint = 0;
+  p.status = header.newSize == 0 ? DELTA_DONE : DELTA_RUNNING;
+}
+
+// ---- Output ----
+
+static bool emit(DeltaPatcher& p, const uint8_t* buf, size_t len) {
+  if (!p.writeNew(p.ctx, buf, len)) return false;
+  for (size_t i = 0; i < len; i++) p.ring[(p.written + i) % DELTA_WINDOW] = buf[i];
+  p.written += len;
+  return true;
+}
+
+static DeltaStatus copyOld(DeltaPatcher& p, uint32_t offset, uint32_t len) {
+  uint8_t buf[COPY_CHUNK];
+  while (len > 0) {
+    uint32_t n = len < COPY_CHUNK ? len : COPY_CHUNK;
+    if (!p.readOld(p.ctx, offset, buf, n)) return DELTA_READ_FAILED;
+    if (!emit(p, buf, n)) return DELTA_WRITE_FAILED;
+    offset += n;
+    len -= n;
+  }
+  return DELTA_RUNNING;
+}
+
+// Overlapping copies repeat the last `distance` bytes, as in LZ77
+static DeltaStatus copyNew(DeltaPatcher& p, uint32_t distance, uint32_t len) {
+  uint8_t buf[COPY_CHUNK];
+  while (len > 0) {
+    uint32_t n = len < COPY_CHUNK ? len : COPY_CHUNK;
+    if (n > distance) n = distance;
+    uint32_t from = p.written - distance;
+    for (uint32_t i = 0; i < n; i++) buf[i] = p.ring[(from + i) % DELTA_WINDOW];
+    if (!emit(p, buf, n)) return DELTA_WRITE_FAILED;
+    len -= n;
+  }
+  return DELTA_RUNNING;
+}
+
+// ---- Op decoding ----
+
+// The op's argument is complete: check it and run the copy
+static DeltaStatus runCopy(DeltaPatcher& p, uint64_t arg) {
+  if (p.op == DELTA_COPY_OLD) {
+    // Zigzag: even = forward, odd = backward
+    int64_t delta = (arg & 1) ? -(int64_t)(arg >> 1) - 1 : (int64_t)(arg >> 1);
+    int64_t offset = (int64_t)p.oldEnd + delta;
+    if (offset < 0 || offset + p.length > p.oldSize) return DELTA_MALFORMED;
+    p.oldEnd = (uint32_t)offset + p.length;
+    return copyOld(p, (uint32_t)offset, p.length);
+  }
+  if (arg == 0 || arg > p.window || arg > p.written) return DELTA_MALFORMED;
+  return copyNew(p, (uint32_t)arg, p.length);
+}
+
+DeltaStatus deltaFeed(DeltaPatcher& p, const uint8_t* data, size_t len) {
+  size_t at = 0;
+  while (at < len && p.status == DELTA_RUNNING) {
+    if (p.stage == STAGE_LITERAL) {
+      size_t n = len - at < p.length ? len - at : p.length;
+      if (!emit(p, data + at, n)) {
+        p.status = DELTA_WRITE_FAILED;
+        break;
+      }
+      at += n;
+      p.length -= n;
+      if (p.length == 0) p.stage = STAGE_OP;
+    } else {
+      uint8_t b = data[at++];
+      if (p.shift > 56) {
+        p.status = DELTA_MALFORMED;
+        break;
+      }
+      p.varint |= (uint64_t)(b & 0x7F) << p.shift;
+      p.shift += 7;
+      if (b & 0x80) continue;
+
+      uint64_t value = p.varint;
+      p.varint = 0;
+      p.shift = 0;
+      if (p.stage == STAGE_OP) {
+        p.op = (uint8_t)(value & 3);
+        uint64_t length = value >> 2;
+        if (p.op > DELTA_LITERAL || length == 0 || length > p.newSize - p.written) {
+          p.status = DELTA_MALFORMED;
+          break;
+        }
+        p.length = (uint32_t)length;
+        p.stage = p.op == DELTA_LITERAL ? STAGE_LITERAL : STAGE_ARG;
+      } else {
+        p.status = runCopy(p, value);
+        p.stage = STAGE_OP;
+      }
+    }
+    if (p.status == DELTA_RUNNING && p.written == p.newSize && p.stage == STAGE_OP) p.status = DELTA_DONE;
+  }
+  // Anything after the last op is not part of this patch
+  if (p.status == DELTA_DONE && at < len) p.status = DELTA_MALFORMED;
+  return p.status;
+}
+
+const char* deltaStatusName(DeltaStatus status) {
+  return status <= DELTA_WRITE_FAILED ? statusNames[status] : "?";
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==================== FIRMWARE DELTAS ====================
+//
+// Patch format for serial updates (ota.cpp) and the host tool that makes
+// and applies patches (src/host/ota). All integers little endian:
+//
+//   magic "YDD1"
+//   window u32                COPY_NEW reach the patch was made for
+//   oldSize u32, newSize u32
+//   oldSha[32], newSha[32]    SHA-256 of the running and of the new image
+//   signature[64]             release key over Keccak(every field above)
+//   ops, until newSize bytes are out:
+//     varint(len << 2 | op), then
+//       DELTA_COPY_OLD   zigzag varint: source offset - end of the last COPY_OLD
+//       DELTA_COPY_NEW   varint distance back into the output, <= window
+//       DELTA_LITERAL    len raw bytes
+//
+// COPY_OLD carries code that is unchanged or only moved; COPY_NEW is LZ77
+// over what was just written, so the ops are the delta and its compression
+// in one stream. Applying needs the window in RAM and random reads of the
+// old image, nothing else; ops are decoded as bytes arrive, in chunks of
+// any size.
+
+#define DELTA_MAGIC        "YDD1"
+#define DELTA_HEADER_BYTES 144
+#define DELTA_SIGNED_BYTES 80   // Header bytes the signature covers
+#define DELTA_WINDOW       8192
+
+enum DeltaOp { DELTA_COPY_OLD, DELTA_COPY_NEW, DELTA_LITERAL };
+
+enum DeltaStatus {
+  DELTA_RUNNING,      // Wants more ops
+  DELTA_DONE,         // newSize bytes written
+  DELTA_MALFORMED,    // Bad op, out-of-range copy, or bytes after the end
+  DELTA_READ_FAILED,  // Old image
+  DELTA_WRITE_FAILED  // New image
+};
+
+struct DeltaHeader {
+  uint32_t window;
+  uint32_t oldSize;
+  uint32_t newSize;
+  uint8_t oldSha[32];
+  uint8_t newSha[32];
+  uint8_t signature[64];
+};
+
+// False on a wrong magic or a window larger than DELTA_WINDOW
+bool deltaParseHeader(const uint8_t in[DELTA_HEADER_BYTES], DeltaHeader& header);
+void deltaWriteHeader(uint8_t out[DELTA_HEADER_BYTES], const DeltaHeader& header);
+
+// Keccak-256 of the first DELTA_SIGNED_BYTES of the header
+void deltaSignedHash(const DeltaHeader& header, uint8_t out[32]);
+
+// Old image reads at any offset; new image writes arrive in order
+typedef bool (*DeltaReadOld)(void* ctx, uint32_t offset, uint8_t* buf, size_t len);
+typedef bool (*DeltaWriteNew)(void* ctx, const uint8_t* buf, size_t len);
+
+struct DeltaPatcher {
+  DeltaReadOld readOld;
+  DeltaWriteNew writeNew;
+  void* ctx;
+  uint32_t window, oldSize, newSize;
+  uint32_t written;   // Output so far
+  uint32_t oldEnd;    // End of the last COPY_OLD
+  uint8_t stage;      // Decoding: op varint, argument varint, literal bytes
+  uint8_t shift;
+  uint64_t varint;
+  uint8_t op;
+  uint32_t length;    // Of the current op; literal bytes still to come
+  DeltaStatus status;
+  uint8_t ring[DELTA_WINDOW];  // Last window bytes written
+};
+
+void deltaBegin(DeltaPatcher& p, const DeltaHeader& header, DeltaReadOld readOld, DeltaWriteNew writeNew,
+                void* ctx);
+
+// Decode and apply ops. Once not RUNNING, the status sticks.
+DeltaStatus deltaFeed(DeltaPatcher& p, const uint8_t* data, size_t len);
+
+const char* deltaStatusName(DeltaStatus status);
@@ -0,0 +1,152 @@
+#include "derived.h"
+#include "addresses.h"
+#include "keystore.h"
+#include "log.h"
+#include "crypto/cryptonote.h"
+#include "crypto/keccak.h"
+#include <Arduino.h>
+#include <string.h>
+
+#define DERIVED_MAGIC   0xD3C1
+#define DERIVED_VERSION 2  // 1 held a placeholder Salvium address
+
+static const char BINDING_DOMAIN[] = "derived-cache-v1";
+
+enum RebuildStage { STAGE_KEYS, STAGE_ADDRESS, STAGE_QR_YDA, STAGE_QR_SAL, STAGE_SAVE, STAGE_COUNT };
+
+// Persisted image (KEY_DERIVED)
+struct DerivedRecord {
+  uint16_t magic;
+  uint8_t version;
+  uint8_t reserved;
+  uint8_t binding[32];
+  int32_t rotation;
+  uint8_t spendPublic[32];
+  uint8_t viewPublic[32];
+  char yadacoinAddress[WALLET_YDA_ADDR_LEN + 1];
+  char salviumAddress[WALLET_SAL_ADDR_LEN + 1];
+  QrBitmap qr[2];
+};
+
+static_assert(sizeof(DerivedRecord) <= KEYSTORE_DERIVED_BYTES, "grow KEYSTORE_DERIVED_BYTES");
+static_assert(WALLET_SAL_ADDR_LEN == ADDR_MAX_LEN, "the cache holds an encoded primary address");
+
+static DerivedRecord record;
+static bool valid = false;
+static int stage = STAGE_KEYS;
+
+static void bindingHash(uint8_t out[32]) {
+  KeccakState st;
+  uint8_t rot[4];
+  uint32_t r = (uint32_t)wallet.salviumRotation;
+  for (int i = 0; i < 4; i++) rot[i] = (uint8_t)(r >> (8 * i));
+  keccak_init(st);
+  keccak_update(st, (const uint8_t*)BINDING_DOMAIN, sizeof(BINDING_DOMAIN) - 1);
+  keccak_update(st, wallet.secret.salviumSpendKey, 32);
+  keccak_update(st, rot, 4);
+  keccak_final(st, out);
+}
+
+// The derived primary address, unless ROTATE_KEY has stored another
+static void publishSalviumAddress() {
+  char rotated[WALLET_SAL_ADDR_LEN + 1];
+  size_t len = keystoreReadUpTo(KEY_SAL_ADDRESS, rotated, WALLET_SAL_ADDR_LEN);
+  rotated[len] = '\0';
+  walletSetSalviumAddress(len ? rotated : record.salviumAddress);
+}
+
+bool derivedLoad() {
+  valid = false;
+  stage = STAGE_KEYS;
+  if (!keystoreGet(KEY_DERIVED, record)) memset(&record, 0, sizeof(record));
+
+  if (record.magic != DERIVED_MAGIC || record.version != DERIVED_VERSION) {
+    LOG_I("[CACHE] No derived data");
+    return false;
+  }
+  uint8_t binding[32];
+  bindingHash(binding);
+  bool match = memcmp(binding, record.binding, 32) == 0 && record.rotation == wallet.salviumRotation;
+  if (!match) {
+    LOG_I("[CACHE] Stale (keys or rotation changed)");
+    return false;
+  }
+
+  record.salviumAddress[WALLET_SAL_ADDR_LEN] = '\0';
+  record.yadacoinAddress[WALLET_YDA_ADDR_LEN] = '\0';
+  publishSalviumAddress();
+  valid = true;
+  LOG_I("[CACHE] Derived data loaded");
+  return true;
+}
+
+void derivedInvalidate() {
+  valid = false;
+  stage = STAGE_KEYS;
+}
+
+bool derivedValid() {
+  return valid;
+}
+
+DerivedStatus derivedRebuildStep(uint8_t* progress) {
+  switch (stage) {
+    case STAGE_KEYS: {
+      uint8_t b[32], a[32];
+      walletSalviumSpendKey(b);
+      derive_view_key(a, b);
+      secret_to_public(record.spendPublic, b);
+      secret_to_public(record.viewPublic, a);
+      memwipe(b, sizeof(b));
+      memwipe(a, sizeof(a));
+      break;
+    }
+
+    case STAGE_ADDRESS:
+      // The primary address of the keys just derived, as GET_ADDRESSES gives it
+      addressEncode(record.salviumAddress, SAL_ADDRESS_PREFIX, record.spendPublic, record.viewPublic);
+      memcpy(record.yadacoinAddress, wallet.yadacoinAddress, sizeof(record.yadacoinAddress));
+      publishSalviumAddress();
+      break;
+
+    case STAGE_QR_YDA:
+      qrEncode(record.qr[DERIVED_QR_YADACOIN], record.yadacoinAddress, DERIVED_QR_VERSION_YDA);
+      break;
+
+    case STAGE_QR_SAL:
+      qrEncode(record.qr[DERIVED_QR_SALVIUM], record.salviumAddress, DERIVED_QR_VERSION_SAL);
+      break;
+
+    case STAGE_SAVE:
+      record.magic = DERIVED_MAGIC;
+      record.version = DERIVED_VERSION;
+      record.reserved = 0;
+      record.rotation = wallet.salviumRotation;
+      bindingHash(record.binding);
+      keystorePut(KEY_DERIVED, record);
+      keystoreCommit();
+      valid = true;
+      break;
+  }
+
+  stage++;
+  *progress = (uint8_t)((stage * 100) / STAGE_COUNT);
+  if (stage < STAGE_COUNT) return DERIVED_RUNNING;
+  stage = STAGE_KEYS;
+  return DERIVED_DONE;
+}
+
+const QrBitmap* derivedQr(DerivedQr which, const char* addr) {
+  if (!valid) return nullptr;
+  const char* cached = which == DERIVED_QR_YADACOIN ? record.yadacoinAddress : record.salviumAddress;
+  if (strcmp(cached, addr) != 0 || record.qr[which].size == 0) return nullptr;
+  return &record.qr[which];
+}
+
+const uint8_t* derivedSpendPublic() {
+  return valid ? record.spendPublic : nullptr;
+}
+
+const uint8_t* derivedViewPublic() {
+  return valid ? record.viewPublic : nullptr;
+}
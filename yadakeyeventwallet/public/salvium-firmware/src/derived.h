@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+#include "qr.h"
+#include "wallet.h"
+
+// ==================== DERIVED DATA CACHE ====================
+//
+// Public data derived from the wallet secrets: the Salvium public spend and
+// view keys, the encoded addresses and the receive-screen QR bitmaps. It is
+// persisted in the key store (KEY_DERIVED) together with a binding hash,
+//
+//   Keccak("derived-cache-v1" || spendKey || rotation)
+//
+// so boot only hashes and compares instead of re-deriving. A missing or stale
+// cache (new wallet, rotation change) is rebuilt by a background job; until
+// then screens encode their QR codes on the fly as before.
+//
+// Cached QR codes are only used while the address on screen is the one they
+// were built for, so an address pushed with ROTATE_KEY falls back to live
+// encoding without invalidating the cache.
+
+#define DERIVED_QR_VERSION_YDA 5   // 67 chars
+#define DERIVED_QR_VERSION_SAL 6   // 99 chars
+
+enum DerivedQr { DERIVED_QR_YADACOIN, DERIVED_QR_SALVIUM };
+
+enum DerivedStatus { DERIVED_RUNNING, DERIVED_DONE };
+
+// Read the cache from the key store and check it against the wallet. On a
+// hit the Salvium address is copied into the arena, or the one ROTATE_KEY
+// stored (KEY_SAL_ADDRESS) if there is one.
+bool derivedLoad();
+
+// Mark stale after the secrets or the rotation change
+void derivedInvalidate();
+bool derivedValid();
+
+// One bounded stage of the rebuild (keys, address, each QR, then the key
+// store write and commit). *progress is 0-100.
+DerivedStatus derivedRebuildStep(uint8_t* progress);
+
+// Cached QR for addr, or nullptr if the cache does not hold that address
+const QrBitmap* derivedQr(DerivedQr which, const char* addr);
+
+const uint8_t* derivedSpendPublic();
+const uint8_t* derivedViewPublic();
@@ -0,0 +1,137 @@
+#include "fonts.h"
+#include "fonts_data.h"
+
+// Cache slots per font. Titles (24px) use few distinct characters, body text
+// (16px) covers labels, buttons and balances.
+#define GLYPH_CACHE_SLOTS_16 24
+#define GLYPH_CACHE_SLOTS_24 8
+
+struct GlyphCacheSlot {
+  uint32_t colors;   // fg << 16 | bg
+  uint8_t ch;        // 0 = empty
+};
+
+struct GlyphCache {
+  const SmoothFont* font;
+  GlyphCacheSlot* slots;
+  uint16_t* pixels;  // slotCount cells of font->maxCell pixels each
+  uint16_t slotCount;
+};
+
+static GlyphCacheSlot cacheSlots16[GLYPH_CACHE_SLOTS_16];
+static GlyphCacheSlot cacheSlots24[GLYPH_CACHE_SLOTS_24];
+static uint16_t cachePixels16[GLYPH_CACHE_SLOTS_16 * FONT_SANS_16_MAX_CELL];
+static uint16_t cachePixels24[GLYPH_CACHE_SLOTS_24 * FONT_SANS_24_MAX_CELL];
+
+static GlyphCache glyphCaches[] = {
+  { &FONT_SANS_16, cacheSlots16, cachePixels16, GLYPH_CACHE_SLOTS_16 },
+  { &FONT_SANS_24, cacheSlots24, cachePixels24, GLYPH_CACHE_SLOTS_24 },
+};
+
+static uint32_t cacheHits = 0;
+static uint32_t cacheMisses = 0;
+
+static GlyphCache* cacheFor(const SmoothFont& font) {
+  for (auto& cache : glyphCaches) {
+    if (cache.font == &font) return &cache;
+  }
+  return nullptr;
+}
+
+// 16-entry fg/bg blend table, stored byte-swapped so cells can be pushed
+// to the ILI9341 as-is (MSB first) with swap bytes disabled.
+static void buildBlendTable(uint16_t fg, uint16_t bg, uint16_t lut[16]) {
+  int fr = fg >> 11, fgn = (fg >> 5) & 0x3F, fb = fg & 0x1F;
+  int br = bg >> 11, bgn = (bg >> 5) & 0x3F, bb = bg & 0x1F;
+  for (int a = 0; a < 16; a++) {
+    int r = br + ((fr - br) * a) / 15;
+    int g = bgn + ((fgn - bgn) * a) / 15;
+    int b = bb + ((fb - bb) * a) / 15;
+    uint16_t c = (r << 11) | (g << 5) | b;
+    lut[a] = (c >> 8) | (c << 8);
+  }
+}
+
+// Expand one glyph into an advance x lineHeight cell, row by row
+static void renderCell(const SmoothFont& font, const GlyphInfo& g,
+                       const uint16_t lut[16], uint16_t* cell) {
+  int cellW = g.advance;
+  int cellH = font.lineHeight;
+  for (int i = 0; i < cellW * cellH; i++) cell[i] = lut[0];
+
+  int rowBytes = (g.width + 1) / 2;
+  const uint8_t* src = font.bitmap + g.offset;
+  for (int r = 0; r < g.height; r++, src += rowBytes) {
+    int y = g.yOffset + r;
+    if (y < 0 || y >= cellH) continue;
+    uint16_t* dst = cell + y * cellW;
+    for (int c = 0; c < g.width; c++) {
+      int x = g.xOffset + c;
+      if (x < 0 || x >= cellW) continue;
+      uint8_t packed = src[c >> 1];
+      uint8_t alpha = (c & 1) ? (packed & 0x0F) : (packed >> 4);
+      if (alpha) dst[x] = lut[alpha];
+    }
+  }
+}
+
+int fontTextWidth(const SmoothFont& font, const char* text) {
+  int w = 0;
+  for (const char* p = text; *p; p++) {
+    uint8_t ch = (uint8_t)*p;
+    if (ch < font.first || ch > font.last) ch = '?';
+    w += font.glyphs[ch - font.first].advance;
+  }
+  return w;
+}
+
+int fontDrawString(TFT_eSPI& tft, const SmoothFont& font, int x, int y,
+                   const char* text, uint16_t fg, uint16_t bg) {
+  GlyphCache* cache = cacheFor(font);
+  if (!cache) return x;
+
+  uint16_t lut[16];
+  bool lutReady = false;
+  uint32_t colors = ((uint32_t)fg << 16) | bg;
+
+  bool swap = tft.getSwapBytes();
+  tft.setSwapBytes(false);
+  tft.startWrite();
+
+  for (const char* p = text; *p; p++) {
+    uint8_t ch = (uint8_t)*p;
+    if (ch < font.first || ch > font.last) ch = '?';
+    const GlyphInfo& g = font.glyphs[ch - font.first];
+    if (g.advance == 0) continue;
+
+    // Direct-mapped: a miss simply replaces whatever occupied the slot
+    uint16_t idx = (ch * 31u + (colors ^ (colors >> 13))) % cache->slotCount;
+    GlyphCacheSlot& slot = cache->slots[idx];
+    uint16_t* cell = cache->pixels + (uint32_t)idx * font.maxCell;
+
+    if (slot.ch == ch && slot.colors == colors) {
+      cacheHits++;
+    } else {
+      cacheMisses++;
+      if (!lutReady) {
+        buildBlendTable(fg, bg, lut);
+        lutReady = true;
+      }
+      renderCell(font, g, lut, cell);
+      slot.ch = ch;
+      slot.colors = colors;
+    }
+
+    tft.pushImage(x, y, g.advance, font.lineHeight, cell);
+    x += g.advance;
+  }
+
+  tft.endWrite();
+  tft.setSwapBytes(swap);
+  return x;
+}
+
+void fontCacheStats(uint32_t& hits, uint32_t& misses) {
+  hits = cacheHits;
+  misses = cacheMisses;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// ==================== SMOOTH FONTS ====================
+//
+// Pre-rendered anti-aliased fonts stored in flash (see tools/fontgen.py).
+// Glyphs are 4 bits per pixel; each drawn character is blended once into an
+// RGB565 cell, kept in a small RAM cache keyed by (char, fg, bg), and pushed
+// to the panel as a single address window instead of per-pixel rectangles.
+// Size-1 text keeps using the built-in GLCD font.
+
+struct GlyphInfo {
+  uint16_t offset;   // Byte offset of the first row in the font bitmap
+  uint8_t width;     // Bitmap width in pixels
+  uint8_t height;    // Bitmap height in pixels
+  int8_t xOffset;    // Bitmap left edge relative to the pen position
+  int8_t yOffset;    // Bitmap top edge relative to the top of the line
+  uint8_t advance;   // Pen advance (and cell width) in pixels
+};
+
+struct SmoothFont {
+  const uint8_t* bitmap;
+  const GlyphInfo* glyphs;
+  uint8_t first;
+  uint8_t last;
+  uint8_t lineHeight;
+  uint8_t ascent;
+  uint16_t maxCell;  // Largest advance * lineHeight, in pixels
+};
+
+// Replace setTextSize(2) / setTextSize(3) of the GLCD font
+extern const SmoothFont FONT_SANS_16;
+extern const SmoothFont FONT_SANS_24;
+
+// Draw text with its top-left corner at (x, y). Returns the x after the last glyph.
+int fontDrawString(TFT_eSPI& tft, const SmoothFont& font, int x, int y,
+                   const char* text, uint16_t fg, uint16_t bg);
+
+// Width in pixels of text when drawn with font
+int fontTextWidth(const SmoothFont& font, const char* text);
+
+// Glyph cache hit/miss counters since boot
+void fontCacheStats(uint32_t& hits, uint32_t& misses);
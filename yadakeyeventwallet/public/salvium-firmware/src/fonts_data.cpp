@@ -0,0 +1,1126 @@
+// GENERATED by tools/fontgen.py from Lato-Regular.ttf - do not edit.
+// Lato is licensed under the SIL Open Font License 1.1.
+
+#include "fonts.h"
+
+static const uint8_t font_sans_16_bitmap[] PROGMEM = {
+  0x00, 0xe7, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe6, 0x00, 0x00,
+  0xe6, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe8,
+  0x00, 0x0c, 0x72, 0xf2, 0x0c, 0x72, 0xf2, 0x0c, 0x61, 0xf1, 0x09, 0x40, 0xd0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x80, 0x7a, 0x00, 0x00, 0x0d, 0x50, 0xb7, 0x00, 0x00, 0x1f, 0x10, 0xe4,
+  0x00, 0x1f, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x6c, 0x04, 0xe0, 0x00, 0x00, 0x99, 0x07, 0xb0, 0x00,
+  0x00, 0xc6, 0x09, 0x80, 0x00, 0x8f, 0xff, 0xff, 0xff, 0x30, 0x02, 0xf1, 0x0f, 0x30, 0x00, 0x05,
+  0xd0, 0x3f, 0x00, 0x00, 0x09, 0x80, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xb4, 0x00, 0x03, 0xf8, 0x7a, 0x7c, 0x00, 0x09, 0xc0, 0x67,
+  0x00, 0x00, 0x08, 0xd0, 0x76, 0x00, 0x00, 0x02, 0xfd, 0xc6, 0x00, 0x00, 0x00, 0x29, 0xef, 0xc3,
+  0x00, 0x00, 0x00, 0xb6, 0xbf, 0x20, 0x00, 0x00, 0xc2, 0x0f, 0x70, 0x01, 0x00, 0xd1, 0x0f, 0x50,
+  0x0e, 0xb4, 0xe4, 0xbd, 0x00, 0x02, 0xaf, 0xff, 0xa1, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00,
+  0x01, 0xc0, 0x00, 0x00, 0x06, 0xee, 0x90, 0x00, 0x07, 0xc0, 0x00, 0x3e, 0x21, 0xc6, 0x00, 0x4e,
+  0x20, 0x00, 0x6b, 0x00, 0x89, 0x02, 0xe4, 0x00, 0x00, 0x3e, 0x21, 0xc6, 0x0c, 0x70, 0x00, 0x00,
+  0x07, 0xee, 0x90, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0x33, 0xcf, 0xc2, 0x00, 0x00, 0x01, 0xe6, 0x0d, 0x60, 0x8c, 0x00, 0x00, 0x0b, 0x90, 0x0f,
+  0x10, 0x2f, 0x00, 0x00, 0x8c, 0x00, 0x0d, 0x60, 0x7b, 0x00, 0x04, 0xe2, 0x00, 0x03, 0xcf, 0xc2,
+  0x00, 0x00, 0x08, 0xef, 0xb3, 0x00, 0x00, 0x00, 0x8e, 0x30, 0x8e, 0x00, 0x00, 0x00, 0xb9, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x90, 0x00, 0x00, 0x00, 0x04,
+  0xf9, 0xe9, 0x00, 0x4d, 0x00, 0x0e, 0x80, 0x2e, 0xa0, 0x8b, 0x00, 0x4f, 0x20, 0x02, 0xeb, 0xe4,
+  0x00, 0x4f, 0x40, 0x00, 0x2f, 0xe0, 0x00, 0x0c, 0xd3, 0x03, 0xbd, 0xeb, 0x00, 0x01, 0x9e, 0xfd,
+  0x70, 0x2e, 0xa0, 0x0c, 0x70, 0x0c, 0x70, 0x0c, 0x60, 0x09, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x3f, 0x00, 0x00,
+  0xc9, 0x00, 0x02, 0xf2, 0x00, 0x07, 0xc0, 0x00, 0x0b, 0x90, 0x00, 0x0d, 0x60, 0x00, 0x0e, 0x50,
+  0x00, 0x0e, 0x50, 0x00, 0x0d, 0x60, 0x00, 0x0a, 0x90, 0x00, 0x07, 0xd0, 0x00, 0x02, 0xf2, 0x00,
+  0x00, 0xb9, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x0d,
+  0x70, 0x00, 0x07, 0xd0, 0x00, 0x01, 0xf2, 0x00, 0x00, 0xe6, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xa9,
+  0x00, 0x00, 0xa9, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xe5, 0x00, 0x02, 0xf2, 0x00, 0x07, 0xd0, 0x00,
+  0x0e, 0x60, 0x00, 0x4d, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x0b, 0x69, 0x95, 0x01,
+  0xdf, 0x50, 0x0b, 0x69, 0xa5, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00,
+  0x00, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x3f, 0xff,
+  0xff, 0xff, 0x70, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xf3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x80, 0x06, 0x80, 0x0c, 0x10, 0x00, 0x00, 0x3f,
+  0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x70,
+  0x00, 0x00, 0x03, 0xd0, 0x00, 0x00, 0x0b, 0x60, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x89, 0x00,
+  0x00, 0x00, 0xe2, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x0c, 0x50, 0x00, 0x00, 0x3e, 0x00, 0x00,
+  0x00, 0xa8, 0x00, 0x00, 0x01, 0xf1, 0x00, 0x00, 0x07, 0xa0, 0x00, 0x00, 0x0d, 0x30, 0x00, 0x00,
+  0x00, 0x5d, 0xfe, 0x80, 0x00, 0x06, 0xf5, 0x03, 0xda, 0x00, 0x0e, 0x70, 0x00, 0x3f, 0x30, 0x4f,
+  0x20, 0x00, 0x0e, 0x90, 0x7f, 0x00, 0x00, 0x0b, 0xb0, 0x8f, 0x00, 0x00, 0x0b, 0xc0, 0x7f, 0x00,
+  0x00, 0x0b, 0xb0, 0x4f, 0x20, 0x00, 0x0e, 0x90, 0x0f, 0x70, 0x00, 0x3f, 0x40, 0x06, 0xf5, 0x03,
+  0xda, 0x00, 0x00, 0x5d, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x8f, 0x30, 0x00, 0x00, 0x0b, 0xff, 0x30,
+  0x00, 0x01, 0xdd, 0x5f, 0x30, 0x00, 0x00, 0x70, 0x3f, 0x30, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x00,
+  0x00, 0x00, 0x3f, 0x30, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x00, 0x00,
+  0x00, 0x3f, 0x30, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x70, 0x00, 0x4c,
+  0xfe, 0x91, 0x00, 0x04, 0xf6, 0x02, 0xcb, 0x00, 0x0c, 0x90, 0x00, 0x4f, 0x20, 0x01, 0x00, 0x00,
+  0x4f, 0x20, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x06, 0xf5, 0x00, 0x00, 0x00, 0x5f, 0x80,
+  0x00, 0x00, 0x06, 0xf8, 0x00, 0x00, 0x00, 0x6f, 0x80, 0x00, 0x00, 0x07, 0xf8, 0x00, 0x00, 0x00,
+  0x2f, 0xff, 0xff, 0xff, 0x60, 0x00, 0x3b, 0xee, 0xa2, 0x00, 0x02, 0xf8, 0x11, 0xbd, 0x00, 0x09,
+  0xc0, 0x00, 0x2f, 0x30, 0x01, 0x10, 0x00, 0x3f, 0x20, 0x00, 0x00, 0x03, 0xca, 0x00, 0x00, 0x00,
+  0xcf, 0xd2, 0x00, 0x00, 0x00, 0x02, 0x9f, 0x20, 0x00, 0x00, 0x00, 0x0e, 0x80, 0x0d, 0x50, 0x00,
+  0x0f, 0x70, 0x08, 0xe4, 0x02, 0xae, 0x10, 0x00, 0x7d, 0xfe, 0xa2, 0x00, 0x00, 0x00, 0x08, 0xf3,
+  0x00, 0x00, 0x00, 0x4f, 0xf3, 0x00, 0x00, 0x02, 0xf6, 0xf3, 0x00, 0x00, 0x0d, 0x90, 0xf3, 0x00,
+  0x00, 0xbc, 0x00, 0xf3, 0x00, 0x07, 0xe1, 0x00, 0xf3, 0x00, 0x4f, 0x40, 0x00, 0xf3, 0x00, 0x8f,
+  0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00,
+  0x00, 0xf3, 0x00, 0x00, 0xbf, 0xff, 0xfb, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x01, 0xf2, 0x00,
+  0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x06, 0xfe, 0xfd, 0x80, 0x00, 0x01, 0x31, 0x04, 0xe9,
+  0x00, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x20, 0x00, 0x00, 0x00, 0x8e, 0x00,
+  0x09, 0x61, 0x16, 0xf5, 0x00, 0x06, 0xcf, 0xfc, 0x40, 0x00, 0x00, 0x00, 0x1d, 0xb0, 0x00, 0x00,
+  0x00, 0xbd, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x00, 0x00, 0x00, 0x5f, 0x30, 0x00, 0x00, 0x01, 0xfd,
+  0xef, 0xb2, 0x00, 0x0a, 0xf5, 0x02, 0xbe, 0x10, 0x0f, 0x70, 0x00, 0x1f, 0x70, 0x1f, 0x40, 0x00,
+  0x0e, 0x90, 0x0f, 0x70, 0x00, 0x1f, 0x60, 0x07, 0xe4, 0x02, 0xcc, 0x00, 0x00, 0x6d, 0xfe, 0x80,
+  0x00, 0x1f, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x2f, 0x60, 0x00, 0x00, 0x00, 0xad, 0x00,
+  0x00, 0x00, 0x02, 0xf5, 0x00, 0x00, 0x00, 0x0b, 0xd0, 0x00, 0x00, 0x00, 0x3f, 0x50, 0x00, 0x00,
+  0x00, 0xbd, 0x00, 0x00, 0x00, 0x04, 0xf4, 0x00, 0x00, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x00, 0x4f,
+  0x40, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xfd, 0x80, 0x00, 0x05, 0xf5, 0x03,
+  0xd9, 0x00, 0x0b, 0xa0, 0x00, 0x6f, 0x00, 0x0b, 0xa0, 0x00, 0x6f, 0x00, 0x05, 0xf5, 0x03, 0xd8,
+  0x00, 0x00, 0x8f, 0xff, 0xc0, 0x00, 0x0a, 0xd3, 0x02, 0xbd, 0x10, 0x2f, 0x50, 0x00, 0x1f, 0x60,
+  0x2f, 0x50, 0x00, 0x1f, 0x60, 0x0b, 0xd3, 0x02, 0xbe, 0x10, 0x00, 0x8d, 0xfe, 0xa2, 0x00, 0x00,
+  0x3b, 0xef, 0xa2, 0x00, 0x03, 0xf7, 0x11, 0x8e, 0x10, 0x0b, 0xb0, 0x00, 0x0d, 0x70, 0x0b, 0xb0,
+  0x00, 0x0d, 0x90, 0x06, 0xf5, 0x01, 0x9f, 0x70, 0x00, 0x7d, 0xfd, 0xdf, 0x20, 0x00, 0x00, 0x04,
+  0xf8, 0x00, 0x00, 0x00, 0x1e, 0xc0, 0x00, 0x00, 0x00, 0xbf, 0x20, 0x00, 0x00, 0x07, 0xf5, 0x00,
+  0x00, 0x00, 0x3f, 0x90, 0x00, 0x00, 0x0b, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0xc0, 0x0b, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0xd0, 0x01, 0xd0, 0x0a, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x6e, 0xd2, 0x00, 0x00, 0x5d, 0xd5, 0x00, 0x00, 0x0b, 0xf7, 0x00, 0x00, 0x00,
+  0x01, 0x9f, 0x92, 0x00, 0x00, 0x00, 0x02, 0xaf, 0x91, 0x00, 0x00, 0x00, 0x02, 0xa5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x91, 0x00, 0x00,
+  0x00, 0x00, 0xbf, 0x81, 0x00, 0x00, 0x00, 0x03, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x04, 0xee, 0x00,
+  0x00, 0x00, 0x7e, 0xb3, 0x00, 0x00, 0x7e, 0xc4, 0x00, 0x00, 0x01, 0xc4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xa1, 0x00, 0x68, 0x11, 0xbb,
+  0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x05, 0xf6, 0x00, 0x00, 0x5f, 0x60,
+  0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x01, 0x7c, 0xfe, 0xc6, 0x00, 0x00, 0x00, 0x4e, 0x83, 0x00,
+  0x3a, 0xc1, 0x00, 0x02, 0xe3, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x0b, 0x60, 0x04, 0xcf, 0xe5, 0x0d,
+  0x30, 0x1e, 0x00, 0x5e, 0x50, 0xd3, 0x09, 0x60, 0x4c, 0x00, 0xe4, 0x01, 0xf0, 0x09, 0x70, 0x4c,
+  0x02, 0xe0, 0x06, 0xb0, 0x0c, 0x40, 0x1f, 0x02, 0xf2, 0x2d, 0xc0, 0x7c, 0x00, 0x0c, 0x50, 0x9f,
+  0xc3, 0xbf, 0xb1, 0x00, 0x03, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x83, 0x00, 0x14,
+  0x95, 0x00, 0x00, 0x01, 0x8c, 0xff, 0xeb, 0x40, 0x00, 0x00, 0x00, 0x8f, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0xee, 0xd0, 0x00, 0x00, 0x00, 0x06, 0xf5, 0xf4, 0x00, 0x00, 0x00, 0x0c, 0xb0, 0xdb, 0x00,
+  0x00, 0x00, 0x3f, 0x50, 0x6f, 0x10, 0x00, 0x00, 0xae, 0x00, 0x0f, 0x80, 0x00, 0x01, 0xf8, 0x00,
+  0x09, 0xe0, 0x00, 0x07, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x0d, 0xa0, 0x00, 0x00, 0xcc, 0x00, 0x4f,
+  0x40, 0x00, 0x00, 0x5f, 0x30, 0xbd, 0x00, 0x00, 0x00, 0x0e, 0x90, 0x09, 0xff, 0xff, 0xd8, 0x00,
+  0x09, 0xf0, 0x00, 0x4e, 0xb0, 0x09, 0xf0, 0x00, 0x08, 0xf0, 0x09, 0xf0, 0x00, 0x08, 0xf0, 0x09,
+  0xf0, 0x01, 0x5f, 0x60, 0x09, 0xff, 0xff, 0xf9, 0x10, 0x09, 0xf0, 0x00, 0x2b, 0xe1, 0x09, 0xf0,
+  0x00, 0x02, 0xf6, 0x09, 0xf0, 0x00, 0x02, 0xf6, 0x09, 0xf0, 0x00, 0x2c, 0xd1, 0x09, 0xff, 0xff,
+  0xd9, 0x10, 0x00, 0x04, 0xbe, 0xfe, 0xb4, 0x00, 0x00, 0x9f, 0x71, 0x02, 0x7e, 0x10, 0x06, 0xf4,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xb0, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x61, 0x02, 0x8f, 0x10, 0x00, 0x06,
+  0xcf, 0xfe, 0xa3, 0x00, 0x09, 0xff, 0xff, 0xeb, 0x50, 0x00, 0x09, 0xf0, 0x00, 0x16, 0xea, 0x00,
+  0x09, 0xf0, 0x00, 0x00, 0x3f, 0x80, 0x09, 0xf0, 0x00, 0x00, 0x0a, 0xf0, 0x09, 0xf0, 0x00, 0x00,
+  0x05, 0xf3, 0x09, 0xf0, 0x00, 0x00, 0x04, 0xf4, 0x09, 0xf0, 0x00, 0x00, 0x05, 0xf3, 0x09, 0xf0,
+  0x00, 0x00, 0x0a, 0xf0, 0x09, 0xf0, 0x00, 0x00, 0x3f, 0x80, 0x09, 0xf0, 0x00, 0x16, 0xea, 0x00,
+  0x09, 0xff, 0xff, 0xeb, 0x50, 0x00, 0x09, 0xff, 0xff, 0xff, 0x70, 0x09, 0xf0, 0x00, 0x00, 0x00,
+  0x09, 0xf0, 0x00, 0x00, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x00, 0x09,
+  0xff, 0xff, 0xf6, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x00, 0x09, 0xf0,
+  0x00, 0x00, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0x70, 0x09, 0xff, 0xff,
+  0xff, 0x70, 0x09, 0xf0, 0x00, 0x00, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x00, 0x09, 0xf0, 0x00, 0x00,
+  0x00, 0x09, 0xf0, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xfa, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x00,
+  0x09, 0xf0, 0x00, 0x00, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x00, 0x09,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xae, 0xff, 0xc7, 0x00, 0x00, 0x9f, 0x72, 0x01, 0x6e, 0x60,
+  0x07, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x60, 0x00, 0x0b, 0xff, 0xc0, 0x0e, 0xb0,
+  0x00, 0x00, 0x0a, 0xc0, 0x06, 0xf4, 0x00, 0x00, 0x0a, 0xc0, 0x00, 0x9f, 0x71, 0x00, 0x4d, 0xc0,
+  0x00, 0x04, 0xbe, 0xff, 0xc8, 0x20, 0x09, 0xf0, 0x00, 0x00, 0x0e, 0xb0, 0x09, 0xf0, 0x00, 0x00,
+  0x0e, 0xb0, 0x09, 0xf0, 0x00, 0x00, 0x0e, 0xb0, 0x09, 0xf0, 0x00, 0x00, 0x0e, 0xb0, 0x09, 0xf0,
+  0x00, 0x00, 0x0e, 0xb0, 0x09, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x09, 0xf0, 0x00, 0x00, 0x0e, 0xb0,
+  0x09, 0xf0, 0x00, 0x00, 0x0e, 0xb0, 0x09, 0xf0, 0x00, 0x00, 0x0e, 0xb0, 0x09, 0xf0, 0x00, 0x00,
+  0x0e, 0xb0, 0x09, 0xf0, 0x00, 0x00, 0x0e, 0xb0, 0x05, 0xf3, 0x00, 0x05, 0xf3, 0x00, 0x05, 0xf3,
+  0x00, 0x05, 0xf3, 0x00, 0x05, 0xf3, 0x00, 0x05, 0xf3, 0x00, 0x05, 0xf3, 0x00, 0x05, 0xf3, 0x00,
+  0x05, 0xf3, 0x00, 0x05, 0xf3, 0x00, 0x05, 0xf3, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xdb,
+  0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xdb,
+  0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x1a, 0xf1,
+  0x00, 0x6f, 0xfb, 0x20, 0x00, 0x07, 0xf1, 0x00, 0x00, 0xbd, 0x10, 0x07, 0xf1, 0x00, 0x0a, 0xe2,
+  0x00, 0x07, 0xf1, 0x00, 0x9f, 0x30, 0x00, 0x07, 0xf1, 0x07, 0xf4, 0x00, 0x00, 0x07, 0xf1, 0x6f,
+  0x50, 0x00, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x07, 0xf1, 0x3f, 0xa0, 0x00, 0x00, 0x07,
+  0xf1, 0x04, 0xf9, 0x00, 0x00, 0x07, 0xf1, 0x00, 0x5f, 0x70, 0x00, 0x07, 0xf1, 0x00, 0x06, 0xf5,
+  0x00, 0x07, 0xf1, 0x00, 0x00, 0x8f, 0x40, 0x09, 0xf0, 0x00, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x09,
+  0xf0, 0x00, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x09,
+  0xf0, 0x00, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x09,
+  0xff, 0xff, 0xfe, 0x09, 0xf3, 0x00, 0x00, 0x00, 0x07, 0xf5, 0x00, 0x09, 0xfc, 0x00, 0x00, 0x00,
+  0x1f, 0xf5, 0x00, 0x09, 0xce, 0x60, 0x00, 0x00, 0xaa, 0xf5, 0x00, 0x09, 0xc5, 0xe0, 0x00, 0x03,
+  0xf2, 0xf5, 0x00, 0x09, 0xc0, 0xc8, 0x00, 0x0c, 0x80, 0xf5, 0x00, 0x09, 0xc0, 0x4f, 0x20, 0x5e,
+  0x10, 0xf5, 0x00, 0x09, 0xc0, 0x0b, 0xb0, 0xe7, 0x00, 0xf5, 0x00, 0x09, 0xc0, 0x02, 0xfb, 0xd0,
+  0x00, 0xf5, 0x00, 0x09, 0xc0, 0x00, 0x9f, 0x50, 0x00, 0xf5, 0x00, 0x09, 0xc0, 0x00, 0x05, 0x00,
+  0x00, 0xf5, 0x00, 0x09, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x09, 0xd0, 0x00, 0x00, 0x0a,
+  0xb0, 0x09, 0xfa, 0x00, 0x00, 0x0a, 0xb0, 0x09, 0xde, 0x70, 0x00, 0x0a, 0xb0, 0x09, 0xc3, 0xf3,
+  0x00, 0x0a, 0xb0, 0x09, 0xc0, 0x6e, 0x10, 0x0a, 0xb0, 0x09, 0xc0, 0x0a, 0xb0, 0x0a, 0xb0, 0x09,
+  0xc0, 0x00, 0xd8, 0x0a, 0xb0, 0x09, 0xc0, 0x00, 0x2f, 0x4a, 0xb0, 0x09, 0xc0, 0x00, 0x05, 0xec,
+  0xb0, 0x09, 0xc0, 0x00, 0x00, 0x9f, 0xb0, 0x09, 0xc0, 0x00, 0x00, 0x0c, 0xb0, 0x00, 0x04, 0xbe,
+  0xfe, 0xa2, 0x00, 0x00, 0x00, 0x9f, 0x61, 0x02, 0x8f, 0x60, 0x00, 0x06, 0xf3, 0x00, 0x00, 0x07,
+  0xf3, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x00, 0xea, 0x00, 0x2f, 0x60, 0x00, 0x00, 0x00, 0xaf, 0x00,
+  0x3f, 0x50, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x2f, 0x60, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x0e, 0xa0,
+  0x00, 0x00, 0x00, 0xea, 0x00, 0x07, 0xf3, 0x00, 0x00, 0x07, 0xf3, 0x00, 0x00, 0x9f, 0x61, 0x02,
+  0x8f, 0x60, 0x00, 0x00, 0x05, 0xbe, 0xfe, 0xa3, 0x00, 0x00, 0x07, 0xff, 0xff, 0xd7, 0x00, 0x07,
+  0xf1, 0x01, 0x6f, 0x90, 0x07, 0xf1, 0x00, 0x08, 0xf1, 0x07, 0xf1, 0x00, 0x06, 0xf2, 0x07, 0xf1,
+  0x00, 0x09, 0xf0, 0x07, 0xf1, 0x01, 0x6f, 0x80, 0x07, 0xff, 0xfe, 0xc6, 0x00, 0x07, 0xf1, 0x00,
+  0x00, 0x00, 0x07, 0xf1, 0x00, 0x00, 0x00, 0x07, 0xf1, 0x00, 0x00, 0x00, 0x07, 0xf1, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xbe, 0xfe, 0x92, 0x00, 0x00, 0x00, 0x9f, 0x61, 0x02, 0x8f, 0x50, 0x00, 0x06,
+  0xf3, 0x00, 0x00, 0x07, 0xf3, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x00, 0xea, 0x00, 0x2f, 0x60, 0x00,
+  0x00, 0x00, 0xae, 0x00, 0x3f, 0x50, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x2f, 0x60, 0x00, 0x00, 0x00,
+  0xaf, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x07, 0xf3, 0x00, 0x00, 0x07, 0xf4, 0x00,
+  0x00, 0x9f, 0x61, 0x02, 0x8f, 0x80, 0x00, 0x00, 0x05, 0xbe, 0xfe, 0xed, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x9f, 0x30, 0x07, 0xff, 0xff, 0xd7, 0x00, 0x00, 0x07, 0xf1, 0x01, 0x5f, 0x90, 0x00, 0x07,
+  0xf1, 0x00, 0x09, 0xe0, 0x00, 0x07, 0xf1, 0x00, 0x0a, 0xd0, 0x00, 0x07, 0xf1, 0x01, 0x7f, 0x50,
+  0x00, 0x07, 0xff, 0xff, 0xb3, 0x00, 0x00, 0x07, 0xf1, 0x1d, 0xc0, 0x00, 0x00, 0x07, 0xf1, 0x03,
+  0xf8, 0x00, 0x00, 0x07, 0xf1, 0x00, 0x7f, 0x40, 0x00, 0x07, 0xf1, 0x00, 0x0c, 0xe1, 0x00, 0x07,
+  0xf1, 0x00, 0x02, 0xea, 0x00, 0x00, 0x7d, 0xfd, 0xa2, 0x08, 0xd3, 0x03, 0xa4, 0x0e, 0x70, 0x00,
+  0x00, 0x0f, 0xb0, 0x00, 0x00, 0x09, 0xfe, 0x82, 0x00, 0x00, 0x7e, 0xff, 0xb1, 0x00, 0x00, 0x3a,
+  0xfa, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00, 0xab, 0x4f, 0x61, 0x06, 0xf3, 0x06, 0xcf, 0xfc,
+  0x30, 0xcf, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00,
+  0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00,
+  0x01, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x01,
+  0xf8, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x0b, 0xd0, 0x00, 0x00, 0x2f, 0x60, 0x0b, 0xd0,
+  0x00, 0x00, 0x2f, 0x60, 0x0b, 0xd0, 0x00, 0x00, 0x2f, 0x60, 0x0b, 0xd0, 0x00, 0x00, 0x2f, 0x60,
+  0x0b, 0xd0, 0x00, 0x00, 0x2f, 0x60, 0x0b, 0xd0, 0x00, 0x00, 0x2f, 0x60, 0x0b, 0xd0, 0x00, 0x00,
+  0x2f, 0x60, 0x09, 0xe0, 0x00, 0x00, 0x4f, 0x40, 0x05, 0xf4, 0x00, 0x00, 0x9f, 0x00, 0x00, 0xae,
+  0x51, 0x17, 0xf6, 0x00, 0x00, 0x06, 0xdf, 0xfb, 0x30, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x1e, 0x90,
+  0x4f, 0x40, 0x00, 0x00, 0x7f, 0x20, 0x0d, 0xb0, 0x00, 0x00, 0xdb, 0x00, 0x07, 0xf2, 0x00, 0x04,
+  0xf5, 0x00, 0x01, 0xf8, 0x00, 0x0b, 0xe0, 0x00, 0x00, 0x9e, 0x00, 0x1f, 0x70, 0x00, 0x00, 0x2f,
+  0x60, 0x8f, 0x10, 0x00, 0x00, 0x0c, 0xd0, 0xea, 0x00, 0x00, 0x00, 0x05, 0xf8, 0xf3, 0x00, 0x00,
+  0x00, 0x00, 0xef, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x50, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x08,
+  0xe0, 0x00, 0x00, 0x8f, 0x00, 0x6f, 0x40, 0x00, 0x0e, 0xf5, 0x00, 0x00, 0xeb, 0x00, 0x1f, 0x90,
+  0x00, 0x4f, 0xcb, 0x00, 0x03, 0xf5, 0x00, 0x0c, 0xe0, 0x00, 0xab, 0x6f, 0x10, 0x08, 0xf1, 0x00,
+  0x06, 0xf3, 0x00, 0xf5, 0x1f, 0x60, 0x0d, 0xb0, 0x00, 0x01, 0xf8, 0x05, 0xf0, 0x0b, 0xb0, 0x2f,
+  0x60, 0x00, 0x00, 0xcd, 0x0b, 0xa0, 0x05, 0xf1, 0x7f, 0x10, 0x00, 0x00, 0x7f, 0x3f, 0x40, 0x00,
+  0xf7, 0xcb, 0x00, 0x00, 0x00, 0x2f, 0xce, 0x00, 0x00, 0xad, 0xf6, 0x00, 0x00, 0x00, 0x0c, 0xf9,
+  0x00, 0x00, 0x4f, 0xf1, 0x00, 0x00, 0x00, 0x07, 0xf4, 0x00, 0x00, 0x0e, 0xc0, 0x00, 0x00, 0x6f,
+  0x60, 0x00, 0x01, 0xea, 0x00, 0x0a, 0xe1, 0x00, 0x0a, 0xe1, 0x00, 0x01, 0xeb, 0x00, 0x5f, 0x30,
+  0x00, 0x00, 0x4f, 0x51, 0xe8, 0x00, 0x00, 0x00, 0x08, 0xeb, 0xc0, 0x00, 0x00, 0x00, 0x02, 0xff,
+  0x60, 0x00, 0x00, 0x00, 0x0b, 0xc8, 0xf1, 0x00, 0x00, 0x00, 0x7f, 0x20, 0xdb, 0x00, 0x00, 0x02,
+  0xf7, 0x00, 0x3f, 0x60, 0x00, 0x0d, 0xc0, 0x00, 0x09, 0xf2, 0x00, 0x8f, 0x20, 0x00, 0x00, 0xdc,
+  0x00, 0x9e, 0x10, 0x00, 0x01, 0xeb, 0x00, 0x1e, 0xa0, 0x00, 0x09, 0xf1, 0x00, 0x05, 0xf4, 0x00,
+  0x3f, 0x60, 0x00, 0x00, 0xbd, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x2f, 0x76, 0xf2, 0x00, 0x00, 0x00,
+  0x07, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd,
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x1e, 0xd0, 0x00, 0x00, 0x00,
+  0xbf, 0x30, 0x00, 0x00, 0x07, 0xf6, 0x00, 0x00, 0x00, 0x3f, 0xb0, 0x00, 0x00, 0x00, 0xde, 0x10,
+  0x00, 0x00, 0x0a, 0xf4, 0x00, 0x00, 0x00, 0x6f, 0x80, 0x00, 0x00, 0x02, 0xfc, 0x00, 0x00, 0x00,
+  0x0c, 0xf2, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xf4, 0x0d, 0xff, 0x00, 0x0d, 0x50, 0x00,
+  0x0d, 0x50, 0x00, 0x0d, 0x50, 0x00, 0x0d, 0x50, 0x00, 0x0d, 0x50, 0x00, 0x0d, 0x50, 0x00, 0x0d,
+  0x50, 0x00, 0x0d, 0x50, 0x00, 0x0d, 0x50, 0x00, 0x0d, 0x50, 0x00, 0x0d, 0x50, 0x00, 0x0d, 0x50,
+  0x00, 0x0d, 0xff, 0x00, 0x0d, 0x20, 0x00, 0x00, 0x08, 0x90, 0x00, 0x00, 0x02, 0xf1, 0x00, 0x00,
+  0x00, 0xb7, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x0d, 0x40, 0x00, 0x00, 0x07, 0xb0, 0x00,
+  0x00, 0x01, 0xf2, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x0c, 0x60,
+  0x00, 0x00, 0x04, 0xc0, 0x3f, 0xfa, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00,
+  0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00,
+  0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x3f, 0xfa, 0x00, 0x00, 0x02,
+  0xf5, 0x00, 0x00, 0x00, 0x0b, 0xdd, 0x00, 0x00, 0x00, 0x4f, 0x1c, 0x70, 0x00, 0x00, 0xd7, 0x03,
+  0xf1, 0x00, 0x07, 0xd0, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x40, 0x3e, 0x60, 0x00,
+  0x03, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xae,
+  0xfb, 0x20, 0x0a, 0x91, 0x1c, 0xc0, 0x00, 0x00, 0x05, 0xf0, 0x00, 0x00, 0x04, 0xf2, 0x02, 0x9d,
+  0xff, 0xf2, 0x1f, 0x93, 0x04, 0xf2, 0x2f, 0x50, 0x2a, 0xf2, 0x08, 0xef, 0xb3, 0xf2, 0x0c, 0xa0,
+  0x00, 0x00, 0x00, 0x0c, 0xa0, 0x00, 0x00, 0x00, 0x0c, 0xa0, 0x00, 0x00, 0x00, 0x0c, 0xa6, 0xef,
+  0xb2, 0x00, 0x0c, 0xf7, 0x02, 0xdc, 0x00, 0x0c, 0xa0, 0x00, 0x5f, 0x20, 0x0c, 0xa0, 0x00, 0x2f,
+  0x50, 0x0c, 0xa0, 0x00, 0x2f, 0x40, 0x0c, 0xa0, 0x00, 0x6f, 0x10, 0x0c, 0xe4, 0x04, 0xe9, 0x00,
+  0x0c, 0x8a, 0xfe, 0x80, 0x00, 0x00, 0x8e, 0xfd, 0x60, 0x09, 0xe4, 0x03, 0x70, 0x2f, 0x50, 0x00,
+  0x00, 0x5f, 0x20, 0x00, 0x00, 0x5f, 0x10, 0x00, 0x00, 0x2f, 0x50, 0x00, 0x00, 0x0a, 0xe3, 0x04,
+  0xa0, 0x00, 0x8e, 0xfc, 0x50, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00,
+  0x00, 0x00, 0xbb, 0x00, 0x00, 0x9e, 0xea, 0xcb, 0x00, 0x0a, 0xd3, 0x04, 0xeb, 0x00, 0x2f, 0x50,
+  0x00, 0xbb, 0x00, 0x5f, 0x10, 0x00, 0xbb, 0x00, 0x5f, 0x10, 0x00, 0xbb, 0x00, 0x3f, 0x30, 0x00,
+  0xbb, 0x00, 0x0d, 0xc1, 0x07, 0xfb, 0x00, 0x02, 0xbf, 0xe6, 0x8b, 0x00, 0x00, 0x7e, 0xfc, 0x40,
+  0x0a, 0xc2, 0x05, 0xf2, 0x2f, 0x30, 0x00, 0xa9, 0x5f, 0xff, 0xff, 0xfa, 0x5f, 0x10, 0x00, 0x00,
+  0x2f, 0x50, 0x00, 0x00, 0x09, 0xe4, 0x02, 0x84, 0x00, 0x7e, 0xfe, 0x91, 0x00, 0x7e, 0xf3, 0x05,
+  0xf4, 0x00, 0x08, 0xe0, 0x00, 0xbf, 0xff, 0xf3, 0x08, 0xe0, 0x00, 0x08, 0xe0, 0x00, 0x08, 0xe0,
+  0x00, 0x08, 0xe0, 0x00, 0x08, 0xe0, 0x00, 0x08, 0xe0, 0x00, 0x08, 0xe0, 0x00, 0x02, 0xbf, 0xff,
+  0xfe, 0x0e, 0x90, 0x1b, 0xd3, 0x2f, 0x20, 0x06, 0xe0, 0x0e, 0x91, 0x1c, 0xa0, 0x03, 0xff, 0xea,
+  0x10, 0x0b, 0x60, 0x00, 0x00, 0x0d, 0x90, 0x00, 0x00, 0x08, 0xff, 0xff, 0xc3, 0x5c, 0x10, 0x01,
+  0xca, 0x7e, 0x30, 0x04, 0xe6, 0x08, 0xdf, 0xec, 0x50, 0x0d, 0x90, 0x00, 0x00, 0x00, 0x0d, 0x90,
+  0x00, 0x00, 0x00, 0x0d, 0x90, 0x00, 0x00, 0x00, 0x0d, 0x97, 0xee, 0xa0, 0x00, 0x0d, 0xf7, 0x02,
+  0xe9, 0x00, 0x0d, 0x90, 0x00, 0x9d, 0x00, 0x0d, 0x90, 0x00, 0x8e, 0x00, 0x0d, 0x90, 0x00, 0x8e,
+  0x00, 0x0d, 0x90, 0x00, 0x8e, 0x00, 0x0d, 0x90, 0x00, 0x8e, 0x00, 0x0d, 0x90, 0x00, 0x8e, 0x00,
+  0x0b, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0,
+  0x0a, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xac, 0x00, 0x00, 0xac, 0x00, 0x00, 0xac, 0x00, 0x00, 0xac, 0x00, 0x00, 0xac, 0x00, 0x00, 0xac,
+  0x00, 0x00, 0xac, 0x00, 0x00, 0xac, 0x00, 0x00, 0xab, 0x00, 0x01, 0xd9, 0x00, 0x5f, 0xc1, 0x00,
+  0x0c, 0xa0, 0x00, 0x00, 0x00, 0x0c, 0xa0, 0x00, 0x00, 0x00, 0x0c, 0xa0, 0x00, 0x00, 0x00, 0x0c,
+  0xa0, 0x03, 0xe6, 0x00, 0x0c, 0xa0, 0x3f, 0x60, 0x00, 0x0c, 0xa3, 0xf6, 0x00, 0x00, 0x0c, 0xff,
+  0xc0, 0x00, 0x00, 0x0c, 0xa3, 0xf6, 0x00, 0x00, 0x0c, 0xa0, 0x6f, 0x30, 0x00, 0x0c, 0xa0, 0x0a,
+  0xe1, 0x00, 0x0c, 0xa0, 0x00, 0xcb, 0x00, 0x0a, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x0a,
+  0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x0d, 0x69, 0xfd,
+  0x34, 0xdf, 0xc2, 0x00, 0x0d, 0xe5, 0x08, 0xdc, 0x21, 0xbd, 0x00, 0x0d, 0x90, 0x01, 0xf6, 0x00,
+  0x5f, 0x10, 0x0d, 0x90, 0x01, 0xf5, 0x00, 0x4f, 0x20, 0x0d, 0x90, 0x01, 0xf5, 0x00, 0x4f, 0x20,
+  0x0d, 0x90, 0x01, 0xf5, 0x00, 0x4f, 0x20, 0x0d, 0x90, 0x01, 0xf5, 0x00, 0x4f, 0x20, 0x0d, 0x90,
+  0x01, 0xf5, 0x00, 0x4f, 0x20, 0x0d, 0x67, 0xee, 0xa0, 0x00, 0x0d, 0xe7, 0x02, 0xe9, 0x00, 0x0d,
+  0x90, 0x00, 0x9d, 0x00, 0x0d, 0x90, 0x00, 0x8e, 0x00, 0x0d, 0x90, 0x00, 0x8e, 0x00, 0x0d, 0x90,
+  0x00, 0x8e, 0x00, 0x0d, 0x90, 0x00, 0x8e, 0x00, 0x0d, 0x90, 0x00, 0x8e, 0x00, 0x00, 0x7e, 0xfd,
+  0x60, 0x00, 0x09, 0xd3, 0x04, 0xe8, 0x00, 0x2f, 0x40, 0x00, 0x7f, 0x10, 0x6f, 0x10, 0x00, 0x3f,
+  0x40, 0x6f, 0x10, 0x00, 0x3f, 0x40, 0x2f, 0x40, 0x00, 0x7f, 0x10, 0x0a, 0xd3, 0x04, 0xe8, 0x00,
+  0x00, 0x7e, 0xfd, 0x60, 0x00, 0x0d, 0x67, 0xef, 0xa1, 0x00, 0x0d, 0xe6, 0x02, 0xdb, 0x00, 0x0d,
+  0x90, 0x00, 0x5f, 0x10, 0x0d, 0x90, 0x00, 0x3f, 0x40, 0x0d, 0x90, 0x00, 0x3f, 0x30, 0x0d, 0x90,
+  0x00, 0x7f, 0x10, 0x0d, 0xe3, 0x04, 0xe8, 0x00, 0x0d, 0xbb, 0xfe, 0x80, 0x00, 0x0d, 0x90, 0x00,
+  0x00, 0x00, 0x0d, 0x90, 0x00, 0x00, 0x00, 0x0d, 0x90, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xea, 0x9b,
+  0x00, 0x0a, 0xd3, 0x04, 0xeb, 0x00, 0x2f, 0x50, 0x00, 0xbb, 0x00, 0x5f, 0x10, 0x00, 0xbb, 0x00,
+  0x5f, 0x10, 0x00, 0xbb, 0x00, 0x3f, 0x30, 0x00, 0xbb, 0x00, 0x0d, 0xc1, 0x07, 0xfb, 0x00, 0x02,
+  0xbf, 0xe6, 0xbb, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00,
+  0x00, 0xbb, 0x00, 0x0d, 0x69, 0xee, 0x00, 0x0d, 0xf7, 0x00, 0x00, 0x0d, 0xb0, 0x00, 0x00, 0x0d,
+  0x90, 0x00, 0x00, 0x0d, 0x90, 0x00, 0x00, 0x0d, 0x90, 0x00, 0x00, 0x0d, 0x90, 0x00, 0x00, 0x0d,
+  0x90, 0x00, 0x00, 0x04, 0xcf, 0xd7, 0x00, 0x1f, 0x60, 0x26, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x0b,
+  0xfb, 0x60, 0x00, 0x00, 0x38, 0xed, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x28, 0x20, 0x7e, 0x00, 0x19,
+  0xef, 0xc3, 0x00, 0x00, 0x70, 0x00, 0x01, 0xf1, 0x00, 0x03, 0xf1, 0x00, 0x8f, 0xff, 0xf6, 0x06,
+  0xf1, 0x00, 0x06, 0xf1, 0x00, 0x06, 0xf1, 0x00, 0x06, 0xf1, 0x00, 0x05, 0xf1, 0x00, 0x04, 0xf4,
+  0x21, 0x00, 0xaf, 0xd4, 0x0f, 0x60, 0x00, 0xbb, 0x00, 0x0f, 0x60, 0x00, 0xbb, 0x00, 0x0f, 0x60,
+  0x00, 0xbb, 0x00, 0x0f, 0x60, 0x00, 0xbb, 0x00, 0x0f, 0x60, 0x00, 0xbb, 0x00, 0x0f, 0x70, 0x00,
+  0xbb, 0x00, 0x0b, 0xd2, 0x07, 0xfb, 0x00, 0x01, 0xbf, 0xe7, 0x8b, 0x00, 0xac, 0x00, 0x00, 0x8d,
+  0x00, 0x3f, 0x30, 0x00, 0xf6, 0x00, 0x0d, 0xa0, 0x06, 0xf0, 0x00, 0x06, 0xf1, 0x0c, 0x90, 0x00,
+  0x00, 0xf6, 0x3f, 0x20, 0x00, 0x00, 0x9d, 0x9c, 0x00, 0x00, 0x00, 0x2f, 0xe5, 0x00, 0x00, 0x00,
+  0x0c, 0xe0, 0x00, 0x00, 0xbb, 0x00, 0x09, 0xe0, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x0e, 0xf4, 0x00,
+  0xba, 0x00, 0x1f, 0x50, 0x4e, 0xa9, 0x00, 0xf5, 0x00, 0x0b, 0xa0, 0x99, 0x5e, 0x05, 0xf0, 0x00,
+  0x06, 0xe0, 0xe3, 0x0f, 0x3a, 0xa0, 0x00, 0x01, 0xf7, 0xe0, 0x0a, 0x9e, 0x50, 0x00, 0x00, 0xcf,
+  0x80, 0x04, 0xff, 0x00, 0x00, 0x00, 0x6f, 0x30, 0x00, 0xeb, 0x00, 0x00, 0x5f, 0x40, 0x02, 0xf5,
+  0x0a, 0xe0, 0x0c, 0xa0, 0x00, 0xe9, 0x7e, 0x10, 0x00, 0x4f, 0xf4, 0x00, 0x00, 0x5f, 0xf6, 0x00,
+  0x01, 0xe7, 0x7f, 0x20, 0x0b, 0xc0, 0x0c, 0xc0, 0x6e, 0x20, 0x02, 0xf7, 0xad, 0x00, 0x00, 0x8d,
+  0x00, 0x3f, 0x40, 0x00, 0xe6, 0x00, 0x0d, 0xb0, 0x06, 0xf0, 0x00, 0x06, 0xf1, 0x0c, 0x90, 0x00,
+  0x00, 0xe8, 0x2f, 0x20, 0x00, 0x00, 0x8e, 0x9b, 0x00, 0x00, 0x00, 0x1f, 0xf4, 0x00, 0x00, 0x00,
+  0x0a, 0xd0, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x00, 0x00, 0x00, 0x5f, 0x10, 0x00, 0x00, 0x00, 0xc9,
+  0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0x50, 0x00, 0x01, 0xe9, 0x00, 0x00,
+  0x0b, 0xd0, 0x00, 0x00, 0x7f, 0x20, 0x00, 0x03, 0xf5, 0x00, 0x00, 0x1e, 0x90, 0x00, 0x00, 0x6f,
+  0xff, 0xff, 0xa0, 0x02, 0xcf, 0x10, 0x0c, 0x90, 0x00, 0x0e, 0x40, 0x00, 0x0c, 0x60, 0x00, 0x09,
+  0x90, 0x00, 0x0b, 0x80, 0x00, 0xad, 0x10, 0x00, 0x0c, 0x70, 0x00, 0x09, 0xa0, 0x00, 0x0b, 0x80,
+  0x00, 0x0d, 0x50, 0x00, 0x0e, 0x40, 0x00, 0x0b, 0xa0, 0x00, 0x02, 0xbf, 0x10, 0x02, 0xf0, 0x00,
+  0x02, 0xf0, 0x00, 0x02, 0xf0, 0x00, 0x02, 0xf0, 0x00, 0x02, 0xf0, 0x00, 0x02, 0xf0, 0x00, 0x02,
+  0xf0, 0x00, 0x02, 0xf0, 0x00, 0x02, 0xf0, 0x00, 0x02, 0xf0, 0x00, 0x02, 0xf0, 0x00, 0x02, 0xf0,
+  0x00, 0x02, 0xf0, 0x00, 0x02, 0xf0, 0x00, 0x02, 0xf0, 0x00, 0x4f, 0xa1, 0x00, 0x01, 0xc9, 0x00,
+  0x00, 0x8b, 0x00, 0x00, 0xa9, 0x00, 0x00, 0xc6, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x3f, 0x70, 0x00,
+  0xb9, 0x00, 0x00, 0xd6, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x8b, 0x00, 0x01, 0xc8,
+  0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x20, 0x04, 0xde, 0x92, 0x2f, 0x20, 0x0e, 0x61,
+  0x7d, 0xe7, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const GlyphInfo font_sans_16_glyphs[] PROGMEM = {
+  {     0,  3,  0,   0,  16,  3 },  // ' '
+  {     0,  5, 11,   0,   5,  5 },  // '!'
+  {    33,  6, 11,   0,   5,  6 },  // '"'
+  {    66,  9, 11,   0,   5,  9 },  // '#'
+  {   121,  9, 15,   0,   3,  9 },  // '$'
+  {   196, 13, 11,   0,   5, 13 },  // '%'
+  {   273, 12, 11,   0,   5, 11 },  // '&'
+  {   339,  4, 11,   0,   5,  4 },  // '''
+  {   361,  5, 16,   0,   3,  5 },  // '('
+  {   409,  5, 16,   0,   3,  5 },  // ')'
+  {   457,  6, 11,   0,   5,  6 },  // '*'
+  {   490,  9,  9,   0,   7,  9 },  // '+'
+  {   535,  3,  4,   0,  15,  3 },  // ','
+  {   543,  6,  5,   0,  11,  6 },  // '-'
+  {   558,  3,  1,   0,  15,  3 },  // '.'
+  {   560,  8, 12,  -1,   5,  6 },  // '/'
+  {   608,  9, 11,   0,   5,  9 },  // '0'
+  {   663,  9, 11,   0,   5,  9 },  // '1'
+  {   718,  9, 11,   0,   5,  9 },  // '2'
+  {   773,  9, 11,   0,   5,  9 },  // '3'
+  {   828,  9, 11,   0,   5,  9 },  // '4'
+  {   883,  9, 11,   0,   5,  9 },  // '5'
+  {   938,  9, 11,   0,   5,  9 },  // '6'
+  {   993,  9, 11,   0,   5,  9 },  // '7'
+  {  1048,  9, 11,   0,   5,  9 },  // '8'
+  {  1103,  9, 11,   0,   5,  9 },  // '9'
+  {  1158,  4,  8,   0,   8,  4 },  // ':'
+  {  1174,  4, 11,   0,   8,  4 },  // ';'
+  {  1196,  9,  9,   0,   7,  9 },  // '<'
+  {  1241,  9,  7,   0,   9,  9 },  // '='
+  {  1276,  9,  9,   0,   7,  9 },  // '>'
+  {  1321,  7, 11,   0,   5,  6 },  // '?'
+  {  1365, 13, 12,   0,   6, 13 },  // '@'
+  {  1449, 11, 11,   0,   5, 11 },  // 'A'
+  {  1515, 10, 11,   0,   5, 10 },  // 'B'
+  {  1570, 11, 11,   0,   5, 11 },  // 'C'
+  {  1636, 12, 11,   0,   5, 12 },  // 'D'
+  {  1702,  9, 11,   0,   5,  9 },  // 'E'
+  {  1757,  9, 11,   0,   5,  9 },  // 'F'
+  {  1812, 12, 11,   0,   5, 12 },  // 'G'
+  {  1878, 12, 11,   0,   5, 12 },  // 'H'
+  {  1944,  5, 11,   0,   5,  5 },  // 'I'
+  {  1977,  7, 11,   0,   5,  7 },  // 'J'
+  {  2021, 11, 11,   0,   5, 11 },  // 'K'
+  {  2087,  8, 11,   0,   5,  8 },  // 'L'
+  {  2131, 15, 11,   0,   5, 15 },  // 'M'
+  {  2219, 12, 11,   0,   5, 12 },  // 'N'
+  {  2285, 13, 11,   0,   5, 13 },  // 'O'
+  {  2362, 10, 11,   0,   5, 10 },  // 'P'
+  {  2417, 13, 14,   0,   5, 13 },  // 'Q'
+  {  2515, 11, 11,   0,   5, 10 },  // 'R'
+  {  2581,  8, 11,   0,   5,  8 },  // 'S'
+  {  2625, 10, 11,   0,   5,  9 },  // 'T'
+  {  2680, 12, 11,   0,   5, 12 },  // 'U'
+  {  2746, 11, 11,   0,   5, 11 },  // 'V'
+  {  2812, 17, 11,   0,   5, 16 },  // 'W'
+  {  2911, 11, 11,   0,   5, 10 },  // 'X'
+  {  2977, 11, 11,   0,   5, 10 },  // 'Y'
+  {  3043, 10, 11,   0,   5, 10 },  // 'Z'
+  {  3098,  5, 14,   0,   4,  5 },  // '['
+  {  3140,  8, 12,  -1,   5,  6 },  // 'backslash'
+  {  3188,  5, 14,   0,   4,  5 },  // ']'
+  {  3230,  9, 11,   0,   5,  9 },  // '^'
+  {  3285,  7,  2,   0,  16,  6 },  // '_'
+  {  3293,  5, 11,   0,   5,  5 },  // '`'
+  {  3326,  8,  8,   0,   8,  8 },  // 'a'
+  {  3358,  9, 11,   0,   5,  9 },  // 'b'
+  {  3413,  8,  8,   0,   8,  7 },  // 'c'
+  {  3445,  9, 11,   0,   5,  9 },  // 'd'
+  {  3500,  8,  8,   0,   8,  8 },  // 'e'
+  {  3532,  6, 11,   0,   5,  5 },  // 'f'
+  {  3565,  8, 11,   0,   8,  8 },  // 'g'
+  {  3609,  9, 11,   0,   5,  9 },  // 'h'
+  {  3664,  4, 11,   0,   5,  4 },  // 'i'
+  {  3686,  5, 14,  -1,   5,  4 },  // 'j'
+  {  3728,  9, 11,   0,   5,  8 },  // 'k'
+  {  3783,  4, 11,   0,   5,  4 },  // 'l'
+  {  3805, 13,  8,   0,   8, 13 },  // 'm'
+  {  3861,  9,  8,   0,   8,  9 },  // 'n'
+  {  3901,  9,  8,   0,   8,  9 },  // 'o'
+  {  3941,  9, 11,   0,   8,  9 },  // 'p'
+  {  3996,  9, 11,   0,   8,  9 },  // 'q'
+  {  4051,  7,  8,   0,   8,  6 },  // 'r'
+  {  4083,  7,  8,   0,   8,  7 },  // 's'
+  {  4115,  6, 11,   0,   5,  6 },  // 't'
+  {  4148,  9,  8,   0,   8,  9 },  // 'u'
+  {  4188,  9,  8,   0,   8,  8 },  // 'v'
+  {  4228, 13,  8,   0,   8, 12 },  // 'w'
+  {  4284,  8,  8,   0,   8,  8 },  // 'x'
+  {  4316,  9, 11,   0,   8,  8 },  // 'y'
+  {  4371,  7,  8,   0,   8,  7 },  // 'z'
+  {  4403,  5, 14,   0,   4,  5 },  // '{'
+  {  4445,  5, 15,   0,   4,  5 },  // '|'
+  {  4490,  5, 14,   0,   4,  5 },  // '}'
+  {  4532,  9,  7,   0,   9,  9 },  // '~'
+};
+
+const SmoothFont FONT_SANS_16 = {
+  font_sans_16_bitmap, font_sans_16_glyphs, 0x20, 0x7E, 20, 16, 320
+};
+
+static const uint8_t font_sans_24_bitmap[] PROGMEM = {
+  0x00, 0x0e, 0xf2, 0x00, 0x00, 0x0e, 0xf2, 0x00, 0x00, 0x0e, 0xf2, 0x00, 0x00, 0x0e, 0xf2, 0x00,
+  0x00, 0x0e, 0xf2, 0x00, 0x00, 0x0e, 0xf2, 0x00, 0x00, 0x0e, 0xf2, 0x00, 0x00, 0x0d, 0xf2, 0x00,
+  0x00, 0x0d, 0xf1, 0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00, 0x0a, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xe5, 0x00,
+  0x00, 0x2e, 0xe5, 0x00, 0x02, 0xfb, 0x03, 0xfb, 0x00, 0x02, 0xfb, 0x03, 0xfb, 0x00, 0x02, 0xfb,
+  0x03, 0xfb, 0x00, 0x02, 0xfa, 0x02, 0xfa, 0x00, 0x00, 0xf9, 0x01, 0xf9, 0x00, 0x00, 0xc5, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xe0, 0x02, 0xf7, 0x00,
+  0x00, 0x00, 0x1f, 0xb0, 0x05, 0xf7, 0x00, 0x00, 0x00, 0x4f, 0x70, 0x08, 0xf3, 0x00, 0x00, 0x00,
+  0x7f, 0x40, 0x0b, 0xf0, 0x00, 0x00, 0x00, 0xaf, 0x10, 0x0f, 0xd0, 0x00, 0x06, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xf3, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x02, 0xfa, 0x00, 0x6f, 0x50,
+  0x00, 0x00, 0x06, 0xf5, 0x00, 0xaf, 0x10, 0x00, 0x00, 0x0a, 0xf1, 0x00, 0xed, 0x00, 0x00, 0x4f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x1f, 0xa0,
+  0x06, 0xf6, 0x00, 0x00, 0x00, 0x5f, 0x70, 0x09, 0xf2, 0x00, 0x00, 0x00, 0x8f, 0x30, 0x0c, 0xf0,
+  0x00, 0x00, 0x00, 0xbf, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0xea, 0x00, 0x1f, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x5c, 0xff, 0xfb, 0x50, 0x00, 0x00, 0x0a, 0xff, 0xef, 0xef, 0xfb, 0x10, 0x00, 0x6f, 0xd3, 0x0f,
+  0x52, 0xac, 0x00, 0x00, 0xdf, 0x30, 0x1f, 0x40, 0x00, 0x00, 0x00, 0xff, 0x10, 0x2f, 0x30, 0x00,
+  0x00, 0x00, 0xef, 0x60, 0x3f, 0x20, 0x00, 0x00, 0x00, 0x8f, 0xf7, 0x5f, 0x10, 0x00, 0x00, 0x00,
+  0x0b, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00,
+  0x7e, 0xbf, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x03, 0xef, 0x70, 0x00, 0x00, 0x00, 0xab, 0x00,
+  0x7f, 0xa0, 0x00, 0x00, 0x00, 0xba, 0x00, 0x6f, 0xa0, 0x00, 0x40, 0x00, 0xc9, 0x00, 0xaf, 0x60,
+  0x07, 0xfc, 0x30, 0xd8, 0x08, 0xfe, 0x10, 0x02, 0xdf, 0xfe, 0xfe, 0xff, 0xf3, 0x00, 0x00, 0x06,
+  0xbf, 0xff, 0xd9, 0x10, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0x8f, 0x70, 0x00, 0x04, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x05, 0xfb, 0x00, 0x00, 0x0c, 0xf6,
+  0x03, 0xdf, 0x20, 0x00, 0x2e, 0xd1, 0x00, 0x00, 0x0f, 0xb0, 0x00, 0x5f, 0x60, 0x00, 0xcf, 0x30,
+  0x00, 0x00, 0x1f, 0x90, 0x00, 0x3f, 0x70, 0x09, 0xf6, 0x00, 0x00, 0x00, 0x0f, 0xb0, 0x00, 0x5f,
+  0x60, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x0c, 0xf5, 0x02, 0xdf, 0x12, 0xfd, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xff, 0xff, 0xf8, 0x0c, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xfe, 0x60, 0x9f, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfa, 0x01, 0x9e, 0xfc, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x2f, 0xd0, 0x0c, 0xff, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x30, 0x5f, 0xb1, 0x06,
+  0xfb, 0x00, 0x00, 0x00, 0x09, 0xf6, 0x00, 0x9f, 0x20, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x5f, 0xa0,
+  0x00, 0x9f, 0x20, 0x00, 0xcf, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x6f, 0xa1, 0x05, 0xfb, 0x00,
+  0x00, 0x0d, 0xf2, 0x00, 0x00, 0x0d, 0xff, 0xff, 0xf2, 0x00, 0x00, 0xaf, 0x50, 0x00, 0x00, 0x01,
+  0x9e, 0xfb, 0x30, 0x00, 0x00, 0x00, 0x06, 0xdf, 0xfb, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf,
+  0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0x51, 0x18, 0xfe, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0xf8, 0x00, 0x00, 0xbe, 0x20, 0x00, 0x00, 0x00, 0x0a, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xf9, 0xff,
+  0x60, 0x00, 0x0e, 0xc0, 0x00, 0x01, 0xef, 0x40, 0x3e, 0xf7, 0x00, 0x2f, 0xa0, 0x00, 0x09, 0xf8,
+  0x00, 0x02, 0xef, 0x90, 0x7f, 0x60, 0x00, 0x0e, 0xf3, 0x00, 0x00, 0x2e, 0xfa, 0xef, 0x10, 0x00,
+  0x0f, 0xf3, 0x00, 0x00, 0x02, 0xef, 0xf8, 0x00, 0x00, 0x0d, 0xfa, 0x00, 0x00, 0x00, 0x9f, 0xfa,
+  0x00, 0x00, 0x06, 0xff, 0xa2, 0x01, 0x5c, 0xfc, 0xdf, 0x80, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff,
+  0xa0, 0x2f, 0xf7, 0x00, 0x00, 0x05, 0xbf, 0xfd, 0x93, 0x00, 0x04, 0xff, 0x50, 0x02, 0xfb, 0x00,
+  0x02, 0xfb, 0x00, 0x02, 0xfb, 0x00, 0x02, 0xfa, 0x00, 0x00, 0xf9, 0x00, 0x00, 0xc5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0xbf, 0x10, 0x00, 0x04, 0xfb, 0x00, 0x00, 0x0c, 0xf3, 0x00,
+  0x00, 0x2f, 0xc0, 0x00, 0x00, 0x8f, 0x70, 0x00, 0x00, 0xcf, 0x20, 0x00, 0x00, 0xfe, 0x00, 0x00,
+  0x02, 0xfb, 0x00, 0x00, 0x04, 0xf9, 0x00, 0x00, 0x05, 0xf8, 0x00, 0x00, 0x06, 0xf7, 0x00, 0x00,
+  0x05, 0xf8, 0x00, 0x00, 0x04, 0xf9, 0x00, 0x00, 0x02, 0xfb, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00,
+  0x00, 0xcf, 0x20, 0x00, 0x00, 0x7f, 0x70, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0x0b, 0xf4, 0x00,
+  0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0xaf, 0x10, 0x00, 0x00, 0x12, 0x00, 0x03, 0x30, 0x00, 0x00,
+  0x0f, 0xc0, 0x00, 0x00, 0x0a, 0xf5, 0x00, 0x00, 0x02, 0xfc, 0x00, 0x00, 0x00, 0xbf, 0x20, 0x00,
+  0x00, 0x6f, 0x80, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0x0d, 0xf0, 0x00, 0x00, 0x0a, 0xf3, 0x00,
+  0x00, 0x08, 0xf4, 0x00, 0x00, 0x07, 0xf5, 0x00, 0x00, 0x07, 0xf6, 0x00, 0x00, 0x07, 0xf5, 0x00,
+  0x00, 0x08, 0xf4, 0x00, 0x00, 0x0b, 0xf3, 0x00, 0x00, 0x0e, 0xf0, 0x00, 0x00, 0x2f, 0xc0, 0x00,
+  0x00, 0x7f, 0x80, 0x00, 0x00, 0xcf, 0x20, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x0b, 0xf4, 0x00, 0x00,
+  0x0f, 0xb0, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x02, 0x10, 0xc4,
+  0x03, 0x00, 0x08, 0xe5, 0xb5, 0xae, 0x20, 0x00, 0x4d, 0xee, 0x91, 0x00, 0x00, 0x3c, 0xfe, 0x80,
+  0x00, 0x08, 0xe6, 0xb6, 0xae, 0x20, 0x03, 0x10, 0xc4, 0x04, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00,
+  0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00,
+  0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xf9, 0x00, 0x09, 0xff, 0x00, 0x00, 0x7c, 0x00, 0x01, 0xe4, 0x00, 0x09, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x0c, 0xff, 0xff, 0xf2, 0x0c, 0xff, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0xfb, 0x00, 0x0a, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xa0, 0x00, 0x00,
+  0x00, 0x00, 0x8f, 0x30, 0x00, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0x00, 0x05, 0xf6, 0x00,
+  0x00, 0x00, 0x00, 0x0c, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x9f,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x06, 0xf4, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x70, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x10, 0x00, 0x00,
+  0x00, 0x01, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xa0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xc6, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xff, 0xc0,
+  0x00, 0x00, 0xbf, 0xe5, 0x01, 0x6e, 0xfa, 0x00, 0x04, 0xff, 0x20, 0x00, 0x03, 0xff, 0x30, 0x0b,
+  0xf9, 0x00, 0x00, 0x00, 0xbf, 0x90, 0x0f, 0xf4, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0x2f, 0xf0, 0x00,
+  0x00, 0x00, 0x2f, 0xf1, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x1f, 0xf2, 0x4f, 0xe0, 0x00, 0x00, 0x00,
+  0x0f, 0xf3, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x1f, 0xf2, 0x2f, 0xf0, 0x00, 0x00, 0x00, 0x2f, 0xf1,
+  0x0f, 0xf4, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0x0b, 0xf9, 0x00, 0x00, 0x00, 0xbf, 0xa0, 0x05, 0xff,
+  0x20, 0x00, 0x03, 0xff, 0x30, 0x00, 0xcf, 0xe5, 0x01, 0x6e, 0xfa, 0x00, 0x00, 0x1d, 0xff, 0xff,
+  0xff, 0xc0, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xf4, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xf4, 0x00, 0x00, 0x00,
+  0x0a, 0xff, 0x4d, 0xf4, 0x00, 0x00, 0x00, 0x5f, 0xd2, 0x0d, 0xf4, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0x0d, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0d, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0d, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
+  0xf4, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x09, 0xff, 0xff, 0xff, 0xff,
+  0xa0, 0x00, 0x00, 0x6c, 0xff, 0xd8, 0x10, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00,
+  0x9f, 0xe6, 0x11, 0x5d, 0xfd, 0x00, 0x01, 0xff, 0x30, 0x00, 0x03, 0xff, 0x30, 0x04, 0xfb, 0x00,
+  0x00, 0x00, 0xef, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xd0, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0xfe, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xe2, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xfe, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x6f, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xee, 0xff, 0xff, 0xff,
+  0x90, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x5b, 0xef, 0xea, 0x20, 0x00, 0x00,
+  0x0a, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x7f, 0xf7, 0x10, 0x3b, 0xff, 0x10, 0x00, 0xef, 0x50,
+  0x00, 0x00, 0xdf, 0x60, 0x00, 0x98, 0x00, 0x00, 0x00, 0xaf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xef, 0x20, 0x00, 0x00, 0x00, 0x01, 0x4c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xfe, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0xbf, 0xff, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4a, 0xff, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xc0, 0x06, 0xe6, 0x00, 0x00,
+  0x00, 0x6f, 0xc0, 0x05, 0xfe, 0x10, 0x00, 0x00, 0xdf, 0x80, 0x00, 0xcf, 0xd5, 0x00, 0x3c, 0xff,
+  0x10, 0x00, 0x2e, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x01, 0x8d, 0xff, 0xd9, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x6f, 0xd0, 0x00, 0x00, 0x00, 0x07, 0xfa, 0x0f,
+  0xd0, 0x00, 0x00, 0x00, 0x3f, 0xd0, 0x0f, 0xd0, 0x00, 0x00, 0x00, 0xdf, 0x20, 0x0f, 0xd0, 0x00,
+  0x00, 0x0a, 0xf6, 0x00, 0x0f, 0xd0, 0x00, 0x00, 0x6f, 0xa0, 0x00, 0x0f, 0xd0, 0x00, 0x02, 0xfd,
+  0x00, 0x00, 0x0f, 0xd0, 0x00, 0x0d, 0xf3, 0x00, 0x00, 0x0f, 0xd0, 0x00, 0x6f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xf7, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xd0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xd0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xd0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x0a, 0xff,
+  0xff, 0xff, 0xf7, 0x00, 0x00, 0x0d, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8f, 0xde, 0xff, 0xc6, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x36,
+  0x31, 0x02, 0x8f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xfc, 0x00, 0x04, 0xfb, 0x41, 0x03, 0xbf, 0xf3, 0x00, 0x03,
+  0xef, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x07, 0xcf, 0xfd, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xb0,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xe1, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xef, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xfa, 0xcf, 0xeb, 0x40, 0x00, 0x00, 0x7f,
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0xef, 0xe5, 0x01, 0x4c, 0xff, 0x30, 0x06, 0xfe, 0x10, 0x00,
+  0x00, 0xdf, 0x90, 0x09, 0xf8, 0x00, 0x00, 0x00, 0x6f, 0xd0, 0x0a, 0xf6, 0x00, 0x00, 0x00, 0x4f,
+  0xd0, 0x09, 0xf8, 0x00, 0x00, 0x00, 0x6f, 0xb0, 0x05, 0xfe, 0x10, 0x00, 0x01, 0xef, 0x60, 0x00,
+  0xdf, 0xd4, 0x10, 0x4d, 0xfd, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xff, 0xd2, 0x00, 0x00, 0x01, 0x8d,
+  0xff, 0xc7, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x09, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xaf, 0x70, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+  0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xf7, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x70, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8d, 0xff, 0xc7,
+  0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xff, 0xd1, 0x00, 0x00, 0xcf, 0xd4, 0x11, 0x5e, 0xfb, 0x00,
+  0x02, 0xff, 0x10, 0x00, 0x03, 0xff, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0xff, 0x10, 0x00, 0xff,
+  0x10, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x8f, 0xd4, 0x11, 0x5d, 0xf6, 0x00, 0x00, 0x06, 0xef, 0xff,
+  0xfd, 0x50, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff, 0x90, 0x00, 0x01, 0xef, 0xb3, 0x01, 0x4c, 0xfd,
+  0x00, 0x08, 0xfc, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x0c, 0xf6, 0x00, 0x00, 0x00, 0x8f, 0xa0, 0x0c,
+  0xf7, 0x00, 0x00, 0x00, 0x9f, 0xb0, 0x0a, 0xfc, 0x00, 0x00, 0x00, 0xdf, 0x80, 0x03, 0xff, 0xb3,
+  0x01, 0x4c, 0xff, 0x20, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x03, 0x9d, 0xff, 0xd9,
+  0x20, 0x00, 0x00, 0x00, 0x4a, 0xef, 0xea, 0x30, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xf6, 0x00,
+  0x00, 0x6f, 0xf8, 0x20, 0x29, 0xff, 0x20, 0x00, 0xef, 0x60, 0x00, 0x00, 0x9f, 0x90, 0x02, 0xff,
+  0x00, 0x00, 0x00, 0x2f, 0xd0, 0x03, 0xff, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x01, 0xff, 0x50, 0x00,
+  0x00, 0x9f, 0xd0, 0x00, 0xbf, 0xe6, 0x10, 0x3a, 0xff, 0x90, 0x00, 0x1e, 0xff, 0xff, 0xff, 0xff,
+  0x30, 0x00, 0x01, 0x9e, 0xfe, 0x9c, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xe1, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf7, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xef, 0xa0, 0x00, 0x00, 0x00, 0x03, 0xee, 0x40, 0x03, 0xee, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xee, 0x40, 0x03, 0xee, 0x40, 0x03, 0xee, 0x40,
+  0x03, 0xee, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xee, 0x20, 0x02, 0xef,
+  0x70, 0x00, 0x0f, 0x40, 0x00, 0x9c, 0x00, 0x02, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x07, 0xef,
+  0xd0, 0x00, 0x00, 0x00, 0x07, 0xef, 0xd6, 0x00, 0x00, 0x00, 0x06, 0xef, 0xe6, 0x00, 0x00, 0x00,
+  0x02, 0xdf, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xf8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0xcf, 0xf8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0xdf, 0xf8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xdf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x10, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2e, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xfe, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6e, 0xfe, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xfd, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7e, 0xfd, 0x10, 0x00, 0x00, 0x00, 0x01, 0x9f, 0xfb, 0x00, 0x00, 0x00, 0x01,
+  0x9f, 0xfb, 0x30, 0x00, 0x00, 0x01, 0x9f, 0xfc, 0x40, 0x00, 0x00, 0x00, 0x1f, 0xfc, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x2d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d,
+  0xfe, 0xa2, 0x00, 0x2e, 0xff, 0xff, 0xff, 0x30, 0x4f, 0x82, 0x03, 0xcf, 0xc0, 0x01, 0x00, 0x00,
+  0x1f, 0xf1, 0x00, 0x00, 0x00, 0x0e, 0xf1, 0x00, 0x00, 0x00, 0x2f, 0xd0, 0x00, 0x00, 0x00, 0xcf,
+  0x50, 0x00, 0x00, 0x2d, 0xf7, 0x00, 0x00, 0x02, 0xef, 0x50, 0x00, 0x00, 0x08, 0xf6, 0x00, 0x00,
+  0x00, 0x08, 0xf2, 0x00, 0x00, 0x00, 0x05, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xf6, 0x00, 0x00, 0x00, 0x1d,
+  0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xcf, 0xfd, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xff, 0xff, 0xff, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xe8, 0x31, 0x01, 0x48, 0xef, 0x80,
+  0x00, 0x00, 0x0c, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xf6, 0x00, 0x00, 0x9f, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xce, 0x00, 0x02, 0xfb, 0x00, 0x00, 0x29, 0xdf, 0xea, 0x10, 0x3f, 0x50, 0x08,
+  0xf3, 0x00, 0x06, 0xff, 0xff, 0xff, 0x10, 0x0e, 0x90, 0x0c, 0xe0, 0x00, 0x4f, 0xf7, 0x10, 0xbc,
+  0x00, 0x0c, 0xb0, 0x0e, 0xb0, 0x00, 0xdf, 0x30, 0x00, 0xf7, 0x00, 0x0d, 0xb0, 0x0f, 0xa0, 0x02,
+  0xf8, 0x00, 0x05, 0xf2, 0x00, 0x0f, 0x90, 0x0e, 0xb0, 0x05, 0xf5, 0x00, 0x0c, 0xf0, 0x00, 0x7f,
+  0x50, 0x0c, 0xd0, 0x04, 0xfb, 0x11, 0x9f, 0xf4, 0x06, 0xfd, 0x00, 0x08, 0xf3, 0x00, 0xef, 0xff,
+  0xf3, 0xff, 0xff, 0xf3, 0x00, 0x02, 0xfb, 0x00, 0x3c, 0xfc, 0x30, 0x5e, 0xfa, 0x20, 0x00, 0x00,
+  0xaf, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xf9, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x02, 0xef, 0xe8, 0x41, 0x00, 0x13, 0x7c, 0xf4, 0x00, 0x00, 0x00, 0x1a,
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x00, 0x00, 0x00, 0x00, 0x27, 0xce, 0xff, 0xda, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xfe, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xef, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfd,
+  0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf7, 0x1f, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0xf1, 0x0b, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xb0, 0x05, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xff, 0x50, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x9f, 0xc0,
+  0x00, 0x00, 0x00, 0x0d, 0xf8, 0x00, 0x00, 0x3f, 0xf3, 0x00, 0x00, 0x00, 0x3f, 0xf2, 0x00, 0x00,
+  0x0c, 0xf9, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x07, 0xff, 0x10, 0x00, 0x00, 0x00, 0xbf, 0xd0, 0x00, 0x0d,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xf3, 0x00, 0x4f, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xfa,
+  0x00, 0xaf, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0x10, 0x00, 0xef, 0xff, 0xff, 0xfd, 0x92,
+  0x00, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00, 0xef, 0x60, 0x00, 0x15, 0xdf,
+  0xf2, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x1f, 0xf7, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x0c,
+  0xf9, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x0c, 0xf8, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x2f,
+  0xf2, 0x00, 0x00, 0xef, 0x60, 0x00, 0x16, 0xef, 0x70, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xd4,
+  0x00, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xfe, 0x60, 0x00, 0x00, 0xef, 0x60, 0x00, 0x02, 0x7f,
+  0xf8, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x05, 0xff, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x02,
+  0xff, 0x20, 0x00, 0xef, 0x60, 0x00, 0x00, 0x06, 0xff, 0x10, 0x00, 0xef, 0x60, 0x00, 0x02, 0x7f,
+  0xfa, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x00, 0x00, 0xef, 0xff, 0xff, 0xfe, 0xb6,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x7b, 0xef, 0xed, 0x82, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff,
+  0xff, 0x80, 0x00, 0x09, 0xff, 0xc5, 0x10, 0x13, 0x8f, 0xf2, 0x00, 0x6f, 0xf8, 0x00, 0x00, 0x00,
+  0x02, 0x40, 0x01, 0xef, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf6, 0x00, 0x00, 0x00,
+  0x04, 0x70, 0x00, 0x0b, 0xff, 0xb4, 0x10, 0x14, 0xaf, 0xf3, 0x00, 0x00, 0x9f, 0xff, 0xff, 0xff,
+  0xfe, 0x50, 0x00, 0x00, 0x02, 0x8d, 0xef, 0xec, 0x71, 0x00, 0x00, 0xef, 0xff, 0xff, 0xfe, 0xc8,
+  0x20, 0x00, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00,
+  0x01, 0x4b, 0xff, 0xb0, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x5f, 0xf8, 0x00, 0x00, 0xef,
+  0x60, 0x00, 0x00, 0x00, 0x07, 0xff, 0x10, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0xef, 0x80,
+  0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xc0, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x7f, 0xe0, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xf0, 0x00, 0xef, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0xe0, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xc0, 0x00, 0xef, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0xef, 0x80, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x07, 0xff, 0x20, 0x00,
+  0xef, 0x60, 0x00, 0x00, 0x00, 0x5f, 0xf8, 0x00, 0x00, 0xef, 0x60, 0x00, 0x01, 0x4a, 0xff, 0xb0,
+  0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x00, 0xef, 0xff, 0xff, 0xfe, 0xc8,
+  0x20, 0x00, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0xef, 0xff, 0xff, 0xff, 0xff,
+  0xb0, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff,
+  0xf1, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xf1, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0xff,
+  0xff, 0xff, 0xb0, 0x00, 0xef, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0xef, 0xff, 0xff, 0xff, 0xff,
+  0xb0, 0x00, 0xef, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xf7, 0x00,
+  0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x7b, 0xef, 0xfd, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,
+  0xff, 0xd3, 0x00, 0x00, 0x0a, 0xff, 0xc5, 0x10, 0x02, 0x7d, 0xfb, 0x00, 0x00, 0x7f, 0xf7, 0x00,
+  0x00, 0x00, 0x00, 0x61, 0x00, 0x01, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0xf8, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0x20, 0x0b, 0xfb, 0x00, 0x00, 0x00,
+  0x1f, 0xff, 0xff, 0x20, 0x06, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x01, 0xff, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0x6f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00,
+  0x09, 0xff, 0xc5, 0x10, 0x01, 0x5a, 0xff, 0x20, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf6,
+  0x00, 0x00, 0x00, 0x01, 0x7c, 0xef, 0xfd, 0xa6, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00,
+  0x05, 0xff, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x05, 0xff, 0x00, 0x00, 0xef, 0x60, 0x00,
+  0x00, 0x00, 0x05, 0xff, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x05, 0xff, 0x00, 0x00, 0xef,
+  0x60, 0x00, 0x00, 0x00, 0x05, 0xff, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x05, 0xff, 0x00,
+  0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x05, 0xff, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x05,
+  0xff, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x05, 0xff, 0x00, 0x00, 0xef, 0x60,
+  0x00, 0x00, 0x00, 0x05, 0xff, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x05, 0xff, 0x00, 0x00,
+  0xef, 0x60, 0x00, 0x00, 0x00, 0x05, 0xff, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x05, 0xff,
+  0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x05, 0xff, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00,
+  0x05, 0xff, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00,
+  0x7f, 0xd0, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00,
+  0x7f, 0xd0, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00,
+  0x7f, 0xd0, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00,
+  0x7f, 0xd0, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0xcf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0xcf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0xcf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0xcf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x04, 0xff, 0x20, 0x00, 0x00, 0x01, 0x6f, 0xfc, 0x00,
+  0x00, 0x1f, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x2d, 0xff, 0xd8, 0x10, 0x00, 0x00, 0x00, 0xaf, 0xa0,
+  0x00, 0x00, 0x00, 0x7f, 0xf3, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x07, 0xff, 0x30, 0x00, 0x00,
+  0xaf, 0xa0, 0x00, 0x00, 0x6f, 0xf4, 0x00, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x05, 0xff, 0x50, 0x00,
+  0x00, 0x00, 0xaf, 0xa0, 0x00, 0x5f, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xa0, 0x04, 0xff, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0xaf, 0xa0, 0x5f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf,
+  0xa0, 0x2e, 0xfd, 0x10, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xa0, 0x03, 0xff, 0xb0, 0x00, 0x00, 0x00,
+  0x00, 0xaf, 0xa0, 0x00, 0x4f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x07, 0xff, 0x60,
+  0x00, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x9f, 0xf3, 0x00, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00,
+  0x0b, 0xfe, 0x10, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x00, 0xdf, 0xc0, 0x00, 0x00, 0xaf, 0xa0,
+  0x00, 0x00, 0x00, 0x1d, 0xfa, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0xef,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0xef,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0xef, 0xff, 0xff, 0xff, 0xfd, 0x00, 0xef, 0xff, 0xff, 0xff, 0xfd, 0x00, 0xef, 0xa0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0x00, 0x00, 0xef, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f,
+  0xff, 0x00, 0x00, 0xef, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x00, 0x00, 0xef, 0xdf,
+  0x50, 0x00, 0x00, 0x00, 0x04, 0xfd, 0xff, 0x00, 0x00, 0xef, 0x5f, 0xe0, 0x00, 0x00, 0x00, 0x0d,
+  0xf5, 0xff, 0x00, 0x00, 0xef, 0x2a, 0xf8, 0x00, 0x00, 0x00, 0x6f, 0xc1, 0xff, 0x00, 0x00, 0xef,
+  0x22, 0xff, 0x10, 0x00, 0x00, 0xef, 0x31, 0xff, 0x00, 0x00, 0xef, 0x20, 0x8f, 0xa0, 0x00, 0x08,
+  0xfa, 0x01, 0xff, 0x00, 0x00, 0xef, 0x20, 0x1e, 0xf3, 0x00, 0x1f, 0xf2, 0x01, 0xff, 0x00, 0x00,
+  0xef, 0x20, 0x07, 0xfc, 0x00, 0x9f, 0x90, 0x01, 0xff, 0x00, 0x00, 0xef, 0x20, 0x00, 0xdf, 0x52,
+  0xff, 0x10, 0x01, 0xff, 0x00, 0x00, 0xef, 0x20, 0x00, 0x5f, 0xda, 0xf7, 0x00, 0x01, 0xff, 0x00,
+  0x00, 0xef, 0x20, 0x00, 0x0c, 0xff, 0xe0, 0x00, 0x01, 0xff, 0x00, 0x00, 0xef, 0x20, 0x00, 0x03,
+  0xff, 0x60, 0x00, 0x01, 0xff, 0x00, 0x00, 0xef, 0x20, 0x00, 0x00, 0x57, 0x00, 0x00, 0x01, 0xff,
+  0x00, 0x00, 0xef, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0xef, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0xee, 0x30, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
+  0x00, 0xef, 0xd1, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xef, 0xfb, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0xef, 0xff, 0x70, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xef, 0x6f, 0xf4, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xef, 0x27, 0xfe, 0x10, 0x00, 0x00, 0xff, 0x00, 0x00, 0xef, 0x20,
+  0xbf, 0xc0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xef, 0x20, 0x1e, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0xef, 0x20, 0x03, 0xff, 0x50, 0x00, 0xff, 0x00, 0x00, 0xef, 0x20, 0x00, 0x6f, 0xf2, 0x00, 0xff,
+  0x00, 0x00, 0xef, 0x20, 0x00, 0x0a, 0xfd, 0x00, 0xff, 0x00, 0x00, 0xef, 0x20, 0x00, 0x00, 0xdf,
+  0x90, 0xff, 0x00, 0x00, 0xef, 0x20, 0x00, 0x00, 0x2f, 0xf6, 0xff, 0x00, 0x00, 0xef, 0x20, 0x00,
+  0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0xef, 0x20, 0x00, 0x00, 0x00, 0x9f, 0xff, 0x00, 0x00, 0xef,
+  0x20, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x00, 0x00, 0xef, 0x20, 0x00, 0x00, 0x00, 0x01, 0xdf, 0x00,
+  0x00, 0x00, 0x01, 0x7c, 0xef, 0xec, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,
+  0xff, 0x90, 0x00, 0x00, 0x00, 0x09, 0xff, 0xb5, 0x10, 0x14, 0xaf, 0xfb, 0x00, 0x00, 0x00, 0x6f,
+  0xf7, 0x00, 0x00, 0x00, 0x05, 0xff, 0x90, 0x00, 0x00, 0xef, 0x90, 0x00, 0x00, 0x00, 0x00, 0x6f,
+  0xf2, 0x00, 0x06, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf9, 0x00, 0x0a, 0xfb, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xfd, 0x00, 0x0c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0x00,
+  0x0d, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0x00, 0x0c, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0xff, 0x00, 0x0a, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfd, 0x00, 0x06, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf9, 0x00, 0x00, 0xef, 0x90, 0x00, 0x00, 0x00, 0x00, 0x6f,
+  0xf2, 0x00, 0x00, 0x7f, 0xf6, 0x00, 0x00, 0x00, 0x04, 0xff, 0x90, 0x00, 0x00, 0x0a, 0xff, 0xb5,
+  0x10, 0x14, 0xaf, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x7c, 0xef, 0xec, 0x82, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xec, 0x71,
+  0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x15, 0xef,
+  0xf1, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x1f, 0xf7, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x0a,
+  0xfb, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x08, 0xfc, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x0a,
+  0xfb, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x3f, 0xf6, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x27, 0xff,
+  0xe0, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xec, 0x60,
+  0x00, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x7c, 0xef, 0xec, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff,
+  0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x09, 0xff, 0xb5, 0x10, 0x14, 0xaf, 0xfb, 0x00, 0x00,
+  0x00, 0x6f, 0xf7, 0x00, 0x00, 0x00, 0x05, 0xff, 0x90, 0x00, 0x00, 0xef, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x6f, 0xf2, 0x00, 0x06, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf9, 0x00, 0x0a, 0xfb,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfd, 0x00, 0x0c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0xff, 0x00, 0x0d, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0x00, 0x0c, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0xff, 0x00, 0x0a, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfd, 0x00,
+  0x06, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf8, 0x00, 0x00, 0xef, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x6f, 0xf2, 0x00, 0x00, 0x7f, 0xf6, 0x00, 0x00, 0x00, 0x04, 0xff, 0x80, 0x00, 0x00, 0x0a,
+  0xff, 0xb5, 0x10, 0x14, 0xaf, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xb0,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x7c, 0xef, 0xec, 0xaf, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xe2, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xfd, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x68, 0x50, 0x00, 0xaf, 0xff, 0xff, 0xec, 0x71, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff,
+  0xff, 0xfe, 0x30, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x26, 0xef, 0xe0, 0x00, 0x00, 0xaf, 0xa0, 0x00,
+  0x00, 0x2f, 0xf5, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x0d, 0xf7, 0x00, 0x00, 0xaf, 0xa0, 0x00,
+  0x00, 0x0d, 0xf6, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x4f, 0xf2, 0x00, 0x00, 0xaf, 0xa0, 0x00,
+  0x27, 0xff, 0x90, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff,
+  0xfa, 0x10, 0x00, 0x00, 0x00, 0xaf, 0xa0, 0x08, 0xff, 0x30, 0x00, 0x00, 0x00, 0xaf, 0xa0, 0x00,
+  0xbf, 0xd0, 0x00, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x1e, 0xfa, 0x00, 0x00, 0x00, 0xaf, 0xa0, 0x00,
+  0x03, 0xff, 0x60, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x7f, 0xf3, 0x00, 0x00, 0xaf, 0xa0, 0x00,
+  0x00, 0x0b, 0xfd, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x01, 0xdf, 0xa0, 0x00, 0x02, 0x9d, 0xfe,
+  0xc7, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xd2, 0x00, 0x01, 0xff, 0xb3, 0x01, 0x5c, 0xf2,
+  0x00, 0x06, 0xfd, 0x00, 0x00, 0x00, 0x20, 0x00, 0x08, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff,
+  0xd8, 0x20, 0x00, 0x00, 0x00, 0x02, 0x9e, 0xff, 0xfb, 0x20, 0x00, 0x00, 0x00, 0x00, 0x49, 0xff,
+  0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfc, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x06, 0x50, 0x00, 0x00, 0x0c, 0xf8, 0x00, 0x1f, 0xfb,
+  0x40, 0x03, 0xbf, 0xf2, 0x00, 0x06, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x18, 0xdf, 0xfd,
+  0x92, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xfc, 0x00, 0x00, 0x01, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40, 0x00, 0x00, 0x01, 0xff, 0x30, 0x00, 0x00, 0x00,
+  0x0b, 0xf9, 0x00, 0x01, 0xff, 0x30, 0x00, 0x00, 0x00, 0x0b, 0xf9, 0x00, 0x01, 0xff, 0x30, 0x00,
+  0x00, 0x00, 0x0b, 0xf9, 0x00, 0x01, 0xff, 0x30, 0x00, 0x00, 0x00, 0x0b, 0xf9, 0x00, 0x01, 0xff,
+  0x30, 0x00, 0x00, 0x00, 0x0b, 0xf9, 0x00, 0x01, 0xff, 0x30, 0x00, 0x00, 0x00, 0x0b, 0xf9, 0x00,
+  0x01, 0xff, 0x30, 0x00, 0x00, 0x00, 0x0b, 0xf9, 0x00, 0x01, 0xff, 0x30, 0x00, 0x00, 0x00, 0x0b,
+  0xf9, 0x00, 0x01, 0xff, 0x30, 0x00, 0x00, 0x00, 0x0b, 0xf9, 0x00, 0x01, 0xff, 0x30, 0x00, 0x00,
+  0x00, 0x0b, 0xf9, 0x00, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x0b, 0xf9, 0x00, 0x00, 0xff, 0x60,
+  0x00, 0x00, 0x00, 0x0d, 0xf7, 0x00, 0x00, 0xbf, 0xb0, 0x00, 0x00, 0x00, 0x2f, 0xf4, 0x00, 0x00,
+  0x5f, 0xf5, 0x00, 0x00, 0x00, 0xcf, 0xd0, 0x00, 0x00, 0x0b, 0xff, 0x82, 0x01, 0x4c, 0xff, 0x30,
+  0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xae, 0xff, 0xc8,
+  0x10, 0x00, 0x00, 0xbf, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0x00, 0x4f, 0xf2, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0xf9, 0x00, 0x0d, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf2, 0x00, 0x07, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0xaf, 0xc0, 0x00, 0x01, 0xff, 0x50, 0x00, 0x00, 0x01, 0xff, 0x50, 0x00,
+  0x00, 0xaf, 0xc0, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x3f, 0xf2, 0x00, 0x00, 0x0d, 0xf8,
+  0x00, 0x00, 0x00, 0x0c, 0xf9, 0x00, 0x00, 0x4f, 0xf2, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x00, 0x00,
+  0xaf, 0xb0, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x01, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x9f,
+  0xc0, 0x07, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3, 0x0d, 0xf7, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0c, 0xf9, 0x4f, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfe, 0x9f, 0xa0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xfd, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xc0, 0x00, 0x00,
+  0x00, 0x0b, 0xf5, 0x00, 0x00, 0x00, 0x03, 0xff, 0x10, 0x5f, 0xf2, 0x00, 0x00, 0x00, 0x2f, 0xfb,
+  0x00, 0x00, 0x00, 0x09, 0xfc, 0x00, 0x1f, 0xf7, 0x00, 0x00, 0x00, 0x8f, 0xff, 0x10, 0x00, 0x00,
+  0x0e, 0xf7, 0x00, 0x0b, 0xfc, 0x00, 0x00, 0x00, 0xdf, 0xdf, 0x60, 0x00, 0x00, 0x3f, 0xf2, 0x00,
+  0x06, 0xff, 0x10, 0x00, 0x02, 0xfd, 0x5f, 0xc0, 0x00, 0x00, 0x8f, 0xd0, 0x00, 0x01, 0xff, 0x60,
+  0x00, 0x08, 0xf8, 0x1f, 0xf1, 0x00, 0x00, 0xcf, 0x80, 0x00, 0x00, 0xcf, 0xa0, 0x00, 0x0d, 0xf2,
+  0x0b, 0xf7, 0x00, 0x01, 0xff, 0x30, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x3f, 0xd0, 0x05, 0xfc, 0x00,
+  0x06, 0xfe, 0x00, 0x00, 0x00, 0x2f, 0xf4, 0x00, 0x8f, 0x70, 0x00, 0xff, 0x20, 0x0b, 0xf9, 0x00,
+  0x00, 0x00, 0x0d, 0xf9, 0x00, 0xef, 0x20, 0x00, 0xbf, 0x70, 0x0f, 0xf4, 0x00, 0x00, 0x00, 0x08,
+  0xfe, 0x03, 0xfd, 0x00, 0x00, 0x5f, 0xd0, 0x5f, 0xf0, 0x00, 0x00, 0x00, 0x03, 0xff, 0x29, 0xf7,
+  0x00, 0x00, 0x0f, 0xf2, 0x9f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7e, 0xf2, 0x00, 0x00, 0x0b,
+  0xf7, 0xef, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xdf, 0xc0, 0x00, 0x00, 0x05, 0xfd, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0x70, 0x00, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0e, 0xff, 0x20, 0x00, 0x00, 0x00, 0xaf, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xfc,
+  0x00, 0x00, 0x00, 0x00, 0x5f, 0xf1, 0x00, 0x00, 0x00, 0x4f, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xcf,
+  0xb0, 0x09, 0xff, 0x10, 0x00, 0x00, 0x07, 0xfe, 0x10, 0x00, 0xdf, 0xb0, 0x00, 0x00, 0x2f, 0xf4,
+  0x00, 0x00, 0x3f, 0xf6, 0x00, 0x00, 0xcf, 0x90, 0x00, 0x00, 0x08, 0xfe, 0x10, 0x07, 0xfd, 0x00,
+  0x00, 0x00, 0x00, 0xcf, 0xa0, 0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf5, 0xdf, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xf9, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0c, 0xfc, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x9f, 0xd0, 0x00,
+  0x00, 0x00, 0x02, 0xff, 0x50, 0x0e, 0xf9, 0x00, 0x00, 0x00, 0x0c, 0xfa, 0x00, 0x05, 0xff, 0x30,
+  0x00, 0x00, 0x7f, 0xe1, 0x00, 0x00, 0xaf, 0xd0, 0x00, 0x02, 0xff, 0x50, 0x00, 0x00, 0x1f, 0xf9,
+  0x00, 0x0c, 0xfa, 0x00, 0x00, 0x00, 0x06, 0xff, 0x30, 0x7f, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xbf,
+  0xd0, 0x9f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xb0, 0x1e, 0xf8, 0x00, 0x00, 0x00, 0x06, 0xff,
+  0x20, 0x05, 0xff, 0x20, 0x00, 0x00, 0x1e, 0xf7, 0x00, 0x00, 0xcf, 0xb0, 0x00, 0x00, 0x9f, 0xd0,
+  0x00, 0x00, 0x2f, 0xf4, 0x00, 0x03, 0xff, 0x40, 0x00, 0x00, 0x08, 0xfd, 0x00, 0x0c, 0xfa, 0x00,
+  0x00, 0x00, 0x00, 0xdf, 0x70, 0x5f, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xf1, 0xef, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x0a, 0xfd, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xaf, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xb0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xb0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xb0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9f, 0xb0, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xf2,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xfb, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xdf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfd, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xef, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0x00, 0x04, 0xff, 0xff, 0x20, 0x04, 0xff, 0xff, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00,
+  0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00,
+  0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00,
+  0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00,
+  0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00,
+  0x00, 0x04, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x20, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xf1, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf3,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x4f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf4, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xf6, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xbc, 0x00, 0x0e, 0xff, 0xf8, 0x00, 0x0c, 0xff, 0xf8, 0x00, 0x00, 0x04, 0xf8,
+  0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8,
+  0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8,
+  0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8,
+  0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xf8,
+  0x00, 0x00, 0x04, 0xf8, 0x00, 0x0c, 0xff, 0xf8, 0x00, 0x0e, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x02,
+  0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xbe, 0xe1,
+  0x00, 0x00, 0x00, 0x00, 0xcf, 0x35, 0xf9, 0x00, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xcf, 0x20, 0x00,
+  0x00, 0x0e, 0xf1, 0x00, 0x3f, 0xb0, 0x00, 0x00, 0x8f, 0x70, 0x00, 0x09, 0xf4, 0x00, 0x00, 0x77,
+  0x00, 0x00, 0x01, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
+  0xff, 0xff, 0xf7, 0x2e, 0xf5, 0x00, 0x00, 0x03, 0xfe, 0x10, 0x00, 0x00, 0x5f, 0x90, 0x00, 0x00,
+  0x04, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xae, 0xfd, 0x80, 0x00, 0x00, 0x8f, 0xff,
+  0xff, 0xfb, 0x00, 0x01, 0xeb, 0x41, 0x05, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x6f, 0xa0, 0x00, 0x02, 0x8b, 0xef, 0xff, 0xb0, 0x00, 0x9f, 0xff, 0xff, 0xff,
+  0xb0, 0x08, 0xfe, 0x73, 0x10, 0x6f, 0xb0, 0x0d, 0xf3, 0x00, 0x00, 0x7f, 0xb0, 0x0c, 0xf9, 0x10,
+  0x28, 0xef, 0xb0, 0x06, 0xff, 0xff, 0xfd, 0x4f, 0xb0, 0x00, 0x7d, 0xfe, 0x81, 0x0e, 0xb0, 0x02,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xff, 0x03, 0xbf, 0xfb, 0x30, 0x00, 0x02, 0xff, 0x5f, 0xff, 0xff, 0xf4, 0x00,
+  0x02, 0xff, 0xe6, 0x10, 0x3d, 0xfd, 0x00, 0x02, 0xff, 0x30, 0x00, 0x02, 0xff, 0x30, 0x02, 0xff,
+  0x00, 0x00, 0x00, 0xcf, 0x60, 0x02, 0xff, 0x00, 0x00, 0x00, 0xaf, 0x80, 0x02, 0xff, 0x00, 0x00,
+  0x00, 0xbf, 0x80, 0x02, 0xff, 0x00, 0x00, 0x00, 0xef, 0x60, 0x02, 0xff, 0x00, 0x00, 0x05, 0xff,
+  0x10, 0x02, 0xff, 0xb3, 0x01, 0x6f, 0xfa, 0x00, 0x02, 0xfd, 0xbf, 0xff, 0xff, 0xc1, 0x00, 0x02,
+  0xfa, 0x08, 0xef, 0xd7, 0x00, 0x00, 0x00, 0x03, 0xae, 0xfe, 0xa2, 0x00, 0x00, 0x6f, 0xff, 0xff,
+  0xff, 0x30, 0x03, 0xff, 0xa2, 0x01, 0x6b, 0x20, 0x0a, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf5,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf2, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xb2, 0x01,
+  0x6e, 0x60, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x04, 0xbe, 0xfd, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xf9,
+  0x00, 0x00, 0x04, 0xbe, 0xfb, 0x39, 0xf9, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xfc, 0xf9, 0x00, 0x03,
+  0xff, 0xa2, 0x01, 0x8f, 0xf9, 0x00, 0x0b, 0xfc, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x0f, 0xf4, 0x00,
+  0x00, 0x09, 0xf9, 0x00, 0x1f, 0xf2, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x1f, 0xf1, 0x00, 0x00, 0x09,
+  0xf9, 0x00, 0x0f, 0xf3, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x0d, 0xf9, 0x00, 0x00, 0x0b, 0xf9, 0x00,
+  0x07, 0xff, 0x71, 0x03, 0xbf, 0xf9, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xc6, 0xf9, 0x00, 0x00, 0x08,
+  0xef, 0xd7, 0x03, 0xf9, 0x00, 0x00, 0x02, 0xae, 0xfe, 0xa2, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff,
+  0xff, 0x40, 0x00, 0x03, 0xff, 0x61, 0x01, 0x6f, 0xe0, 0x00, 0x0b, 0xf4, 0x00, 0x00, 0x07, 0xf5,
+  0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x0f,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xfc, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xb3, 0x01, 0x4a, 0xe2, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff,
+  0xb0, 0x00, 0x00, 0x02, 0x9e, 0xfe, 0xb5, 0x00, 0x00, 0x00, 0x02, 0xae, 0xfc, 0x00, 0x1e, 0xff,
+  0xfd, 0x00, 0x8f, 0xe3, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0xcf, 0x50, 0x00, 0xbf, 0xff, 0xff,
+  0xfd, 0x7f, 0xff, 0xff, 0xfd, 0x00, 0xcf, 0x60, 0x00, 0x00, 0xcf, 0x60, 0x00, 0x00, 0xcf, 0x60,
+  0x00, 0x00, 0xcf, 0x60, 0x00, 0x00, 0xcf, 0x60, 0x00, 0x00, 0xcf, 0x60, 0x00, 0x00, 0xcf, 0x60,
+  0x00, 0x00, 0xcf, 0x60, 0x00, 0x00, 0xcf, 0x60, 0x00, 0x00, 0xcf, 0x60, 0x00, 0x00, 0x07, 0xdf,
+  0xff, 0xff, 0xfe, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x07, 0xfd, 0x40, 0x16, 0xff, 0x72, 0x0b,
+  0xf5, 0x00, 0x00, 0x9f, 0x40, 0x0b, 0xf5, 0x00, 0x00, 0x9f, 0x50, 0x06, 0xfd, 0x40, 0x16, 0xff,
+  0x20, 0x00, 0x9f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x7f, 0xcf, 0xfc, 0x40, 0x00, 0x04, 0xfa, 0x10,
+  0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xeb, 0x40, 0x00, 0xbf, 0xef, 0xff, 0xff, 0xf3, 0x0d,
+  0xd2, 0x00, 0x00, 0x3c, 0xf9, 0x5f, 0x80, 0x00, 0x00, 0x07, 0xf8, 0x4f, 0xf6, 0x20, 0x02, 0x7f,
+  0xf2, 0x0a, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5b, 0xef, 0xfd, 0x82, 0x00, 0x04, 0xfe, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xfe, 0x04, 0xcf, 0xea, 0x20, 0x00, 0x04, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x00, 0x04, 0xff,
+  0xf7, 0x10, 0x5f, 0xf8, 0x00, 0x04, 0xff, 0x20, 0x00, 0x08, 0xfc, 0x00, 0x04, 0xfe, 0x00, 0x00,
+  0x04, 0xfd, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x04, 0xfe,
+  0x00, 0x04, 0xfe, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x04,
+  0xfe, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x04, 0xfe, 0x00,
+  0x00, 0x04, 0xfe, 0x00, 0x03, 0xee, 0x40, 0x03, 0xee, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00,
+  0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff,
+  0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0x3e, 0xe4, 0x00, 0x00, 0x3e, 0xe5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf2, 0x00, 0x00,
+  0x0f, 0xf2, 0x00, 0x00, 0x0f, 0xf2, 0x00, 0x00, 0x0f, 0xf2, 0x00, 0x00, 0x0f, 0xf2, 0x00, 0x00,
+  0x0f, 0xf2, 0x00, 0x00, 0x0f, 0xf2, 0x00, 0x00, 0x0f, 0xf2, 0x00, 0x00, 0x0f, 0xf2, 0x00, 0x00,
+  0x0f, 0xf2, 0x00, 0x00, 0x0f, 0xf2, 0x00, 0x00, 0x0f, 0xf2, 0x00, 0x00, 0x0f, 0xf1, 0x00, 0x00,
+  0x7f, 0xf0, 0x00, 0x9f, 0xff, 0xa0, 0x00, 0x8f, 0xd9, 0x00, 0x00, 0x02, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff,
+  0x00, 0x00, 0x1d, 0xf7, 0x00, 0x02, 0xff, 0x00, 0x00, 0xcf, 0x80, 0x00, 0x02, 0xff, 0x00, 0x0b,
+  0xfa, 0x00, 0x00, 0x02, 0xff, 0x00, 0xaf, 0xc0, 0x00, 0x00, 0x02, 0xff, 0x09, 0xfd, 0x10, 0x00,
+  0x00, 0x02, 0xff, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x02,
+  0xff, 0x06, 0xff, 0x50, 0x00, 0x00, 0x02, 0xff, 0x00, 0x7f, 0xf3, 0x00, 0x00, 0x02, 0xff, 0x00,
+  0x08, 0xfe, 0x20, 0x00, 0x02, 0xff, 0x00, 0x00, 0x9f, 0xd1, 0x00, 0x02, 0xff, 0x00, 0x00, 0x0a,
+  0xfb, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff,
+  0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20,
+  0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00,
+  0xff, 0x20, 0x00, 0xff, 0x20, 0x04, 0xf7, 0x07, 0xef, 0xa1, 0x01, 0x9e, 0xfc, 0x50, 0x00, 0x04,
+  0xfa, 0x9f, 0xff, 0xfa, 0x0d, 0xff, 0xff, 0xf5, 0x00, 0x04, 0xff, 0xd4, 0x03, 0xdf, 0xae, 0x40,
+  0x2c, 0xfe, 0x00, 0x04, 0xff, 0x10, 0x00, 0x4f, 0xf5, 0x00, 0x02, 0xff, 0x20, 0x04, 0xfe, 0x00,
+  0x00, 0x2f, 0xf1, 0x00, 0x00, 0xff, 0x30, 0x04, 0xfe, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0xef,
+  0x30, 0x04, 0xfe, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0xef, 0x30, 0x04, 0xfe, 0x00, 0x00, 0x1f,
+  0xf0, 0x00, 0x00, 0xef, 0x30, 0x04, 0xfe, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0xef, 0x30, 0x04,
+  0xfe, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0xef, 0x30, 0x04, 0xfe, 0x00, 0x00, 0x1f, 0xf0, 0x00,
+  0x00, 0xef, 0x30, 0x04, 0xfe, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0xef, 0x30, 0x04, 0xf8, 0x04,
+  0xcf, 0xea, 0x20, 0x00, 0x04, 0xfa, 0x7f, 0xff, 0xff, 0xe0, 0x00, 0x04, 0xff, 0xf7, 0x10, 0x5f,
+  0xf8, 0x00, 0x04, 0xff, 0x20, 0x00, 0x08, 0xfc, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x04, 0xfd, 0x00,
+  0x04, 0xfe, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x04, 0xfe,
+  0x00, 0x00, 0x04, 0xfe, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x04, 0xfe, 0x00, 0x00,
+  0x04, 0xfe, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x04, 0xfe,
+  0x00, 0x00, 0x02, 0xae, 0xfe, 0xb5, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x03,
+  0xff, 0xb2, 0x01, 0x6f, 0xf8, 0x00, 0x0b, 0xfb, 0x00, 0x00, 0x06, 0xff, 0x00, 0x0f, 0xf4, 0x00,
+  0x00, 0x00, 0xff, 0x40, 0x1f, 0xf2, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x1f, 0xf2, 0x00, 0x00, 0x00,
+  0xdf, 0x60, 0x0f, 0xf4, 0x00, 0x00, 0x00, 0xff, 0x40, 0x0b, 0xfb, 0x00, 0x00, 0x06, 0xff, 0x00,
+  0x03, 0xff, 0xa2, 0x01, 0x6f, 0xf8, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x03,
+  0xae, 0xfe, 0xb5, 0x00, 0x00, 0x04, 0xf8, 0x04, 0xcf, 0xeb, 0x20, 0x00, 0x04, 0xfb, 0x6f, 0xff,
+  0xff, 0xf3, 0x00, 0x04, 0xfe, 0xe6, 0x11, 0x4d, 0xfc, 0x00, 0x04, 0xff, 0x20, 0x00, 0x03, 0xff,
+  0x20, 0x04, 0xfe, 0x00, 0x00, 0x00, 0xef, 0x50, 0x04, 0xfe, 0x00, 0x00, 0x00, 0xcf, 0x70, 0x04,
+  0xfe, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x04, 0xfe, 0x00, 0x00, 0x00, 0xff, 0x40, 0x04, 0xfe, 0x00,
+  0x00, 0x06, 0xff, 0x10, 0x04, 0xff, 0xb3, 0x01, 0x6f, 0xf9, 0x00, 0x04, 0xfe, 0xdf, 0xff, 0xff,
+  0xc0, 0x00, 0x04, 0xfe, 0x19, 0xef, 0xd7, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbe, 0xfb, 0x32, 0xf9, 0x00, 0x00, 0x7f, 0xff, 0xff,
+  0xf9, 0xf9, 0x00, 0x03, 0xff, 0xa2, 0x01, 0x8f, 0xf9, 0x00, 0x0b, 0xfc, 0x00, 0x00, 0x09, 0xf9,
+  0x00, 0x0f, 0xf4, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x1f, 0xf2, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x1f,
+  0xf1, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x0f, 0xf3, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x0d, 0xf9, 0x00,
+  0x00, 0x0b, 0xf9, 0x00, 0x07, 0xff, 0x71, 0x03, 0xbf, 0xf9, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xb9,
+  0xf9, 0x00, 0x00, 0x08, 0xef, 0xd7, 0x09, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xf9, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0xf9, 0x00, 0x04, 0xf8, 0x06, 0xdf, 0xe0, 0x04, 0xfb, 0x8f, 0xff, 0xe0, 0x04,
+  0xfe, 0xf6, 0x10, 0x00, 0x04, 0xff, 0x60, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00, 0x04, 0xfe,
+  0x00, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x00,
+  0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00,
+  0x00, 0x00, 0x3a, 0xef, 0xd8, 0x00, 0x04, 0xff, 0xff, 0xff, 0xd0, 0x0d, 0xfb, 0x20, 0x27, 0x80,
+  0x0e, 0xf2, 0x00, 0x00, 0x00, 0x08, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xfb, 0x61, 0x00, 0x00,
+  0x00, 0x49, 0xef, 0x60, 0x00, 0x00, 0x00, 0x1d, 0xf3, 0x00, 0x00, 0x00, 0x0b, 0xf5, 0x0b, 0xa3,
+  0x01, 0x6f, 0xf3, 0x0c, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x6d, 0xff, 0xc6, 0x00, 0x00, 0x0f, 0x90,
+  0x00, 0x00, 0x00, 0x2f, 0x90, 0x00, 0x00, 0x00, 0x4f, 0x90, 0x00, 0x00, 0x00, 0x6f, 0x90, 0x00,
+  0x00, 0x5d, 0xff, 0xff, 0xff, 0x10, 0x6f, 0xff, 0xff, 0xff, 0x10, 0x00, 0x8f, 0x90, 0x00, 0x00,
+  0x00, 0x8f, 0x90, 0x00, 0x00, 0x00, 0x8f, 0x90, 0x00, 0x00, 0x00, 0x8f, 0x90, 0x00, 0x00, 0x00,
+  0x8f, 0x90, 0x00, 0x00, 0x00, 0x8f, 0x90, 0x00, 0x00, 0x00, 0x8f, 0x90, 0x00, 0x00, 0x00, 0x7f,
+  0xd1, 0x15, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x20, 0x00, 0x06, 0xdf, 0xd5, 0x00, 0x08, 0xf9, 0x00,
+  0x00, 0x09, 0xf9, 0x00, 0x08, 0xf9, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x08, 0xf9, 0x00, 0x00, 0x09,
+  0xf9, 0x00, 0x08, 0xf9, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x08, 0xf9, 0x00, 0x00, 0x09, 0xf9, 0x00,
+  0x08, 0xf9, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x08, 0xf9, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x08, 0xfa,
+  0x00, 0x00, 0x09, 0xf9, 0x00, 0x06, 0xfd, 0x00, 0x00, 0x0b, 0xf9, 0x00, 0x02, 0xff, 0x81, 0x04,
+  0xcf, 0xf9, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xd7, 0xf9, 0x00, 0x00, 0x07, 0xef, 0xd8, 0x03, 0xf9,
+  0x00, 0x9f, 0x90, 0x00, 0x00, 0x03, 0xfd, 0x00, 0x2f, 0xf1, 0x00, 0x00, 0x0a, 0xf7, 0x00, 0x0c,
+  0xf7, 0x00, 0x00, 0x1f, 0xf1, 0x00, 0x05, 0xfd, 0x00, 0x00, 0x7f, 0x90, 0x00, 0x00, 0xef, 0x30,
+  0x00, 0xdf, 0x30, 0x00, 0x00, 0x8f, 0xa0, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x1f, 0xf1, 0x0b, 0xf6,
+  0x00, 0x00, 0x00, 0x0b, 0xf7, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x04, 0xfc, 0x7f, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0xdf, 0xdf, 0x20, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0xf5, 0x00, 0x00, 0x00, 0xaf, 0x70, 0x00, 0x00, 0xcf, 0x40, 0x00, 0x00, 0xef, 0x10, 0x5f,
+  0xd0, 0x00, 0x02, 0xff, 0xa0, 0x00, 0x05, 0xfb, 0x00, 0x0f, 0xf2, 0x00, 0x07, 0xff, 0xf0, 0x00,
+  0x0a, 0xf6, 0x00, 0x0a, 0xf6, 0x00, 0x0d, 0xe8, 0xf4, 0x00, 0x0e, 0xf1, 0x00, 0x05, 0xfb, 0x00,
+  0x2f, 0x93, 0xfa, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0xff, 0x00, 0x7f, 0x40, 0xde, 0x00, 0x8f, 0x60,
+  0x00, 0x00, 0xbf, 0x50, 0xde, 0x00, 0x8f, 0x40, 0xdf, 0x10, 0x00, 0x00, 0x5f, 0xa2, 0xf9, 0x00,
+  0x3f, 0x92, 0xfc, 0x00, 0x00, 0x00, 0x1f, 0xe7, 0xf4, 0x00, 0x0d, 0xe7, 0xf7, 0x00, 0x00, 0x00,
+  0x0b, 0xfd, 0xe0, 0x00, 0x08, 0xfd, 0xf1, 0x00, 0x00, 0x00, 0x06, 0xff, 0x90, 0x00, 0x03, 0xff,
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0xff, 0x30, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x2f, 0xf4, 0x00,
+  0x00, 0x1e, 0xf3, 0x07, 0xfd, 0x00, 0x00, 0xbf, 0x80, 0x00, 0xcf, 0x80, 0x06, 0xfc, 0x00, 0x00,
+  0x2f, 0xf3, 0x1f, 0xf2, 0x00, 0x00, 0x06, 0xfd, 0xbf, 0x60, 0x00, 0x00, 0x00, 0xbf, 0xfb, 0x00,
+  0x00, 0x00, 0x00, 0xcf, 0xfe, 0x00, 0x00, 0x00, 0x08, 0xfb, 0xaf, 0x90, 0x00, 0x00, 0x3f, 0xe1,
+  0x1e, 0xf5, 0x00, 0x00, 0xdf, 0x50, 0x05, 0xfe, 0x10, 0x09, 0xfa, 0x00, 0x00, 0xaf, 0xb0, 0x4f,
+  0xd0, 0x00, 0x00, 0x1e, 0xf6, 0x9f, 0xa0, 0x00, 0x00, 0x03, 0xfd, 0x00, 0x2f, 0xf2, 0x00, 0x00,
+  0x0a, 0xf6, 0x00, 0x0b, 0xf8, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x8f, 0x80,
+  0x00, 0x00, 0xdf, 0x60, 0x00, 0xef, 0x20, 0x00, 0x00, 0x6f, 0xd0, 0x05, 0xfa, 0x00, 0x00, 0x00,
+  0x0e, 0xf4, 0x0c, 0xf3, 0x00, 0x00, 0x00, 0x08, 0xfb, 0x2f, 0xc0, 0x00, 0x00, 0x00, 0x01, 0xff,
+  0xaf, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf7, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xdf, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
+  0xf4, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0c, 0xff, 0xff, 0xff, 0xfe,
+  0x10, 0x00, 0x00, 0x00, 0x0a, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x70, 0x00, 0x00, 0x00, 0x03,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xd0, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x20, 0x00, 0x00, 0x00,
+  0x09, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x80, 0x00, 0x00, 0x00, 0x02, 0xfb, 0x00, 0x00, 0x00,
+  0x00, 0x0d, 0xff, 0xff, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x08, 0xef,
+  0x20, 0x00, 0xbf, 0xff, 0x10, 0x03, 0xfe, 0x40, 0x00, 0x06, 0xf8, 0x00, 0x00, 0x05, 0xf7, 0x00,
+  0x00, 0x03, 0xf8, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00, 0xdf, 0x00,
+  0x00, 0x05, 0xfc, 0x00, 0x00, 0x7f, 0xd3, 0x00, 0x00, 0x7f, 0xd3, 0x00, 0x00, 0x05, 0xfc, 0x00,
+  0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x03, 0xf8, 0x00,
+  0x00, 0x05, 0xf7, 0x00, 0x00, 0x06, 0xf8, 0x00, 0x00, 0x03, 0xfe, 0x30, 0x00, 0x00, 0xbf, 0xff,
+  0x10, 0x00, 0x08, 0xef, 0x20, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60,
+  0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60,
+  0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60,
+  0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60,
+  0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60,
+  0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x0e, 0xea, 0x20,
+  0x00, 0x0d, 0xff, 0xe0, 0x00, 0x00, 0x2d, 0xf6, 0x00, 0x00, 0x05, 0xf9, 0x00, 0x00, 0x04, 0xf9,
+  0x00, 0x00, 0x05, 0xf6, 0x00, 0x00, 0x08, 0xf3, 0x00, 0x00, 0x0a, 0xf1, 0x00, 0x00, 0x0c, 0xf1,
+  0x00, 0x00, 0x09, 0xf8, 0x00, 0x00, 0x01, 0xcf, 0xa0, 0x00, 0x01, 0xcf, 0xa0, 0x00, 0x09, 0xf8,
+  0x00, 0x00, 0x0c, 0xf1, 0x00, 0x00, 0x0a, 0xf1, 0x00, 0x00, 0x08, 0xf3, 0x00, 0x00, 0x05, 0xf6,
+  0x00, 0x00, 0x04, 0xf9, 0x00, 0x00, 0x05, 0xf9, 0x00, 0x00, 0x2d, 0xf6, 0x00, 0x0d, 0xff, 0xe0,
+  0x00, 0x0e, 0xea, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x30, 0x00, 0x3c, 0xfe, 0xa5,
+  0x11, 0xaf, 0x50, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xf9, 0x01, 0x6b, 0xef, 0xb2,
+  0x00, 0x04, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+};
+
+static const GlyphInfo font_sans_24_glyphs[] PROGMEM = {
+  {     0,  5,  0,   0,  24,  5 },  // ' '
+  {     0,  8, 17,   0,   7,  8 },  // '!'
+  {    68, 10, 17,   0,   7, 10 },  // '"'
+  {   153, 14, 17,   0,   7, 14 },  // '#'
+  {   272, 14, 22,   0,   5, 14 },  // '$'
+  {   426, 19, 17,   0,   7, 19 },  // '%'
+  {   596, 17, 17,   0,   7, 17 },  // '&'
+  {   749,  6, 17,   0,   7,  6 },  // '''
+  {   800,  7, 23,   0,   5,  7 },  // '('
+  {   892,  7, 23,   0,   5,  7 },  // ')'
+  {   984, 10, 17,   0,   7, 10 },  // '*'
+  {  1069, 14, 14,   0,  10, 14 },  // '+'
+  {  1167,  5,  6,   0,  22,  5 },  // ','
+  {  1185,  8,  8,   0,  16,  8 },  // '-'
+  {  1217,  5,  2,   0,  22,  5 },  // '.'
+  {  1223, 11, 18,  -1,   7,  9 },  // '/'
+  {  1331, 14, 17,   0,   7, 14 },  // '0'
+  {  1450, 14, 17,   0,   7, 14 },  // '1'
+  {  1569, 14, 17,   0,   7, 14 },  // '2'
+  {  1688, 14, 17,   0,   7, 14 },  // '3'
+  {  1807, 14, 17,   0,   7, 14 },  // '4'
+  {  1926, 14, 17,   0,   7, 14 },  // '5'
+  {  2045, 14, 17,   0,   7, 14 },  // '6'
+  {  2164, 14, 17,   0,   7, 14 },  // '7'
+  {  2283, 14, 17,   0,   7, 14 },  // '8'
+  {  2402, 14, 17,   0,   7, 14 },  // '9'
+  {  2521,  6, 12,   0,  12,  6 },  // ':'
+  {  2557,  6, 16,   0,  12,  6 },  // ';'
+  {  2605, 14, 14,   0,  10, 14 },  // '<'
+  {  2703, 14, 11,   0,  13, 14 },  // '='
+  {  2780, 14, 14,   0,  10, 14 },  // '>'
+  {  2878, 10, 17,   0,   7, 10 },  // '?'
+  {  2963, 20, 19,   0,   8, 20 },  // '@'
+  {  3153, 17, 17,   0,   7, 16 },  // 'A'
+  {  3306, 16, 17,   0,   7, 16 },  // 'B'
+  {  3442, 16, 17,   0,   7, 16 },  // 'C'
+  {  3578, 18, 17,   0,   7, 18 },  // 'D'
+  {  3731, 14, 17,   0,   7, 14 },  // 'E'
+  {  3850, 14, 17,   0,   7, 14 },  // 'F'
+  {  3969, 18, 17,   0,   7, 18 },  // 'G'
+  {  4122, 18, 17,   0,   7, 18 },  // 'H'
+  {  4275,  7, 17,   0,   7,  7 },  // 'I'
+  {  4343, 11, 17,   0,   7, 11 },  // 'J'
+  {  4445, 17, 17,   0,   7, 16 },  // 'K'
+  {  4598, 12, 17,   0,   7, 12 },  // 'L'
+  {  4700, 22, 17,   0,   7, 22 },  // 'M'
+  {  4887, 18, 17,   0,   7, 18 },  // 'N'
+  {  5040, 19, 17,   0,   7, 19 },  // 'O'
+  {  5210, 15, 17,   0,   7, 15 },  // 'P'
+  {  5346, 19, 21,   0,   7, 19 },  // 'Q'
+  {  5556, 16, 17,   0,   7, 15 },  // 'R'
+  {  5692, 13, 17,   0,   7, 13 },  // 'S'
+  {  5811, 14, 17,   0,   7, 14 },  // 'T'
+  {  5930, 18, 17,   0,   7, 18 },  // 'U'
+  {  6083, 17, 17,   0,   7, 16 },  // 'V'
+  {  6236, 25, 17,   0,   7, 24 },  // 'W'
+  {  6457, 16, 17,   0,   7, 15 },  // 'X'
+  {  6593, 16, 17,   0,   7, 15 },  // 'Y'
+  {  6729, 15, 17,   0,   7, 15 },  // 'Z'
+  {  6865,  7, 22,   0,   5,  7 },  // '['
+  {  6953, 11, 18,  -1,   7,  9 },  // 'backslash'
+  {  7061,  7, 22,   0,   5,  7 },  // ']'
+  {  7149, 14, 17,   0,   7, 14 },  // '^'
+  {  7268, 10,  3,   0,  24,  9 },  // '_'
+  {  7283,  7, 17,   0,   7,  7 },  // '`'
+  {  7351, 12, 12,   0,  12, 12 },  // 'a'
+  {  7423, 13, 17,   0,   7, 13 },  // 'b'
+  {  7542, 11, 12,   0,  12, 11 },  // 'c'
+  {  7614, 13, 17,   0,   7, 13 },  // 'd'
+  {  7733, 13, 12,   0,  12, 13 },  // 'e'
+  {  7817,  8, 17,   0,   7,  8 },  // 'f'
+  {  7885, 12, 16,   0,  12, 12 },  // 'g'
+  {  7981, 13, 17,   0,   7, 13 },  // 'h'
+  {  8100,  6, 17,   0,   7,  6 },  // 'i'
+  {  8151,  7, 21,  -1,   7,  6 },  // 'j'
+  {  8235, 13, 17,   0,   7, 13 },  // 'k'
+  {  8354,  6, 17,   0,   7,  6 },  // 'l'
+  {  8405, 20, 12,   0,  12, 20 },  // 'm'
+  {  8525, 13, 12,   0,  12, 13 },  // 'n'
+  {  8609, 13, 12,   0,  12, 13 },  // 'o'
+  {  8693, 13, 16,   0,  12, 13 },  // 'p'
+  {  8805, 13, 16,   0,  12, 13 },  // 'q'
+  {  8917, 10, 12,   0,  12, 10 },  // 'r'
+  {  8977, 10, 12,   0,  12, 10 },  // 's'
+  {  9037,  9, 16,   0,   8,  9 },  // 't'
+  {  9117, 13, 12,   0,  12, 13 },  // 'u'
+  {  9201, 13, 12,   0,  12, 12 },  // 'v'
+  {  9285, 19, 12,   0,  12, 18 },  // 'w'
+  {  9405, 12, 12,   0,  12, 12 },  // 'x'
+  {  9477, 13, 16,   0,  12, 12 },  // 'y'
+  {  9589, 11, 12,   0,  12, 11 },  // 'z'
+  {  9661,  7, 22,   0,   5,  7 },  // '{'
+  {  9749,  7, 22,   0,   6,  7 },  // '|'
+  {  9837,  7, 22,   0,   5,  7 },  // '}'
+  {  9925, 14,  9,   0,  15, 14 },  // '~'
+};
+
+const SmoothFont FONT_SANS_24 = {
+  font_sans_24_bitmap, font_sans_24_glyphs, 0x20, 0x7E, 30, 24, 720
+};
+
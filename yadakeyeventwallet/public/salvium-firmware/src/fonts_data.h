@@ -0,0 +1,9 @@
+// GENERATED by tools/fontgen.py from Lato-Regular.ttf - do not edit.
+// Lato is licensed under the SIL Open Font License 1.1.
+
+#pragma once
+
+// Largest glyph cell (advance x line height) per font, in pixels.
+// Used to size the RAM glyph cache at compile time.
+#define FONT_SANS_16_MAX_CELL 320
+#define FONT_SANS_24_MAX_CELL 720
@@ -0,0 +1,636 @@
+#include "history.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <esp_partition.h>
+#endif
+
+#define SEGMENT_MAGIC 0x48495354  // "HIST"
+#define BOOK_MAGIC    0x424F   // "BO"
+#define ERASED32      0xFFFFFFFF
+#define SEGMENT_SECTORS (HISTORY_SEGMENT_SIZE / HISTORY_SECTOR)
+#define BOOK_PER_SECTOR (HISTORY_SECTOR / (HISTORY_BOOK_SIZE / HISTORY_BOOK_ENTRIES))
+#define BOOK_SECTORS    (HISTORY_BOOK_ENTRIES / BOOK_PER_SECTOR)
+
+// First bytes of sector 0 of every segment; sealedCount is written at seal
+struct SegmentHeader {
+  uint32_t magic;
+  uint32_t segSeq;       // Increases with every segment opened
+  uint32_t firstSeq;     // Record seq of slot 0
+  uint32_t sealedCount;  // ERASED32 while open
+};
+
+struct __attribute__((packed)) DigestEntry {
+  uint32_t prefix;
+  uint16_t slot;
+};
+
+struct DestEntry {
+  uint16_t destId;
+  uint16_t slot;
+};
+
+struct BookEntry {
+  uint16_t magic;
+  uint8_t len;
+  uint8_t reserved;
+  uint32_t key;
+  char text[HISTORY_DEST_MAX + 2];  // NUL terminated
+  uint32_t crc;
+};
+
+static_assert(sizeof(BookEntry) == HISTORY_BOOK_SIZE / HISTORY_BOOK_ENTRIES, "book entries are 128 bytes");
+static_assert(BOOK_PER_SECTOR == 32, "one blank mask word per book sector");
+
+#define DIGEST_INDEX_OFFSET sizeof(SegmentHeader)
+#define DEST_INDEX_OFFSET   (DIGEST_INDEX_OFFSET + HISTORY_SEGMENT_RECORDS * sizeof(DigestEntry))
+#define RECORDS_OFFSET      (HISTORY_INDEX_SECTORS * HISTORY_SECTOR)
+
+static_assert(DEST_INDEX_OFFSET + HISTORY_SEGMENT_RECORDS * sizeof(DestEntry) <= RECORDS_OFFSET,
+              "indexes must fit the index sectors");
+static_assert(RECORDS_OFFSET + HISTORY_SEGMENT_RECORDS * sizeof(HistoryRecord) <= HISTORY_SEGMENT_SIZE,
+              "records must fit the segment");
+
+// In RAM, one per segment position in the partition
+struct Segment {
+  uint32_t base;      // Partition offset
+  uint32_t segSeq;
+  uint32_t firstSeq;
+  uint16_t count;     // Slots used (including torn ones)
+  uint16_t entries;   // Index entries once sealed
+  bool sealed;
+};
+
+static Segment segments[HISTORY_MAX_SEGMENTS];  // By position in the partition
+static uint8_t order[HISTORY_MAX_SEGMENTS];     // Live segments, oldest first
+static int segmentTotal = 0;
+static int liveCount = 0;
+static uint32_t nextSegSeq = 0;
+static uint32_t flashReads = 0;
+static bool ready = false;
+
+// Open segment mirror
+static uint32_t openPrefix[HISTORY_SEGMENT_RECORDS];
+static uint16_t openDest[HISTORY_SEGMENT_RECORDS];
+static bool openValid[HISTORY_SEGMENT_RECORDS];
+
+// Seal scratch
+static DigestEntry digestSort[HISTORY_SEGMENT_RECORDS];
+static DestEntry destSort[HISTORY_SEGMENT_RECORDS];
+
+// Address book: key per entry (0 for blank or torn), and a mask of the
+// blank entries of each sector, bit k for entry k
+static uint32_t bookKeys[HISTORY_BOOK_ENTRIES];
+static uint32_t bookBlank[BOOK_SECTORS];
+static int bookReclaim = 0;      // Next sector to try when the book is full
+static uint32_t bookDropped = 0;  // Destinations stored as HISTORY_NO_DEST since boot
+
+// Next segment to reuse, erased ahead by historyMaintain
+static int eraseSegment = -1;
+static int eraseSector = 0;
+
+// ---- Flash backend ----
+
+#ifdef ARDUINO
+
+static const esp_partition_t* partition = nullptr;
+
+static uint32_t flashSize() {
+  return partition ? partition->size : 0;
+}
+
+static bool flashOpen() {
+  partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)0x40, "history");
+  return partition != nullptr;
+}
+
+static void flashRead(uint32_t offset, void* buf, size_t len) {
+  flashReads++;
+  esp_partition_read(partition, offset, buf, len);
+}
+
+static void flashWrite(uint32_t offset, const void* buf, size_t len) {
+  esp_partition_write(partition, offset, buf, len);
+}
+
+static void flashErase(uint32_t offset, size_t len) {
+  esp_partition_erase_range(partition, offset, len);
+}
+
+#else
+
+// NOR semantics: erase sets bytes to 0xFF, writes can only clear bits
+static uint8_t* flash = nullptr;
+
+static uint32_t flashSize() {
+  return HISTORY_PARTITION_SIZE;
+}
+
+static bool flashOpen() {
+  if (!flash) {
+    flash = (uint8_t*)malloc(HISTORY_PARTITION_SIZE);
+    memset(flash, 0xFF, HISTORY_PARTITION_SIZE);
+  }
+  return true;
+}
+
+static void flashRead(uint32_t offset, void* buf, size_t len) {
+  flashReads++;
+  memcpy(buf, flash + offset, len);
+}
+
+static void flashWrite(uint32_t offset, const void* buf, size_t len) {
+  const uint8_t* p = (const uint8_t*)buf;
+  for (size_t k = 0; k < len; k++) flash[offset + k] &= p[k];
+}
+
+static void flashErase(uint32_t offset, size_t len) {
+  memset(flash + offset, 0xFF, len);
+}
+
+#endif
+
+// ---- Helpers ----
+
+static uint32_t crc32(const uint8_t* data, size_t len) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t k = 0; k < len; k++) {
+    crc ^= data[k];
+    for (int b = 0; b < 8; b++) crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+  }
+  return ~crc;
+}
+
+static uint32_t recordCrc(const HistoryRecord& rec) {
+  return crc32((const uint8_t*)&rec + 4, offsetof(HistoryRecord, crc) - 4);
+}
+
+static bool recordValid(const HistoryRecord& rec) {
+  return rec.seq != ERASED32 && rec.crc == recordCrc(rec);
+}
+
+// FNV-1a, never 0 so 0 can mean a free book entry
+static uint32_t destKey(const char* s) {
+  uint32_t h = 2166136261u;
+  while (*s) h = (h ^ (uint8_t)*s++) * 16777619u;
+  return h ? h : 1;
+}
+
+static uint32_t digestPrefix(const uint8_t digest[32]) {
+  return (uint32_t)digest[0] << 24 | (uint32_t)digest[1] << 16 | (uint32_t)digest[2] << 8 | digest[3];
+}
+
+static uint32_t recordOffset(const Segment& s, int slot) {
+  return s.base + RECORDS_OFFSET + slot * sizeof(HistoryRecord);
+}
+
+static bool readRecord(const Segment& s, int slot, HistoryRecord& out) {
+  flashRead(recordOffset(s, slot), &out, sizeof(out));
+  return recordValid(out);
+}
+
+static bool isBlank(uint32_t offset, size_t len) {
+  uint8_t buf[256];
+  while (len > 0) {
+    size_t n = len < sizeof(buf) ? len : sizeof(buf);
+    flashRead(offset, buf, n);
+    for (size_t k = 0; k < n; k++) {
+      if (buf[k] != 0xFF) return false;
+    }
+    offset += n;
+    len -= n;
+  }
+  return true;
+}
+
+static Segment& openSegment() {
+  return segments[order[liveCount - 1]];
+}
+
+// ---- Address book ----
+
+static void loadBook() {
+  static BookEntry chunk[BOOK_PER_SECTOR];
+  for (int sector = 0; sector < BOOK_SECTORS; sector++) {
+    flashRead(sector * HISTORY_SECTOR, chunk, sizeof(chunk));
+    bookBlank[sector] = 0;
+    for (int k = 0; k < BOOK_PER_SECTOR; k++) {
+      const BookEntry& e = chunk[k];
+      bool ok = e.magic == BOOK_MAGIC && e.crc == crc32((const uint8_t*)&e, offsetof(BookEntry, crc));
+      bookKeys[sector * BOOK_PER_SECTOR + k] = ok ? e.key : 0;
+      if (e.magic == 0xFFFF) bookBlank[sector] |= 1UL << k;  // Torn entries are neither
+    }
+  }
+}
+
+static uint16_t findDest(const char* destination) {
+  uint32_t key = destKey(destination);
+  BookEntry e;
+  for (int id = 0; id < HISTORY_BOOK_ENTRIES; id++) {
+    if (bookKeys[id] != key) continue;
+    flashRead(id * sizeof(BookEntry), &e, sizeof(e));
+    if (strcmp(e.text, destination) == 0) return (uint16_t)id;
+  }
+  return HISTORY_NO_DEST;
+}
+
+static uint32_t destLowerBound(const Segment& s, uint16_t id);
+
+// Whether a live record points into this book sector
+static bool bookSectorReferenced(int sector) {
+  uint16_t first = (uint16_t)(sector * BOOK_PER_SECTOR);
+  uint16_t end = (uint16_t)(first + BOOK_PER_SECTOR);
+  for (int i = 0; i < liveCount; i++) {
+    const Segment& s = segments[order[i]];
+    if (!s.sealed) {
+      for (int slot = 0; slot < s.count; slot++) {
+        if (openDest[slot] >= first && openDest[slot] < end) return true;
+      }
+      continue;
+    }
+    uint32_t at = destLowerBound(s, first);
+    DestEntry e;
+    if (at < s.entries) {
+      flashRead(s.base + DEST_INDEX_OFFSET + at * sizeof(DestEntry), &e, sizeof(e));
+      if (e.destId < end) return true;
+    }
+  }
+  return false;
+}
+
+// Erase a book sector no live record points into, oldest reuse first.
+// Entries are freed a sector at a time, once the segments that referenced
+// them have been reused. The sector, or -1 if every one is still in use.
+static int reclaimBookSector() {
+  for (int n = 0; n < BOOK_SECTORS; n++) {
+    int sector = (bookReclaim + n) % BOOK_SECTORS;
+    if (bookSectorReferenced(sector)) continue;
+    flashErase(sector * HISTORY_SECTOR, HISTORY_SECTOR);
+    memset(bookKeys + sector * BOOK_PER_SECTOR, 0, BOOK_PER_SECTOR * sizeof(bookKeys[0]));
+    bookBlank[sector] = 0xFFFFFFFF;
+    bookReclaim = (sector + 1) % BOOK_SECTORS;
+    return sector;
+  }
+  return -1;
+}
+
+static int takeBlankEntry() {
+  int sector = 0;
+  while (sector < BOOK_SECTORS && !bookBlank[sector]) sector++;
+  if (sector == BOOK_SECTORS && (sector = reclaimBookSector()) < 0) return -1;
+  int k = __builtin_ctz(bookBlank[sector]);
+  bookBlank[sector] &= ~(1UL << k);
+  return sector * BOOK_PER_SECTOR + k;
+}
+
+static uint16_t addDest(const char* destination) {
+  size_t len = strlen(destination);
+  if (len == 0 || len > HISTORY_DEST_MAX) return HISTORY_NO_DEST;
+  uint16_t id = findDest(destination);
+  if (id != HISTORY_NO_DEST) return id;
+  int entry = takeBlankEntry();
+  if (entry < 0) {
+    bookDropped++;
+    return HISTORY_NO_DEST;
+  }
+
+  BookEntry e;
+  memset(&e, 0, sizeof(e));
+  e.magic = BOOK_MAGIC;
+  e.len = (uint8_t)len;
+  e.key = destKey(destination);
+  memcpy(e.text, destination, len);
+  e.crc = crc32((const uint8_t*)&e, offsetof(BookEntry, crc));
+  id = (uint16_t)entry;
+  flashWrite(id * sizeof(BookEntry), &e, sizeof(e));
+  bookKeys[id] = e.key;
+  return id;
+}
+
+// ---- Segments ----
+
+static void loadOpenMirror(Segment& s) {
+  HistoryRecord rec;
+  s.count = 0;
+  for (int slot = 0; slot < HISTORY_SEGMENT_RECORDS; slot++) {
+    bool valid = readRecord(s, slot, rec);
+    bool blank = !valid && rec.seq == ERASED32 && isBlank(recordOffset(s, slot), sizeof(rec));
+    if (blank) break;
+    openValid[slot] = valid;
+    openPrefix[slot] = valid ? digestPrefix(rec.digest) : 0;
+    openDest[slot] = valid ? rec.destId : HISTORY_NO_DEST;
+    s.count = slot + 1;
+  }
+}
+
+static void openNewSegment() {
+  // Reuse the oldest segment when every one is live
+  int pos = -1;
+  for (int k = 0; k < segmentTotal && pos < 0; k++) {
+    bool live = false;
+    for (int i = 0; i < liveCount; i++) live = live || order[i] == k;
+    if (!live) pos = k;
+  }
+  if (pos < 0) {
+    pos = order[0];
+    memmove(order, order + 1, --liveCount);
+  }
+
+  Segment& s = segments[pos];
+  // Fresh partitions are blank already; a block erase takes most of a second
+  bool erased = eraseSegment == pos && eraseSector == SEGMENT_SECTORS;
+  if (!erased && !isBlank(s.base, HISTORY_SEGMENT_SIZE)) flashErase(s.base, HISTORY_SEGMENT_SIZE);
+  eraseSegment = -1;
+
+  uint32_t firstSeq = 0;
+  if (liveCount > 0) {
+    const Segment& prev = openSegment();
+    firstSeq = prev.firstSeq + prev.count;
+  }
+  SegmentHeader h = {SEGMENT_MAGIC, nextSegSeq++, firstSeq, ERASED32};
+  flashWrite(s.base, &h, sizeof(h));
+  s.segSeq = h.segSeq;
+  s.firstSeq = firstSeq;
+  s.count = 0;
+  s.entries = 0;
+  s.sealed = false;
+  order[liveCount++] = (uint8_t)pos;
+}
+
+static void sealSegment(Segment& s) {
+  int n = 0;
+  for (int slot = 0; slot < s.count; slot++) {
+    if (!openValid[slot]) continue;
+    digestSort[n].prefix = openPrefix[slot];
+    digestSort[n].slot = (uint16_t)slot;
+    destSort[n].destId = openDest[slot];
+    destSort[n].slot = (uint16_t)slot;
+    n++;
+  }
+  qsort(digestSort, n, sizeof(DigestEntry), [](const void* a, const void* b) -> int {
+    uint32_t x = ((const DigestEntry*)a)->prefix, y = ((const DigestEntry*)b)->prefix;
+    return x < y ? -1 : x > y;
+  });
+  // Destination, then newest slot first
+  qsort(destSort, n, sizeof(DestEntry), [](const void* a, const void* b) -> int {
+    const DestEntry* x = (const DestEntry*)a;
+    const DestEntry* y = (const DestEntry*)b;
+    if (x->destId != y->destId) return x->destId < y->destId ? -1 : 1;
+    return y->slot - x->slot;
+  });
+
+  flashWrite(s.base + DIGEST_INDEX_OFFSET, digestSort, n * sizeof(DigestEntry));
+  flashWrite(s.base + DEST_INDEX_OFFSET, destSort, n * sizeof(DestEntry));
+  uint32_t sealed = (uint32_t)n;
+  flashWrite(s.base + offsetof(SegmentHeader, sealedCount), &sealed, sizeof(sealed));
+  s.sealed = true;
+  s.entries = (uint16_t)n;
+  s.count = HISTORY_SEGMENT_RECORDS;
+}
+
+// ---- Public API ----
+
+bool historyBegin() {
+  ready = false;
+  eraseSegment = -1;
+  if (!flashOpen()) return false;
+
+  segmentTotal = (int)((flashSize() - HISTORY_BOOK_SIZE) / HISTORY_SEGMENT_SIZE);
+  if (segmentTotal > HISTORY_MAX_SEGMENTS) segmentTotal = HISTORY_MAX_SEGMENTS;
+  if (segmentTotal < 2) return false;
+
+  loadBook();
+
+  // Live segments, by segSeq
+  liveCount = 0;
+  nextSegSeq = 0;
+  for (int k = 0; k < segmentTotal; k++) {
+    Segment& s = segments[k];
+    SegmentHeader h;
+    s.base = HISTORY_BOOK_SIZE + k * HISTORY_SEGMENT_SIZE;
+    flashRead(s.base, &h, sizeof(h));
+    if (h.magic != SEGMENT_MAGIC) continue;
+    s.segSeq = h.segSeq;
+    s.firstSeq = h.firstSeq;
+    s.sealed = h.sealedCount != ERASED32;
+    s.count = s.sealed ? HISTORY_SEGMENT_RECORDS : 0;
+    s.entries = s.sealed ? (uint16_t)h.sealedCount : 0;
+    int at = liveCount++;
+    while (at > 0 && segments[order[at - 1]].segSeq > s.segSeq) {
+      order[at] = order[at - 1];
+      at--;
+    }
+    order[at] = (uint8_t)k;
+    if (h.segSeq >= nextSegSeq) nextSegSeq = h.segSeq + 1;
+  }
+
+  if (liveCount == 0) {
+    openNewSegment();
+  } else {
+    Segment& s = openSegment();
+    if (!s.sealed) {
+      loadOpenMirror(s);
+      if (s.count == HISTORY_SEGMENT_RECORDS) {
+        // Power was lost while sealing: redo the indexes on blank sectors
+        if (!isBlank(s.base + DIGEST_INDEX_OFFSET, RECORDS_OFFSET - DIGEST_INDEX_OFFSET)) {
+          SegmentHeader h = {SEGMENT_MAGIC, s.segSeq, s.firstSeq, ERASED32};
+          flashErase(s.base, RECORDS_OFFSET);
+          flashWrite(s.base, &h, sizeof(h));
+        }
+        sealSegment(s);
+      }
+    }
+  }
+
+  ready = true;
+  return true;
+}
+
+bool historyReady() {
+  return ready;
+}
+
+uint32_t historyCount() {
+  uint32_t n = 0;
+  for (int i = 0; i < liveCount; i++) n += segments[order[i]].count;
+  return n;
+}
+
+bool historyAppend(HistoryKind kind, HistoryCoin coin, const uint8_t digest[32], int64_t amount,
+                   const char* destination, uint32_t timestamp) {
+  if (!ready) return false;
+  // Sealed but the next segment was never opened (power loss)
+  if (openSegment().sealed) openNewSegment();
+
+  Segment& s = openSegment();
+  int slot = s.count;
+  HistoryRecord rec;
+  memset(&rec, 0, sizeof(rec));
+  rec.timestamp = timestamp;
+  rec.amount = amount;
+  memcpy(rec.digest, digest, 32);
+  rec.destId = destination ? addDest(destination) : HISTORY_NO_DEST;
+  rec.coin = (uint8_t)coin;
+  rec.kind = (uint8_t)kind;
+  rec.crc = recordCrc(rec);
+
+  // Body first, then the sequence number as the commit
+  uint32_t offset = recordOffset(s, slot);
+  flashWrite(offset + 4, (const uint8_t*)&rec + 4, sizeof(rec) - 4);
+  rec.seq = s.firstSeq + slot;
+  flashWrite(offset, &rec.seq, sizeof(rec.seq));
+
+  openValid[slot] = true;
+  openPrefix[slot] = digestPrefix(digest);
+  openDest[slot] = rec.destId;
+  s.count++;
+
+  // Seal eagerly so the next segment can be erased in the background
+  if (s.count == HISTORY_SEGMENT_RECORDS) {
+    sealSegment(s);
+    openNewSegment();
+  }
+  return true;
+}
+
+// First entry of a sealed segment's destination index at or above id
+static uint32_t destLowerBound(const Segment& s, uint16_t id) {
+  uint32_t lo = 0, hi = s.entries;
+  DestEntry e;
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    flashRead(s.base + DEST_INDEX_OFFSET + mid * sizeof(DestEntry), &e, sizeof(e));
+    if (e.destId < id) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+bool historyFindDigest(const uint8_t digest[32], HistoryRecord& out) {
+  if (!ready) return false;
+  uint32_t prefix = digestPrefix(digest);
+
+  for (int i = liveCount - 1; i >= 0; i--) {
+    const Segment& s = segments[order[i]];
+    if (!s.sealed) {
+      for (int slot = s.count - 1; slot >= 0; slot--) {
+        if (openValid[slot] && openPrefix[slot] == prefix && readRecord(s, slot, out) &&
+            memcmp(out.digest, digest, 32) == 0) {
+          return true;
+        }
+      }
+      continue;
+    }
+
+    // Lower bound on the sorted prefixes, then check each equal prefix
+    uint32_t lo = 0, hi = s.entries;
+    DigestEntry e;
+    while (lo < hi) {
+      uint32_t mid = (lo + hi) / 2;
+      flashRead(s.base + DIGEST_INDEX_OFFSET + mid * sizeof(DigestEntry), &e, sizeof(e));
+      if (e.prefix < prefix) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    for (; lo < s.entries; lo++) {
+      flashRead(s.base + DIGEST_INDEX_OFFSET + lo * sizeof(DigestEntry), &e, sizeof(e));
+      if (e.prefix != prefix) break;
+      if (readRecord(s, e.slot, out) && memcmp(out.digest, digest, 32) == 0) return true;
+    }
+  }
+  return false;
+}
+
+int historyFindDestination(const char* destination, HistoryVisitor fn, void* ctx) {
+  if (!ready) return 0;
+  uint16_t id = findDest(destination);
+  if (id == HISTORY_NO_DEST) return 0;
+
+  int visited = 0;
+  HistoryRecord rec;
+  for (int i = liveCount - 1; i >= 0; i--) {
+    const Segment& s = segments[order[i]];
+    if (!s.sealed) {
+      for (int slot = s.count - 1; slot >= 0; slot--) {
+        if (!openValid[slot] || openDest[slot] != id || !readRecord(s, slot, rec)) continue;
+        visited++;
+        if (!fn(rec, ctx)) return visited;
+      }
+      continue;
+    }
+
+    DestEntry e;
+    for (uint32_t lo = destLowerBound(s, id); lo < s.entries; lo++) {
+      flashRead(s.base + DEST_INDEX_OFFSET + lo * sizeof(DestEntry), &e, sizeof(e));
+      if (e.destId != id) break;
+      if (!readRecord(s, e.slot, rec)) continue;
+      visited++;
+      if (!fn(rec, ctx)) return visited;
+    }
+  }
+  return visited;
+}
+
+bool historyRead(uint32_t n, HistoryRecord& out) {
+  if (!ready) return false;
+  for (int i = liveCount - 1; i >= 0; i--) {
+    const Segment& s = segments[order[i]];
+    if (n < s.count) return readRecord(s, s.count - 1 - n, out);
+    n -= s.count;
+  }
+  return false;
+}
+
+bool historyDestination(uint16_t destId, char out[HISTORY_DEST_MAX + 1]) {
+  if (destId >= HISTORY_BOOK_ENTRIES || bookKeys[destId] == 0) return false;
+  BookEntry e;
+  flashRead(destId * sizeof(BookEntry), &e, sizeof(e));
+  memcpy(out, e.text, HISTORY_DEST_MAX);
+  out[HISTORY_DEST_MAX] = '\0';
+  return true;
+}
+
+bool historyMaintenancePending() {
+  if (!ready) return false;
+  if (eraseSegment >= 0) return eraseSector < SEGMENT_SECTORS;
+  return liveCount == segmentTotal;
+}
+
+bool historyMaintain() {
+  if (!historyMaintenancePending()) return false;
+
+  // Pre-erase the segment the next seal will reuse. It stops being live
+  // before its first sector goes, so a reboot never mounts half of it.
+  if (eraseSegment < 0) {
+    eraseSegment = order[0];
+    eraseSector = 0;
+    memmove(order, order + 1, --liveCount);
+  }
+  flashErase(segments[eraseSegment].base + eraseSector * HISTORY_SECTOR, HISTORY_SECTOR);
+  eraseSector++;
+  return historyMaintenancePending();
+}
+
+uint32_t historyFlashReads() {
+  return flashReads;
+}
+
+void historyBookStats(int& used, uint32_t& dropped) {
+  used = HISTORY_BOOK_ENTRIES;
+  for (int sector = 0; sector < BOOK_SECTORS; sector++) used -= __builtin_popcount(bookBlank[sector]);
+  dropped = bookDropped;
+}
+
+void historyFormat() {
+  if (!flashOpen()) return;
+  flashErase(0, flashSize());
+  eraseSegment = -1;
+  ready = false;
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==================== TRANSACTION HISTORY ====================
+//
+// Append-only record of what the device signed and received, kept in the
+// "history" data partition (partitions.csv) so the host does not have to
+// replay everything on connect.
+//
+// Layout: an address book of destinations, then HISTORY_SEGMENT_SIZE
+// segments. Each segment has HISTORY_INDEX_SECTORS of header and index
+// followed by HISTORY_SEGMENT_RECORDS fixed 64-byte records.
+//
+// The newest segment is filled in place, with its digests and destinations
+// mirrored in RAM. When it is full it is sealed: two sorted indexes
+// (digest prefix -> slot, destination -> slot) are written into its index
+// sectors once. Lookups binary-search every sealed segment and scan the
+// mirror of the open one, so a query costs O(segments * log n) small flash
+// reads. Nothing is ever rewritten in place. When the partition is full the
+// oldest segment is erased together with its index, so no index rebuild is
+// ever needed. Erasing is done a sector at a time by historyMaintain.
+//
+// The address book holds HISTORY_BOOK_ENTRIES destinations, 32 per sector.
+// When it is full, a sector that no live record points into (its records
+// went with the segments that were reused) is erased and refilled. Only if
+// every sector is still in use is a new destination stored as
+// HISTORY_NO_DEST; historyBookStats counts those.
+//
+// The native build keeps the partition in RAM with NOR semantics (writes
+// only clear bits) so the same code can be benchmarked on the host.
+
+#define HISTORY_SECTOR          4096
+#define HISTORY_SEGMENT_SIZE    65536
+#define HISTORY_INDEX_SECTORS   3
+#define HISTORY_SEGMENT_RECORDS 832   // (64 KiB - 3 sectors) / 64
+#define HISTORY_MAX_SEGMENTS    32
+#define HISTORY_BOOK_SIZE       65536
+#define HISTORY_BOOK_ENTRIES    512   // 128-byte entries
+#define HISTORY_DEST_MAX        114
+#define HISTORY_NO_DEST         0xFFFF
+#define HISTORY_PARTITION_SIZE  0x150000  // Native build; the device uses the partition size
+
+enum HistoryKind { HISTORY_SIGNED = 1, HISTORY_RECEIVED = 2 };
+
+enum HistoryCoin { HISTORY_COIN_YDA = 0, HISTORY_COIN_SAL = 1 };
+
+struct HistoryRecord {
+  uint32_t seq;         // Global sequence number, written last as the commit
+  uint32_t timestamp;   // Unix seconds from the host (SET_TIME), 0 if unknown
+  int64_t amount;       // Atomic units, 0 if unknown
+  uint8_t digest[32];   // Signed message, or key image for received outputs
+  uint16_t destId;      // Address book entry, HISTORY_NO_DEST if none
+  uint8_t coin;
+  uint8_t kind;
+  uint8_t reserved[8];
+  uint32_t crc;         // CRC-32 of everything after seq, up to here
+};
+
+static_assert(sizeof(HistoryRecord) == 64, "history records are 64 bytes");
+
+// Called for each match, newest first; return false to stop
+typedef bool (*HistoryVisitor)(const HistoryRecord& rec, void* ctx);
+
+// Mount the partition and find the open segment. False if there is none.
+bool historyBegin();
+bool historyReady();
+
+// Records currently stored
+uint32_t historyCount();
+
+bool historyAppend(HistoryKind kind, HistoryCoin coin, const uint8_t digest[32], int64_t amount,
+                   const char* destination, uint32_t timestamp);
+
+bool historyFindDigest(const uint8_t digest[32], HistoryRecord& out);
+
+// Records sent to destination, newest first. Returns the number visited.
+int historyFindDestination(const char* destination, HistoryVisitor fn, void* ctx);
+
+// n-th newest record (0 = newest), for paging
+bool historyRead(uint32_t n, HistoryRecord& out);
+
+// Destination string of an address book entry. False if destId is unused.
+bool historyDestination(uint16_t destId, char out[HISTORY_DEST_MAX + 1]);
+
+// Erase one sector of the next segment ahead of time. True while more is pending.
+bool historyMaintain();
+bool historyMaintenancePending();
+
+// Address book entries in use, and destinations stored as HISTORY_NO_DEST
+// since boot because every entry was taken by a live record
+void historyBookStats(int& used, uint32_t& dropped);
+
+// Flash reads since boot (for the native bench)
+uint32_t historyFlashReads();
+
+// Erase everything (native bench)
+void historyFormat();
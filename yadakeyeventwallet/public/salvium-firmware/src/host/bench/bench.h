@@ -0,0 +1,29 @@
+#pragma once
+
+// Native benchmarks: signing (bench_sign.cpp), scanning (bench_scan.cpp),
+// subaddress derivation (bench_addrs.cpp), history lookups
+// (bench_history.cpp), the DRBG (bench_rng.cpp) and the no-heap check of
+// the wallet API (bench_alloc.cpp, exits 1 on any allocation).
+//
+//   pio run -e native_bench
+//   .pio/build/native_bench/program sign [txs] [inputs]
+//   .pio/build/native_bench/program scan [outputs]
+//   .pio/build/native_bench/program addrs [count]
+//   .pio/build/native_bench/program history [records]
+//   .pio/build/native_bench/program rng [draws]
+//   .pio/build/native_bench/program alloc
+
+#include <stdint.h>
+#include <time.h>
+#include <string>
+
+int benchSign(int argc, char** argv);
+int benchScan(int argc, char** argv);
+int benchAddrs(int argc, char** argv);
+int benchHistory(int argc, char** argv);
+int benchRng(int argc, char** argv);
+int benchAlloc(int argc, char** argv);
+
+void appendHex(std::string& out, const uint8_t* data, size_t len);
+void randomPoint(uint8_t out[32]);
+double elapsedMs(const struct timespec& start);
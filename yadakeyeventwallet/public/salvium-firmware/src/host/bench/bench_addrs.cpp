@@ -0,0 +1,92 @@
+// Derives a GET_ADDRESSES range of Salvium subaddresses in ADDR_BATCH
+// batches with one thread and with all threads, checks that both agree and
+// that every 64th one matches a direct computation, and prints the
+// throughput.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+#include <vector>
+
+#include "../../addresses.h"
+#include "../../crypto/base58.h"
+#include "../../crypto/random.h"
+#include "../../parallel.h"
+#include "bench.h"
+
+static AddressContext ctx;
+
+// Returns elapsed ms
+static double deriveAll(std::vector<std::string>& out, uint32_t count) {
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  out.clear();
+  addressesBegin(ctx, ADDR_COIN_SAL, 1);
+  for (uint32_t first = 0; first < count; first += ADDR_BATCH) {
+    int n = count - first < ADDR_BATCH ? (int)(count - first) : ADDR_BATCH;
+    addressesDerive(ctx, first, n);
+    for (int k = 0; k < n; k++) out.push_back(ctx.out[k]);
+  }
+  addressesEnd(ctx);
+  return elapsedMs(start);
+}
+
+// D = (b + m)*G, C = a*D for account 1
+static bool checkDirect(const std::string& address, uint32_t index, const uint8_t spend[32]) {
+  uint8_t a[32], data[48], m[32], d[32];
+  derive_view_key(a, spend);
+  memcpy(data, "SubAddr", 8);
+  memcpy(data + 8, a, 32);
+  const uint32_t idx[2] = {1, index};
+  for (int i = 0; i < 8; i++) data[40 + i] = (uint8_t)(idx[i / 4] >> (8 * (i % 4)));
+  hash_to_scalar(data, sizeof(data), m);
+  sc_add(d, m, spend);
+
+  ge_p3 D, C;
+  ge_scalarmult_base(D, d);
+  ge_scalarmult(C, a, D);
+  uint8_t raw[8 + 64 + 32];
+  size_t n = write_varint(raw, SAL_SUBADDRESS_PREFIX);
+  ge_tobytes(raw + n, D);
+  ge_tobytes(raw + n + 32, C);
+  n += 64;
+  uint8_t checksum[32];
+  keccak256(raw, n, checksum);
+  memcpy(raw + n, checksum, 4);
+
+  char expect[ADDR_MAX_LEN + 1];
+  base58_encode(expect, raw, n + 4);
+  return address == expect;
+}
+
+int benchAddrs(int argc, char** argv) {
+  uint32_t count = argc > 1 ? (uint32_t)atoi(argv[1]) : 1000;
+  if (count < 1) count = 1;
+
+  char spendHex[65];
+  uint8_t spend[32];
+  randomScalar(spend);
+  for (int i = 0; i < 32; i++) sprintf(spendHex + 2 * i, "%02x", spend[i]);
+  walletSetSalviumSpendHex(spendHex);
+
+  std::vector<std::string> seq, par;
+  parallelSetThreads(1);
+  double seqMs = deriveAll(seq, count);
+  parallelSetThreads(PARALLEL_MAX_THREADS);
+  double parMs = deriveAll(par, count);
+
+  for (uint32_t n = 0; n < count; n++) {
+    if (seq[n] != par[n] || seq[n].size() != ADDR_MAX_LEN || (n % 64 == 0 && !checkDirect(seq[n], n, spend))) {
+      fprintf(stderr, "[BENCH] subaddress 1/%u: wrong result\n", n);
+      return 1;
+    }
+  }
+
+  printf("[BENCH] addrs: %u subaddresses of account 1\n", count);
+  printf("[BENCH] 1 thread:  %8.1f ms (%.0f addresses/s)\n", seqMs, count * 1000.0 / seqMs);
+  printf("[BENCH] %d threads: %8.1f ms (%.0f addresses/s)\n", PARALLEL_MAX_THREADS, parMs, count * 1000.0 / parMs);
+  printf("[BENCH] Threads agree, sampled addresses correct\n");
+  return 0;
+}
@@ -0,0 +1,142 @@
+// Checks that the wallet arena API never touches the heap: malloc and
+// operator new are counted while every wallet, balance and amount call
+// runs, and any count but zero fails. A deliberate allocation first proves
+// the counters are wired in.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <new>
+
+#include "../../amount.h"
+#include "../../coins.h"
+#include "../../wallet.h"
+#include "bench.h"
+
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* p, size_t size);
+extern "C" void __libc_free(void* p);
+
+static std::atomic<bool> armed(false);
+static std::atomic<uint32_t> mallocs(0);
+static std::atomic<uint32_t> news(0);
+
+extern "C" void* malloc(size_t size) {
+  if (armed.load(std::memory_order_relaxed)) mallocs++;
+  return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size) {
+  if (armed.load(std::memory_order_relaxed)) mallocs++;
+  return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* p, size_t size) {
+  if (armed.load(std::memory_order_relaxed)) mallocs++;
+  return __libc_realloc(p, size);
+}
+
+extern "C" void free(void* p) {
+  __libc_free(p);
+}
+
+void* operator new(size_t size) {
+  if (armed.load(std::memory_order_relaxed)) news++;
+  void* p = __libc_malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+  __libc_free(p);
+}
+
+void operator delete[](void* p) noexcept {
+  __libc_free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  __libc_free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+  __libc_free(p);
+}
+
+static void arm() {
+  mallocs = 0;
+  news = 0;
+  armed = true;
+}
+
+static uint32_t disarm() {
+  armed = false;
+  return mallocs + news;
+}
+
+// Every call the serial and UI paths make on the arena
+static bool walletCalls() {
+  static const char spendHex[] = "0f1e2d3c4b5a69788796a5b4c3d2e1f00112233445566778899aabbccddeeff0";
+  static const char ydaAddress[] = "YDA0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcd";
+  char hex[WALLET_KEY_HEX_LEN + 1];
+  uint8_t key[32];
+  char text[AMOUNT_TEXT_MAX + COIN_TICKER_MAX + 2];
+  int64_t atomic;
+  bool ok = true;
+
+  ok &= walletSetSalviumSpendHex(spendHex);
+  walletSalviumSpendHex(hex);
+  ok &= strcmp(hex, spendHex) == 0;
+  walletSalviumSpendKey(key);
+  ok &= walletSetYadaAddress(ydaAddress);
+  ok &= walletSetSalviumAddress("SaLv-not-a-real-address");
+  ok &= !walletSetSalviumAddress("SaLv-this-one-is-far-too-long-for-the-arena-slot-so-it-is-refused-"
+                                 "and-the-old-address-stays-where-it-was");
+
+  ok &= amountParse("16777217.00000001", YadaCoin::atomicDecimals, atomic);
+  coinBalance<YadaCoin>(YadaCoin::tag, true)->atomic = atomic;
+  ok &= amountParse("5e-7", Salvium::atomicDecimals, atomic);
+  WalletBalance* asset = coinBalance<Salvium>(coinTag("SAL1", 4), true);
+  ok &= asset != nullptr;
+  if (asset) *asset = {coinTag("SAL1", 4), atomic};
+  ok &= coinBalance<Salvium>(coinTag("SAL1", 4), false) == asset;
+  ok &= coinBalance<YadaCoin>(coinTag("SAL1", 4), true) == nullptr;
+  coinFormat<YadaCoin>(text, sizeof(text), YadaCoin::balances()[0].atomic);
+  ok &= strcmp(text, "16777217.0000 YDA") == 0;
+  amountFormat(text, sizeof(text), atomic, Salvium::atomicDecimals);
+  ok &= strcmp(text, "0.0000005") == 0;
+
+  memwipe(hex, sizeof(hex));
+  memwipe(key, sizeof(key));
+  walletWipeSecrets();
+  walletWipe();
+  ok &= wallet.yadacoinAddress[0] == '\0' && YadaCoin::balances()[0].atomic == 0;
+  return ok;
+}
+
+int benchAlloc(int argc, char** argv) {
+  (void)argc;
+  (void)argv;
+
+  arm();
+  void* (*volatile alloc)(size_t) = malloc;
+  free(alloc(16));
+  ::operator delete(::operator new(16));
+  if (disarm() != 2) {
+    fprintf(stderr, "[ALLOC] counters not hooked in\n");
+    return 1;
+  }
+
+  arm();
+  bool ok = walletCalls();
+  uint32_t count = disarm();
+  printf("[ALLOC] wallet API: %u heap allocation(s), results %s\n", count, ok ? "ok" : "WRONG");
+  return ok && count == 0 ? 0 : 1;
+}
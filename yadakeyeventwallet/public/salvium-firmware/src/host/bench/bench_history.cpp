@@ -0,0 +1,165 @@
+// Fills the history store (RAM flash) with synthetic records, one in four
+// sent to one of 64 destinations, remounts it as after a reboot, and checks
+// digest lookups, destination lookups and paging against the inserted
+// records. Prints the time and flash reads per query. Then checks that the
+// address book recycles: a fresh store gets more distinct destinations than
+// the book holds, a few at a time, and every stored record must still name
+// its own.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+#include "../../crypto/keccak.h"
+#include "../../history.h"
+#include "bench.h"
+
+struct BenchEntry {
+  uint8_t digest[32];
+  int dest;  // -1 if none
+};
+
+static void destName(int d, char out[HISTORY_DEST_MAX + 1]) {
+  snprintf(out, HISTORY_DEST_MAX + 1, "SC1bench%04d", d);
+}
+
+static void makeDigest(uint32_t n, uint8_t out[32]) {
+  uint8_t le[4] = {(uint8_t)n, (uint8_t)(n >> 8), (uint8_t)(n >> 16), (uint8_t)(n >> 24)};
+  keccak256(le, 4, out);
+}
+
+struct DestCheck {
+  uint32_t firstSeq;
+  uint32_t lastSeq;  // Records are visited newest first
+  bool ok;
+};
+
+static bool visitDest(const HistoryRecord& rec, void* ctx) {
+  DestCheck* c = (DestCheck*)ctx;
+  if (rec.seq >= c->lastSeq || rec.seq < c->firstSeq) c->ok = false;
+  c->lastSeq = rec.seq;
+  return true;
+}
+
+// Destination n / 64 for record n: about 260 live at a time, 3 x the book over the run
+static bool checkBookRecycling() {
+  const int records = 3 * HISTORY_BOOK_ENTRIES * 64;
+  historyFormat();
+  if (!historyBegin()) return false;
+  char name[HISTORY_DEST_MAX + 1], stored[HISTORY_DEST_MAX + 1];
+  uint8_t digest[32];
+  for (int n = 0; n < records; n++) {
+    makeDigest(n, digest);
+    destName(n / 64, name);
+    historyAppend(HISTORY_SIGNED, HISTORY_COIN_SAL, digest, n, name, 0);
+    while (historyMaintain()) {}
+  }
+  historyBegin();
+  HistoryRecord rec;
+  for (uint32_t k = 0; k < historyCount(); k++) {
+    if (!historyRead(k, rec)) return false;
+    destName(rec.seq / 64, name);
+    if (!historyDestination(rec.destId, stored) || strcmp(stored, name) != 0) {
+      fprintf(stderr, "[BENCH] history: record %u lost its destination\n", rec.seq);
+      return false;
+    }
+  }
+  int used;
+  uint32_t dropped;
+  historyBookStats(used, dropped);
+  printf("[BENCH] book:    %d destinations over %d records, %d entries in use, %u dropped\n", records / 64, records,
+         used, dropped);
+  return dropped == 0;
+}
+
+int benchHistory(int argc, char** argv) {
+  int count = argc > 1 ? atoi(argv[1]) : 16000;
+  if (count < 1) count = 1;
+  srand(1);
+
+  historyFormat();
+  if (!historyBegin()) {
+    fprintf(stderr, "[BENCH] history: mount failed\n");
+    return 1;
+  }
+
+  std::vector<BenchEntry> entries(count);
+  char name[HISTORY_DEST_MAX + 1];
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (int n = 0; n < count; n++) {
+    BenchEntry& e = entries[n];
+    makeDigest(n, e.digest);
+    e.dest = rand() % 4 == 0 ? rand() % 64 : -1;
+    if (e.dest >= 0) destName(e.dest, name);
+    historyAppend(HISTORY_SIGNED, HISTORY_COIN_SAL, e.digest, n, e.dest >= 0 ? name : nullptr, 1700000000 + n);
+    while (historyMaintain()) {}
+  }
+  double appendMs = elapsedMs(start);
+
+  // Remount: the open segment is read back, sealed ones are not
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  historyBegin();
+  double mountMs = elapsedMs(start);
+
+  uint32_t stored = historyCount();
+  uint32_t firstSeq = (uint32_t)count - stored;
+  HistoryRecord rec;
+  if (stored == 0 || !historyRead(stored - 1, rec) || rec.seq != firstSeq) {
+    fprintf(stderr, "[BENCH] history: oldest record is wrong\n");
+    return 1;
+  }
+
+  const int queries = 1000;
+  uint32_t readsBefore = historyFlashReads();
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (int q = 0; q < queries; q++) {
+    uint32_t n = firstSeq + (uint32_t)rand() % stored;
+    if (!historyFindDigest(entries[n].digest, rec) || rec.seq != n || rec.amount != (int64_t)n) {
+      fprintf(stderr, "[BENCH] history: digest lookup %u failed\n", n);
+      return 1;
+    }
+  }
+  double digestMs = elapsedMs(start);
+  uint32_t digestReads = historyFlashReads() - readsBefore;
+
+  // Evicted records must be gone
+  if (firstSeq > 0 && historyFindDigest(entries[0].digest, rec)) {
+    fprintf(stderr, "[BENCH] history: evicted record still found\n");
+    return 1;
+  }
+
+  readsBefore = historyFlashReads();
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  int visited = 0;
+  for (int d = 0; d < 64; d++) {
+    destName(d, name);
+    DestCheck check = {firstSeq, 0xFFFFFFFF, true};
+    int found = historyFindDestination(name, visitDest, &check);
+    int expected = 0;
+    for (uint32_t n = firstSeq; n < (uint32_t)count; n++) expected += entries[n].dest == d;
+    if (!check.ok || found != expected) {
+      fprintf(stderr, "[BENCH] history: destination %d found %d of %d\n", d, found, expected);
+      return 1;
+    }
+    visited += found;
+  }
+  double destMs = elapsedMs(start);
+  uint32_t destReads = historyFlashReads() - readsBefore;
+
+  printf("[BENCH] history: %d appended, %u stored\n", count, stored);
+  printf("[BENCH] append:  %8.1f ms (%.1f us/record)\n", appendMs, appendMs * 1000.0 / count);
+  printf("[BENCH] mount:   %8.2f ms\n", mountMs);
+  printf("[BENCH] digest:  %8.3f ms/query, %.1f flash reads/query\n", digestMs / queries,
+         (double)digestReads / queries);
+  printf("[BENCH] dest:    %8.3f ms/query, %.1f flash reads/record (%d records)\n", destMs / 64,
+         (double)destReads / visited, visited);
+  if (!checkBookRecycling()) {
+    fprintf(stderr, "[BENCH] history: address book did not recycle\n");
+    return 1;
+  }
+  printf("[BENCH] All lookups correct\n");
+  return 0;
+}
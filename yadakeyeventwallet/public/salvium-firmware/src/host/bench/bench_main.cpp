@@ -0,0 +1,45 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "../../crypto/cryptonote.h"
+#include "../../crypto/random.h"
+#include "../../parallel.h"
+#include "bench.h"
+
+void appendHex(std::string& out, const uint8_t* data, size_t len) {
+  static const char digits[] = "0123456789abcdef";
+  for (size_t k = 0; k < len; k++) {
+    out += digits[data[k] >> 4];
+    out += digits[data[k] & 15];
+  }
+}
+
+void randomPoint(uint8_t out[32]) {
+  uint8_t s[32];
+  randomScalar(s);
+  secret_to_public(out, s);
+}
+
+double elapsedMs(const struct timespec& start) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (now.tv_sec - start.tv_sec) * 1e3 + (now.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+int main(int argc, char** argv) {
+  ed25519_init();
+  parallelBegin();
+
+  const char* mode = argc > 1 ? argv[1] : "sign";
+  if (strcmp(mode, "sign") == 0) return benchSign(argc - 1, argv + 1);
+  if (strcmp(mode, "scan") == 0) return benchScan(argc - 1, argv + 1);
+  if (strcmp(mode, "addrs") == 0) return benchAddrs(argc - 1, argv + 1);
+  if (strcmp(mode, "history") == 0) return benchHistory(argc - 1, argv + 1);
+  if (strcmp(mode, "rng") == 0) return benchRng(argc - 1, argv + 1);
+  if (strcmp(mode, "alloc") == 0) return benchAlloc(argc - 1, argv + 1);
+
+  fprintf(stderr, "usage: %s sign [txs] [inputs] | scan [outputs] | addrs [count] | history [records] | "
+                  "rng [draws] | alloc\n", argv[0]);
+  return 2;
+}
@@ -0,0 +1,78 @@
+// Checks that the start-up health tests reject a stuck and a biased source
+// and pass the OS CSPRNG, then times 32-byte draws from the DRBG against
+// reading the source directly, and nonce derivation, and prints how many
+// source bytes the DRBG consumed.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../../crypto/random.h"
+#include "bench.h"
+
+static FILE* urandom = nullptr;
+
+static void osSource(void* buf, size_t len) {
+  if (fread(buf, 1, len, urandom) != len) abort();
+}
+
+static void stuckSource(void* buf, size_t len) {
+  memset(buf, 0xA5, len);
+}
+
+// Two bits per byte: passes the repetition count, fails adaptive proportion
+static void biasedSource(void* buf, size_t len) {
+  uint8_t* out = (uint8_t*)buf;
+  for (size_t i = 0; i < len; i++) out[i] = (uint8_t)(rand() & 3);
+}
+
+int benchRng(int argc, char** argv) {
+  uint32_t draws = argc > 1 ? (uint32_t)atoi(argv[1]) : 200000;
+  if (draws < 1) draws = 1;
+  urandom = fopen("/dev/urandom", "rb");
+  if (!urandom) {
+    fprintf(stderr, "[BENCH] /dev/urandom unavailable\n");
+    return 1;
+  }
+
+  if (randomBegin(stuckSource) || randomBegin(biasedSource) || !randomBegin(osSource)) {
+    fprintf(stderr, "[BENCH] health tests: wrong result\n");
+    return 1;
+  }
+
+  uint8_t out[32];
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint32_t n = 0; n < draws; n++) osSource(out, sizeof(out));
+  double sourceMs = elapsedMs(start);
+
+  uint32_t reseeds0, bytes0, reseeds1, bytes1;
+  randomStats(reseeds0, bytes0);
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint32_t n = 0; n < draws; n++) randomBytes(out, sizeof(out));
+  double drbgMs = elapsedMs(start);
+  randomStats(reseeds1, bytes1);
+
+  uint8_t secret[32], message[32];
+  randomBytes(secret, 32);
+  randomBytes(message, 32);
+  uint32_t nonces = draws / 10 + 1;
+  NonceStream ns;
+  nonceBegin(ns, secret);
+  nonceAbsorb(ns, message, 32);
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint32_t n = 0; n < nonces; n++) nonceScalar(ns, out);
+  double nonceMs = elapsedMs(start);
+  nonceEnd(ns);
+  fclose(urandom);
+
+  double mb = draws * 32.0 / (1024 * 1024);
+  printf("[BENCH] rng: %u draws of 32 bytes\n", draws);
+  printf("[BENCH] source:  %8.1f ms (%.1f MB/s)\n", sourceMs, mb * 1000.0 / sourceMs);
+  printf("[BENCH] DRBG:    %8.1f ms (%.1f MB/s), %u reseeds = %u source bytes\n", drbgMs, mb * 1000.0 / drbgMs,
+         reseeds1 - reseeds0, (reseeds1 - reseeds0) * 32);
+  printf("[BENCH] nonces:  %8.1f ms (%.0f scalars/s)\n", nonceMs, nonces * 1000.0 / nonceMs);
+  printf("[BENCH] Health tests reject stuck and biased sources\n");
+  return 0;
+}
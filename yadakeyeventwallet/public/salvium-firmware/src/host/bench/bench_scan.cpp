@@ -0,0 +1,158 @@
+// Scans synthetic outputs (one in eight ours, two outputs per transaction,
+// half of the transactions to a subaddress of account 0) in
+// SCAN_OUTPUTS-sized requests with one thread and with all threads, checks
+// the matches, subaddress indexes and key images against a direct
+// computation, and prints the throughput. The subaddress table is built
+// once beforehand and timed on its own.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+#include <vector>
+
+#include "../../addresses.h"
+#include "../../crypto/random.h"
+#include "../../parallel.h"
+#include "../../scanner.h"
+#include "bench.h"
+
+struct BenchOutput {
+  uint8_t txPub[32];
+  uint32_t index;
+  uint8_t key[32];
+  bool ours;
+  uint32_t subaddress;
+  uint8_t keyImage[32];
+};
+
+// Spend and view keys of subaddress (0, index): D and C = a*D, or B and A
+// for the primary address
+static void subaddressKeys(uint32_t index, const uint8_t spend[32], const uint8_t view[32], uint8_t D[32],
+                           uint8_t C[32], uint8_t m[32]) {
+  memset(m, 0, 32);
+  if (index == 0) {
+    secret_to_public(D, spend);
+    secret_to_public(C, view);
+    return;
+  }
+  ge_p3 P, aP;
+  uint8_t x[32];
+  subaddressScalar(m, view, 0, index);
+  sc_add(x, spend, m);
+  secret_to_public(D, x);
+  ge_frombytes_vartime(P, D);
+  ge_scalarmult(aP, view, P);
+  ge_tobytes(C, aP);
+}
+
+static std::vector<BenchOutput> makeOutputs(int count, const uint8_t spend[32], const uint8_t view[32]) {
+  std::vector<BenchOutput> outs(count);
+  uint8_t r[32], derivation[32], D[32], C[32], m[32];
+  uint32_t subaddress = 0;
+  for (int n = 0; n < count; n++) {
+    BenchOutput& o = outs[n];
+    o.index = (uint32_t)(n & 1);
+    if (o.index == 0) {
+      // R = r*G to the primary address, r*D to a subaddress
+      subaddress = rand() % 2 ? 1 + (uint32_t)rand() % (SCAN_SUBADDRESSES - 1) : 0;
+      subaddressKeys(subaddress, spend, view, D, C, m);
+      randomScalar(r);
+      generate_key_derivation(derivation, C, r);
+      ge_p3 Dp, R;
+      ge_frombytes_vartime(Dp, D);
+      if (subaddress == 0) {
+        ge_scalarmult_base(R, r);
+      } else {
+        ge_scalarmult(R, r, Dp);
+      }
+      ge_tobytes(o.txPub, R);
+    } else {
+      memcpy(o.txPub, outs[n - 1].txPub, 32);
+    }
+
+    o.ours = rand() % 8 == 0;
+    o.subaddress = subaddress;
+    if (o.ours) {
+      uint8_t x[32];
+      derive_public_key(o.key, derivation, o.index, D);
+      derive_secret_key(x, derivation, o.index, spend);
+      sc_add(x, x, m);
+      generate_key_image(o.keyImage, o.key, x);
+    } else {
+      randomPoint(o.key);
+    }
+  }
+  return outs;
+}
+
+// Returns elapsed ms, or -1 if a result is wrong
+static double scanAll(const std::vector<BenchOutput>& outs, const uint8_t spend[32]) {
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (size_t first = 0; first < outs.size(); first += SCAN_MAX_OUTPUTS) {
+    size_t last = first + SCAN_MAX_OUTPUTS < outs.size() ? first + SCAN_MAX_OUTPUTS : outs.size();
+    std::string hex;
+    for (size_t n = first; n < last; n++) {
+      uint8_t le[4] = {(uint8_t)outs[n].index, 0, 0, 0};
+      appendHex(hex, outs[n].txPub, 32);
+      appendHex(hex, le, 4);
+      appendHex(hex, outs[n].key, 32);
+    }
+    if (scannerLoad(hex.c_str(), spend) != SCANNER_OK) return -1;
+
+    uint8_t progress;
+    ScannerStatus status;
+    while ((status = scannerStep(&progress)) == SCANNER_RUNNING) {}
+    if (status != SCANNER_DONE) return -1;
+
+    for (size_t n = first; n < last; n++) {
+      const BenchOutput& o = outs[n];
+      int k = (int)(n - first);
+      bool match = scannerIsMatch(k);
+      if (match != o.ours ||
+          (match && (scannerSubaddress(k) != o.subaddress || memcmp(scannerKeyImage(k), o.keyImage, 32) != 0))) {
+        fprintf(stderr, "[BENCH] output %zu: wrong scan result\n", n);
+        return -1;
+      }
+    }
+    scannerClear();
+  }
+  return elapsedMs(start);
+}
+
+int benchScan(int argc, char** argv) {
+  int count = argc > 1 ? atoi(argv[1]) : 2048;
+  if (count < 2) count = 2;
+  srand(1);
+
+  uint8_t spend[32], view[32];
+  randomScalar(spend);
+  derive_view_key(view, spend);
+
+  std::vector<BenchOutput> outs = makeOutputs(count, spend, view);
+  int ours = 0, toSubaddress = 0;
+  for (const BenchOutput& o : outs) {
+    ours += o.ours;
+    toSubaddress += o.ours && o.subaddress > 0;
+  }
+
+  // First request for these keys: builds the subaddress table
+  parallelSetThreads(PARALLEL_MAX_THREADS);
+  std::vector<BenchOutput> first(outs.begin(), outs.begin() + 2);
+  double tableMs = scanAll(first, spend);
+
+  parallelSetThreads(1);
+  double seqMs = scanAll(outs, spend);
+  parallelSetThreads(PARALLEL_MAX_THREADS);
+  double parMs = scanAll(outs, spend);
+  if (tableMs < 0 || seqMs < 0 || parMs < 0) return 1;
+
+  printf("[BENCH] scan: %d outputs, %d ours (%d to subaddresses)\n", count, ours, toSubaddress);
+  printf("[BENCH] table:     %8.1f ms (%d subaddresses, first request)\n", tableMs, SCAN_SUBADDRESSES);
+  printf("[BENCH] 1 thread:  %8.1f ms (%.0f outputs/s)\n", seqMs, count * 1000.0 / seqMs);
+  printf("[BENCH] %d threads: %8.1f ms (%.0f outputs/s)\n", PARALLEL_MAX_THREADS, parMs, count * 1000.0 / parMs);
+  printf("[BENCH] All matches, subaddresses and key images correct\n");
+  return 0;
+}
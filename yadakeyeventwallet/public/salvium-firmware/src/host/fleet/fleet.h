@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// ==================== FLEET ====================
+//
+// Host daemon for several wallets on USB serial (fleet_daemon.cpp) and a
+// client that measures signing throughput through it (fleet_bench.cpp).
+//
+// Local socket API, one line per request or reply (Unix stream socket):
+//
+//   SIGN <id> <coin> <address|*> <tx>   ->  OK <id> <device> <signature>
+//                                           ERR <id> <reason>
+//   DEVICES                             ->  DEVICE <path> <state> <rng> <signed>
+//                                             <failed> <avg ms> <yda> <sal>
+//                                           ... END
+//
+// <id> is the caller's (no spaces) and comes back in the reply, so a client
+// can keep many requests in flight on one connection; replies arrive in
+// completion order. <address> picks the devices that hold the key (the
+// address the device reports in GET_ADDRESSES for <coin>), * takes any.
+// <tx> is sent to the device as SIGN_TX:<coin>:<tx>. Reasons: BAD_REQUEST,
+// NO_DEVICE (no device holds the key), TIMEOUT, FAILED (every attempt lost
+// its device) or the device's own SIGN:<error>.
+//
+// Every request needs a physical Confirm: the device shows it on its review
+// screen (SIGN:REVIEW) and only sends the signature once Confirm is tapped.
+// The device stays busy until then, so the OK can take up to its 60 s review
+// timeout, and SIGN:REJECTED or SIGN:TIMEOUT come back as the reason.
+
+#define FLEET_SOCKET "/tmp/yada-fleet.sock"
+
+double nowMs();
+
+// Next complete line of pending without the line ending
+bool takeLine(std::string& pending, std::string& line);
+
+int runFleetDaemon(const char* socketPath, const std::vector<std::string>& ports);
+int runFleetBench(const char* socketPath, int count, int window, const char* address);
@@ -0,0 +1,165 @@
+// Throughput client for the fleet daemon: keeps --window SIGN requests in
+// flight on one connection and reports signatures/s, p50/p99 latency and
+// how many each device signed. Run it with one, two, four... simulators
+// behind the daemon to see throughput follow the device count.
+//
+// Requests are SIGN_TX:SAL payloads to the device's own primary address
+// (host/txgen), so they sign like real spends. Every one needs Confirm on
+// the device; run simulators with --confirm.
+//
+// Exits 1 on any ERR reply or if the daemon stops answering.
+
+#include <errno.h>
+#include <math.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <algorithm>
+#include <map>
+
+#include "../../crypto/cryptonote.h"
+#include "../txgen/txgen.h"
+#include "fleet.h"
+
+#define BENCH_READY_TIMEOUT_MS 20000
+#define BENCH_REPLY_TIMEOUT_MS 90000  // Beyond the daemon's own SIGN_TIMEOUT_MS
+#define BENCH_INPUTS           1
+#define BENCH_RING             16
+
+static int connectTo(const char* path) {
+  struct sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (strlen(path) >= sizeof(addr.sun_path)) return -1;
+  strcpy(addr.sun_path, path);
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) return -1;
+  if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+static bool sendAll(int fd, const std::string& s) {
+  size_t sent = 0;
+  while (sent < s.size()) {
+    ssize_t n = write(fd, s.data() + sent, s.size() - sent);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return false;
+    sent += n;
+  }
+  return true;
+}
+
+static bool readLine(int fd, std::string& pending, std::string& line, double deadline) {
+  while (!takeLine(pending, line)) {
+    int wait = (int)(deadline - nowMs());
+    if (wait <= 0) return false;
+    struct pollfd p = {fd, POLLIN, 0};
+    if (poll(&p, 1, wait) <= 0) continue;
+    char buf[8192];
+    ssize_t n = read(fd, buf, sizeof(buf));
+    if (n <= 0) return false;
+    pending.append(buf, n);
+  }
+  return true;
+}
+
+// Nearest rank on a sorted sample
+static double percentile(const std::vector<double>& sorted, double p) {
+  if (sorted.empty()) return 0;
+  size_t rank = (size_t)ceil(p * sorted.size());
+  return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+int runFleetBench(const char* socketPath, int count, int window, const char* address) {
+  int fd = connectTo(socketPath);
+  if (fd < 0) {
+    perror("[FLEET] connect");
+    return 1;
+  }
+  std::string pending, line;
+
+  // Devices boot and get health-checked before they take work
+  int ready = 0;
+  double readyDeadline = nowMs() + BENCH_READY_TIMEOUT_MS;
+  std::vector<std::string> listing;
+  while (ready == 0 && nowMs() < readyDeadline) {
+    if (!listing.empty()) usleep(500 * 1000);
+    listing.clear();
+    sendAll(fd, "DEVICES\n");
+    while (readLine(fd, pending, line, nowMs() + 5000) && line != "END") {
+      listing.push_back(line);
+      if (line.find(" ready ") != std::string::npos) ready++;
+    }
+  }
+  // * signs with the first ready device's key, the last field of its line
+  std::string target = address;
+  for (const std::string& dev : listing) {
+    printf("[FLEET] %s\n", dev.c_str());
+    if (target == "*" && dev.find(" ready ") != std::string::npos) target = dev.substr(dev.rfind(' ') + 1);
+  }
+  if (ready == 0) {
+    fprintf(stderr, "[FLEET] No ready device\n");
+    return 1;
+  }
+  ed25519_init();
+  uint8_t spendPub[32], viewPub[32];
+  if (!txgenParseAddress(target, spendPub, viewPub)) {
+    fprintf(stderr, "[FLEET] Not a primary Salvium address: %s\n", target.c_str());
+    return 1;
+  }
+
+  std::map<int, double> sentAt;
+  std::map<std::string, int> perDevice;
+  std::vector<double> latency;
+  int next = 0, failures = 0;
+  double start = nowMs();
+  while ((int)latency.size() + failures < count) {
+    // Distinct payloads (random messages), so each one is a new history record
+    while (next < count && (int)sentAt.size() < window) {
+      std::string tx = txgenSalPayload(spendPub, viewPub, BENCH_INPUTS, BENCH_RING);
+      sentAt[next] = nowMs();
+      if (!sendAll(fd, "SIGN " + std::to_string(next) + " SAL " + target + " " + tx + "\n")) {
+        perror("[FLEET] write");
+        return 1;
+      }
+      next++;
+    }
+    if (!readLine(fd, pending, line, nowMs() + BENCH_REPLY_TIMEOUT_MS)) {
+      fprintf(stderr, "[FLEET] No reply, %zu in flight\n", sentAt.size());
+      return 1;
+    }
+
+    // OK <id> <device> <signature> | ERR <id> <reason>
+    size_t a = line.find(' '), b = line.find(' ', a + 1);
+    if (a == std::string::npos || b == std::string::npos) continue;
+    int id = atoi(line.c_str() + a + 1);
+    auto it = sentAt.find(id);
+    if (it == sentAt.end()) continue;
+    double ms = nowMs() - it->second;
+    sentAt.erase(it);
+    if (line.compare(0, 3, "OK ") == 0) {
+      latency.push_back(ms);
+      perDevice[line.substr(b + 1, line.find(' ', b + 1) - b - 1)]++;
+    } else {
+      fprintf(stderr, "[FLEET] #%d: %s\n", id, line.c_str());
+      failures++;
+    }
+  }
+  double elapsed = nowMs() - start;
+  close(fd);
+
+  std::sort(latency.begin(), latency.end());
+  printf("[FLEET] %zu signed in %.1f ms, %d device(s) ready at start, %d failed, window %d\n", latency.size(), elapsed, ready,
+         failures, window);
+  printf("[FLEET] %.0f signatures/s  p50 %.3f  p99 %.3f  max %.3f ms\n", latency.size() * 1000.0 / elapsed,
+         percentile(latency, 0.50), percentile(latency, 0.99), latency.empty() ? 0 : latency.back());
+  for (auto& d : perDevice) printf("[FLEET]   %-24s %6d\n", d.first.c_str(), d.second);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,569 @@
+// Fleet daemon: every wallet's serial port and every client of the local
+// socket in one epoll loop on one thread. A device is synced with PING
+// (boot shows the splash screen first), then health-checked with
+// GET_ADDRESSES + GET_STATUS + PING, which also learns the keys it holds.
+// The firmware signs one transaction at a time (SIGN:BUSY otherwise), so
+// each device has at most one exchange in flight; signing requests wait in
+// one queue and go to the idle, healthy device holding the key that has
+// been idle longest. Throughput grows with the number of devices because
+// the daemon only moves lines while the devices sign.
+//
+// A device that stops answering is closed and reopened by the next rescan;
+// its request goes back to the head of the queue, up to SIGN_ATTEMPTS
+// devices per request.
+
+#include <errno.h>
+#include <fcntl.h>
+#include <glob.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <termios.h>
+#include <unistd.h>
+#include <deque>
+#include <map>
+
+#include "fleet.h"
+
+#define SYNC_TIMEOUT_MS    15000  // Boot (splash screen) before the first PONG
+#define SYNC_PING_MS       500
+#define HEALTH_INTERVAL_MS 5000   // Between checks of an idle device
+#define HEALTH_TIMEOUT_MS  3000
+#define SIGN_TIMEOUT_MS    75000  // Above the device's 60 s review, so its SIGN:TIMEOUT comes first
+#define QUEUE_TIMEOUT_MS   30000  // Waiting for a device that holds the key
+#define RESCAN_MS          2000
+#define SIGN_ATTEMPTS      3      // Devices tried before a request fails
+#define TICK_MS            100
+#define LINE_MAX_BYTES     16384  // Longer unterminated input drops the peer
+#define CLIENT_OUT_MAX     (1 << 20)
+
+// epoll_event.data.u64: tag in the top byte, device index or client id below
+#define TAG_LISTEN 1ull
+#define TAG_DEVICE 2ull
+#define TAG_CLIENT 3ull
+#define TAG_SHIFT  56
+#define TAG_MASK   ((1ull << TAG_SHIFT) - 1)
+
+enum DeviceState { DEV_CLOSED, DEV_SYNC, DEV_HEALTH, DEV_READY, DEV_SIGNING };
+
+static const char* stateNames[] = {"closed", "sync", "health", "ready", "signing"};
+
+struct SignRequest {
+  uint64_t client;
+  std::string id, coin, address, tx;
+  int attempts;
+  double deadline;  // In the queue
+};
+
+struct Device {
+  std::string path;
+  int fd = -1;
+  DeviceState state = DEV_CLOSED;
+  double deadline = 0;   // Current exchange
+  double nextPing = 0;   // While syncing
+  double nextHealth = 0;
+  double idleSince = 0;
+  std::string in, out;
+  std::string yda, sal;  // Addresses from the last health check
+  bool statusSeen = false;
+  bool identified = false;
+  bool rngOk = true;
+  SignRequest job;
+  double jobStart = 0;
+  uint64_t signedCount = 0, failedCount = 0;
+  double signMs = 0;
+};
+
+struct Client {
+  int fd;
+  std::string in, out;
+};
+
+static int epfd = -1;
+static int listenFd = -1;
+static std::vector<Device> devices;
+static std::map<uint64_t, Client> clients;
+static uint64_t nextClientId = 1;
+static std::deque<SignRequest> queue;
+static volatile sig_atomic_t stopRequested = 0;
+
+static void onSignal(int) {
+  stopRequested = 1;
+}
+
+static bool startsWith(const std::string& s, const char* prefix) {
+  return s.compare(0, strlen(prefix), prefix) == 0;
+}
+
+static void watch(int fd, uint64_t tag, uint64_t id, bool wantWrite, int op) {
+  struct epoll_event ev;
+  ev.events = EPOLLIN | EPOLLRDHUP | (wantWrite ? (uint32_t)EPOLLOUT : (uint32_t)0);
+  ev.data.u64 = (tag << TAG_SHIFT) | id;
+  epoll_ctl(epfd, op, fd, &ev);
+}
+
+// Write what the fd takes now, keep the rest and ask for EPOLLOUT
+static bool flush(int fd, std::string& out, uint64_t tag, uint64_t id) {
+  bool hadBacklog = !out.empty();
+  while (!out.empty()) {
+    ssize_t n = write(fd, out.data(), out.size());
+    if (n > 0) {
+      out.erase(0, n);
+    } else if (n < 0 && errno == EINTR) {
+      continue;
+    } else if (n < 0 && errno == EAGAIN) {
+      break;
+    } else {
+      return false;
+    }
+  }
+  if (hadBacklog || !out.empty()) watch(fd, tag, id, !out.empty(), EPOLL_CTL_MOD);
+  return true;
+}
+
+// ---- Clients ----
+
+static void closeClient(uint64_t id) {
+  auto it = clients.find(id);
+  if (it == clients.end()) return;
+  epoll_ctl(epfd, EPOLL_CTL_DEL, it->second.fd, nullptr);
+  close(it->second.fd);
+  clients.erase(it);
+}
+
+static void reply(uint64_t id, const std::string& line) {
+  auto it = clients.find(id);
+  if (it == clients.end()) return;  // Gone while its request was signed
+  Client& c = it->second;
+  bool idle = c.out.empty();
+  c.out += line;
+  c.out += '\n';
+  if (c.out.size() > CLIENT_OUT_MAX) {
+    fprintf(stderr, "[FLEET] Client %llu not reading, dropped\n", (unsigned long long)id);
+    closeClient(id);
+    return;
+  }
+  if (idle && !flush(c.fd, c.out, TAG_CLIENT, id)) closeClient(id);
+}
+
+static void fail(const SignRequest& req, const char* reason) {
+  reply(req.client, "ERR " + req.id + " " + reason);
+}
+
+// ---- Devices ----
+
+static bool holdsKey(const Device& dev, const SignRequest& req) {
+  if (!dev.identified) return false;
+  if (req.address == "*") return true;
+  if (req.coin == "YDA") return dev.yda == req.address;
+  if (req.coin == "SAL") return dev.sal == req.address;
+  return false;
+}
+
+static void sendDevice(Device& dev, const std::string& lines) {
+  bool idle = dev.out.empty();
+  dev.out += lines;
+  if (idle) flush(dev.fd, dev.out, TAG_DEVICE, &dev - devices.data());
+}
+
+static void requeue(SignRequest& req) {
+  if (++req.attempts >= SIGN_ATTEMPTS) {
+    fail(req, "FAILED");
+    return;
+  }
+  req.deadline = nowMs() + QUEUE_TIMEOUT_MS;
+  queue.push_front(std::move(req));
+}
+
+static void closeDevice(Device& dev, const char* why) {
+  if (dev.fd < 0) return;
+  fprintf(stderr, "[FLEET] %s: %s, closed\n", dev.path.c_str(), why);
+  if (dev.state == DEV_SIGNING) {
+    dev.failedCount++;
+    requeue(dev.job);
+  }
+  epoll_ctl(epfd, EPOLL_CTL_DEL, dev.fd, nullptr);
+  close(dev.fd);
+  dev.fd = -1;
+  dev.state = DEV_CLOSED;
+  dev.in.clear();
+  dev.out.clear();
+}
+
+static void startHealth(Device& dev) {
+  dev.state = DEV_HEALTH;
+  dev.statusSeen = false;
+  dev.deadline = nowMs() + HEALTH_TIMEOUT_MS;
+  // PONG after STATUS:READY closes the exchange; earlier PONGs answer sync pings
+  sendDevice(dev, "GET_ADDRESSES\nGET_STATUS\nPING\n");
+}
+
+static void becomeIdle(Device& dev) {
+  dev.state = DEV_READY;
+  dev.idleSince = nowMs();
+}
+
+static void startSign(Device& dev, SignRequest&& req) {
+  dev.job = std::move(req);
+  dev.state = DEV_SIGNING;
+  dev.jobStart = nowMs();
+  dev.deadline = dev.jobStart + SIGN_TIMEOUT_MS;
+  sendDevice(dev, "SIGN_TX:" + dev.job.coin + ":" + dev.job.tx + "\n");
+}
+
+// Idle, healthy, holds the key; the one idle longest spreads the load
+static Device* pickDevice(const SignRequest& req) {
+  Device* best = nullptr;
+  for (Device& dev : devices) {
+    if (dev.state != DEV_READY || !dev.rngOk || !holdsKey(dev, req)) continue;
+    if (!best || dev.idleSince < best->idleSince) best = &dev;
+  }
+  return best;
+}
+
+static void dispatch() {
+  for (auto it = queue.begin(); it != queue.end();) {
+    Device* dev = pickDevice(*it);
+    if (!dev) {
+      ++it;
+      continue;
+    }
+    startSign(*dev, std::move(*it));
+    it = queue.erase(it);
+  }
+}
+
+static void openDevice(Device& dev) {
+  int fd = open(dev.path.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (fd < 0) return;
+  // One host process per port: keep other openers out
+  ioctl(fd, TIOCEXCL);
+  struct termios t;
+  if (tcgetattr(fd, &t) == 0) {
+    cfmakeraw(&t);
+    cfsetspeed(&t, B115200);
+    t.c_cflag |= CLOCAL;
+    tcsetattr(fd, TCSANOW, &t);
+  }
+  dev.fd = fd;
+  dev.state = DEV_SYNC;
+  dev.deadline = nowMs() + SYNC_TIMEOUT_MS;
+  dev.nextPing = 0;
+  dev.identified = false;
+  dev.rngOk = true;
+  watch(fd, TAG_DEVICE, &dev - devices.data(), false, EPOLL_CTL_ADD);
+  fprintf(stderr, "[FLEET] %s: opened\n", dev.path.c_str());
+}
+
+static void rescan(const std::vector<std::string>& patterns) {
+  for (const std::string& pattern : patterns) {
+    glob_t g;
+    if (glob(pattern.c_str(), 0, nullptr, &g) != 0) continue;
+    for (size_t i = 0; i < g.gl_pathc; i++) {
+      size_t k = 0;
+      while (k < devices.size() && devices[k].path != g.gl_pathv[i]) k++;
+      if (k == devices.size()) {
+        devices.emplace_back();
+        devices.back().path = g.gl_pathv[i];
+      }
+      if (devices[k].fd < 0) openDevice(devices[k]);
+    }
+    globfree(&g);
+  }
+}
+
+static void onDeviceLine(Device& dev, const std::string& line) {
+  switch (dev.state) {
+    case DEV_SYNC:
+      if (line == "PONG") startHealth(dev);
+      break;
+
+    case DEV_HEALTH:
+      // Plain GET_ADDRESSES form only; ranged replies carry an index
+      if (startsWith(line, "ADDRESS:YDA:") && line.find(':', 12) == std::string::npos) {
+        dev.yda = line.substr(12);
+      } else if (startsWith(line, "ADDRESS:SAL:") && line.find(':', 12) == std::string::npos) {
+        dev.sal = line.substr(12);
+      } else if (line == "STATUS:READY") {
+        dev.statusSeen = true;
+      } else if (startsWith(line, "RNG:")) {
+        bool ok = startsWith(line, "RNG:OK");
+        if (ok != dev.rngOk) fprintf(stderr, "[FLEET] %s: RNG %s\n", dev.path.c_str(), ok ? "recovered" : "failed");
+        dev.rngOk = ok;
+      } else if (line == "PONG" && dev.statusSeen) {
+        if (!dev.identified) {
+          fprintf(stderr, "[FLEET] %s: ready, YDA %s, SAL %.16s...\n", dev.path.c_str(), dev.yda.c_str(),
+                  dev.sal.c_str());
+        }
+        dev.identified = true;
+        dev.nextHealth = nowMs() + HEALTH_INTERVAL_MS;
+        becomeIdle(dev);
+      }
+      break;
+
+    case DEV_SIGNING:
+      if (startsWith(line, "SIGNATURE:")) {
+        double ms = nowMs() - dev.jobStart;
+        dev.signedCount++;
+        dev.signMs += ms;
+        reply(dev.job.client, "OK " + dev.job.id + " " + dev.path + " " + line.substr(10));
+        becomeIdle(dev);
+      } else if (line == "SIGN:REVIEW") {
+        // On the device's screen, waiting for Confirm; the answer follows
+      } else if (line == "SIGN:BUSY") {
+        // Signing something started elsewhere (the touch UI): try another
+        requeue(dev.job);
+        becomeIdle(dev);
+        dev.nextHealth = 0;
+      } else if (startsWith(line, "SIGN:")) {
+        // Refused on the screen (REJECTED, TIMEOUT), CANCELLED, or the
+        // request's own fault; another device would refuse it too
+        dev.failedCount++;
+        fail(dev.job, line.c_str());
+        becomeIdle(dev);
+      }
+      break;
+
+    default:
+      break;  // Logs, JOB: progress, unsolicited output
+  }
+}
+
+static void onDeviceEvent(Device& dev, uint32_t events) {
+  if (events & EPOLLOUT) flush(dev.fd, dev.out, TAG_DEVICE, &dev - devices.data());
+  if (events & (EPOLLIN | EPOLLHUP | EPOLLERR | EPOLLRDHUP)) {
+    char buf[4096];
+    ssize_t n;
+    while ((n = read(dev.fd, buf, sizeof(buf))) > 0) {
+      dev.in.append(buf, n);
+      std::string line;
+      while (dev.fd >= 0 && takeLine(dev.in, line)) onDeviceLine(dev, line);
+      if (dev.fd < 0) return;
+      if (dev.in.size() > LINE_MAX_BYTES) dev.in.clear();
+    }
+    // A pty whose simulator exited reads EIO; a USB adapter that was unplugged, 0 or EIO
+    if (n == 0 || (n < 0 && errno != EAGAIN && errno != EINTR)) closeDevice(dev, "disconnected");
+  }
+}
+
+static void checkDevices(double now) {
+  for (Device& dev : devices) {
+    switch (dev.state) {
+      case DEV_SYNC:
+        if (now > dev.deadline) {
+          closeDevice(dev, "no PONG");
+        } else if (now >= dev.nextPing) {
+          sendDevice(dev, "PING\n");
+          dev.nextPing = now + SYNC_PING_MS;
+        }
+        break;
+      case DEV_HEALTH:
+        if (now > dev.deadline) closeDevice(dev, "health check timed out");
+        break;
+      case DEV_READY:
+        if (now >= dev.nextHealth) startHealth(dev);
+        break;
+      case DEV_SIGNING:
+        if (now > dev.deadline) {
+          sendDevice(dev, "CANCEL_JOB\n");
+          closeDevice(dev, "signing timed out");
+        }
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+static void expireQueue(double now) {
+  for (auto it = queue.begin(); it != queue.end();) {
+    if (now < it->deadline) {
+      ++it;
+      continue;
+    }
+    fail(*it, "TIMEOUT");
+    it = queue.erase(it);
+  }
+}
+
+// ---- Socket API ----
+
+static void listDevices(uint64_t client) {
+  char buf[512];
+  for (const Device& dev : devices) {
+    double avg = dev.signedCount ? dev.signMs / dev.signedCount : 0;
+    snprintf(buf, sizeof(buf), "DEVICE %s %s %s %llu %llu %.1f %s %s", dev.path.c_str(), stateNames[dev.state],
+             dev.rngOk ? "OK" : "FAIL", (unsigned long long)dev.signedCount, (unsigned long long)dev.failedCount,
+             avg, dev.yda.empty() ? "-" : dev.yda.c_str(), dev.sal.empty() ? "-" : dev.sal.c_str());
+    reply(client, buf);
+  }
+  reply(client, "END");
+}
+
+static void submit(uint64_t client, const std::string& line) {
+  // SIGN <id> <coin> <address|*> <tx>
+  SignRequest req;
+  req.client = client;
+  req.attempts = 0;
+  size_t a = line.find(' ', 5), b = std::string::npos, c = std::string::npos;
+  if (a != std::string::npos) b = line.find(' ', a + 1);
+  if (b != std::string::npos) c = line.find(' ', b + 1);
+  req.id = line.substr(5, a == std::string::npos ? std::string::npos : a - 5);
+  if (c == std::string::npos || a == 5) {
+    fail(req, "BAD_REQUEST");
+    return;
+  }
+  req.coin = line.substr(a + 1, b - a - 1);
+  req.address = line.substr(b + 1, c - b - 1);
+  req.tx = line.substr(c + 1);
+  if (req.coin.empty() || req.coin.size() > 7 || req.tx.empty() || req.tx.find(' ') != std::string::npos) {
+    fail(req, "BAD_REQUEST");
+    return;
+  }
+
+  // Fail now if every device is identified and none holds the key
+  bool possible = false;
+  for (const Device& dev : devices) {
+    if (dev.fd >= 0 && (!dev.identified || holdsKey(dev, req))) possible = true;
+  }
+  if (!possible) {
+    fail(req, "NO_DEVICE");
+    return;
+  }
+  req.deadline = nowMs() + QUEUE_TIMEOUT_MS;
+  queue.push_back(std::move(req));
+}
+
+static void onClientLine(uint64_t id, const std::string& line) {
+  if (startsWith(line, "SIGN ")) {
+    submit(id, line);
+  } else if (line == "DEVICES") {
+    listDevices(id);
+  } else if (!line.empty()) {
+    reply(id, "ERR - UNKNOWN_COMMAND");
+  }
+}
+
+static void onClientEvent(uint64_t id, uint32_t events) {
+  auto it = clients.find(id);
+  if (it == clients.end()) return;
+  if ((events & EPOLLOUT) && !flush(it->second.fd, it->second.out, TAG_CLIENT, id)) {
+    closeClient(id);
+    return;
+  }
+  if (!(events & (EPOLLIN | EPOLLHUP | EPOLLERR | EPOLLRDHUP))) return;
+
+  char buf[4096];
+  ssize_t n;
+  while ((n = read(it->second.fd, buf, sizeof(buf))) > 0) {
+    it->second.in.append(buf, n);
+    std::string line;
+    while (takeLine(it->second.in, line)) {
+      onClientLine(id, line);
+      it = clients.find(id);
+      if (it == clients.end()) return;
+    }
+    if (it->second.in.size() > LINE_MAX_BYTES) {
+      closeClient(id);
+      return;
+    }
+  }
+  if (n == 0 || (n < 0 && errno != EAGAIN && errno != EINTR)) closeClient(id);
+}
+
+static void acceptClients() {
+  int fd;
+  while ((fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0) {
+    uint64_t id = nextClientId++;
+    clients[id] = Client{fd, "", ""};
+    watch(fd, TAG_CLIENT, id, false, EPOLL_CTL_ADD);
+  }
+}
+
+static int listenOn(const char* path) {
+  struct sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (strlen(path) >= sizeof(addr.sun_path)) return -1;
+  strcpy(addr.sun_path, path);
+  int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (fd < 0) return -1;
+  unlink(path);
+  if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, 64) != 0) {
+    close(fd);
+    return -1;
+  }
+  // Anyone who can connect can sign: owner and group only
+  chmod(path, 0660);
+  return fd;
+}
+
+int runFleetDaemon(const char* socketPath, const std::vector<std::string>& ports) {
+  listenFd = listenOn(socketPath);
+  if (listenFd < 0) {
+    perror("[FLEET] socket");
+    return 1;
+  }
+  epfd = epoll_create1(EPOLL_CLOEXEC);
+  watch(listenFd, TAG_LISTEN, 0, false, EPOLL_CTL_ADD);
+
+  struct sigaction sa;
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = onSignal;
+  sigaction(SIGINT, &sa, nullptr);
+  sigaction(SIGTERM, &sa, nullptr);
+  signal(SIGPIPE, SIG_IGN);
+
+  // Indices are epoll ids: no reallocation once ports are open
+  devices.reserve(256);
+  fprintf(stderr, "[FLEET] Listening on %s\n", socketPath);
+
+  double nextRescan = 0;
+  struct epoll_event events[64];
+  while (!stopRequested) {
+    double now = nowMs();
+    if (now >= nextRescan && devices.size() < devices.capacity()) {
+      rescan(ports);
+      nextRescan = now + RESCAN_MS;
+    }
+
+    int n = epoll_wait(epfd, events, 64, TICK_MS);
+    for (int i = 0; i < n; i++) {
+      uint64_t tag = events[i].data.u64 >> TAG_SHIFT;
+      uint64_t id = events[i].data.u64 & TAG_MASK;
+      if (tag == TAG_LISTEN) {
+        acceptClients();
+      } else if (tag == TAG_DEVICE && devices[id].fd >= 0) {
+        onDeviceEvent(devices[id], events[i].events);
+      } else if (tag == TAG_CLIENT) {
+        onClientEvent(id, events[i].events);
+      }
+    }
+
+    now = nowMs();
+    checkDevices(now);
+    dispatch();
+    expireQueue(now);
+  }
+
+  for (Device& dev : devices) {
+    if (dev.fd < 0) continue;
+    fprintf(stderr, "[FLEET] %s: %llu signed, %llu failed\n", dev.path.c_str(), (unsigned long long)dev.signedCount,
+            (unsigned long long)dev.failedCount);
+    closeDevice(dev, "stopping");
+  }
+  while (!queue.empty()) {
+    fail(queue.front(), "FAILED");
+    queue.pop_front();
+  }
+  close(listenFd);
+  unlink(socketPath);
+  fprintf(stderr, "[FLEET] Stopped\n");
+  return 0;
+}
@@ -0,0 +1,76 @@
+// Fleet signing daemon and its throughput client (see fleet.h):
+//
+//   pio run -e native_fleet
+//   .pio/build/native_fleet/program serve [--socket PATH] [PORT|GLOB ...]
+//   .pio/build/native_fleet/program bench [--socket PATH] [--count N] [--window W]
+//                                         [--address SAL_ADDR|*]
+//
+// serve  opens every port matching the arguments (default /dev/ttyUSB* and
+//        /dev/ttyACM*), rescans for new ones and serves the socket API
+// bench  sends --count SAL SIGN requests, --window in flight, to the key of
+//        --address (* = the first ready device's), and prints signatures/s,
+//        latency and the share each device signed
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "fleet.h"
+
+double nowMs() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+bool takeLine(std::string& pending, std::string& line) {
+  size_t end = pending.find('\n');
+  if (end == std::string::npos) return false;
+  line = pending.substr(0, end);
+  pending.erase(0, end + 1);
+  if (!line.empty() && line.back() == '\r') line.pop_back();
+  return true;
+}
+
+static int usage(const char* prog) {
+  fprintf(stderr, "usage: %s serve [--socket PATH] [PORT|GLOB ...]\n"
+                  "       %s bench [--socket PATH] [--count N] [--window W] [--address SAL_ADDR|*]\n",
+          prog, prog);
+  return 2;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) return usage(argv[0]);
+  const char* mode = argv[1];
+  const char* socketPath = FLEET_SOCKET;
+  std::vector<std::string> ports;
+  int count = 1000, window = 16;
+  const char* address = "*";
+
+  for (int i = 2; i < argc; i++) {
+    bool more = i + 1 < argc;
+    if (strcmp(argv[i], "--socket") == 0 && more) {
+      socketPath = argv[++i];
+    } else if (strcmp(argv[i], "--count") == 0 && more) {
+      count = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--window") == 0 && more) {
+      window = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--address") == 0 && more) {
+      address = argv[++i];
+    } else if (argv[i][0] != '-') {
+      ports.push_back(argv[i]);
+    } else {
+      return usage(argv[0]);
+    }
+  }
+
+  if (strcmp(mode, "serve") == 0) {
+    if (ports.empty()) ports = {"/dev/ttyUSB*", "/dev/ttyACM*"};
+    return runFleetDaemon(socketPath, ports);
+  }
+  if (strcmp(mode, "bench") == 0 && ports.empty() && count > 0 && window > 0) {
+    return runFleetBench(socketPath, count, window, address);
+  }
+  return usage(argv[0]);
+}
@@ -0,0 +1,296 @@
+// Serial load generator: replays a weighted mix of PING, GET_ADDRESSES,
+// BALANCE: and SIGN_TX: against a device or the simulator (src/host/sim),
+// one command in flight at a time, and reports commands/s and p50/p99/p999
+// latency per command. Latency runs from the write to the command's final
+// reply line; other output (logs, JOB: lines) is skipped.
+//
+//   pio run -e native_loadgen
+//   .pio/build/native_loadgen/program PORT [--count N] [--mix ping=4,addresses=2,balance=2]
+//                                          [--max-p99-ms MS] [--seed S]
+//
+// sign (not in the default mix) sends SIGN_TX:SAL payloads to the device's
+// primary address (host/txgen). Each one waits for Confirm on the device, so
+// only mix it in against a simulator run with --confirm.
+//
+// Exits 1 on a timeout, a wrong reply, or an overall p99 above --max-p99-ms.
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../../crypto/cryptonote.h"
+#include "../txgen/txgen.h"
+
+#define REPLY_TIMEOUT_MS 10000
+#define SIGN_TIMEOUT_MS  65000  // Through the device's 60 s review screen
+#define SIGN_INPUTS      1
+#define SIGN_RING        16
+#define SYNC_TIMEOUT_MS  15000  // Boot (splash screen) before the first PONG
+
+enum Kind { KIND_PING, KIND_ADDRESSES, KIND_BALANCE, KIND_SIGN, KIND_COUNT };
+
+static const char* kindNames[KIND_COUNT] = {"ping", "addresses", "balance", "sign"};
+
+struct Port {
+  int fd;
+  std::string pending;  // Received bytes not yet split into lines
+};
+
+static double nowMs() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+static int openPort(const char* path) {
+  int fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (fd < 0) return -1;
+  struct termios t;
+  if (tcgetattr(fd, &t) == 0) {
+    cfmakeraw(&t);
+    cfsetspeed(&t, B115200);
+    tcsetattr(fd, TCSANOW, &t);
+  }
+  return fd;
+}
+
+static bool sendLine(Port& port, const std::string& line) {
+  std::string out = line + "\n";
+  size_t sent = 0;
+  while (sent < out.size()) {
+    ssize_t n = write(port.fd, out.data() + sent, out.size() - sent);
+    if (n > 0) {
+      sent += n;
+    } else if (n < 0 && errno != EAGAIN && errno != EINTR) {
+      return false;
+    } else {
+      struct pollfd p = {port.fd, POLLOUT, 0};
+      poll(&p, 1, 100);
+    }
+  }
+  return true;
+}
+
+// Next complete line without the line ending, or false on timeout
+static bool readLine(Port& port, std::string& line, double deadline) {
+  for (;;) {
+    size_t end = port.pending.find('\n');
+    if (end != std::string::npos) {
+      line = port.pending.substr(0, end);
+      port.pending.erase(0, end + 1);
+      if (!line.empty() && line.back() == '\r') line.pop_back();
+      return true;
+    }
+    int wait = (int)(deadline - nowMs());
+    if (wait <= 0) return false;
+    struct pollfd p = {port.fd, POLLIN, 0};
+    if (poll(&p, 1, wait) <= 0) continue;
+    char buf[4096];
+    ssize_t n = read(port.fd, buf, sizeof(buf));
+    if (n > 0) port.pending.append(buf, n);
+  }
+}
+
+static bool startsWith(const std::string& s, const char* prefix) {
+  return s.compare(0, strlen(prefix), prefix) == 0;
+}
+
+// Final reply of each command: 1 = done, -1 = error reply, 0 = not yet
+static int classify(Kind kind, const std::string& line) {
+  switch (kind) {
+    case KIND_PING:
+      return line == "PONG" ? 1 : 0;
+    case KIND_ADDRESSES:
+      return startsWith(line, "ADDRESS:SAL:") ? 1 : 0;
+    case KIND_BALANCE:
+      return startsWith(line, "[OK] YadaCoin balance updated") ? 1 : 0;
+    case KIND_SIGN:
+      // SIGN:REVIEW only means the request is on screen, waiting for Confirm
+      if (startsWith(line, "SIGNATURE:")) return 1;
+      return startsWith(line, "SIGN:") && line != "SIGN:REVIEW" ? -1 : 0;
+    default:
+      return 0;
+  }
+}
+
+// Keys of the device's primary Salvium address, for sign payloads
+static uint8_t salSpend[32], salView[32];
+
+static std::string makeCommand(Kind kind, unsigned n) {
+  char buf[256];
+  switch (kind) {
+    case KIND_PING:
+      return "PING";
+    case KIND_ADDRESSES:
+      return "GET_ADDRESSES";
+    case KIND_BALANCE:
+      snprintf(buf, sizeof(buf), "BALANCE:YDA:%u.%04u", n % 1000, n % 10000);
+      return buf;
+    case KIND_SIGN:
+      // Random messages, so each one is a new history record
+      return "SIGN_TX:SAL:" + txgenSalPayload(salSpend, salView, SIGN_INPUTS, SIGN_RING);
+    default:
+      return "";
+  }
+}
+
+static bool parseMix(const char* spec, int weights[KIND_COUNT]) {
+  for (int k = 0; k < KIND_COUNT; k++) weights[k] = 0;
+  std::string s = spec;
+  size_t pos = 0;
+  while (pos < s.size()) {
+    size_t comma = s.find(',', pos);
+    std::string item = s.substr(pos, comma == std::string::npos ? std::string::npos : comma - pos);
+    size_t eq = item.find('=');
+    int k = 0;
+    while (k < KIND_COUNT && item.substr(0, eq) != kindNames[k]) k++;
+    if (eq == std::string::npos || k == KIND_COUNT) return false;
+    weights[k] = atoi(item.c_str() + eq + 1);
+    if (comma == std::string::npos) break;
+    pos = comma + 1;
+  }
+  int total = 0;
+  for (int k = 0; k < KIND_COUNT; k++) total += weights[k];
+  return total > 0;
+}
+
+// Nearest rank on a sorted sample
+static double percentile(const std::vector<double>& sorted, double p) {
+  if (sorted.empty()) return 0;
+  size_t rank = (size_t)ceil(p * sorted.size());
+  return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+static void report(const char* name, std::vector<double>& ms, double elapsedMs) {
+  if (ms.empty()) return;
+  std::sort(ms.begin(), ms.end());
+  printf("[LOAD] %-9s %6zu  %8.0f/s  p50 %7.3f  p99 %7.3f  p999 %7.3f  max %7.3f ms\n", name, ms.size(),
+         ms.size() * 1000.0 / elapsedMs, percentile(ms, 0.50), percentile(ms, 0.99), percentile(ms, 0.999),
+         ms.back());
+}
+
+int main(int argc, char** argv) {
+  const char* path = nullptr;
+  int count = 2000;
+  double maxP99 = 0;
+  unsigned seed = 1;
+  int weights[KIND_COUNT];
+  parseMix("ping=4,addresses=2,balance=2", weights);
+
+  for (int i = 1; i < argc; i++) {
+    bool more = i + 1 < argc;
+    if (strcmp(argv[i], "--count") == 0 && more) {
+      count = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--mix") == 0 && more) {
+      if (!parseMix(argv[++i], weights)) {
+        fprintf(stderr, "[LOAD] bad mix: %s\n", argv[i]);
+        return 2;
+      }
+    } else if (strcmp(argv[i], "--max-p99-ms") == 0 && more) {
+      maxP99 = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--seed") == 0 && more) {
+      seed = (unsigned)atoi(argv[++i]);
+    } else if (!path && argv[i][0] != '-') {
+      path = argv[i];
+    } else {
+      path = nullptr;
+      break;
+    }
+  }
+  if (!path || count < 1) {
+    fprintf(stderr, "usage: %s PORT [--count N] [--mix ping=4,addresses=2,balance=2,sign=1] "
+                    "[--max-p99-ms MS] [--seed S]\n", argv[0]);
+    return 2;
+  }
+
+  Port port = {openPort(path), ""};
+  if (port.fd < 0) {
+    perror("[LOAD] open");
+    return 1;
+  }
+
+  // Wait out boot: PING until the first PONG, then drop whatever is left
+  std::string line;
+  double syncDeadline = nowMs() + SYNC_TIMEOUT_MS;
+  bool synced = false;
+  while (!synced && nowMs() < syncDeadline) {
+    sendLine(port, "PING");
+    double wait = nowMs() + 500;
+    while (!synced && readLine(port, line, wait)) synced = line == "PONG";
+  }
+  if (!synced) {
+    fprintf(stderr, "[LOAD] no PONG from %s\n", path);
+    return 1;
+  }
+  while (readLine(port, line, nowMs() + 200)) {}
+
+  if (weights[KIND_SIGN] > 0) {
+    ed25519_init();
+    sendLine(port, "GET_ADDRESSES");
+    bool found = false;
+    while (!found && readLine(port, line, nowMs() + REPLY_TIMEOUT_MS)) {
+      found = startsWith(line, "ADDRESS:SAL:") && txgenParseAddress(line.substr(12), salSpend, salView);
+    }
+    if (!found) {
+      fprintf(stderr, "[LOAD] no Salvium address from %s to sign for\n", path);
+      return 1;
+    }
+    while (readLine(port, line, nowMs() + 200)) {}
+  }
+
+  int total = 0;
+  for (int k = 0; k < KIND_COUNT; k++) total += weights[k];
+  srand(seed);
+
+  std::vector<double> latency[KIND_COUNT];
+  std::vector<double> all;
+  int failures = 0;
+  double start = nowMs();
+  for (int n = 0; n < count; n++) {
+    int pick = rand() % total;
+    int k = 0;
+    while (pick >= weights[k]) pick -= weights[k++];
+    Kind kind = (Kind)k;
+
+    double sent = nowMs();
+    if (!sendLine(port, makeCommand(kind, (unsigned)n))) {
+      perror("[LOAD] write");
+      return 1;
+    }
+    int result = 0;
+    double timeout = kind == KIND_SIGN ? SIGN_TIMEOUT_MS : REPLY_TIMEOUT_MS;
+    while (result == 0 && readLine(port, line, sent + timeout)) result = classify(kind, line);
+    double ms = nowMs() - sent;
+
+    if (result != 1) {
+      fprintf(stderr, "[LOAD] %s #%d: %s\n", kindNames[k], n, result ? line.c_str() : "timeout");
+      failures++;
+      if (result == 0) break;  // The port is out of step with the replies
+      continue;
+    }
+    latency[k].push_back(ms);
+    all.push_back(ms);
+  }
+  double elapsed = nowMs() - start;
+
+  printf("[LOAD] %s: %zu commands in %.1f ms, %d failed\n", path, all.size(), elapsed, failures);
+  for (int k = 0; k < KIND_COUNT; k++) report(kindNames[k], latency[k], elapsed);
+  report("all", all, elapsed);
+
+  double p99 = percentile(all, 0.99);
+  if (maxP99 > 0 && p99 > maxP99) {
+    printf("[LOAD] FAIL: p99 %.3f ms above %.3f ms\n", p99, maxP99);
+    return 1;
+  }
+  return failures ? 1 : 0;
+}
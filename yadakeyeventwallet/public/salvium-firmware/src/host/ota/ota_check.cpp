@@ -0,0 +1,202 @@
+// Test of the generator and the streaming applier; exits 1 on any failure.
+// Fixtures are synthetic firmware-like images under the edits a rebuild
+// makes (code inserted or removed with every later literal-pool address
+// shifted, scattered changes, growth, shrinkage). Each pair must round trip
+// in 1-byte, odd-sized and OTA_CHUNK-sized pieces, and every patch must be
+// refused, for the right reason, when signed with another key, truncated
+// anywhere, extended, corrupted, or made for another image, or when its
+// new image digest does not match. With OLD and NEW that pair is tested
+// the same way.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../crypto/cryptonote.h"
+#include "../../crypto/random.h"
+#include "ota_tool.h"
+
+#define CHECK_IMAGE_BYTES (192 * 1024)
+#define CHECK_CORRUPTIONS 100  // Per fixture
+#define CHECK_TRUNCATIONS 40
+
+static uint32_t rng = 1;
+
+static uint32_t next() {
+  rng = rng * 1103515245u + 12345u;
+  return rng >> 8;
+}
+
+// Instruction-like words from a small vocabulary, every 16th word an
+// absolute address (a literal pool entry) into the image itself
+static Bytes makeImage(size_t size) {
+  Bytes img(size);
+  uint32_t vocab[512];
+  for (uint32_t& v : vocab) v = next() * 2654435761u;
+  for (size_t i = 0; i + 4 <= size; i += 4) {
+    uint32_t w = (i / 4) % 16 == 15 ? 0x400d0000u + (next() % size) : vocab[next() % 512];
+    memcpy(&img[i], &w, 4);
+  }
+  return img;
+}
+
+// Insert (or with a negative count remove) bytes at `at` and move every
+// later address the way a relink would
+static Bytes shifted(const Bytes& img, size_t at, long count) {
+  Bytes out(img.begin(), img.begin() + at);
+  if (count > 0) {
+    for (long i = 0; i < count; i++) out.push_back((uint8_t)next());
+    out.insert(out.end(), img.begin() + at, img.end());
+  } else {
+    out.insert(out.end(), img.begin() + at - count, img.end());
+  }
+  for (size_t i = 0; i + 4 <= out.size(); i += 4) {
+    uint32_t w;
+    memcpy(&w, &out[i], 4);
+    if ((w & 0xffff0000u) == 0x400d0000u && w - 0x400d0000u > at) {
+      w += (uint32_t)count;
+      memcpy(&out[i], &w, 4);
+    }
+  }
+  return out;
+}
+
+static bool roundTrip(const char* name, const Bytes& oldImage, const Bytes& newImage, const Bytes& patch) {
+  const size_t chunks[] = {0, 1, 7, 512};
+  for (size_t chunk : chunks) {
+    Bytes out;
+    std::string error;
+    if (!applyPatch(oldImage, patch, out, error, nullptr, chunk) || out != newImage) {
+      printf("[OTA] FAIL %s (chunk %zu): %s\n", name, chunk, error.empty() ? "output differs" : error.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+// The applier must refuse patch, with an error starting with reason if given
+static bool refused(const char* name, const char* what, const Bytes& oldImage, const Bytes& patch,
+                    const uint8_t* pub, const char* reason, size_t chunk = 0) {
+  Bytes out;
+  std::string error;
+  if (applyPatch(oldImage, patch, out, error, pub, chunk)) {
+    printf("[OTA] FAIL %s: %s accepted\n", name, what);
+    return false;
+  }
+  if (reason && error.compare(0, strlen(reason), reason) != 0) {
+    printf("[OTA] FAIL %s: %s refused as \"%s\", expected \"%s\"\n", name, what, error.c_str(), reason);
+    return false;
+  }
+  return true;
+}
+
+static Bytes withHeader(const Bytes& patch, const DeltaHeader& header) {
+  Bytes out = patch;
+  deltaWriteHeader(out.data(), header);
+  return out;
+}
+
+static bool checkRefusals(const char* name, const Bytes& oldImage, const Bytes& newImage) {
+  uint8_t sec[32], pub[32], otherSec[32], otherPub[32];
+  randomScalar(sec);
+  secret_to_public(pub, sec);
+  randomScalar(otherSec);
+  secret_to_public(otherPub, otherSec);
+  Bytes patch = makePatch(oldImage, newImage, sec);
+  Bytes out;
+  std::string error;
+
+  if (!applyPatch(oldImage, patch, out, error, pub, 512) || out != newImage) {
+    printf("[OTA] FAIL %s: signed patch refused: %s\n", name, error.c_str());
+    return false;
+  }
+  bool ok = refused(name, "patch under another key", oldImage, patch, otherPub, "bad signature");
+
+  DeltaHeader header;
+  deltaParseHeader(patch.data(), header);
+  DeltaHeader edited = header;
+  edited.newSize ^= 1;
+  ok &= refused(name, "tampered header", oldImage, withHeader(patch, edited), pub, "bad signature");
+  edited = header;
+  edited.newSha[0] ^= 1;
+  ok &= refused(name, "wrong new image digest", oldImage, withHeader(patch, edited), nullptr,
+                "new image digest mismatch");
+  edited = header;
+  edited.oldSha[0] ^= 1;
+  ok &= refused(name, "wrong old image digest", oldImage, withHeader(patch, edited), nullptr,
+                "made for another old image");
+
+  Bytes otherOld = oldImage;
+  otherOld.push_back(0);
+  ok &= refused(name, "longer old image", otherOld, patch, nullptr, "made for another old image");
+  if (!oldImage.empty()) {
+    otherOld = oldImage;
+    otherOld[otherOld.size() / 2] ^= 0x40;
+    ok &= refused(name, "changed old image", otherOld, patch, nullptr, "made for another old image");
+  }
+
+  Bytes cut(patch.begin(), patch.begin() + DELTA_HEADER_BYTES - 1);
+  ok &= refused(name, "truncated header", oldImage, cut, nullptr, "not a patch");
+  size_t ops = patch.size() - DELTA_HEADER_BYTES;
+  for (int n = 0; n < CHECK_TRUNCATIONS && ops > 0; n++) {
+    size_t keep = n == 0 ? ops - 1 : next() % ops;  // Always the last byte, then anywhere
+    cut.assign(patch.begin(), patch.begin() + DELTA_HEADER_BYTES + keep);
+    ok &= refused(name, "truncated ops", oldImage, cut, nullptr, "patch RUNNING", 1 + next() % 600);
+  }
+  Bytes extended = patch;
+  extended.push_back(0);
+  ok &= refused(name, "trailing bytes", oldImage, extended, nullptr, "patch MALFORMED");
+
+  // Any flipped op byte must be refused, whether by the decoder or by the digest
+  for (int n = 0; n < CHECK_CORRUPTIONS && ops > 0; n++) {
+    Bytes bad = patch;
+    size_t at = DELTA_HEADER_BYTES + next() % ops;
+    bad[at] ^= (uint8_t)(1 + next() % 255);
+    char what[48];
+    snprintf(what, sizeof(what), "corruption at %zu", at);
+    ok &= refused(name, what, oldImage, bad, nullptr, nullptr, 1 + next() % 600);
+  }
+  return ok;
+}
+
+static bool checkPair(const char* name, const Bytes& oldImage, const Bytes& newImage) {
+  Bytes patch = makePatch(oldImage, newImage, nullptr);
+  bool ok = roundTrip(name, oldImage, newImage, patch) && checkRefusals(name, oldImage, newImage);
+  printf("[OTA] %-4s %-16s %7zu -> %7zu bytes, patch %7zu (%5.1f%%)\n", ok ? "ok" : "FAIL", name,
+         oldImage.size(), newImage.size(), patch.size(),
+         newImage.empty() ? 0.0 : 100.0 * patch.size() / newImage.size());
+  return ok;
+}
+
+int runCheck(const char* oldPath, const char* newPath) {
+  Bytes base = makeImage(CHECK_IMAGE_BYTES);
+  Bytes scattered = base;
+  for (int i = 0; i < 64; i++) scattered[next() % scattered.size()] ^= 0x5a;
+  Bytes grown = base;
+  Bytes extra = makeImage(8192);
+  grown.insert(grown.end(), extra.begin(), extra.end());
+
+  bool ok = checkPair("identical", base, base);
+  ok &= checkPair("insert 300", base, shifted(base, base.size() / 3, 300));
+  ok &= checkPair("remove 1000", base, shifted(base, base.size() / 2, -1000));
+  ok &= checkPair("64 bytes", base, scattered);
+  ok &= checkPair("append 8 KB", base, grown);
+  ok &= checkPair("half", base, Bytes(base.begin(), base.begin() + base.size() / 2));
+  ok &= checkPair("from empty", Bytes(), base);
+  ok &= checkPair("to empty", base, Bytes());
+  Bytes noise(16384);
+  for (uint8_t& b : noise) b = (uint8_t)next();
+  ok &= checkPair("random", base, noise);
+  ok &= checkPair("relink 4096", base, shifted(base, 4096, 300));
+
+  if (oldPath && newPath) {
+    Bytes oldImage, newImage;
+    if (!readFile(oldPath, oldImage) || !readFile(newPath, newImage)) {
+      perror("[OTA] read");
+      return 1;
+    }
+    ok &= checkPair(newPath, oldImage, newImage);
+  }
+  printf("[OTA] %s\n", ok ? "All checks passed" : "FAILED");
+  return ok ? 0 : 1;
+}
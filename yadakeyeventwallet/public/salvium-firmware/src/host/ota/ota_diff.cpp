@@ -0,0 +1,243 @@
+// Delta generator and applier (delta.h has the format). The generator is a
+// greedy LZ77 parse with one step of lazy matching over two sources: the
+// old image, indexed whole, and the new image's last window bytes, indexed
+// as the parse moves. Each position takes whichever match saves the most
+// bytes once its op and argument are paid for; a continuation of the
+// previous old copy is always tried, since that is where unchanged code
+// after an edit is.
+
+#include <string.h>
+
+#include "../../crypto/cryptonote.h"
+#include "../shim/SHA256.h"
+#include "ota_tool.h"
+
+#define HASH_BITS 16
+#define MIN_MATCH 4
+#define MAX_CHAIN 48  // Candidates tried per source and position
+
+struct Match {
+  int gain;  // Bytes saved over literals
+  uint8_t op;
+  uint32_t len;
+  uint64_t arg;
+};
+
+struct Index {
+  std::vector<int32_t> head;
+  std::vector<int32_t> prev;
+};
+
+static uint32_t hashAt(const uint8_t* p) {
+  uint32_t v = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+  return (v * 2654435761u) >> (32 - HASH_BITS);
+}
+
+static void indexInit(Index& ix, size_t size) {
+  ix.head.assign(1 << HASH_BITS, -1);
+  ix.prev.assign(size, -1);
+}
+
+static void indexAdd(Index& ix, const Bytes& data, size_t pos) {
+  if (pos + MIN_MATCH > data.size()) return;
+  uint32_t h = hashAt(&data[pos]);
+  ix.prev[pos] = ix.head[h];
+  ix.head[h] = (int32_t)pos;
+}
+
+static int varintBytes(uint64_t v) {
+  int n = 1;
+  while (v >= 0x80) {
+    v >>= 7;
+    n++;
+  }
+  return n;
+}
+
+static void putVarint(Bytes& out, uint64_t v) {
+  uint8_t buf[10];
+  size_t n = write_varint(buf, v);
+  out.insert(out.end(), buf, buf + n);
+}
+
+static uint64_t zigzag(int64_t delta) {
+  return delta >= 0 ? (uint64_t)delta << 1 : ((uint64_t)(-delta - 1) << 1) | 1;
+}
+
+// Matching bytes of a[from..] and b[at..], b bounded by its end
+static uint32_t extend(const Bytes& a, size_t from, const Bytes& b, size_t at) {
+  size_t n = 0, max = b.size() - at;
+  if (&a != &b && a.size() - from < max) max = a.size() - from;
+  while (n < max && a[from + n] == b[at + n]) n++;
+  return (uint32_t)n;
+}
+
+static void consider(Match& best, uint8_t op, uint32_t len, uint64_t arg) {
+  if (len < MIN_MATCH) return;
+  int gain = (int)len - varintBytes((uint64_t)len << 2) - varintBytes(arg);
+  if (gain > best.gain) best = Match{gain, op, len, arg};
+}
+
+static Match bestMatch(const Bytes& oldImage, const Bytes& newImage, const Index& oldIx, const Index& newIx,
+                       size_t pos, uint32_t oldEnd, uint32_t window) {
+  Match best = {0, DELTA_LITERAL, 0, 0};
+  if (pos + MIN_MATCH > newImage.size()) return best;
+
+  if (oldEnd < oldImage.size()) {
+    consider(best, DELTA_COPY_OLD, extend(oldImage, oldEnd, newImage, pos), 0);
+  }
+  uint32_t h = hashAt(&newImage[pos]);
+  int32_t cand = oldImage.size() >= MIN_MATCH ? oldIx.head[h] : -1;
+  for (int depth = 0; cand >= 0 && depth < MAX_CHAIN; depth++, cand = oldIx.prev[cand]) {
+    consider(best, DELTA_COPY_OLD, extend(oldImage, cand, newImage, pos), zigzag((int64_t)cand - oldEnd));
+  }
+  cand = newIx.head[h];
+  for (int depth = 0; cand >= 0 && depth < MAX_CHAIN; depth++, cand = newIx.prev[cand]) {
+    uint64_t distance = pos - cand;
+    if (distance > window) break;
+    consider(best, DELTA_COPY_NEW, extend(newImage, cand, newImage, pos), distance);
+  }
+  return best;
+}
+
+Bytes deltaDiff(const Bytes& oldImage, const Bytes& newImage, uint32_t window) {
+  Index oldIx, newIx;
+  indexInit(oldIx, oldImage.size());
+  indexInit(newIx, newImage.size());
+  for (size_t i = 0; i < oldImage.size(); i++) indexAdd(oldIx, oldImage, i);
+
+  Bytes ops;
+  size_t pos = 0, literalStart = 0;
+  uint32_t oldEnd = 0;
+  auto flushLiteral = [&](size_t end) {
+    if (end == literalStart) return;
+    putVarint(ops, (uint64_t)(end - literalStart) << 2 | DELTA_LITERAL);
+    ops.insert(ops.end(), newImage.begin() + literalStart, newImage.begin() + end);
+  };
+
+  while (pos < newImage.size()) {
+    Match m = bestMatch(oldImage, newImage, oldIx, newIx, pos, oldEnd, window);
+    indexAdd(newIx, newImage, pos);
+    if (m.gain <= 0) {
+      pos++;
+      continue;
+    }
+    // One step of lazy matching: a better match one byte on wins
+    if (pos + 1 < newImage.size()) {
+      Match next = bestMatch(oldImage, newImage, oldIx, newIx, pos + 1, oldEnd, window);
+      if (next.gain > m.gain + 1) {
+        pos++;
+        continue;
+      }
+    }
+
+    flushLiteral(pos);
+    putVarint(ops, (uint64_t)m.len << 2 | m.op);
+    putVarint(ops, m.arg);
+    if (m.op == DELTA_COPY_OLD) {
+      // The argument is relative to the previous copy's end
+      oldEnd = (uint32_t)((m.arg & 1) ? (int64_t)oldEnd - (int64_t)(m.arg >> 1) - 1
+                                      : (int64_t)oldEnd + (int64_t)(m.arg >> 1)) + m.len;
+    }
+    for (uint32_t i = 1; i < m.len; i++) indexAdd(newIx, newImage, pos + i);
+    pos += m.len;
+    literalStart = pos;
+  }
+  flushLiteral(pos);
+  return ops;
+}
+
+void sha256(const Bytes& data, uint8_t out[32]) {
+  SHA256 sha;
+  sha.update(data.data(), data.size());
+  sha.finalize(out, 32);
+}
+
+Bytes makePatch(const Bytes& oldImage, const Bytes& newImage, const uint8_t* sec) {
+  DeltaHeader header;
+  memset(&header, 0, sizeof(header));
+  header.window = DELTA_WINDOW;
+  header.oldSize = (uint32_t)oldImage.size();
+  header.newSize = (uint32_t)newImage.size();
+  sha256(oldImage, header.oldSha);
+  sha256(newImage, header.newSha);
+  if (sec) {
+    uint8_t hash[32], pub[32];
+    deltaSignedHash(header, hash);
+    secret_to_public(pub, sec);
+    generate_signature(header.signature, hash, pub, sec);
+  }
+
+  Bytes patch(DELTA_HEADER_BYTES);
+  deltaWriteHeader(patch.data(), header);
+  Bytes ops = deltaDiff(oldImage, newImage, header.window);
+  patch.insert(patch.end(), ops.begin(), ops.end());
+  return patch;
+}
+
+// ---- Applier ----
+
+struct ApplyCtx {
+  const Bytes* oldImage;
+  Bytes* out;
+};
+
+static bool readOld(void* ctx, uint32_t offset, uint8_t* buf, size_t len) {
+  const Bytes& old = *((ApplyCtx*)ctx)->oldImage;
+  if ((size_t)offset + len > old.size()) return false;
+  memcpy(buf, old.data() + offset, len);
+  return true;
+}
+
+static bool writeNew(void* ctx, const uint8_t* buf, size_t len) {
+  Bytes& out = *((ApplyCtx*)ctx)->out;
+  out.insert(out.end(), buf, buf + len);
+  return true;
+}
+
+bool applyPatch(const Bytes& oldImage, const Bytes& patch, Bytes& out, std::string& error, const uint8_t* pub,
+                size_t chunk) {
+  DeltaHeader header;
+  if (patch.size() < DELTA_HEADER_BYTES || !deltaParseHeader(patch.data(), header)) {
+    error = "not a patch";
+    return false;
+  }
+  if (pub) {
+    uint8_t hash[32];
+    deltaSignedHash(header, hash);
+    if (!check_signature(header.signature, hash, pub)) {
+      error = "bad signature";
+      return false;
+    }
+  }
+  uint8_t sha[32];
+  sha256(oldImage, sha);
+  if (header.oldSize != oldImage.size() || memcmp(sha, header.oldSha, 32) != 0) {
+    error = "made for another old image";
+    return false;
+  }
+
+  static DeltaPatcher p;  // 8 KB window
+  out.clear();
+  ApplyCtx ctx = {&oldImage, &out};
+  deltaBegin(p, header, readOld, writeNew, &ctx);
+  size_t at = DELTA_HEADER_BYTES;
+  DeltaStatus status = p.status;
+  while (at < patch.size()) {
+    size_t n = chunk ? chunk : patch.size() - at;
+    if (n > patch.size() - at) n = patch.size() - at;
+    status = deltaFeed(p, patch.data() + at, n);
+    at += n;
+    if (status != DELTA_RUNNING) break;
+  }
+  if (status != DELTA_DONE || at != patch.size()) {
+    error = std::string("patch ") + (status == DELTA_DONE ? "has trailing bytes" : deltaStatusName(status));
+    return false;
+  }
+  sha256(out, sha);
+  if (memcmp(sha, header.newSha, 32) != 0) {
+    error = "new image digest mismatch";
+    return false;
+  }
+  return true;
+}
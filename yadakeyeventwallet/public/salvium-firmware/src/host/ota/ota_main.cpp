@@ -0,0 +1,164 @@
+// Firmware delta tool: makes, applies, checks and sends patches in the
+// format of src/delta.h.
+//
+//   pio run -e native_ota
+//   .pio/build/native_ota/program keygen                 # release key pair (hex)
+//   .pio/build/native_ota/program diff OLD NEW PATCH [--key SECRET_FILE]
+//   .pio/build/native_ota/program apply OLD PATCH OUT [--pub HEX]
+//   .pio/build/native_ota/program check [OLD NEW]        # test, exits 1 on any failure
+//   .pio/build/native_ota/program send PORT PATCH
+//
+// OLD and NEW are firmware.bin files. diff signs with the secret key in
+// SECRET_FILE (64 hex digits); devices refuse unsigned patches. apply
+// checks both digests and, with --pub, the signature.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../crypto/cryptonote.h"
+#include "../../crypto/random.h"
+#include "ota_tool.h"
+
+#define OTA_CHUNK_BYTES 512  // As the firmware's OTA_CHUNK_MAX
+
+bool readFile(const char* path, Bytes& out) {
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+  out.clear();
+  uint8_t buf[65536];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.insert(out.end(), buf, buf + n);
+  fclose(f);
+  return true;
+}
+
+bool writeFile(const char* path, const Bytes& data) {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+  return fclose(f) == 0 && ok;
+}
+
+bool parseHexKey(const char* hex, uint8_t out[32]) {
+  for (int i = 0; i < 64; i++) {
+    char c = hex[i];
+    uint8_t v;
+    if (c >= '0' && c <= '9') v = c - '0';
+    else if (c >= 'a' && c <= 'f') v = c - 'a' + 10;
+    else if (c >= 'A' && c <= 'F') v = c - 'A' + 10;
+    else return false;
+    out[i / 2] = (uint8_t)((i & 1) ? (out[i / 2] << 4) | v : v);
+  }
+  return true;
+}
+
+double serialSeconds(size_t len) {
+  size_t chunks = (len + OTA_CHUNK_BYTES - 1) / OTA_CHUNK_BYTES;
+  size_t lineBytes = 2 * len + 16 * chunks + 2 * DELTA_HEADER_BYTES + 20;
+  return lineBytes * 10 / 115200.0;
+}
+
+static void printHex(const char* label, const uint8_t* data) {
+  printf("%s", label);
+  for (int i = 0; i < 32; i++) printf("%02x", data[i]);
+  printf("\n");
+}
+
+static int usage(const char* prog) {
+  fprintf(stderr, "usage: %s keygen\n"
+                  "       %s diff OLD NEW PATCH [--key SECRET_FILE]\n"
+                  "       %s apply OLD PATCH OUT [--pub HEX]\n"
+                  "       %s check [OLD NEW]\n"
+                  "       %s send PORT PATCH\n",
+          prog, prog, prog, prog, prog);
+  return 2;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) return usage(argv[0]);
+  ed25519_init();
+  const char* mode = argv[1];
+  const char* keyFile = nullptr;
+  const char* pubHex = nullptr;
+  std::vector<const char*> args;
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "--key") == 0 && i + 1 < argc) {
+      keyFile = argv[++i];
+    } else if (strcmp(argv[i], "--pub") == 0 && i + 1 < argc) {
+      pubHex = argv[++i];
+    } else {
+      args.push_back(argv[i]);
+    }
+  }
+
+  if (strcmp(mode, "keygen") == 0 && args.empty()) {
+    uint8_t sec[32], pub[32];
+    randomScalar(sec);
+    secret_to_public(pub, sec);
+    printHex("secret ", sec);
+    printHex("public ", pub);
+    memwipe(sec, sizeof(sec));
+    return 0;
+  }
+
+  if (strcmp(mode, "diff") == 0 && args.size() == 3) {
+    Bytes oldImage, newImage;
+    if (!readFile(args[0], oldImage) || !readFile(args[1], newImage)) {
+      perror("[OTA] read");
+      return 1;
+    }
+    uint8_t sec[32];
+    if (keyFile) {
+      Bytes key;
+      if (!readFile(keyFile, key) || key.size() < 64 || !parseHexKey((const char*)key.data(), sec)) {
+        fprintf(stderr, "[OTA] %s: expected 64 hex digits\n", keyFile);
+        return 1;
+      }
+      memwipe(key.data(), key.size());
+    }
+    Bytes patch = makePatch(oldImage, newImage, keyFile ? sec : nullptr);
+    memwipe(sec, sizeof(sec));
+    if (!writeFile(args[2], patch)) {
+      perror("[OTA] write");
+      return 1;
+    }
+    printf("[OTA] %zu -> %zu bytes, patch %zu (%.1f%%), %.1f s at 115200%s\n", oldImage.size(), newImage.size(),
+           patch.size(), newImage.empty() ? 0.0 : 100.0 * patch.size() / newImage.size(), serialSeconds(patch.size()),
+           keyFile ? "" : ", UNSIGNED");
+    return 0;
+  }
+
+  if (strcmp(mode, "apply") == 0 && args.size() == 3) {
+    Bytes oldImage, patch, out;
+    if (!readFile(args[0], oldImage) || !readFile(args[1], patch)) {
+      perror("[OTA] read");
+      return 1;
+    }
+    uint8_t pub[32];
+    if (pubHex && (strlen(pubHex) != 64 || !parseHexKey(pubHex, pub))) {
+      fprintf(stderr, "[OTA] --pub: expected 64 hex digits\n");
+      return 1;
+    }
+    std::string error;
+    if (!applyPatch(oldImage, patch, out, error, pubHex ? pub : nullptr, OTA_CHUNK_BYTES)) {
+      fprintf(stderr, "[OTA] %s\n", error.c_str());
+      return 1;
+    }
+    if (!writeFile(args[2], out)) {
+      perror("[OTA] write");
+      return 1;
+    }
+    printf("[OTA] %zu bytes written, digest matches%s\n", out.size(), pubHex ? ", signature valid" : "");
+    return 0;
+  }
+
+  if (strcmp(mode, "check") == 0 && (args.empty() || args.size() == 2)) {
+    return runCheck(args.empty() ? nullptr : args[0], args.empty() ? nullptr : args[1]);
+  }
+
+  if (strcmp(mode, "send") == 0 && args.size() == 2) {
+    return runSend(args[0], args[1]);
+  }
+  return usage(argv[0]);
+}
@@ -0,0 +1,159 @@
+// Streams a patch to a device (or the simulator) over its serial port:
+// OTA_BEGIN with the header, OTA_CHUNK with the ops, one chunk in flight
+// (the UART receive buffer is smaller than a chunk line), then OTA_END.
+// The device verifies, switches slots and restarts after OTA:DONE.
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ota_tool.h"
+
+#define SYNC_TIMEOUT_MS  15000  // Boot (splash screen) before the first PONG
+#define BEGIN_TIMEOUT_MS 10000  // Signature check and hashing the running image
+#define CHUNK_TIMEOUT_MS 5000
+#define END_TIMEOUT_MS   30000  // Image verification
+
+struct Port {
+  int fd;
+  std::string pending;
+};
+
+static double nowMs() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+static int openPort(const char* path) {
+  int fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (fd < 0) return -1;
+  struct termios t;
+  if (tcgetattr(fd, &t) == 0) {
+    cfmakeraw(&t);
+    cfsetspeed(&t, B115200);
+    tcsetattr(fd, TCSANOW, &t);
+  }
+  return fd;
+}
+
+static bool sendLine(Port& port, const std::string& line) {
+  std::string out = line + "\n";
+  size_t sent = 0;
+  while (sent < out.size()) {
+    ssize_t n = write(port.fd, out.data() + sent, out.size() - sent);
+    if (n > 0) {
+      sent += n;
+    } else if (n < 0 && errno != EAGAIN && errno != EINTR) {
+      return false;
+    } else {
+      struct pollfd p = {port.fd, POLLOUT, 0};
+      poll(&p, 1, 100);
+    }
+  }
+  return true;
+}
+
+static bool readLine(Port& port, std::string& line, double deadline) {
+  for (;;) {
+    size_t end = port.pending.find('\n');
+    if (end != std::string::npos) {
+      line = port.pending.substr(0, end);
+      port.pending.erase(0, end + 1);
+      if (!line.empty() && line.back() == '\r') line.pop_back();
+      return true;
+    }
+    int wait = (int)(deadline - nowMs());
+    if (wait <= 0) return false;
+    struct pollfd p = {port.fd, POLLIN, 0};
+    if (poll(&p, 1, wait) <= 0) continue;
+    char buf[4096];
+    ssize_t n = read(port.fd, buf, sizeof(buf));
+    if (n > 0) port.pending.append(buf, n);
+  }
+}
+
+// Next OTA: reply, skipping logs
+static bool readReply(Port& port, std::string& line, int timeoutMs) {
+  double deadline = nowMs() + timeoutMs;
+  while (readLine(port, line, deadline)) {
+    if (line.compare(0, 4, "OTA:") == 0) return true;
+  }
+  line = "timeout";
+  return false;
+}
+
+static std::string hex(const uint8_t* data, size_t len) {
+  static const char digits[] = "0123456789abcdef";
+  std::string s(2 * len, '0');
+  for (size_t i = 0; i < len; i++) {
+    s[2 * i] = digits[data[i] >> 4];
+    s[2 * i + 1] = digits[data[i] & 15];
+  }
+  return s;
+}
+
+int runSend(const char* path, const char* patchPath) {
+  Bytes patch;
+  if (!readFile(patchPath, patch) || patch.size() < DELTA_HEADER_BYTES) {
+    fprintf(stderr, "[OTA] %s is not a patch\n", patchPath);
+    return 1;
+  }
+  Port port = {openPort(path), ""};
+  if (port.fd < 0) {
+    perror("[OTA] open");
+    return 1;
+  }
+
+  std::string line;
+  double syncDeadline = nowMs() + SYNC_TIMEOUT_MS;
+  bool synced = false;
+  while (!synced && nowMs() < syncDeadline) {
+    sendLine(port, "PING");
+    double wait = nowMs() + 500;
+    while (!synced && readLine(port, line, wait)) synced = line == "PONG";
+  }
+  if (!synced) {
+    fprintf(stderr, "[OTA] no PONG from %s\n", path);
+    return 1;
+  }
+  while (readLine(port, line, nowMs() + 200)) {}
+
+  double start = nowMs();
+  sendLine(port, "OTA_BEGIN:" + hex(patch.data(), DELTA_HEADER_BYTES));
+  if (!readReply(port, line, BEGIN_TIMEOUT_MS) || line.compare(0, 10, "OTA:READY:") != 0) {
+    fprintf(stderr, "[OTA] OTA_BEGIN: %s\n", line.c_str());
+    return 1;
+  }
+  size_t chunk = (size_t)atoi(line.c_str() + 10);
+  if (chunk == 0) chunk = 256;
+
+  unsigned seq = 0;
+  for (size_t at = DELTA_HEADER_BYTES; at < patch.size(); at += chunk, seq++) {
+    size_t n = patch.size() - at < chunk ? patch.size() - at : chunk;
+    char head[32];
+    snprintf(head, sizeof(head), "OTA_CHUNK:%u:", seq);
+    sendLine(port, head + hex(patch.data() + at, n));
+    snprintf(head, sizeof(head), "OTA:ACK:%u:", seq);
+    if (!readReply(port, line, CHUNK_TIMEOUT_MS) || line.compare(0, strlen(head), head) != 0) {
+      fprintf(stderr, "[OTA] chunk %u: %s\n", seq, line.c_str());
+      sendLine(port, "OTA_ABORT");
+      return 1;
+    }
+  }
+
+  sendLine(port, "OTA_END");
+  if (!readReply(port, line, END_TIMEOUT_MS) || line != "OTA:DONE") {
+    fprintf(stderr, "[OTA] OTA_END: %s\n", line.c_str());
+    return 1;
+  }
+  printf("[OTA] %s: %zu byte patch in %u chunks, %.1f s, device restarting\n", path, patch.size(), seq,
+         (nowMs() - start) / 1000.0);
+  return 0;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "../../delta.h"
+
+typedef std::vector<uint8_t> Bytes;
+
+// Ops that turn oldImage into newImage, COPY_NEW limited to window (ota_diff.cpp)
+Bytes deltaDiff(const Bytes& oldImage, const Bytes& newImage, uint32_t window);
+
+// Header and ops; signed with sec if given, else the signature is zero
+Bytes makePatch(const Bytes& oldImage, const Bytes& newImage, const uint8_t* sec);
+
+// Apply a whole patch, feeding the ops in pieces of at most `chunk` bytes
+// (0 = all at once) the way the device receives them. Checks both
+// digests and, if pub is given, the signature. False with a reason.
+bool applyPatch(const Bytes& oldImage, const Bytes& patch, Bytes& out, std::string& error,
+                const uint8_t* pub = nullptr, size_t chunk = 0);
+
+void sha256(const Bytes& data, uint8_t out[32]);
+bool readFile(const char* path, Bytes& out);
+bool writeFile(const char* path, const Bytes& data);
+bool parseHexKey(const char* hex, uint8_t out[32]);
+
+// Seconds to send len bytes as OTA_CHUNK hex lines at 115200 baud
+double serialSeconds(size_t len);
+
+int runCheck(const char* oldPath, const char* newPath);
+int runSend(const char* port, const char* patchPath);
@@ -0,0 +1,164 @@
+#include "Arduino.h"
+#include <time.h>
+#include <vector>
+#include "sim.h"
+
+static int pinLevel[SHIM_PINS];
+static bool pinLevelSet[SHIM_PINS];
+static uint32_t ledcDuty[16];
+static int backlightChannel = -1;
+static uint32_t cpuMhz = 240;
+
+size_t Print::write(const uint8_t* data, size_t len) {
+  size_t n = 0;
+  while (n < len && write(data[n])) n++;
+  return n;
+}
+
+size_t Print::printf(const char* format, ...) {
+  char small[128];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(small, sizeof(small), format, args);
+  va_end(args);
+  if (len < 0) return 0;
+  if ((size_t)len < sizeof(small)) return write((const uint8_t*)small, len);
+
+  std::vector<char> big(len + 1);
+  va_start(args, format);
+  vsnprintf(big.data(), big.size(), format, args);
+  va_end(args);
+  return write((const uint8_t*)big.data(), len);
+}
+
+// ---- Time ----
+
+// With the virtual clock, time is real run time plus everything skipped by
+// delay() and idle waits
+static bool virtualClock = false;
+static uint64_t skippedUs = 0;
+static uint64_t horizonUs = UINT64_MAX;
+
+static uint64_t monotonicUs() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 + skippedUs;
+}
+
+static const uint64_t bootUs = monotonicUs();
+
+unsigned long millis() {
+  return (unsigned long)((monotonicUs() - bootUs) / 1000);
+}
+
+unsigned long micros() {
+  return (unsigned long)(monotonicUs() - bootUs);
+}
+
+void delay(unsigned long ms) {
+  if (virtualClock) {
+    skippedUs += (uint64_t)ms * 1000;
+    return;
+  }
+  struct timespec t = {(time_t)(ms / 1000), (long)(ms % 1000) * 1000000};
+  nanosleep(&t, nullptr);
+}
+
+void delayMicroseconds(unsigned int us) {
+  if (virtualClock) {
+    skippedUs += us;
+    return;
+  }
+  struct timespec t = {0, (long)us * 1000};
+  nanosleep(&t, nullptr);
+}
+
+void yield() {}
+
+void simVirtualClock(bool on) {
+  virtualClock = on;
+}
+
+bool simVirtualClockOn() {
+  return virtualClock;
+}
+
+void simClockHorizon(uint32_t ms) {
+  horizonUs = (uint64_t)ms * 1000;
+}
+
+void simClockIdle(int timeoutMs) {
+  uint64_t now = monotonicUs() - bootUs;
+  if (now >= horizonUs) return;
+  uint64_t step = horizonUs - now;
+  if (timeoutMs >= 0 && (uint64_t)timeoutMs * 1000 < step) step = (uint64_t)timeoutMs * 1000;
+  skippedUs += step;
+}
+
+// ---- GPIO ----
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+
+int digitalRead(uint8_t pin) {
+  if (pin >= SHIM_PINS || !pinLevelSet[pin]) return HIGH;
+  return pinLevel[pin];
+}
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+  simSetPin(pin, level);
+}
+
+// Edges wake the loop through simWake; the handlers themselves only notify
+void attachInterrupt(uint8_t pin, void (*fn)(), int mode) {}
+void detachInterrupt(uint8_t pin) {}
+
+void simSetPin(uint8_t pin, int level) {
+  if (pin >= SHIM_PINS) return;
+  pinLevel[pin] = level;
+  pinLevelSet[pin] = true;
+}
+
+// ---- LEDC / clock ----
+
+double ledcSetup(uint8_t channel, double freq, uint8_t bits) {
+  return freq;
+}
+
+void ledcAttachPin(uint8_t pin, uint8_t channel) {
+  backlightChannel = channel;
+}
+
+void ledcWrite(uint8_t channel, uint32_t duty) {
+  if (channel < 16) ledcDuty[channel] = duty;
+}
+
+bool setCpuFrequencyMhz(uint32_t mhz) {
+  cpuMhz = mhz;
+  return true;
+}
+
+uint32_t getCpuFrequencyMhz() {
+  return cpuMhz;
+}
+
+uint32_t simBacklight() {
+  return backlightChannel >= 0 ? ledcDuty[backlightChannel] : 0;
+}
+
+uint32_t simCpuMhz() {
+  return cpuMhz;
+}
+
+// ---- Random (Arduino API, not used for keys) ----
+
+long random(long howBig) {
+  return howBig > 0 ? rand() % howBig : 0;
+}
+
+long random(long howSmall, long howBig) {
+  return howBig > howSmall ? howSmall + random(howBig - howSmall) : howSmall;
+}
+
+void randomSeed(unsigned long seed) {
+  srand((unsigned)seed);
+}
@@ -0,0 +1,215 @@
+#pragma once
+
+// Arduino-ESP32 core shim for the native simulator (env:native_sim).
+//
+// Covers what the firmware uses, with the same signatures, so main.cpp and
+// its modules build unchanged: String, Print, Serial on a pseudo-terminal
+// (HardwareSerial.cpp), millis/delay, GPIO levels, LEDC and the CPU clock.
+// FreeRTOS task notifications and ESP-IDF sleep calls block on the serial
+// fd instead (esp_shim.cpp). sim.h is the simulator's side of the shim.
+
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <functional>
+#include <string>
+
+#include "freertos/FreeRTOS.h"
+
+#define PROGMEM
+#define IRAM_ATTR
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+#define DEC 10
+#define HEX 16
+
+#define SHIM_PINS 40
+
+using std::max;
+using std::min;
+typedef bool boolean;
+typedef uint8_t byte;
+
+// ==================== STRING ====================
+
+class String {
+ public:
+  String() {}
+  String(const char* c) : s(c ? c : "") {}
+  String(const std::string& x) : s(x) {}
+  explicit String(char c) : s(1, c) {}
+  explicit String(int v, int base = DEC) : s(number((long)v, base)) {}
+  explicit String(unsigned v, int base = DEC) : s(number((unsigned long)v, base)) {}
+  explicit String(long v, int base = DEC) : s(number(v, base)) {}
+  explicit String(unsigned long v, int base = DEC) : s(number(v, base)) {}
+  explicit String(double v, int decimals = 2) {
+    char b[48];
+    snprintf(b, sizeof(b), "%.*f", decimals, v);
+    s = b;
+  }
+
+  unsigned length() const { return (unsigned)s.size(); }
+  const char* c_str() const { return s.c_str(); }
+  bool isEmpty() const { return s.empty(); }
+  bool reserve(unsigned n) { s.reserve(n); return true; }
+  char charAt(unsigned i) const { return i < s.size() ? s[i] : 0; }
+  char operator[](unsigned i) const { return charAt(i); }
+  char& operator[](unsigned i) { return s[i]; }
+
+  String substring(unsigned from) const { return from >= s.size() ? String() : String(s.substr(from)); }
+  String substring(unsigned from, unsigned to) const {
+    if (from > to) std::swap(from, to);
+    return from >= s.size() ? String() : String(s.substr(from, to - from));
+  }
+  int indexOf(char c, unsigned from = 0) const { return found(s.find(c, from)); }
+  int indexOf(const char* c, unsigned from = 0) const { return found(s.find(c, from)); }
+  int indexOf(const String& c, unsigned from = 0) const { return found(s.find(c.s, from)); }
+  int lastIndexOf(char c) const { return found(s.rfind(c)); }
+  bool startsWith(const String& p) const { return s.compare(0, p.s.size(), p.s) == 0; }
+  bool endsWith(const String& p) const {
+    return s.size() >= p.s.size() && s.compare(s.size() - p.s.size(), p.s.size(), p.s) == 0;
+  }
+  bool equals(const String& o) const { return s == o.s; }
+
+  void trim() {
+    size_t a = 0, b = s.size();
+    while (a < b && isspace((unsigned char)s[a])) a++;
+    while (b > a && isspace((unsigned char)s[b - 1])) b--;
+    s = s.substr(a, b - a);
+  }
+  void toUpperCase() { for (char& c : s) c = (char)toupper((unsigned char)c); }
+  void toLowerCase() { for (char& c : s) c = (char)tolower((unsigned char)c); }
+  long toInt() const { return atol(s.c_str()); }
+  float toFloat() const { return (float)atof(s.c_str()); }
+
+  bool concat(const String& o) { s += o.s; return true; }
+  String& operator+=(const String& o) { s += o.s; return *this; }
+  String& operator+=(const char* o) { s += o; return *this; }
+  String& operator+=(char c) { s += c; return *this; }
+  bool operator==(const String& o) const { return s == o.s; }
+  bool operator==(const char* o) const { return s == o; }
+  bool operator!=(const String& o) const { return s != o.s; }
+  bool operator!=(const char* o) const { return s != o; }
+
+  friend String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+  friend String operator+(const String& a, const char* b) { return String(a.s + b); }
+  friend String operator+(const char* a, const String& b) { return String(a + b.s); }
+  friend String operator+(const String& a, char b) { return String(a.s + b); }
+
+ private:
+  std::string s;
+  static int found(size_t p) { return p == std::string::npos ? -1 : (int)p; }
+  static std::string number(long v, int base) {
+    return v < 0 ? "-" + number((unsigned long)-v, base) : number((unsigned long)v, base);
+  }
+  static std::string number(unsigned long v, int base) {
+    char b[72];
+    int n = sizeof(b);
+    b[--n] = '\0';
+    do {
+      b[--n] = "0123456789abcdef"[v % base];
+      v /= base;
+    } while (v);
+    return b + n;
+  }
+};
+
+// ==================== PRINT ====================
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* data, size_t len);
+  size_t write(const char* str) { return write((const uint8_t*)str, strlen(str)); }
+
+  size_t print(const char* s) { return write(s); }
+  size_t print(const String& s) { return write(s.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v, int base = DEC) { return print(String(v, base)); }
+  size_t print(unsigned v, int base = DEC) { return print(String(v, base)); }
+  size_t print(long v, int base = DEC) { return print(String(v, base)); }
+  size_t print(unsigned long v, int base = DEC) { return print(String(v, base)); }
+  size_t print(double v, int decimals = 2) { return print(String(v, decimals)); }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(T v) { return print(v) + println(); }
+  template <typename T> size_t println(T v, int format) { return print(v, format) + println(); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+// ==================== SERIAL ====================
+
+class HardwareSerial : public Print {
+ public:
+  void begin(unsigned long baud) {}
+  void end() {}
+  int available();
+  int peek();
+  int read();
+  size_t readBytes(char* buffer, size_t length);
+  String readStringUntil(char terminator);
+  void setTimeout(unsigned long ms) { timeoutMs = ms; }
+  void flush() {}
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* data, size_t len) override;
+  using Print::write;
+  int availableForWrite();
+  size_t setRxBufferSize(size_t n) { return n; }
+  size_t setTxBufferSize(size_t n) { txBufferSize = n; return n; }
+  void onReceive(std::function<void()> fn, bool onlyOnTimeout = false) { receiveHook = fn; }
+  operator bool() const { return true; }
+
+  std::function<void()> receiveHook;  // Called by the shim when RX data arrives
+
+ private:
+  unsigned long timeoutMs = 1000;
+  size_t txBufferSize = 256;
+};
+
+extern HardwareSerial Serial;
+
+// ==================== TIME / GPIO / LEDC ====================
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t level);
+inline int digitalPinToInterrupt(uint8_t pin) { return pin; }
+void attachInterrupt(uint8_t pin, void (*fn)(), int mode);
+void detachInterrupt(uint8_t pin);
+
+double ledcSetup(uint8_t channel, double freq, uint8_t bits);
+void ledcAttachPin(uint8_t pin, uint8_t channel);
+void ledcWrite(uint8_t channel, uint32_t duty);
+
+bool setCpuFrequencyMhz(uint32_t mhz);
+uint32_t getCpuFrequencyMhz();
+
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+template <typename T, typename L, typename H> T constrain(T x, L lo, H hi) {
+  return x < (T)lo ? (T)lo : x > (T)hi ? (T)hi : x;
+}
@@ -0,0 +1,3 @@
+#pragma once
+
+// rweather/Crypto: only SHA256 (SHA256.h) is used by the firmware
@@ -0,0 +1,153 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include "Arduino.h"
+#include "sim.h"
+
+#define TX_STALL_MS 100  // A write blocked this long means nobody is reading
+
+HardwareSerial Serial;
+
+static int serialFd = -1;
+static int slaveFd = -1;
+static bool mirror = false;
+static uint32_t dropped = 0;
+static std::string rx;
+static int wakePipe[2] = {-1, -1};
+
+void simSerialAttach(int fd, int slave) {
+  serialFd = fd;
+  slaveFd = slave;
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+}
+
+void simSerialMirror(bool on) {
+  mirror = on;
+}
+
+uint32_t simSerialDropped() {
+  return dropped;
+}
+
+// Move whatever the port has into rx without blocking
+static void pump() {
+  if (serialFd < 0) return;
+  char buf[512];
+  ssize_t n;
+  while ((n = ::read(serialFd, buf, sizeof(buf))) > 0) rx.append(buf, n);
+}
+
+void simWake() {
+  if (wakePipe[1] >= 0) {
+    char c = 0;
+    (void)!::write(wakePipe[1], &c, 1);
+  }
+}
+
+bool simWaitForEvent(int timeoutMs) {
+  if (wakePipe[0] < 0) {
+    if (pipe(wakePipe) == 0) {
+      fcntl(wakePipe[0], F_SETFL, O_NONBLOCK);
+      fcntl(wakePipe[1], F_SETFL, O_NONBLOCK);
+    }
+  }
+  pump();
+  if (!rx.empty()) return true;
+
+  // A virtual clock never sleeps: it jumps to the timeout instead
+  struct pollfd fds[2] = {{serialFd, POLLIN, 0}, {wakePipe[0], POLLIN, 0}};
+  if (poll(fds, 2, simVirtualClockOn() ? 0 : timeoutMs) <= 0) {
+    if (simVirtualClockOn()) simClockIdle(timeoutMs);
+    return false;
+  }
+
+  char drain[64];
+  while (::read(wakePipe[0], drain, sizeof(drain)) > 0) {}
+  pump();
+  if (!rx.empty() && Serial.receiveHook) Serial.receiveHook();
+  return true;
+}
+
+void simSerialInject(const char* data) {
+  rx.append(data);
+  if (Serial.receiveHook) Serial.receiveHook();
+}
+
+int HardwareSerial::available() {
+  pump();
+  return (int)rx.size();
+}
+
+int HardwareSerial::peek() {
+  pump();
+  return rx.empty() ? -1 : (uint8_t)rx[0];
+}
+
+int HardwareSerial::read() {
+  pump();
+  if (rx.empty()) return -1;
+  uint8_t c = rx[0];
+  rx.erase(0, 1);
+  return c;
+}
+
+size_t HardwareSerial::readBytes(char* buffer, size_t length) {
+  size_t n = 0;
+  unsigned long start = millis();
+  while (n < length && millis() - start < timeoutMs) {
+    int c = read();
+    if (c < 0) {
+      simWaitForEvent(1);
+      continue;
+    }
+    buffer[n++] = (char)c;
+  }
+  return n;
+}
+
+// Stream::readStringUntil: stops at the terminator or after timeoutMs of silence
+String HardwareSerial::readStringUntil(char terminator) {
+  std::string line;
+  unsigned long last = millis();
+  while (millis() - last < timeoutMs) {
+    int c = read();
+    if (c < 0) {
+      simWaitForEvent(1);
+      continue;
+    }
+    if (c == terminator) break;
+    line += (char)c;
+    last = millis();
+  }
+  return String(line);
+}
+
+// Output that nobody reads is dropped after TX_STALL_MS, like a UART with
+// no host attached, rather than stalling the firmware loop
+size_t HardwareSerial::write(const uint8_t* data, size_t len) {
+  if (mirror) fwrite(data, 1, len, stdout);
+  if (serialFd < 0) return len;
+
+  size_t sent = 0;
+  while (sent < len) {
+    ssize_t n = ::write(serialFd, data + sent, len - sent);
+    if (n > 0) {
+      sent += n;
+      continue;
+    }
+    if (n < 0 && errno != EAGAIN && errno != EINTR) break;
+    struct pollfd out = {serialFd, POLLOUT, 0};
+    if (poll(&out, 1, TX_STALL_MS) <= 0) break;
+  }
+  dropped += len - sent;
+  return len;
+}
+
+// Free space in the emulated TX buffer: what the client has not read yet
+int HardwareSerial::availableForWrite() {
+  int queued = 0;
+  if (slaveFd >= 0) ioctl(slaveFd, FIONREAD, &queued);
+  return queued >= (int)txBufferSize ? 0 : (int)txBufferSize - queued;
+}
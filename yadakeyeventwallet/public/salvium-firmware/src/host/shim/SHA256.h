@@ -0,0 +1,28 @@
+#pragma once
+
+// rweather/Crypto SHA256 interface, portable implementation
+
+#include <stddef.h>
+#include <stdint.h>
+
+class SHA256 {
+ public:
+  SHA256() { reset(); }
+  ~SHA256() { clear(); }
+
+  size_t hashSize() const { return 32; }
+  size_t blockSize() const { return 64; }
+
+  void reset();
+  void update(const void* data, size_t len);
+  void finalize(void* hash, size_t len);
+  void clear();
+
+ private:
+  uint32_t h[8];
+  uint8_t block[64];
+  uint64_t length;  // Bytes hashed
+  uint8_t used;     // Bytes in block
+
+  void processBlock();
+};
@@ -0,0 +1,359 @@
+#include "TFT_eSPI.h"
+#include <vector>
+#include "sim.h"
+
+// Bytes on the SPI bus for one address window: CASET and RASET with four
+// data bytes each, then RAMWR
+#define TFT_WINDOW_BYTES 11
+#define TFT_FRAME_PIXELS (240 * 320)
+
+// Row-major RGB565 in the current rotation. A plain array: the firmware's
+// global TFT_eSPI is constructed before this file's dynamic initializers.
+static uint16_t frame[TFT_FRAME_PIXELS];
+static int16_t frameWidth = 0;
+static int16_t frameHeight = 0;
+
+static SimTftCost costs[SIM_TFT_PRIMS];
+static int activePrim = -1;  // Outermost primitive; nested calls bill to it
+
+static const char* const primNames[SIM_TFT_PRIMS] = {
+  "fillScreen", "fillRect", "drawRect", "drawFastHLine", "drawFastVLine",
+  "drawPixel", "fillTriangle", "pushImage", "text",
+};
+
+// Classic 5x7 GLCD font (TFT_eSPI font 1), printable ASCII, one byte per column
+static const uint8_t glcdFont[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x5F, 0x00, 0x00,  0x00, 0x07, 0x00, 0x07, 0x00,
+  0x14, 0x7F, 0x14, 0x7F, 0x14,  0x24, 0x2A, 0x7F, 0x2A, 0x12,  0x23, 0x13, 0x08, 0x64, 0x62,
+  0x36, 0x49, 0x56, 0x20, 0x50,  0x00, 0x08, 0x07, 0x03, 0x00,  0x00, 0x1C, 0x22, 0x41, 0x00,
+  0x00, 0x41, 0x22, 0x1C, 0x00,  0x2A, 0x1C, 0x7F, 0x1C, 0x2A,  0x08, 0x08, 0x3E, 0x08, 0x08,
+  0x00, 0x80, 0x70, 0x30, 0x00,  0x08, 0x08, 0x08, 0x08, 0x08,  0x00, 0x00, 0x60, 0x60, 0x00,
+  0x20, 0x10, 0x08, 0x04, 0x02,  0x3E, 0x51, 0x49, 0x45, 0x3E,  0x00, 0x42, 0x7F, 0x40, 0x00,
+  0x72, 0x49, 0x49, 0x49, 0x46,  0x21, 0x41, 0x49, 0x4D, 0x33,  0x18, 0x14, 0x12, 0x7F, 0x10,
+  0x27, 0x45, 0x45, 0x45, 0x39,  0x3C, 0x4A, 0x49, 0x49, 0x31,  0x41, 0x21, 0x11, 0x09, 0x07,
+  0x36, 0x49, 0x49, 0x49, 0x36,  0x46, 0x49, 0x49, 0x29, 0x1E,  0x00, 0x00, 0x14, 0x00, 0x00,
+  0x00, 0x40, 0x34, 0x00, 0x00,  0x00, 0x08, 0x14, 0x22, 0x41,  0x14, 0x14, 0x14, 0x14, 0x14,
+  0x00, 0x41, 0x22, 0x14, 0x08,  0x02, 0x01, 0x59, 0x09, 0x06,  0x3E, 0x41, 0x5D, 0x59, 0x4E,
+  0x7C, 0x12, 0x11, 0x12, 0x7C,  0x7F, 0x49, 0x49, 0x49, 0x36,  0x3E, 0x41, 0x41, 0x41, 0x22,
+  0x7F, 0x41, 0x41, 0x41, 0x3E,  0x7F, 0x49, 0x49, 0x49, 0x41,  0x7F, 0x09, 0x09, 0x09, 0x01,
+  0x3E, 0x41, 0x41, 0x51, 0x73,  0x7F, 0x08, 0x08, 0x08, 0x7F,  0x00, 0x41, 0x7F, 0x41, 0x00,
+  0x20, 0x40, 0x41, 0x3F, 0x01,  0x7F, 0x08, 0x14, 0x22, 0x41,  0x7F, 0x40, 0x40, 0x40, 0x40,
+  0x7F, 0x02, 0x1C, 0x02, 0x7F,  0x7F, 0x04, 0x08, 0x10, 0x7F,  0x3E, 0x41, 0x41, 0x41, 0x3E,
+  0x7F, 0x09, 0x09, 0x09, 0x06,  0x3E, 0x41, 0x51, 0x21, 0x5E,  0x7F, 0x09, 0x19, 0x29, 0x46,
+  0x26, 0x49, 0x49, 0x49, 0x32,  0x03, 0x01, 0x7F, 0x01, 0x03,  0x3F, 0x40, 0x40, 0x40, 0x3F,
+  0x1F, 0x20, 0x40, 0x20, 0x1F,  0x3F, 0x40, 0x38, 0x40, 0x3F,  0x63, 0x14, 0x08, 0x14, 0x63,
+  0x03, 0x04, 0x78, 0x04, 0x03,  0x61, 0x59, 0x49, 0x4D, 0x43,  0x00, 0x7F, 0x41, 0x41, 0x41,
+  0x02, 0x04, 0x08, 0x10, 0x20,  0x00, 0x41, 0x41, 0x41, 0x7F,  0x04, 0x02, 0x01, 0x02, 0x04,
+  0x40, 0x40, 0x40, 0x40, 0x40,  0x00, 0x03, 0x07, 0x08, 0x00,  0x20, 0x54, 0x54, 0x78, 0x40,
+  0x7F, 0x28, 0x44, 0x44, 0x38,  0x38, 0x44, 0x44, 0x44, 0x28,  0x38, 0x44, 0x44, 0x28, 0x7F,
+  0x38, 0x54, 0x54, 0x54, 0x18,  0x00, 0x08, 0x7E, 0x09, 0x02,  0x18, 0xA4, 0xA4, 0x9C, 0x78,
+  0x7F, 0x08, 0x04, 0x04, 0x78,  0x00, 0x44, 0x7D, 0x40, 0x00,  0x20, 0x40, 0x40, 0x3D, 0x00,
+  0x7F, 0x10, 0x28, 0x44, 0x00,  0x00, 0x41, 0x7F, 0x40, 0x00,  0x7C, 0x04, 0x78, 0x04, 0x78,
+  0x7C, 0x08, 0x04, 0x04, 0x78,  0x38, 0x44, 0x44, 0x44, 0x38,  0xFC, 0x18, 0x24, 0x24, 0x18,
+  0x18, 0x24, 0x24, 0x18, 0xFC,  0x7C, 0x08, 0x04, 0x04, 0x08,  0x48, 0x54, 0x54, 0x54, 0x24,
+  0x04, 0x04, 0x3F, 0x44, 0x24,  0x3C, 0x40, 0x40, 0x20, 0x7C,  0x1C, 0x20, 0x40, 0x20, 0x1C,
+  0x3C, 0x40, 0x30, 0x40, 0x3C,  0x44, 0x28, 0x10, 0x28, 0x44,  0x4C, 0x90, 0x90, 0x90, 0x7C,
+  0x44, 0x64, 0x54, 0x4C, 0x44,  0x00, 0x08, 0x36, 0x41, 0x00,  0x00, 0x00, 0x77, 0x00, 0x00,
+  0x00, 0x41, 0x36, 0x08, 0x00,  0x02, 0x01, 0x02, 0x04, 0x02,
+};
+
+// Bills the outermost primitive for everything drawn until it returns
+struct Primitive {
+  bool outer;
+  explicit Primitive(int prim) : outer(activePrim < 0) {
+    if (!outer) return;
+    activePrim = prim;
+    costs[prim].calls++;
+  }
+  ~Primitive() {
+    if (outer) activePrim = -1;
+  }
+};
+
+// One address window over the visible part of a rect and its pixels; the
+// caller writes them. False when nothing is on screen (TFT_eSPI sends nothing).
+static bool clipWindow(int32_t& x, int32_t& y, int32_t& w, int32_t& h) {
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > frameWidth) w = frameWidth - x;
+  if (y + h > frameHeight) h = frameHeight - y;
+  if (w <= 0 || h <= 0) return false;
+
+  SimTftCost& cost = costs[activePrim];
+  cost.windows++;
+  cost.pixels += (uint32_t)(w * h);
+  cost.bytes += TFT_WINDOW_BYTES + 2 * (uint32_t)(w * h);
+  return true;
+}
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) : _init_width(w), _init_height(h), _width(w), _height(h) {
+  if ((int32_t)w * h > TFT_FRAME_PIXELS) abort();
+  frameWidth = w;
+  frameHeight = h;
+}
+
+// Rotations 1 and 3 are landscape; the frame buffer follows the rotation
+void TFT_eSPI::setRotation(uint8_t r) {
+  bool landscape = r & 1;
+  _width = landscape ? _init_height : _init_width;
+  _height = landscape ? _init_width : _init_height;
+  frameWidth = _width;
+  frameHeight = _height;
+}
+
+void TFT_eSPI::fillScreen(uint32_t color) {
+  Primitive p(SIM_TFT_FILL_SCREEN);
+  fillRect(0, 0, _width, _height, color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  Primitive p(SIM_TFT_FILL_RECT);
+  if (!clipWindow(x, y, w, h)) return;
+  for (int32_t r = 0; r < h; r++) {
+    uint16_t* row = &frame[(size_t)(y + r) * frameWidth + x];
+    for (int32_t c = 0; c < w; c++) row[c] = (uint16_t)color;
+  }
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  Primitive p(SIM_TFT_DRAW_RECT);
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y + 1, h - 2, color);
+  drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+  Primitive p(SIM_TFT_HLINE);
+  fillRect(x, y, w, 1, color);
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+  Primitive p(SIM_TFT_VLINE);
+  fillRect(x, y, 1, h, color);
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  Primitive p(SIM_TFT_PIXEL);
+  fillRect(x, y, 1, 1, color);
+}
+
+// Flat-top/flat-bottom split with one horizontal line per scanline, as in
+// TFT_eSPI (and Adafruit_GFX)
+void TFT_eSPI::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                            uint32_t color) {
+  Primitive p(SIM_TFT_TRIANGLE);
+  if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+  if (y1 > y2) { std::swap(y2, y1); std::swap(x2, x1); }
+  if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+
+  if (y0 == y2) {
+    int32_t a = std::min(x0, std::min(x1, x2));
+    int32_t b = std::max(x0, std::max(x1, x2));
+    drawFastHLine(a, y0, b - a + 1, color);
+    return;
+  }
+
+  int32_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0;
+  int32_t dx12 = x2 - x1, dy12 = y2 - y1;
+  int32_t sa = 0, sb = 0;
+  int32_t last = y1 == y2 ? y1 : y1 - 1;
+  int32_t y = y0;
+
+  for (; y <= last; y++) {
+    int32_t a = x0 + sa / dy01;
+    int32_t b = x0 + sb / dy02;
+    sa += dx01;
+    sb += dx02;
+    if (a > b) std::swap(a, b);
+    drawFastHLine(a, y, b - a + 1, color);
+  }
+
+  sa = dx12 * (y - y1);
+  sb = dx02 * (y - y0);
+  for (; y <= y2; y++) {
+    int32_t a = x1 + sa / dy12;
+    int32_t b = x0 + sb / dy02;
+    sa += dx12;
+    sb += dx02;
+    if (a > b) std::swap(a, b);
+    drawFastHLine(a, y, b - a + 1, color);
+  }
+}
+
+// Without swap bytes the data is already in wire order (MSB first)
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+  Primitive p(SIM_TFT_IMAGE);
+  int32_t x0 = x, y0 = y, stride = w;
+  if (!clipWindow(x, y, w, h)) return;
+  for (int32_t r = 0; r < h; r++) {
+    const uint16_t* src = data + (size_t)(y - y0 + r) * stride + (x - x0);
+    uint16_t* row = &frame[(size_t)(y + r) * frameWidth + x];
+    for (int32_t c = 0; c < w; c++) {
+      uint16_t v = src[c];
+      row[c] = swapBytes ? v : (uint16_t)((v >> 8) | (v << 8));
+    }
+  }
+}
+
+// Font 1 cursor handling: newline returns to x = 0, text wraps at the edge
+size_t TFT_eSPI::write(uint8_t c) {
+  Primitive p(SIM_TFT_TEXT);
+  if (c == '\r') return 1;
+  if (c == '\n') {
+    cursorX = 0;
+    cursorY += 8 * textSize;
+    return 1;
+  }
+  if (cursorX + 6 * textSize > _width) {
+    cursorX = 0;
+    cursorY += 8 * textSize;
+  }
+  drawChar(cursorX, cursorY, c);
+  cursorX += 6 * textSize;
+  return 1;
+}
+
+// TFT_eSPI 2.5 drawChar for font 1: an opaque size-1 glyph fully on screen
+// is one 6x8 window; anything else goes out a pixel (or size x size block)
+// at a time, background included when the colours differ.
+void TFT_eSPI::drawChar(int32_t x, int32_t y, uint8_t c) {
+  const uint8_t* glyph = c >= 0x20 && c <= 0x7E ? glcdFont + (c - 0x20) * 5 : glcdFont;
+  bool fillBg = textBg != textFg;
+  int32_t size = textSize;
+
+  if (fillBg && size == 1 && x >= 0 && y >= 0 && x + 6 <= _width && y + 8 <= _height) {
+    int32_t wx = x, wy = y, ww = 6, wh = 8;
+    clipWindow(wx, wy, ww, wh);
+    for (int32_t col = 0; col < 6; col++) {
+      uint8_t line = col < 5 ? glyph[col] : 0;
+      for (int32_t row = 0; row < 8; row++, line >>= 1) {
+        frame[(size_t)(y + row) * frameWidth + x + col] = (line & 1) ? textFg : textBg;
+      }
+    }
+    return;
+  }
+
+  for (int32_t col = 0; col < 5; col++) {
+    uint8_t line = glyph[col];
+    for (int32_t row = 0; row < 8; row++, line >>= 1) {
+      if (line & 1) {
+        fillRect(x + col * size, y + row * size, size, size, textFg);
+      } else if (fillBg) {
+        fillRect(x + col * size, y + row * size, size, size, textBg);
+      }
+    }
+  }
+  if (fillBg) fillRect(x + 5 * size, y, size, 8 * size, textBg);
+}
+
+// ---- Simulator side ----
+
+const char* simTftPrimName(int prim) {
+  return prim >= 0 && prim < SIM_TFT_PRIMS ? primNames[prim] : "";
+}
+
+SimTftCost simTftCost(int prim) {
+  SimTftCost total = {};
+  for (int k = 0; k < SIM_TFT_PRIMS; k++) {
+    if (prim >= 0 && k != prim) continue;
+    total.calls += costs[k].calls;
+    total.windows += costs[k].windows;
+    total.pixels += costs[k].pixels;
+    total.bytes += costs[k].bytes;
+  }
+  return total;
+}
+
+void simTftReset() {
+  memset(costs, 0, sizeof(costs));
+}
+
+uint32_t simTftFrameHash() {
+  uint32_t h = 2166136261u;  // FNV-1a over the pixels, low byte first
+  for (int32_t i = 0; i < (int32_t)frameWidth * frameHeight; i++) {
+    uint16_t px = frame[i];
+    h = (h ^ (px & 0xFF)) * 16777619u;
+    h = (h ^ (px >> 8)) * 16777619u;
+  }
+  return h;
+}
+
+// ---- PNG ----
+
+static uint32_t crcTable[256];
+
+static uint32_t crc32(uint32_t crc, const uint8_t* p, size_t n) {
+  if (!crcTable[1]) {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      crcTable[i] = c;
+    }
+  }
+  crc = ~crc;
+  while (n--) crc = crcTable[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+  return ~crc;
+}
+
+static void put32(std::vector<uint8_t>& out, uint32_t v) {
+  for (int s = 24; s >= 0; s -= 8) out.push_back((uint8_t)(v >> s));
+}
+
+static void putChunk(std::vector<uint8_t>& out, const char* type, const std::vector<uint8_t>& body) {
+  put32(out, (uint32_t)body.size());
+  size_t start = out.size();
+  out.insert(out.end(), type, type + 4);
+  out.insert(out.end(), body.begin(), body.end());
+  put32(out, crc32(0, out.data() + start, out.size() - start));
+}
+
+// 8-bit RGB, filter 0 on every row, zlib stream of stored (uncompressed)
+// deflate blocks: no zlib dependency and byte-identical output per frame
+bool simTftWritePng(const char* path) {
+  std::vector<uint8_t> raw;
+  raw.reserve((size_t)frameHeight * (1 + frameWidth * 3));
+  for (int32_t y = 0; y < frameHeight; y++) {
+    raw.push_back(0);
+    for (int32_t x = 0; x < frameWidth; x++) {
+      uint16_t px = frame[(size_t)y * frameWidth + x];
+      uint8_t r = px >> 11, g = (px >> 5) & 0x3F, b = px & 0x1F;
+      raw.push_back((uint8_t)(r << 3 | r >> 2));
+      raw.push_back((uint8_t)(g << 2 | g >> 4));
+      raw.push_back((uint8_t)(b << 3 | b >> 2));
+    }
+  }
+
+  std::vector<uint8_t> z = {0x78, 0x01};
+  for (size_t pos = 0; pos < raw.size();) {
+    size_t n = std::min(raw.size() - pos, (size_t)65535);
+    z.push_back(pos + n == raw.size() ? 1 : 0);
+    z.push_back((uint8_t)n);
+    z.push_back((uint8_t)(n >> 8));
+    z.push_back((uint8_t)~n);
+    z.push_back((uint8_t)(~n >> 8));
+    z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + n);
+    pos += n;
+  }
+  uint32_t a = 1, b = 0;
+  for (uint8_t v : raw) {
+    a = (a + v) % 65521;
+    b = (b + a) % 65521;
+  }
+  put32(z, b << 16 | a);
+
+  std::vector<uint8_t> ihdr;
+  put32(ihdr, (uint32_t)frameWidth);
+  put32(ihdr, (uint32_t)frameHeight);
+  ihdr.insert(ihdr.end(), {8, 2, 0, 0, 0});
+
+  std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  putChunk(png, "IHDR", ihdr);
+  putChunk(png, "IDAT", z);
+  putChunk(png, "IEND", {});
+
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  bool ok = fwrite(png.data(), 1, png.size(), f) == png.size();
+  return fclose(f) == 0 && ok;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+// TFT_eSPI interface for the simulator. Drawing goes into an RGB565 frame
+// buffer and every primitive is costed the way TFT_eSPI 2.5 drives an
+// ILI9341: an address window (CASET + RASET + RAMWR, 11 bytes) per rect,
+// line, pixel or glyph it sends, plus 2 bytes per pixel. sim.h reads the
+// counters and writes the frame buffer out as a PNG.
+
+#include "Arduino.h"
+
+#define TFT_BLACK 0x0000
+#define TFT_BLUE  0x001F
+#define TFT_RED   0xF800
+#define TFT_GREEN 0x07E0
+#define TFT_WHITE 0xFFFF
+
+class TFT_eSPI : public Print {
+ public:
+  TFT_eSPI(int16_t w = 240, int16_t h = 320);
+
+  void init() {}
+  void setRotation(uint8_t r);
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+
+  void fillScreen(uint32_t color);
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+  void drawPixel(int32_t x, int32_t y, uint32_t color);
+  void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+
+  void startWrite() {}
+  void endWrite() {}
+  void setSwapBytes(bool swap) { swapBytes = swap; }
+  bool getSwapBytes() const { return swapBytes; }
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+
+  void setCursor(int16_t x, int16_t y) { cursorX = x; cursorY = y; }
+  void setTextColor(uint16_t fg) { textFg = textBg = fg; }
+  void setTextColor(uint16_t fg, uint16_t bg) { textFg = fg; textBg = bg; }
+  void setTextSize(uint8_t size) { textSize = size ? size : 1; }
+  size_t write(uint8_t c) override;
+  using Print::write;
+
+ private:
+  int16_t _init_width, _init_height;
+  int16_t _width, _height;
+  bool swapBytes = false;
+  int32_t cursorX = 0, cursorY = 0;
+  uint16_t textFg = TFT_WHITE, textBg = TFT_WHITE;
+  uint8_t textSize = 1;
+
+  void drawChar(int32_t x, int32_t y, uint8_t c);
+};
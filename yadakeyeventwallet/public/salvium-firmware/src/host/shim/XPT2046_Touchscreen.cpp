@@ -0,0 +1,22 @@
+#include "XPT2046_Touchscreen.h"
+#include "sim.h"
+
+static bool pressed = false;
+static TS_Point point;
+
+bool XPT2046_Touchscreen::touched() {
+  return pressed;
+}
+
+TS_Point XPT2046_Touchscreen::getPoint() {
+  return pressed ? point : TS_Point();
+}
+
+void simTouch(int16_t x, int16_t y, int16_t z) {
+  point = TS_Point(x, y, z);
+  pressed = true;
+}
+
+void simTouchRelease() {
+  pressed = false;
+}
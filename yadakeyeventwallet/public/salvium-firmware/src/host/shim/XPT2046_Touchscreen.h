@@ -0,0 +1,26 @@
+#pragma once
+
+// XPT2046_Touchscreen interface. The panel is driven by the simulator
+// (simTouch / simTouchRelease in sim.h); PENIRQ is a plain GPIO that the
+// simulator drives separately, as the firmware's idle manager owns it.
+// Points are raw panel coordinates, as from the controller.
+
+#include "Arduino.h"
+#include "SPI.h"
+
+class TS_Point {
+ public:
+  TS_Point() {}
+  TS_Point(int16_t x, int16_t y, int16_t z) : x(x), y(y), z(z) {}
+  int16_t x = 0, y = 0, z = 0;
+};
+
+class XPT2046_Touchscreen {
+ public:
+  XPT2046_Touchscreen(uint8_t cs, uint8_t irq = 255) {}
+  bool begin(SPIClass& spi) { return true; }
+  bool begin() { return true; }
+  void setRotation(uint8_t r) {}
+  bool touched();
+  TS_Point getPoint();
+};
@@ -0,0 +1,6 @@
+#pragma once
+
+typedef int esp_err_t;
+typedef enum { UART_NUM_0, UART_NUM_1, UART_NUM_2 } uart_port_t;
+
+esp_err_t uart_set_wakeup_threshold(uart_port_t port, int edges);
@@ -0,0 +1,106 @@
+#include "esp_ota_ops.h"
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "sim.h"
+
+#define SLOT_BYTES      0x140000  // partitions.csv app0 and app1
+#define ESP_IMAGE_MAGIC 0xe9  // First byte of every app image
+
+static const esp_partition_t slots[2] = {
+  {0x10000, SLOT_BYTES, "app0"},
+  {0x150000, SLOT_BYTES, "app1"},
+};
+
+static std::string firmwareFile;
+static std::vector<uint8_t> running;
+static bool loaded = false;
+static std::vector<uint8_t> next;
+static esp_ota_handle_t openHandle = 0;
+static esp_ota_handle_t lastHandle = 0;
+static size_t expected = 0;  // 0 if esp_ota_begin was not given the size
+
+void simFirmwareFile(const char* path) {
+  firmwareFile = path;
+  loaded = false;
+}
+
+static void load() {
+  loaded = true;
+  running.clear();
+  if (firmwareFile.empty()) return;
+  FILE* f = fopen(firmwareFile.c_str(), "rb");
+  if (!f) return;
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) running.insert(running.end(), buf, buf + n);
+  fclose(f);
+  fprintf(stderr, "[SIM] Firmware: %zu bytes from %s\n", running.size(), firmwareFile.c_str());
+}
+
+// Past the end of the image the slot reads as erased flash
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t offset, void* dst, size_t size) {
+  if (!partition || offset + size > partition->size) return ESP_ERR_INVALID_ARG;
+  if (!loaded) load();
+  const std::vector<uint8_t>& image = partition == &slots[0] ? running : next;
+  uint8_t* out = (uint8_t*)dst;
+  for (size_t i = 0; i < size; i++) out[i] = offset + i < image.size() ? image[offset + i] : 0xff;
+  return ESP_OK;
+}
+
+const esp_partition_t* esp_ota_get_running_partition() {
+  return &slots[0];
+}
+
+const esp_partition_t* esp_ota_get_next_update_partition(const esp_partition_t* start) {
+  return &slots[1];
+}
+
+// Nothing to erase in RAM: a known imageSize is checked at esp_ota_end,
+// OTA_SIZE_UNKNOWN and OTA_WITH_SEQUENTIAL_WRITES only against the slot
+esp_err_t esp_ota_begin(const esp_partition_t* partition, size_t imageSize, esp_ota_handle_t* out) {
+  bool unknown = imageSize == OTA_SIZE_UNKNOWN || imageSize == OTA_WITH_SEQUENTIAL_WRITES;
+  if (partition != &slots[1] || (!unknown && imageSize > partition->size)) return ESP_ERR_INVALID_ARG;
+  next.clear();
+  expected = unknown ? 0 : imageSize;
+  openHandle = ++lastHandle;
+  *out = openHandle;
+  return ESP_OK;
+}
+
+esp_err_t esp_ota_write(esp_ota_handle_t handle, const void* data, size_t size) {
+  if (handle != openHandle || handle == 0) return ESP_ERR_INVALID_ARG;
+  if (next.size() + size > SLOT_BYTES) return ESP_ERR_INVALID_SIZE;
+  next.insert(next.end(), (const uint8_t*)data, (const uint8_t*)data + size);
+  return ESP_OK;
+}
+
+// The device checks the image header and its appended digest; the sim
+// only checks the magic byte and the length
+esp_err_t esp_ota_end(esp_ota_handle_t handle) {
+  if (handle != openHandle || handle == 0) return ESP_ERR_INVALID_ARG;
+  openHandle = 0;
+  if ((expected && next.size() != expected) || next.empty() || next[0] != ESP_IMAGE_MAGIC) return ESP_FAIL;
+  return ESP_OK;
+}
+
+esp_err_t esp_ota_abort(esp_ota_handle_t handle) {
+  if (handle == openHandle) openHandle = 0;
+  next.clear();
+  return ESP_OK;
+}
+
+esp_err_t esp_ota_set_boot_partition(const esp_partition_t* partition) {
+  if (partition != &slots[1] || openHandle != 0) return ESP_ERR_INVALID_ARG;
+  if (firmwareFile.empty()) return ESP_OK;
+  FILE* f = fopen(firmwareFile.c_str(), "wb");
+  bool ok = f && fwrite(next.data(), 1, next.size(), f) == next.size();
+  if (f && fclose(f) != 0) ok = false;
+  fprintf(stderr, "[SIM] Firmware: %zu bytes to %s%s\n", next.size(), firmwareFile.c_str(), ok ? "" : " FAILED");
+  return ok ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t esp_ota_mark_app_valid_cancel_rollback() {
+  return ESP_OK;
+}
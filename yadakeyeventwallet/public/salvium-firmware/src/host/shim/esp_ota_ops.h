@@ -0,0 +1,39 @@
+#pragma once
+
+// ESP-IDF app OTA subset over partitions.csv's two slots: app0 runs, and is
+// backed by a file (sim.h: simFirmwareFile) so an update can be checked
+// against a real firmware.bin; app1 is RAM. esp_ota_set_boot_partition
+// writes the new image over the file, which is what the next run boots.
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int esp_err_t;
+typedef uint32_t esp_ota_handle_t;
+
+#ifndef ESP_OK
+#define ESP_OK   0
+#define ESP_FAIL -1
+#endif
+#define ESP_ERR_INVALID_ARG  0x102
+#define ESP_ERR_INVALID_SIZE 0x104
+
+#define OTA_SIZE_UNKNOWN           0xffffffff  // esp_ota_begin sizes
+#define OTA_WITH_SEQUENTIAL_WRITES 0xfffffffe
+
+typedef struct {
+  uint32_t address;
+  uint32_t size;
+  char label[17];
+} esp_partition_t;
+
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t offset, void* dst, size_t size);
+
+const esp_partition_t* esp_ota_get_running_partition();
+const esp_partition_t* esp_ota_get_next_update_partition(const esp_partition_t* start);
+esp_err_t esp_ota_begin(const esp_partition_t* partition, size_t imageSize, esp_ota_handle_t* out);
+esp_err_t esp_ota_write(esp_ota_handle_t handle, const void* data, size_t size);
+esp_err_t esp_ota_end(esp_ota_handle_t handle);
+esp_err_t esp_ota_abort(esp_ota_handle_t handle);
+esp_err_t esp_ota_set_boot_partition(const esp_partition_t* partition);
+esp_err_t esp_ota_mark_app_valid_cancel_rollback();
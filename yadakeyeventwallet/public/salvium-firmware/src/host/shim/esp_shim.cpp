@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Arduino.h"
+#include "driver/gpio.h"
+#include "driver/uart.h"
+#include "esp_sleep.h"
+#include "esp_system.h"
+#include "esp_task_wdt.h"
+#include "esp_timer.h"
+#include "sim.h"
+
+static uint32_t notifications = 0;
+static esp_sleep_wakeup_cause_t wakeCause = ESP_SLEEP_WAKEUP_UNDEFINED;
+
+// ---- FreeRTOS ----
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  return (TaskHandle_t)&notifications;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+  if (notifications == 0) simWaitForEvent(ticks == portMAX_DELAY ? -1 : (int)ticks);
+  uint32_t count = notifications;
+  if (clearOnExit) {
+    notifications = 0;
+  } else if (notifications > 0) {
+    notifications--;
+  }
+  return count;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  notifications++;
+  return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken) {
+  notifications++;
+  if (woken) *woken = pdFALSE;
+}
+
+void vTaskDelay(TickType_t ticks) {
+  delay(ticks * portTICK_PERIOD_MS);
+}
+
+TickType_t xTaskGetTickCount() {
+  return (TickType_t)millis();
+}
+
+// ---- Watchdog: the host has no hang to recover from ----
+
+esp_err_t esp_task_wdt_add(TaskHandle_t task) {
+  return 0;
+}
+
+esp_err_t esp_task_wdt_delete(TaskHandle_t task) {
+  return 0;
+}
+
+esp_err_t esp_task_wdt_reset() {
+  return 0;
+}
+
+// ---- Sleep ----
+
+esp_err_t esp_sleep_enable_gpio_wakeup() {
+  return 0;
+}
+
+esp_err_t esp_sleep_enable_uart_wakeup(int uart) {
+  return 0;
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us) {
+  return 0;
+}
+
+esp_err_t esp_light_sleep_start() {
+  simWaitForEvent(-1);
+  wakeCause = Serial.available() > 0 ? ESP_SLEEP_WAKEUP_UART : ESP_SLEEP_WAKEUP_GPIO;
+  return 0;
+}
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() {
+  return wakeCause;
+}
+
+esp_err_t gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t type) {
+  return 0;
+}
+
+esp_err_t gpio_wakeup_disable(gpio_num_t pin) {
+  return 0;
+}
+
+esp_err_t uart_set_wakeup_threshold(uart_port_t port, int edges) {
+  return 0;
+}
+
+// ---- Restart ----
+
+void esp_restart() {
+  Serial.flush();
+  fprintf(stderr, "[SIM] esp_restart\n");
+  exit(0);
+}
+
+// ---- Timer / RNG ----
+
+int64_t esp_timer_get_time() {
+  return (int64_t)micros();
+}
+
+static bool randomSeeded = false;
+static uint64_t randomState = 0;
+
+void simRandomSeed(uint64_t seed) {
+  randomSeeded = true;
+  randomState = seed;
+}
+
+void esp_fill_random(void* buf, size_t len) {
+  if (randomSeeded) {
+    // splitmix64
+    uint8_t* out = (uint8_t*)buf;
+    for (size_t i = 0; i < len; i += 8) {
+      uint64_t z = (randomState += 0x9E3779B97F4A7C15ull);
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+      z ^= z >> 31;
+      memcpy(out + i, &z, len - i < 8 ? len - i : 8);
+    }
+    return;
+  }
+  static FILE* urandom = nullptr;
+  if (!urandom) urandom = fopen("/dev/urandom", "rb");
+  if (!urandom || fread(buf, 1, len, urandom) != len) {
+    fprintf(stderr, "[SIM] /dev/urandom unavailable\n");
+    abort();
+  }
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <stddef.h>
+
+// Reads /dev/urandom
+void esp_fill_random(void* buf, size_t len);
+
+// The simulator has nothing to reboot into: it logs and exits
+void esp_restart();
@@ -0,0 +1,142 @@
+#include "nvs.h"
+#include <stdio.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "sim.h"
+
+#define NVS_PAGES            5    // 0x5000 partition
+#define NVS_ENTRIES_PER_PAGE 126
+#define NVS_ENTRIES          ((NVS_PAGES - 1) * NVS_ENTRIES_PER_PAGE)  // One page is kept free
+
+typedef std::map<std::string, std::vector<uint8_t>> Namespace;
+
+static std::map<std::string, Namespace> store;
+static std::vector<std::string> handles;  // Handle n is the namespace at n - 1
+static std::string backingFile = "sim-nvs.bin";
+static bool loaded = false;
+
+void simNvsFile(const char* path) {
+  backingFile = path;
+}
+
+// File: records of <namespace>\0<key>\0<u32 length><bytes>
+static void load() {
+  loaded = true;
+  if (backingFile.empty()) return;
+  FILE* f = fopen(backingFile.c_str(), "rb");
+  if (!f) return;
+  std::vector<uint8_t> file;
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) file.insert(file.end(), buf, buf + n);
+  fclose(f);
+
+  size_t at = 0, records = 0;
+  while (at < file.size()) {
+    const char* ns = (const char*)&file[at];
+    size_t nsLen = strnlen(ns, file.size() - at);
+    const char* key = ns + nsLen + 1;
+    size_t keyAt = at + nsLen + 1;
+    if (keyAt >= file.size()) break;
+    size_t keyLen = strnlen(key, file.size() - keyAt);
+    size_t lenAt = keyAt + keyLen + 1;
+    uint32_t len;
+    if (lenAt + 4 > file.size()) break;
+    memcpy(&len, &file[lenAt], 4);
+    if (lenAt + 4 + len > file.size()) break;
+    store[ns][key].assign(file.begin() + lenAt + 4, file.begin() + lenAt + 4 + len);
+    at = lenAt + 4 + len;
+    records++;
+  }
+  fprintf(stderr, "[SIM] NVS: %zu records from %s\n", records, backingFile.c_str());
+}
+
+static bool save() {
+  if (backingFile.empty()) return true;
+  FILE* f = fopen(backingFile.c_str(), "wb");
+  if (!f) return false;
+  bool ok = true;
+  for (auto& ns : store) {
+    for (auto& kv : ns.second) {
+      uint32_t len = (uint32_t)kv.second.size();
+      ok &= fwrite(ns.first.c_str(), 1, ns.first.size() + 1, f) == ns.first.size() + 1;
+      ok &= fwrite(kv.first.c_str(), 1, kv.first.size() + 1, f) == kv.first.size() + 1;
+      ok &= fwrite(&len, 1, 4, f) == 4;
+      ok &= fwrite(kv.second.data(), 1, len, f) == len;
+    }
+  }
+  return fclose(f) == 0 && ok;
+}
+
+// Entries a blob takes: its index, the chunk header and the data
+static size_t blobEntries(size_t length) {
+  return 2 + (length + 31) / 32;
+}
+
+static size_t usedEntries() {
+  size_t used = 0;
+  for (auto& ns : store) {
+    used++;
+    for (auto& kv : ns.second) used += blobEntries(kv.second.size());
+  }
+  return used;
+}
+
+static Namespace* lookup(nvs_handle_t handle) {
+  if (handle == 0 || handle > handles.size()) return nullptr;
+  return &store[handles[handle - 1]];
+}
+
+esp_err_t nvs_open(const char* name, nvs_open_mode_t mode, nvs_handle_t* out) {
+  if (!loaded) load();
+  // Like the device: a namespace that was never written cannot be opened read-only
+  if (mode == NVS_READONLY && store.find(name) == store.end()) return ESP_ERR_NVS_NOT_FOUND;
+  handles.push_back(name);
+  *out = (nvs_handle_t)handles.size();
+  return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle) {}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char* key, void* out, size_t* length) {
+  Namespace* ns = lookup(handle);
+  if (!ns) return ESP_FAIL;
+  auto it = ns->find(key);
+  if (it == ns->end()) return ESP_ERR_NVS_NOT_FOUND;
+  if (!out) {
+    *length = it->second.size();
+    return ESP_OK;
+  }
+  if (*length < it->second.size()) return ESP_ERR_NVS_INVALID_LENGTH;
+  memcpy(out, it->second.data(), it->second.size());
+  *length = it->second.size();
+  return ESP_OK;
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char* key, const void* value, size_t length) {
+  Namespace* ns = lookup(handle);
+  if (!ns) return ESP_FAIL;
+  // The new copy is written before the old one is erased
+  if (usedEntries() + blobEntries(length) > NVS_ENTRIES) return ESP_ERR_NVS_NOT_ENOUGH_SPACE;
+  (*ns)[key].assign((const uint8_t*)value, (const uint8_t*)value + length);
+  return ESP_OK;
+}
+
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char* key) {
+  Namespace* ns = lookup(handle);
+  if (!ns) return ESP_FAIL;
+  return ns->erase(key) ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_erase_all(nvs_handle_t handle) {
+  Namespace* ns = lookup(handle);
+  if (!ns) return ESP_FAIL;
+  ns->clear();
+  return ESP_OK;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle) {
+  return lookup(handle) && save() ? ESP_OK : ESP_FAIL;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+// ESP-IDF NVS subset (blobs only), backed by a file (sim.h: simNvsFile) so
+// the wallet survives simulator restarts. Like the device, writes are only
+// guaranteed on flash after nvs_commit; here that is when the file is
+// rewritten.
+//
+// Space is counted like the device's 0x5000 nvs partition: 5 pages of 126
+// 32-byte entries, one page kept free for garbage collection. A namespace
+// takes one entry and a blob 2 + ceil(length / 32), so a write that would
+// not fit fails with ESP_ERR_NVS_NOT_ENOUGH_SPACE as it would on the board.
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int esp_err_t;
+typedef uint32_t nvs_handle_t;
+
+typedef enum { NVS_READONLY, NVS_READWRITE } nvs_open_mode_t;
+
+#define ESP_OK                       0
+#define ESP_FAIL                     -1
+#define ESP_ERR_NVS_NOT_FOUND        0x1102
+#define ESP_ERR_NVS_NOT_ENOUGH_SPACE 0x1105
+#define ESP_ERR_NVS_INVALID_LENGTH   0x110c
+
+esp_err_t nvs_open(const char* name, nvs_open_mode_t mode, nvs_handle_t* out);
+void nvs_close(nvs_handle_t handle);
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char* key, void* out, size_t* length);
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char* key, const void* value, size_t length);
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char* key);
+esp_err_t nvs_erase_all(nvs_handle_t handle);
+esp_err_t nvs_commit(nvs_handle_t handle);
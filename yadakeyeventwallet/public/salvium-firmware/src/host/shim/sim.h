@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stdint.h>
+
+// ==================== SIMULATOR CONTROL ====================
+//
+// The simulator's side of the Arduino shim: where Serial goes, what the
+// GPIO inputs read, and how the loop task blocks between events.
+
+// Serial RX/TX go through fd (the pty master). slaveFd is held open so the
+// pty never hangs up between clients; its queue length is the TX backlog.
+void simSerialAttach(int fd, int slaveFd);
+
+// Copy device output to stdout as well
+void simSerialMirror(bool on);
+
+// Bytes dropped because nobody was reading the port
+uint32_t simSerialDropped();
+
+// Level an input pin reads (inputs float high: IRQ and BOOT are active low)
+void simSetPin(uint8_t pin, int level);
+
+// Block up to timeoutMs (-1 = forever) until serial data arrives or
+// simWake is called. True if woken by either.
+bool simWaitForEvent(int timeoutMs);
+void simWake();
+
+// Feed bytes to Serial RX as if the host had sent them
+void simSerialInject(const char* data);
+
+// Virtual clock (replay): delay() and idle waits move millis()/micros()
+// forward instead of sleeping, so only real work takes wall time. Idle
+// waits stop at the horizon, where the driver has its next input.
+void simVirtualClock(bool on);
+bool simVirtualClockOn();
+void simClockHorizon(uint32_t ms);
+void simClockIdle(int timeoutMs);  // -1 = until the horizon
+
+// Touch panel contact at raw panel coordinates / lift. PENIRQ is a GPIO
+// of its own (simSetPin).
+void simTouch(int16_t x, int16_t y, int16_t z);
+void simTouchRelease();
+
+// NVS backing file, loaded by the first nvs_open and rewritten by every
+// nvs_commit; "" keeps it in memory only
+void simNvsFile(const char* path);
+
+// Image in the running OTA slot (esp_ota_ops.h), and where an update that
+// switches slots is written; "" leaves the slot erased
+void simFirmwareFile(const char* path);
+
+// Make esp_fill_random a fixed sequence (golden images need the same keys
+// every run). Never use a seeded simulator as a wallet.
+void simRandomSeed(uint64_t seed);
+
+// Current backlight duty and CPU clock, as set by the firmware
+uint32_t simBacklight();
+uint32_t simCpuMhz();
+
+// ---- Display (TFT_eSPI.cpp) ----
+
+// Primitives the firmware calls; calls made inside another primitive
+// (drawRect's lines, a glyph's pixels) are billed to the outer one
+enum SimTftPrim {
+  SIM_TFT_FILL_SCREEN, SIM_TFT_FILL_RECT, SIM_TFT_DRAW_RECT, SIM_TFT_HLINE, SIM_TFT_VLINE,
+  SIM_TFT_PIXEL, SIM_TFT_TRIANGLE, SIM_TFT_IMAGE, SIM_TFT_TEXT, SIM_TFT_PRIMS
+};
+
+struct SimTftCost {
+  uint32_t calls;    // Outermost calls
+  uint32_t windows;  // Address windows set
+  uint32_t pixels;   // Pixels pushed (after clipping)
+  uint32_t bytes;    // SPI bytes: 11 per window + 2 per pixel
+};
+
+const char* simTftPrimName(int prim);
+
+// Cost of one primitive, or of all of them for prim -1, since simTftReset
+SimTftCost simTftCost(int prim);
+void simTftReset();
+
+// FNV-1a of the frame buffer, and the frame buffer as an RGB PNG
+uint32_t simTftFrameHash();
+bool simTftWritePng(const char* path);
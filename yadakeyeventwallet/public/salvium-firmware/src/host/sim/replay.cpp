@@ -0,0 +1,199 @@
+// Trace replay (sim --replay FILE): feeds a GET_TRACE dump back into the
+// firmware on a virtual clock and compares what the simulator's own trace
+// records with the device's, event by event.
+//
+// Inputs land at the same offsets from the first event as on the device.
+// Touches are pressed at the recorded raw coordinates and lifted once the
+// firmware has taken them; button presses are held for the recorded time;
+// serial commands are sent as their recorded name padded to the recorded
+// length (the trace keeps no arguments). delay() and idle waits cost no wall
+// time, so an hour-long session replays in seconds, while handler latency is
+// still measured: real run time plus the delays the handler asked for.
+//
+// Exits 1 if the replay takes a different path (kind, wake or screen
+// transition differs), 2 if the file has no TRACE lines.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../../jobs.h"
+#include "../../trace.h"
+#include "../shim/sim.h"
+
+#define SIM_BOOT_PIN     0      // BOOT is GPIO0 on every ESP32 board
+#define SIM_PENIRQ_PIN   36     // XPT2046 PENIRQ on the CYD
+#define TOUCH_PRESSURE   1000
+#define TOUCH_TAKE_MS    1000   // Give up waiting for the firmware to take a touch
+#define WAKE_PRESS_MS    100    // Press length for a wake-only button press
+#define SETTLE_MS        60000  // Longest wait for jobs after the last event
+
+void setup();
+void loop();
+const char* simSelectScreen(int n);
+
+static bool parseKind(const char* name, uint8_t& kind) {
+  for (uint8_t k = TRACE_TOUCH; k <= TRACE_SERIAL; k++) {
+    if (strcmp(name, traceKindName(k)) == 0) {
+      kind = k;
+      return true;
+    }
+  }
+  return false;
+}
+
+// TRACE:<ms>:<kind>:<a>:<b>:<from>:<to>:<handled_us>:<done_us>:<wake>[:<command>]
+// Anything else (logs, TRACE:DONE) is skipped, so a raw serial capture works
+static std::vector<TraceEvent> readTrace(const char* path) {
+  std::vector<TraceEvent> events;
+  FILE* f = fopen(path, "r");
+  if (!f) return events;
+  char line[512], kind[16];
+  while (fgets(line, sizeof(line), f)) {
+    TraceEvent ev = {};
+    unsigned long ms, handled, done;
+    int a, b;
+    unsigned from, to, wake;
+    int used = 0;
+    if (sscanf(line, "TRACE:%lu:%15[A-Z]:%d:%d:%u:%u:%lu:%lu:%u%n", &ms, kind, &a, &b, &from, &to, &handled, &done,
+               &wake, &used) != 9) {
+      continue;
+    }
+    if (!parseKind(kind, ev.kind)) continue;
+    ev.ms = ms;
+    ev.a = (int16_t)a;
+    ev.b = (int16_t)b;
+    ev.from = from;
+    ev.to = to;
+    ev.handledUs = handled;
+    ev.doneUs = done;
+    ev.wake = wake;
+    if (ev.kind == TRACE_SERIAL && line[used] == ':') {
+      const char* cmd = line + used + 1;
+      size_t len = strcspn(cmd, "\r\n");
+      if (len > TRACE_COMMAND_CHARS - 1) len = TRACE_COMMAND_CHARS - 1;
+      memcpy(ev.command, cmd, len);
+    }
+    events.push_back(ev);
+  }
+  fclose(f);
+  return events;
+}
+
+static bool before(uint32_t ms) {
+  return (int32_t)(millis() - ms) < 0;
+}
+
+// Run the firmware until the virtual clock reaches ms
+static void runUntil(uint32_t ms) {
+  simClockHorizon(ms);
+  while (before(ms)) loop();
+}
+
+// Run until the firmware has opened trace event n (or the wait runs out)
+static void runUntilTaken(uint16_t n, uint32_t waitMs) {
+  uint32_t limit = millis() + waitMs;
+  simClockHorizon(limit);
+  while (traceCount() <= n && before(limit)) loop();
+}
+
+static void inject(const TraceEvent& ev, uint32_t at, uint16_t n) {
+  switch (ev.kind) {
+    case TRACE_TOUCH:
+      runUntil(at);
+      simTouch(ev.a, ev.b, TOUCH_PRESSURE);
+      simSetPin(SIM_PENIRQ_PIN, LOW);
+      simWake();
+      runUntilTaken(n, TOUCH_TAKE_MS);
+      simTouchRelease();
+      simSetPin(SIM_PENIRQ_PIN, HIGH);
+      simWake();
+      loop();
+      break;
+    case TRACE_BUTTON: {
+      // Recorded at release, or at the press for a wake-only press
+      uint32_t held = ev.wake ? WAKE_PRESS_MS : (uint32_t)std::max<int16_t>(ev.a, 0);
+      uint32_t press = ev.wake ? at : at - held;
+      runUntil(press);
+      simSetPin(SIM_BOOT_PIN, LOW);
+      simWake();
+      runUntil(press + held);
+      simSetPin(SIM_BOOT_PIN, HIGH);
+      simWake();
+      runUntilTaken(n, TOUCH_TAKE_MS);
+      break;
+    }
+    case TRACE_SERIAL: {
+      runUntil(at);
+      std::string line = ev.command;
+      if ((int)line.size() < ev.a) line.append(ev.a - line.size(), 'a');
+      simSerialInject((line + "\n").c_str());
+      runUntilTaken(n, TOUCH_TAKE_MS);
+      break;
+    }
+  }
+}
+
+static double percentile(std::vector<double> v, double p) {
+  if (v.empty()) return 0;
+  std::sort(v.begin(), v.end());
+  size_t rank = (size_t)(p * v.size() + 0.999999);
+  return v[rank > 0 ? rank - 1 : 0];
+}
+
+int runReplay(const char* path) {
+  std::vector<TraceEvent> recorded = readTrace(path);
+  if (recorded.empty()) {
+    fprintf(stderr, "[REPLAY] No TRACE lines in %s\n", path);
+    return 2;
+  }
+
+  setup();
+  while (jobsPending()) jobsService();
+  simSelectScreen(recorded[0].from);
+  while (jobsPending()) jobsService();
+  traceClear();
+
+  uint32_t base = millis() + 100;
+  for (size_t i = 0; i < recorded.size(); i++) {
+    inject(recorded[i], base + (recorded[i].ms - recorded[0].ms), (uint16_t)i);
+  }
+  uint32_t limit = millis() + SETTLE_MS;
+  simClockHorizon(limit);
+  while (jobsPending() && before(limit)) loop();
+  loop();
+
+  int diverged = 0;
+  std::vector<double> device[3], sim[3];
+  for (size_t i = 0; i < recorded.size(); i++) {
+    const TraceEvent& want = recorded[i];
+    TraceEvent got = {};
+    bool have = traceRead((uint16_t)i, got);
+    bool same = have && got.kind == want.kind && got.wake == want.wake && got.from == want.from && got.to == want.to;
+    if (!same) diverged++;
+
+    printf("[REPLAY] %3zu %+9ld ms %-6s %-19s %2u->%-2u device %8.3f/%8.3f ms  sim ", i,
+           (long)(want.ms - recorded[0].ms), traceKindName(want.kind), want.kind == TRACE_SERIAL ? want.command : "",
+           want.from, want.to, want.handledUs / 1000.0, want.doneUs / 1000.0);
+    if (have) {
+      printf("%2u->%-2u %8.3f/%8.3f ms%s\n", got.from, got.to, got.handledUs / 1000.0, got.doneUs / 1000.0,
+             same ? "" : "  DIVERGED");
+      device[want.kind].push_back(want.handledUs / 1000.0);
+      sim[want.kind].push_back(got.handledUs / 1000.0);
+    } else {
+      printf("(not taken)  DIVERGED\n");
+    }
+  }
+
+  for (uint8_t k = TRACE_TOUCH; k <= TRACE_SERIAL; k++) {
+    if (sim[k].empty()) continue;
+    printf("[REPLAY] %-6s %4zu events  handled p50 %8.3f p99 %8.3f ms (device p50 %8.3f p99 %8.3f ms)\n",
+           traceKindName(k), sim[k].size(), percentile(sim[k], 0.50), percentile(sim[k], 0.99),
+           percentile(device[k], 0.50), percentile(device[k], 0.99));
+  }
+  printf("[REPLAY] %zu events, %d diverged\n", recorded.size(), diverged);
+  return diverged ? 1 : 0;
+}
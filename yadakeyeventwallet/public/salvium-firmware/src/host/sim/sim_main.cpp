@@ -0,0 +1,241 @@
+// Device simulator: runs setup() and loop() from main.cpp on Linux with the
+// Arduino shim (src/host/shim), its serial port being a pseudo-terminal.
+// Anything that opens a serial device path (server-side tools, pyserial,
+// screen, the load generator in src/host/loadgen) can talk to it like a CYD
+// board. The display is rasterized and costed (shim/TFT_eSPI.cpp); the touch
+// panel and BOOT button are only driven by --replay.
+//
+//   pio run -e native_sim
+//   .pio/build/native_sim/program [--link PATH] [--nvs FILE] [--firmware FILE] [--echo] [--confirm]
+//   .pio/build/native_sim/program --screens DIR [--check screens.txt]
+//   .pio/build/native_sim/program --replay TRACE
+//
+// --link    symlink PATH to the pty, e.g. /tmp/yada-wallet
+// --nvs     NVS backing file (default sim-nvs.bin), keeps the wallet
+// --firmware image in the running OTA slot; an OTA update overwrites it
+// --echo    copy device output to stdout
+// --confirm answer every SIGN_TX review with Confirm (signing benchmarks);
+//           never on a simulator that holds real keys
+// --screens boot with a fixed RNG seed and an empty NVS, draw every
+//           Screen once, write DIR/<screen>.png and DIR/screens.txt (address
+//           windows, pixels, SPI bytes and image hash per screen), then exit
+// --check   compare against an earlier screens.txt: exit 1 if any screen
+//           pushes more than SCREEN_BYTES_SLACK percent more bytes
+// --replay  replay a GET_TRACE dump on a virtual clock and report per-event
+//           handling latency (replay.cpp)
+//
+// --screens and --replay run without a serial port, on a virtual clock, with
+// a fixed RNG seed and (unless --nvs is given) an in-memory NVS.
+
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+#include <map>
+#include <string>
+
+#include "../../jobs.h"
+#include "../shim/sim.h"
+
+#define SCREEN_BYTES_SLACK 5  // Percent
+
+void setup();
+void loop();
+void drawCurrentScreen();
+const char* simSelectScreen(int n);
+void simConfirmReview();
+int runReplay(const char* path);
+
+struct ScreenCost {
+  SimTftCost cost;
+  uint32_t hash;
+};
+
+static volatile sig_atomic_t stopRequested = 0;
+
+static void onSignal(int sig) {
+  stopRequested = 1;
+}
+
+static int openPty(int& slave) {
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) return -1;
+
+  slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+  if (slave < 0) return -1;
+
+  // Raw bytes both ways, as on a USB-UART bridge
+  struct termios t;
+  tcgetattr(slave, &t);
+  cfmakeraw(&t);
+  cfsetspeed(&t, B115200);
+  tcsetattr(slave, TCSANOW, &t);
+  return master;
+}
+
+static void drainJobs() {
+  while (jobsPending()) jobsService();
+}
+
+// name windows pixels bytes hash, one screen per line
+static std::map<std::string, ScreenCost> readScreens(const char* path) {
+  std::map<std::string, ScreenCost> screens;
+  FILE* f = fopen(path, "r");
+  if (!f) return screens;
+  char line[256], name[64];
+  ScreenCost s = {};
+  while (fgets(line, sizeof(line), f)) {
+    if (line[0] == '#') continue;
+    if (sscanf(line, "%63s %u %u %u %x", name, &s.cost.windows, &s.cost.pixels, &s.cost.bytes, &s.hash) == 5) {
+      screens[name] = s;
+    }
+  }
+  fclose(f);
+  return screens;
+}
+
+// Draw each Screen from a settled state (background jobs drained) and cost
+// that one draw
+static int runScreens(const char* dir, const char* check) {
+  std::map<std::string, ScreenCost> baseline;
+  if (check) {
+    baseline = readScreens(check);
+    if (baseline.empty()) {
+      fprintf(stderr, "[SIM] No screens in %s\n", check);
+      return 1;
+    }
+  }
+
+  std::string listPath = std::string(dir) + "/screens.txt";
+  FILE* list = fopen(listPath.c_str(), "w");
+  if (!list) {
+    perror("[SIM] screens.txt");
+    return 1;
+  }
+  fprintf(list, "# screen windows pixels bytes hash\n");
+
+  setup();
+  drainJobs();
+
+  int failures = 0;
+  const char* name;
+  for (int n = 0; (name = simSelectScreen(n)); n++) {
+    drainJobs();
+    simTftReset();
+    drawCurrentScreen();
+
+    SimTftCost total = simTftCost(-1);
+    uint32_t hash = simTftFrameHash();
+    fprintf(list, "%s %u %u %u %08x\n", name, total.windows, total.pixels, total.bytes, hash);
+    std::string png = std::string(dir) + "/" + name + ".png";
+    if (!simTftWritePng(png.c_str())) perror(png.c_str());
+
+    printf("[SCREEN] %-16s %6u windows %7u px %7u bytes\n", name, total.windows, total.pixels, total.bytes);
+    for (int k = 0; k < SIM_TFT_PRIMS; k++) {
+      SimTftCost c = simTftCost(k);
+      if (!c.calls) continue;
+      printf("[SCREEN]   %-14s %5u calls %6u windows %7u px %7u bytes\n", simTftPrimName(k), c.calls, c.windows,
+             c.pixels, c.bytes);
+    }
+
+    auto old = baseline.find(name);
+    if (!check || old == baseline.end()) continue;
+    uint32_t before = old->second.cost.bytes;
+    if (total.bytes > before + (uint64_t)before * SCREEN_BYTES_SLACK / 100) {
+      printf("[SCREEN] FAIL %s: %u -> %u bytes\n", name, before, total.bytes);
+      failures++;
+    } else if (old->second.hash != hash) {
+      printf("[SCREEN] %s: image changed (%u -> %u bytes)\n", name, before, total.bytes);
+    }
+  }
+  fclose(list);
+  return failures ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+  const char* link = nullptr;
+  const char* screens = nullptr;
+  const char* check = nullptr;
+  const char* replay = nullptr;
+  bool echo = false;
+  bool confirm = false;
+  bool nvs = false;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--link") == 0 && i + 1 < argc) {
+      link = argv[++i];
+    } else if (strcmp(argv[i], "--nvs") == 0 && i + 1 < argc) {
+      simNvsFile(argv[++i]);
+      nvs = true;
+    } else if (strcmp(argv[i], "--firmware") == 0 && i + 1 < argc) {
+      simFirmwareFile(argv[++i]);
+    } else if (strcmp(argv[i], "--echo") == 0) {
+      echo = true;
+    } else if (strcmp(argv[i], "--confirm") == 0) {
+      confirm = true;
+    } else if (strcmp(argv[i], "--screens") == 0 && i + 1 < argc) {
+      screens = argv[++i];
+    } else if (strcmp(argv[i], "--check") == 0 && i + 1 < argc) {
+      check = argv[++i];
+    } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+      replay = argv[++i];
+    } else {
+      fprintf(stderr, "usage: %s [--link PATH] [--nvs FILE] [--firmware FILE] [--echo] [--confirm]\n"
+                      "       %s --screens DIR [--check screens.txt]\n"
+                      "       %s --replay TRACE\n", argv[0], argv[0], argv[0]);
+      return 2;
+    }
+  }
+  if (check && !screens) {
+    fprintf(stderr, "[SIM] --check needs --screens\n");
+    return 2;
+  }
+
+  // No serial port: output is only mirrored with --echo
+  if (screens || replay) {
+    if (!nvs) simNvsFile("");
+    simRandomSeed(1);
+    simVirtualClock(true);
+    simSerialMirror(echo);
+    return screens ? runScreens(screens, check) : runReplay(replay);
+  }
+
+  int slave = -1;
+  int master = openPty(slave);
+  if (master < 0) {
+    perror("[SIM] pty");
+    return 1;
+  }
+  const char* port = ptsname(master);
+  if (link) {
+    unlink(link);
+    if (symlink(port, link) != 0) {
+      perror("[SIM] symlink");
+      return 1;
+    }
+  }
+  fprintf(stderr, "[SIM] Serial port: %s%s%s\n", port, link ? " -> " : "", link ? link : "");
+
+  // No SA_RESTART: a signal must break the poll() the idle manager sleeps in
+  struct sigaction sa;
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = onSignal;
+  sigaction(SIGINT, &sa, nullptr);
+  sigaction(SIGTERM, &sa, nullptr);
+
+  simSerialAttach(master, slave);
+  simSerialMirror(echo);
+
+  setup();
+  while (!stopRequested) {
+    loop();
+    if (confirm) simConfirmReview();
+  }
+
+  if (link) unlink(link);
+  if (simSerialDropped()) fprintf(stderr, "[SIM] %u bytes dropped with no reader\n", (unsigned)simSerialDropped());
+  fprintf(stderr, "[SIM] Stopped\n");
+  return 0;
+}
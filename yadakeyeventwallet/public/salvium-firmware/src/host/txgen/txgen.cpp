@@ -0,0 +1,97 @@
+#include "txgen.h"
+
+#include <string.h>
+
+#include "../../addresses.h"
+#include "../../crypto/base58.h"
+#include "../../crypto/keccak.h"
+#include "../../crypto/random.h"
+
+#define ADDRESS_BYTES 72  // varint prefix (4), B, A, checksum (4)
+
+static void appendHex(std::string& out, const uint8_t* data, size_t len) {
+  static const char digits[] = "0123456789abcdef";
+  for (size_t i = 0; i < len; i++) {
+    out += digits[data[i] >> 4];
+    out += digits[data[i] & 15];
+  }
+}
+
+static void randomPoint(uint8_t out[32]) {
+  uint8_t s[32];
+  randomScalar(s);
+  secret_to_public(out, s);
+}
+
+bool txgenParseAddress(const std::string& address, uint8_t spendPub[32], uint8_t viewPub[32]) {
+  uint8_t raw[ADDRESS_BYTES];
+  if (base58_decode(raw, sizeof(raw), address.data(), address.size()) != ADDRESS_BYTES) return false;
+
+  uint8_t prefix[10];
+  if (write_varint(prefix, SAL_ADDRESS_PREFIX) != 4 || memcmp(raw, prefix, 4) != 0) return false;
+
+  uint8_t hash[32];
+  keccak256(raw, ADDRESS_BYTES - 4, hash);
+  if (memcmp(hash, raw + ADDRESS_BYTES - 4, 4) != 0) return false;
+  memcpy(spendPub, raw + 4, 32);
+  memcpy(viewPub, raw + 36, 32);
+  return true;
+}
+
+std::string txgenSalPayload(const uint8_t spendPub[32], const uint8_t viewPub[32], int inputs, int ring) {
+  std::string hex;
+  uint8_t message[32];
+  randomBytes(message, 32);
+  appendHex(hex, message, 32);
+  uint8_t count = (uint8_t)inputs;
+  appendHex(hex, &count, 1);
+
+  for (int k = 0; k < inputs; k++) {
+    uint8_t size = (uint8_t)ring, real;
+    randomBytes(&real, 1);
+    real %= size;
+    uint32_t outIndex = (uint32_t)k;
+
+    uint8_t r[32], R[32], derivation[32];
+    randomScalar(r);
+    secret_to_public(R, r);
+    generate_key_derivation(derivation, viewPub, r);
+
+    // Commitments share an amount term X, so C[real] - Coffset = z*G
+    uint8_t zIn[32], zOut[32], z[32], X[32], Coffset[32];
+    randomScalar(zIn);
+    randomScalar(zOut);
+    sc_sub(z, zIn, zOut);
+    randomPoint(X);
+    ge_p3 x, t;
+    ge_cached xc;
+    ge_frombytes_vartime(x, X);
+    ge_to_cached(xc, x);
+    ge_scalarmult_base(t, zOut);
+    ge_add(t, t, xc);
+    ge_tobytes(Coffset, t);
+
+    uint8_t le[4] = {(uint8_t)outIndex, (uint8_t)(outIndex >> 8), (uint8_t)(outIndex >> 16), (uint8_t)(outIndex >> 24)};
+    appendHex(hex, &size, 1);
+    appendHex(hex, &real, 1);
+    appendHex(hex, R, 32);
+    appendHex(hex, le, 4);
+    appendHex(hex, z, 32);
+    appendHex(hex, Coffset, 32);
+    for (int m = 0; m < ring; m++) {
+      uint8_t P[32], C[32];
+      if (m == real) {
+        derive_public_key(P, derivation, outIndex, spendPub);
+        ge_scalarmult_base(t, zIn);
+        ge_add(t, t, xc);
+        ge_tobytes(C, t);
+      } else {
+        randomPoint(P);
+        randomPoint(C);
+      }
+      appendHex(hex, P, 32);
+      appendHex(hex, C, 32);
+    }
+  }
+  return hex;
+}
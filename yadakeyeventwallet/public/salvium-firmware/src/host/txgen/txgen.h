@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+// ==================== TEST TRANSACTIONS ====================
+//
+// SIGN_TX:SAL payloads (signer.h) for the host tools that drive a device or
+// the simulator (loadgen, fleet bench). Each input spends an output sent to
+// the wallet's primary address the way a sender builds one: R = r*G, the
+// one-time key from 8*r*A, and a commitment that differs from the pseudo
+// output by z*G. The device derives and checks all of it as for a real
+// spend; the decoys are random points.
+//
+// ed25519_init() must have run first.
+
+// Spend and view public keys of a primary Salvium address ("SaLv...").
+// False on anything else or a bad checksum.
+bool txgenParseAddress(const std::string& address, uint8_t spendPub[32], uint8_t viewPub[32]);
+
+// Payload hex with a random message and `inputs` inputs of `ring` members
+std::string txgenSalPayload(const uint8_t spendPub[32], const uint8_t viewPub[32], int inputs, int ring);
@@ -0,0 +1,178 @@
+#include "idle.h"
+#include "log.h"
+#include <driver/gpio.h>
+#include <driver/uart.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+
+#define BACKLIGHT_LEDC_CHANNEL 7
+#define BACKLIGHT_LEDC_FREQ    5000
+#define BACKLIGHT_LEDC_BITS    8
+#define UART_WAKE_THRESHOLD    3   // RX edges needed to leave light sleep
+
+static int blPin = -1;
+static int irqPin = -1;
+static int btnPin = -1;
+static RedrawCallback redrawScreen = nullptr;
+static TaskHandle_t loopTask = nullptr;
+
+static IdleStage stage = IDLE_ACTIVE;
+static bool jobsRunning = false;  // idleSetBusy
+static unsigned long lastInputMs = 0;
+static int64_t wakeStartUs = 0;  // Set when light sleep ends on a GPIO wake
+static uint32_t wakeLatencyLastUs = 0;
+static uint32_t wakeLatencyMaxUs = 0;
+
+static const char* stageNames[] = {"ACTIVE", "DIM", "OFF", "SLEEP"};
+
+static void IRAM_ATTR onInputIrq() {
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(loopTask, &woken);
+  if (woken) portYIELD_FROM_ISR();
+}
+
+// Runs in the UART event task, not in an ISR
+static void onSerialReceive() {
+  xTaskNotifyGive(loopTask);
+}
+
+static void armInputInterrupts() {
+  attachInterrupt(digitalPinToInterrupt(irqPin), onInputIrq, FALLING);
+  attachInterrupt(digitalPinToInterrupt(btnPin), onInputIrq, CHANGE);
+}
+
+void backlightSet(uint8_t duty) {
+  ledcWrite(BACKLIGHT_LEDC_CHANNEL, duty);
+}
+
+static void enterStage(IdleStage next) {
+  if (next == stage) return;
+
+  switch (next) {
+    case IDLE_ACTIVE:
+      setCpuFrequencyMhz(CPU_MHZ_ACTIVE);
+      backlightSet(BACKLIGHT_FULL);
+      break;
+    case IDLE_DIM:
+      backlightSet(BACKLIGHT_DIM);
+      break;
+    case IDLE_OFF:
+      backlightSet(0);
+      if (!jobsRunning) setCpuFrequencyMhz(CPU_MHZ_IDLE);  // APB stays at 80 MHz, UART baud unaffected
+      break;
+    case IDLE_SLEEP:
+      break;
+  }
+
+  stage = next;
+  LOG_D("[IDLE] -> %s", stageNames[stage]);
+}
+
+static void lightSleep() {
+  Serial.flush();
+
+  detachInterrupt(digitalPinToInterrupt(irqPin));
+  detachInterrupt(digitalPinToInterrupt(btnPin));
+  gpio_wakeup_enable((gpio_num_t)irqPin, GPIO_INTR_LOW_LEVEL);
+  gpio_wakeup_enable((gpio_num_t)btnPin, GPIO_INTR_LOW_LEVEL);
+  esp_sleep_enable_gpio_wakeup();
+  uart_set_wakeup_threshold(UART_NUM_0, UART_WAKE_THRESHOLD);
+  esp_sleep_enable_uart_wakeup(0);
+
+  esp_light_sleep_start();
+
+  int64_t wokeAt = esp_timer_get_time();
+  esp_sleep_wakeup_cause_t cause = esp_sleep_get_wakeup_cause();
+
+  gpio_wakeup_disable((gpio_num_t)irqPin);
+  gpio_wakeup_disable((gpio_num_t)btnPin);
+  armInputInterrupts();
+
+  if (cause == ESP_SLEEP_WAKEUP_GPIO) {
+    // The handler that sees the press calls idleNoteInput(), which lights the screen
+    wakeStartUs = wokeAt;
+  }
+  // UART wake: stay dark, the loop processes the command and sleeps again
+}
+
+void idleBegin(int backlightPin, int touchIrqPin, int buttonPin, RedrawCallback redraw) {
+  blPin = backlightPin;
+  irqPin = touchIrqPin;
+  btnPin = buttonPin;
+  redrawScreen = redraw;
+  loopTask = xTaskGetCurrentTaskHandle();
+
+  ledcSetup(BACKLIGHT_LEDC_CHANNEL, BACKLIGHT_LEDC_FREQ, BACKLIGHT_LEDC_BITS);
+  ledcAttachPin(blPin, BACKLIGHT_LEDC_CHANNEL);
+  backlightSet(0);
+
+  pinMode(irqPin, INPUT);  // XPT2046 PENIRQ, external pull-up on the CYD
+  pinMode(btnPin, INPUT_PULLUP);
+  armInputInterrupts();
+  Serial.onReceive(onSerialReceive);
+
+  lastInputMs = millis();
+}
+
+void idleWaitForEvent(bool inputActive) {
+  unsigned long idleFor = millis() - lastInputMs;
+
+  if (stage == IDLE_ACTIVE && idleFor >= IDLE_DIM_MS) enterStage(IDLE_DIM);
+  if (stage == IDLE_DIM && idleFor >= IDLE_OFF_MS) enterStage(IDLE_OFF);
+  if (stage == IDLE_OFF && idleFor >= IDLE_SLEEP_MS) enterStage(IDLE_SLEEP);
+
+  if (Serial.available() > 0) return;
+
+  if (inputActive) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(IDLE_POLL_MS));
+    return;
+  }
+
+  if (stage == IDLE_SLEEP) {
+    lightSleep();
+    return;
+  }
+
+  unsigned long deadline = stage == IDLE_ACTIVE ? IDLE_DIM_MS
+                         : stage == IDLE_DIM    ? IDLE_OFF_MS
+                         :                        IDLE_SLEEP_MS;
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(deadline - idleFor));
+}
+
+void idleSetBusy(bool busy) {
+  if (busy == jobsRunning) return;
+  jobsRunning = busy;
+  if (stage == IDLE_OFF || stage == IDLE_SLEEP) setCpuFrequencyMhz(busy ? CPU_MHZ_ACTIVE : CPU_MHZ_IDLE);
+}
+
+bool idleNoteInput() {
+  lastInputMs = millis();
+
+  if (stage == IDLE_ACTIVE) return false;
+  if (stage == IDLE_DIM) {
+    enterStage(IDLE_ACTIVE);
+    return false;
+  }
+
+  // Screen was dark - wake up and draw the first frame
+  int64_t start = wakeStartUs ? wakeStartUs : esp_timer_get_time();
+  wakeStartUs = 0;
+
+  setCpuFrequencyMhz(CPU_MHZ_ACTIVE);
+  if (redrawScreen) redrawScreen();
+  enterStage(IDLE_ACTIVE);
+
+  wakeLatencyLastUs = (uint32_t)(esp_timer_get_time() - start);
+  if (wakeLatencyLastUs > wakeLatencyMaxUs) wakeLatencyMaxUs = wakeLatencyLastUs;
+  LOG_D("[IDLE] Wake -> first frame in %lu us", (unsigned long)wakeLatencyLastUs);
+  return true;
+}
+
+IdleStage idleStage() {
+  return stage;
+}
+
+void idleWakeLatency(uint32_t& lastUs, uint32_t& maxUs) {
+  lastUs = wakeLatencyLastUs;
+  maxUs = wakeLatencyMaxUs;
+}
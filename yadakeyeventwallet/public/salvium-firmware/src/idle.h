@@ -0,0 +1,58 @@
+#pragma once
+
+#include <Arduino.h>
+
+// ==================== IDLE / POWER MANAGEMENT ====================
+//
+// Replaces the fixed 50 ms polling delay with an event wait. The loop task
+// blocks until the touch IRQ, the BOOT button or UART RX signals it, or until
+// the next idle deadline. With no touch/button input the device steps down:
+//
+//   ACTIVE --IDLE_DIM_MS--> DIM --IDLE_OFF_MS--> OFF --IDLE_SLEEP_MS--> SLEEP
+//
+// DIM lowers the LEDC backlight duty, OFF turns the backlight off and drops
+// the CPU clock, SLEEP enters light sleep between events. Serial traffic is
+// processed in every stage but does not light the screen, so host polling
+// does not keep counter devices awake. Jobs a host starts on a dark device
+// (signing, scans) run at CPU_MHZ_ACTIVE, with the backlight still off.
+//
+// UART wakeup from light sleep consumes the first received characters; hosts
+// should send a bare newline before their first command after a long idle.
+
+#define IDLE_DIM_MS     30000
+#define IDLE_OFF_MS     60000
+#define IDLE_SLEEP_MS   90000
+#define IDLE_POLL_MS    50      // Wait slice while an input is being held
+
+#define BACKLIGHT_FULL  255
+#define BACKLIGHT_DIM   40
+
+#define CPU_MHZ_ACTIVE  240
+#define CPU_MHZ_IDLE    80
+
+enum IdleStage { IDLE_ACTIVE, IDLE_DIM, IDLE_OFF, IDLE_SLEEP };
+
+typedef void (*RedrawCallback)();
+
+// Configure backlight PWM and input wake sources. Backlight starts off.
+void idleBegin(int backlightPin, int touchIrqPin, int buttonPin, RedrawCallback redraw);
+
+// Set backlight duty (0-255) directly, e.g. during boot
+void backlightSet(uint8_t duty);
+
+// Block until an input event or the next idle deadline. Pass inputActive while
+// a touch or button press is in progress so release is polled at IDLE_POLL_MS.
+void idleWaitForEvent(bool inputActive);
+
+// Call with jobsPending() each loop pass: the full CPU clock while true,
+// whatever the stage. Leaves the backlight alone.
+void idleSetBusy(bool busy);
+
+// Call when a touch or button press is seen. Returns true if the screen was
+// dark: the device woke up and the caller should swallow this input.
+bool idleNoteInput();
+
+IdleStage idleStage();
+
+// Wake-to-first-frame latency of the most recent wake and the worst seen
+void idleWakeLatency(uint32_t& lastUs, uint32_t& maxUs);
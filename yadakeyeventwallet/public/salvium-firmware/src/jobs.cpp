@@ -0,0 +1,141 @@
+#include "jobs.h"
+#include "log.h"
+#include "esp_task_wdt.h"
+
+struct Job {
+  int id;
+  const char* name;
+  JobStepFn step;
+  JobFinishFn finish;
+  void* ctx;
+  uint8_t progress;
+  bool cancelRequested;
+  bool background;  // No progress hook
+};
+
+// Ring of pending jobs; the head is the running one
+static Job queue[JOB_QUEUE_SIZE];
+static int queueHead = 0;
+static int queueCount = 0;
+static int nextJobId = 1;
+static bool wdtSubscribed = false;
+static JobProgressHook progressHook = nullptr;
+
+static const char* statusNames[] = {"RUNNING", "DONE", "FAILED", "CANCELLED"};
+
+// The loop task is only on the task watchdog while it has work; otherwise
+// it blocks in the idle manager for far longer than the WDT timeout.
+static void watchdogSubscribe(bool on) {
+  if (on == wdtSubscribed) return;
+  if (on) {
+    esp_task_wdt_add(NULL);
+  } else {
+    esp_task_wdt_delete(NULL);
+  }
+  wdtSubscribed = on;
+}
+
+int jobSubmit(const char* name, JobStepFn step, JobFinishFn finish, void* ctx, bool background) {
+  if (queueCount == JOB_QUEUE_SIZE) {
+    LOG_W("[JOB] Queue full, rejected %s", name);
+    return -1;
+  }
+
+  Job& job = queue[(queueHead + queueCount) % JOB_QUEUE_SIZE];
+  job.id = nextJobId++;
+  job.name = name;
+  job.step = step;
+  job.finish = finish;
+  job.ctx = ctx;
+  job.progress = 0;
+  job.cancelRequested = false;
+  job.background = background;
+  queueCount++;
+
+  Serial.printf("JOB:%d:%s:QUEUED\n", job.id, name);
+  if (queueCount == 1 && !background && progressHook) progressHook(job.id, name, 0);
+  return job.id;
+}
+
+bool jobCancel(int id) {
+  for (int i = 0; i < queueCount; i++) {
+    Job& job = queue[(queueHead + i) % JOB_QUEUE_SIZE];
+    if ((id < 0 && i == 0) || job.id == id) {
+      job.cancelRequested = true;
+      return true;
+    }
+  }
+  return false;
+}
+
+static void finishHead(JobStatus status) {
+  Job& job = queue[queueHead];
+  Serial.printf("JOB:%d:%s:%s\n", job.id, job.name, statusNames[status]);
+  if (job.finish) job.finish(job.ctx, status);
+  bool shown = !job.background;
+
+  queueHead = (queueHead + 1) % JOB_QUEUE_SIZE;
+  queueCount--;
+
+  if (progressHook) {
+    if (queueCount > 0 && !queue[queueHead].background) {
+      Job& next = queue[queueHead];
+      progressHook(next.id, next.name, next.progress);
+    } else if (shown) {
+      progressHook(-1, nullptr, 0);
+    }
+  }
+}
+
+void jobsService() {
+  if (queueCount == 0) return;
+  watchdogSubscribe(true);
+
+  unsigned long start = millis();
+  while (queueCount > 0 && millis() - start < JOB_SLICE_MS) {
+    Job& job = queue[queueHead];
+
+    if (job.cancelRequested) {
+      finishHead(JOB_CANCELLED);
+      continue;
+    }
+
+    uint8_t before = job.progress;
+    JobStatus status = job.step(job.ctx, &job.progress);
+    esp_task_wdt_reset();
+
+    if (status != JOB_RUNNING) {
+      finishHead(status);
+      continue;
+    }
+
+    if (job.progress != before) {
+      Serial.printf("JOB:%d:%s:PROGRESS:%u\n", job.id, job.name, job.progress);
+      if (progressHook && !job.background) progressHook(job.id, job.name, job.progress);
+    }
+  }
+
+  if (queueCount == 0) watchdogSubscribe(false);
+
+  // Let the idle tasks run so their own watchdog stays fed. This slice's
+  // replies are whole lines, so the log drain gets the port for that tick.
+  logUnlockSerial();
+  vTaskDelay(1);
+  logLockSerial();
+}
+
+bool jobsPending() {
+  return queueCount > 0;
+}
+
+bool jobsForegroundPending() {
+  return queueCount > 0 && !queue[queueHead].background;
+}
+
+int jobCurrent() {
+  return queueCount > 0 ? queue[queueHead].id : -1;
+}
+
+void jobsSetProgressHook(JobProgressHook hook) {
+  progressHook = hook;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Arduino.h>
+
+// ==================== CRYPTO JOB SCHEDULER ====================
+//
+// Long crypto work (signing, key derivation, scanning) runs as a job split
+// into resumable steps. Each step does a bounded amount of work and returns;
+// the scheduler runs steps for at most JOB_SLICE_MS per loop() pass, feeds
+// the task watchdog between steps and then gives the loop back to input and
+// serial handling. Jobs run one at a time in submission order.
+//
+// Progress is reported over serial as
+//   JOB:<id>:<name>:PROGRESS:<percent>
+//   JOB:<id>:<name>:DONE | FAILED | CANCELLED
+// and through an optional hook for the on-screen progress bar. Background
+// jobs (cache rebuilds and the like) only report over serial.
+
+#define JOB_QUEUE_SIZE 4
+#define JOB_SLICE_MS   20
+
+enum JobStatus { JOB_RUNNING, JOB_DONE, JOB_FAILED, JOB_CANCELLED };
+
+// One step of work. Update *progress (0-100) and return JOB_RUNNING until done.
+typedef JobStatus (*JobStepFn)(void* ctx, uint8_t* progress);
+
+// Called exactly once when the job leaves the scheduler, with its final status.
+// This is where a job releases or zeroizes its context.
+typedef void (*JobFinishFn)(void* ctx, JobStatus status);
+
+// Screen hook: name is nullptr once the queue is empty
+typedef void (*JobProgressHook)(int id, const char* name, uint8_t progress);
+
+// Returns the job id, or -1 if the queue is full
+int jobSubmit(const char* name, JobStepFn step, JobFinishFn finish, void* ctx, bool background = false);
+
+// Cancel a queued or running job; id -1 cancels the running job
+bool jobCancel(int id);
+
+// Run job steps for up to JOB_SLICE_MS, then yield
+void jobsService();
+
+bool jobsPending();
+
+// True while the running job is a foreground one, i.e. has the progress bar up
+bool jobsForegroundPending();
+
+// Id of the running job, or -1
+int jobCurrent();
+
+void jobsSetProgressHook(JobProgressHook hook);
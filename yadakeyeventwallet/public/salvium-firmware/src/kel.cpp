@@ -0,0 +1,305 @@
+#include "kel.h"
+#include "log.h"
+#include <Arduino.h>
+#include <SHA256.h>
+#include <nvs.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#include <esp_partition.h>
+#endif
+
+#define KEL_STATE_KEY "state"
+#define KEL_SECTOR    4096
+#define KEL_SLOTS     (2 * KEL_CAPACITY - 1)  // Levels 0..KEL_STORE_LEVELS-1
+
+static_assert(KEL_CAPACITY == 1 << KEL_STORE_LEVELS, "one leaf slot per event");
+static_assert(KEL_SLOTS * 32 <= KEL_PARTITION_SIZE, "slots must fit the partition");
+
+#define LEAF_PREFIX 0x00
+#define NODE_PREFIX 0x01
+
+struct KelState {
+  uint32_t count;
+  uint8_t frontier[KEL_DEPTH][32];  // Level h: the left node waiting for its right, if bit h of count is set
+};
+
+static KelState state;
+static uint8_t root[32];
+static uint8_t zero[KEL_DEPTH][32];  // Root of an empty subtree of each level
+static nvs_handle_t handle;
+static bool opened = false;
+
+static const char* errorNames[] = {"OK", "NO_STORE", "RANGE", "MISSING"};
+
+// ---- Flash backend ----
+
+#ifdef ARDUINO
+
+static const esp_partition_t* partition = nullptr;
+
+static bool flashOpen() {
+  partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)0x41, "kel");
+  return partition != nullptr && partition->size >= KEL_PARTITION_SIZE;
+}
+
+static bool flashRead(uint32_t offset, void* buf, size_t len) {
+  return esp_partition_read(partition, offset, buf, len) == ESP_OK;
+}
+
+static bool flashWrite(uint32_t offset, const void* buf, size_t len) {
+  return esp_partition_write(partition, offset, buf, len) == ESP_OK;
+}
+
+static bool flashErase(uint32_t offset, size_t len) {
+  return esp_partition_erase_range(partition, offset, len) == ESP_OK;
+}
+
+#else
+
+// NOR semantics, as in history.cpp: erase sets 0xFF, writes only clear bits
+static uint8_t* flash = nullptr;
+
+static bool flashOpen() {
+  if (!flash) {
+    flash = (uint8_t*)malloc(KEL_PARTITION_SIZE);
+    memset(flash, 0xFF, KEL_PARTITION_SIZE);
+  }
+  return true;
+}
+
+static bool flashRead(uint32_t offset, void* buf, size_t len) {
+  memcpy(buf, flash + offset, len);
+  return true;
+}
+
+static bool flashWrite(uint32_t offset, const void* buf, size_t len) {
+  const uint8_t* p = (const uint8_t*)buf;
+  for (size_t k = 0; k < len; k++) flash[offset + k] &= p[k];
+  return true;
+}
+
+static bool flashErase(uint32_t offset, size_t len) {
+  memset(flash + offset, 0xFF, len);
+  return true;
+}
+
+#endif
+
+static void hashNode(uint8_t out[32], const uint8_t left[32], const uint8_t right[32]) {
+  static const uint8_t prefix = NODE_PREFIX;
+  SHA256 sha;
+  sha.update(&prefix, 1);
+  sha.update(left, 32);
+  sha.update(right, 32);
+  sha.finalize(out, 32);
+}
+
+static void hashLeaf(uint8_t out[32], KelEvent kind, uint8_t coin, const char* from, const char* to) {
+  const uint8_t head[3] = {LEAF_PREFIX, (uint8_t)kind, coin};
+  static const uint8_t separator = 0;
+  SHA256 sha;
+  sha.update(head, sizeof(head));
+  sha.update(from, strnlen(from, KEL_ADDR_MAX));
+  sha.update(&separator, 1);
+  sha.update(to, strnlen(to, KEL_ADDR_MAX));
+  sha.finalize(out, 32);
+}
+
+// Partition offset of a completed node: levels are stored one after the
+// other, level h holding KEL_CAPACITY >> h slots
+static uint32_t slotOffset(int level, uint32_t index) {
+  return (2 * KEL_CAPACITY - (2 * KEL_CAPACITY >> level) + index) * 32;
+}
+
+static bool isBlank(const uint8_t node[32]) {
+  for (int k = 0; k < 32; k++) {
+    if (node[k] != 0xFF) return false;
+  }
+  return true;
+}
+
+// A stored node, false if the slot was never written (or unreadable)
+static bool readNode(int level, uint32_t index, uint8_t out[32]) {
+  return flashRead(slotOffset(level, index), out, 32) && !isBlank(out);
+}
+
+// Write a slot that is not yet part of the committed tree. If an append
+// that never committed already wrote it, erase it with its sector first,
+// keeping the rest of the sector.
+static bool writeNode(int level, uint32_t index, const uint8_t node[32]) {
+  uint32_t offset = slotOffset(level, index);
+  uint8_t old[32];
+  if (!flashRead(offset, old, 32)) return false;
+  if (!isBlank(old)) {
+    uint32_t base = offset - offset % KEL_SECTOR;
+    uint8_t* sector = (uint8_t*)malloc(KEL_SECTOR);
+    if (!sector) return false;
+    bool ok = flashRead(base, sector, KEL_SECTOR);
+    memset(sector + (offset - base), 0xFF, 32);
+    ok = ok && flashErase(base, KEL_SECTOR) && flashWrite(base, sector, KEL_SECTOR);
+    free(sector);
+    if (!ok) return false;
+  }
+  return flashWrite(offset, node, 32);
+}
+
+// Firmware before the kel partition kept every node in NVS as "n<level><index>"
+static void legacyKey(char key[16], int level, uint32_t index) {
+  snprintf(key, 16, "n%02x%06lx", level, (unsigned long)index);
+}
+
+// Move a log kept in the old layout into the partition, then drop its NVS
+// node blobs, which are what filled the NVS partition
+static void migrateLegacy() {
+  char key[16];
+  size_t len = 32;
+  uint8_t node[32];
+  legacyKey(key, 0, 0);
+  if (state.count == 0 || nvs_get_blob(handle, key, node, &len) != ESP_OK) return;
+
+  bool ok = flashErase(0, KEL_PARTITION_SIZE);
+  for (int h = 0; h < KEL_STORE_LEVELS; h++) {
+    for (uint32_t i = 0; ok && i < state.count >> h; i++) {
+      legacyKey(key, h, i);
+      len = 32;
+      ok = nvs_get_blob(handle, key, node, &len) == ESP_OK && len == 32 && flashWrite(slotOffset(h, i), node, 32);
+    }
+  }
+  if (!ok) {
+    LOG_E("[KEL] Could not move the log out of NVS; proofs may be MISSING");
+    return;
+  }
+  for (int h = 0; h < KEL_DEPTH; h++) {
+    for (uint32_t i = 0; i < state.count >> h; i++) {
+      legacyKey(key, h, i);
+      nvs_erase_key(handle, key);
+    }
+  }
+  nvs_commit(handle);
+  LOG_I("[KEL] Moved %lu events from NVS to the kel partition", (unsigned long)state.count);
+}
+
+// Root over the frontier. edges, if given, gets the partial node at each
+// level on the right edge (the subtree that leaf count would go into).
+static void fold(uint8_t out[32], uint8_t edges[][32]) {
+  uint8_t node[32];
+  memcpy(node, zero[0], 32);
+  uint32_t size = state.count;
+  for (int h = 0; h < KEL_DEPTH; h++, size >>= 1) {
+    if (edges) memcpy(edges[h], node, 32);
+    if (size & 1) hashNode(node, state.frontier[h], node);
+    else hashNode(node, node, zero[h]);
+  }
+  memcpy(out, node, 32);
+}
+
+bool kelBegin() {
+  memset(zero[0], 0, 32);
+  for (int h = 1; h < KEL_DEPTH; h++) hashNode(zero[h], zero[h - 1], zero[h - 1]);
+
+  memset(&state, 0, sizeof(state));
+  opened = nvs_open(KEL_NAMESPACE, NVS_READWRITE, &handle) == ESP_OK;
+  if (!opened || !flashOpen()) {
+    LOG_E(opened ? "[KEL] No kel partition" : "[KEL] NVS open failed");
+    opened = false;
+    fold(root, nullptr);
+    return false;
+  }
+  size_t len = sizeof(state);
+  if (nvs_get_blob(handle, KEL_STATE_KEY, &state, &len) != ESP_OK || len != sizeof(state) ||
+      state.count > KEL_CAPACITY) {
+    memset(&state, 0, sizeof(state));  // Absent, or another layout
+  }
+  migrateLegacy();
+  fold(root, nullptr);
+  return true;
+}
+
+uint32_t kelCount() {
+  return state.count;
+}
+
+const uint8_t* kelRoot() {
+  return root;
+}
+
+bool kelAppend(KelEvent kind, uint8_t coin, const char* from, const char* to) {
+  if (!opened) return false;
+  if (state.count >= KEL_CAPACITY) {
+    LOG_E("[KEL] Log full (%d events)", KEL_CAPACITY);
+    return false;
+  }
+
+  KelState next = state;
+  uint32_t index = next.count++;
+  uint8_t node[32];
+  hashLeaf(node, kind, coin, from, to);
+
+  // The leaf, then every node it completes on the way up. Nothing points at
+  // the slots until the state is committed.
+  bool ok = true;
+  int level = 0;
+  for (;;) {
+    if (level < KEL_STORE_LEVELS) ok = ok && writeNode(level, index >> level, node);
+    if (!((index >> level) & 1)) break;
+    hashNode(node, next.frontier[level], node);
+    level++;
+  }
+  memcpy(next.frontier[level], node, 32);
+
+  ok = ok && nvs_set_blob(handle, KEL_STATE_KEY, &next, sizeof(next)) == ESP_OK;
+  if (!ok || nvs_commit(handle) != ESP_OK) {
+    LOG_E("[KEL] Could not store event %lu", (unsigned long)index);
+    return false;
+  }
+  state = next;
+  fold(root, nullptr);
+  LOG_I("[KEL] Event %lu (kind %d) appended", (unsigned long)index, (int)kind);
+  return true;
+}
+
+int kelProofLevels() {
+  int levels = 0;
+  while (levels < KEL_DEPTH && (1UL << levels) < state.count) levels++;
+  return levels;
+}
+
+KelError kelProof(uint32_t n, uint8_t leaf[32], uint8_t siblings[][32]) {
+  if (!opened) return KEL_NO_STORE;
+  if (n >= state.count) return KEL_RANGE;
+
+  if (!readNode(0, n, leaf)) return KEL_MISSING;
+
+  uint8_t edges[KEL_DEPTH][32];
+  uint8_t top[32];
+  fold(top, edges);
+
+  int levels = kelProofLevels();
+  for (int h = 0; h < levels; h++) {
+    uint32_t sibling = (n >> h) ^ 1;
+    uint32_t start = sibling << h;
+    uint32_t end = (sibling + 1) << h;
+    if (start >= state.count) {
+      memcpy(siblings[h], zero[h], 32);
+    } else if (end > state.count) {
+      memcpy(siblings[h], edges[h], 32);  // Right edge, still filling
+    } else {
+      if (!readNode(h, sibling, siblings[h])) return KEL_MISSING;
+    }
+  }
+  return KEL_OK;
+}
+
+bool kelReset() {
+  memset(&state, 0, sizeof(state));
+  fold(root, nullptr);
+  if (!opened) return false;
+  return nvs_erase_all(handle) == ESP_OK && nvs_commit(handle) == ESP_OK && flashErase(0, KEL_PARTITION_SIZE);
+}
+
+const char* kelErrorName(KelError err) {
+  return err <= KEL_MISSING ? errorNames[err] : "?";
+}
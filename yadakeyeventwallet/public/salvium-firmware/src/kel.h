@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==================== KEY EVENT LOG ====================
+//
+// Every key event (the wallet's inception and each ROTATE_KEY) is a leaf of
+// an append-only Merkle tree of fixed depth KEL_DEPTH, so the host can check
+// that the current key descends from one it saw before without replaying
+// the log over serial:
+//
+//   leaf  = SHA-256(0x00 | kind | coin | from | 0x00 | to)
+//   node  = SHA-256(0x01 | left | right)
+//   empty = 32 zero bytes at level 0, node(empty, empty) above
+//
+// from and to are the address before and after the event (from is empty at
+// inception). The tree is kept as an incremental accumulator: the frontier,
+// one pending left node per level, and the leaf count. An append hashes up
+// the frontier, O(log n), and the root is cached in RAM, so GET_KEL_ROOT
+// costs nothing.
+//
+// A proof for leaf n needs the siblings on its path, which the frontier no
+// longer has. Each node is written as it completes (about two per event, 32
+// bytes each) to a fixed slot in the "kel" data partition (partitions.csv),
+// so a proof is at most KEL_STORE_LEVELS flash reads plus the partial nodes
+// on the right edge, which come from the frontier. Siblings above
+// kelProofLevels() are always the empty-subtree hashes and are not sent.
+//
+// Slots are laid out level by level: level h has KEL_CAPACITY >> h of them.
+// The 64 KiB partition holds levels 0..9 (2047 slots), which caps the log at
+// KEL_CAPACITY events; the one node above, completed by the last event, is
+// only ever needed in the frontier. A slot is written once; one left dirty
+// by an append that was not committed is erased with its sector first.
+//
+// NVS (namespace "kel") only keeps "state", the count and the frontier,
+// rewritten and committed on every append, so the log takes the same few
+// NVS entries whatever its length. The native build keeps the partition in
+// RAM like history.cpp, so after a simulator restart proofs of earlier
+// events come back MISSING.
+
+#define KEL_NAMESPACE      "kel"
+#define KEL_DEPTH          16       // Tree depth: fixes the root and the proof format
+#define KEL_STORE_LEVELS   10       // Levels kept in the partition
+#define KEL_CAPACITY       1024     // Events, 1 << KEL_STORE_LEVELS
+#define KEL_PARTITION_SIZE 0x10000  // Native build; the device uses the partition size
+#define KEL_ADDR_MAX       128
+
+enum KelEvent { KEL_INCEPTION = 1, KEL_ROTATION = 2 };
+
+enum KelError { KEL_OK, KEL_NO_STORE, KEL_RANGE, KEL_MISSING };
+
+// Load the accumulator and recompute the root. False if NVS could not be
+// opened or there is no "kel" partition.
+bool kelBegin();
+
+uint32_t kelCount();
+const uint8_t* kelRoot();
+
+// Hash the event into the tree and commit it. False (tree unchanged) if
+// it could not be stored or the tree is full.
+bool kelAppend(KelEvent kind, uint8_t coin, const char* from, const char* to);
+
+// Leaf n and its siblings from level 0 up; siblings has room for KEL_DEPTH
+KelError kelProof(uint32_t n, uint8_t leaf[32], uint8_t siblings[][32]);
+
+// Siblings a proof carries at the current count
+int kelProofLevels();
+
+// Drop the whole log (committed), for a freshly generated wallet
+bool kelReset();
+
+const char* kelErrorName(KelError err);
@@ -0,0 +1,216 @@
+#include "keystore.h"
+#include "log.h"
+#include <Arduino.h>
+#include <nvs.h>
+#include <string.h>
+
+// Old CYD layout: arduino-esp32 EEPROM is one NVS blob, namespace and key "eeprom"
+#define LEGACY_EEPROM_NAME  "eeprom"
+#define LEGACY_EEPROM_SIZE  1024
+#define LEGACY_EEPROM_MAGIC 0xCA57
+#define LEGACY_ADDR_YDA_KEY 2
+#define LEGACY_ADDR_SAL_KEY 66
+#define LEGACY_ADDR_SAL_ROT 130
+
+// Old OLED layout
+#define LEGACY_OLED_NAME    "salvium"
+#define LEGACY_OLED_SPEND   "spend_key"
+
+struct RecordSlot {
+  const char* key;  // NVS key
+  uint16_t offset;  // In cache
+  uint16_t max;
+};
+
+static const RecordSlot SLOTS[KEY_RECORDS] = {
+  {"sal_spend", 0, 32},
+  {"yda_key", 32, 64},
+  {"sal_rot", 96, 4},
+  {"derived", 100, KEYSTORE_DERIVED_BYTES},
+  {"touch_cal", 100 + KEYSTORE_DERIVED_BYTES, 32},
+  {"yda_addr", 132 + KEYSTORE_DERIVED_BYTES, 67},
+  {"sal_addr", 199 + KEYSTORE_DERIVED_BYTES, 99},
+};
+
+#define CACHE_BYTES (298 + KEYSTORE_DERIVED_BYTES)
+
+static uint8_t cache[CACHE_BYTES];
+static uint16_t length[KEY_RECORDS];  // 0 = absent
+static bool dirty[KEY_RECORDS];
+static nvs_handle_t handle;
+static bool opened = false;
+
+static const char* statusNames[] = {"empty", "loaded", "migrated", "corrupt", "failed"};
+
+// Holds the spend key; the compiler may not drop it
+static void wipe(void* p, size_t len) {
+  volatile uint8_t* b = (volatile uint8_t*)p;
+  while (len--) *b++ = 0;
+}
+
+static bool parseHex(const char* hex, uint8_t* out, size_t bytes) {
+  for (size_t i = 0; i < 2 * bytes; i++) {
+    char c = hex[i];
+    uint8_t v;
+    if (c >= '0' && c <= '9') v = c - '0';
+    else if (c >= 'a' && c <= 'f') v = c - 'a' + 10;
+    else if (c >= 'A' && c <= 'F') v = c - 'A' + 10;
+    else return false;
+    out[i / 2] = (uint8_t)((i & 1) ? (out[i / 2] << 4) | v : v);
+  }
+  return true;
+}
+
+static void eraseNamespace(const char* name) {
+  nvs_handle_t old;
+  if (nvs_open(name, NVS_READWRITE, &old) != ESP_OK) return;
+  if (nvs_erase_all(old) == ESP_OK) nvs_commit(old);
+  nvs_close(old);
+}
+
+// Old CYD EEPROM image. Read straight from its NVS blob: EEPROM.begin()
+// would create a 1 KB blob on a device that never had one.
+static KeyStoreStatus migrateEeprom() {
+  nvs_handle_t old;
+  if (nvs_open(LEGACY_EEPROM_NAME, NVS_READONLY, &old) != ESP_OK) return KEYSTORE_EMPTY;
+  uint8_t image[LEGACY_EEPROM_SIZE];
+  size_t len = sizeof(image);
+  esp_err_t err = nvs_get_blob(old, LEGACY_EEPROM_NAME, image, &len);
+  nvs_close(old);
+  if (err != ESP_OK || len < LEGACY_ADDR_SAL_ROT + 4) return KEYSTORE_EMPTY;
+  if ((image[0] | (image[1] << 8)) != LEGACY_EEPROM_MAGIC) return KEYSTORE_EMPTY;
+
+  uint8_t spend[32];
+  if (!parseHex((const char*)image + LEGACY_ADDR_SAL_KEY, spend, sizeof(spend))) {
+    LOG_E("[KEYS] EEPROM spend key is not valid hex - left in place");
+    wipe(image, sizeof(image));
+    wipe(spend, sizeof(spend));
+    return KEYSTORE_CORRUPT;
+  }
+  int32_t rotation;
+  memcpy(&rotation, image + LEGACY_ADDR_SAL_ROT, 4);
+
+  keystoreWrite(KEY_SAL_SPEND, spend, sizeof(spend));
+  keystoreWrite(KEY_YDA_KEY, image + LEGACY_ADDR_YDA_KEY, SLOTS[KEY_YDA_KEY].max);
+  keystorePut(KEY_SAL_ROTATION, rotation);
+  wipe(image, sizeof(image));
+  wipe(spend, sizeof(spend));
+
+  // The old copy goes only once the new one is on flash
+  if (keystoreCommit()) eraseNamespace(LEGACY_EEPROM_NAME);
+  LOG_I("[KEYS] Migrated from EEPROM layout");
+  return KEYSTORE_MIGRATED;
+}
+
+// Old OLED Preferences namespace; its "view_key" was never derived
+static KeyStoreStatus migrateOled() {
+  nvs_handle_t old;
+  if (nvs_open(LEGACY_OLED_NAME, NVS_READONLY, &old) != ESP_OK) return KEYSTORE_EMPTY;
+  uint8_t spend[32];
+  size_t len = sizeof(spend);
+  esp_err_t err = nvs_get_blob(old, LEGACY_OLED_SPEND, spend, &len);
+  nvs_close(old);
+  if (err != ESP_OK || len != sizeof(spend)) return KEYSTORE_EMPTY;
+
+  keystoreWrite(KEY_SAL_SPEND, spend, sizeof(spend));
+  wipe(spend, sizeof(spend));
+  if (keystoreCommit()) eraseNamespace(LEGACY_OLED_NAME);
+  LOG_I("[KEYS] Migrated from OLED layout");
+  return KEYSTORE_MIGRATED;
+}
+
+KeyStoreStatus keystoreBegin() {
+  wipe(cache, sizeof(cache));
+  memset(length, 0, sizeof(length));
+  memset(dirty, 0, sizeof(dirty));
+  opened = nvs_open(KEYSTORE_NAMESPACE, NVS_READWRITE, &handle) == ESP_OK;
+  if (!opened) {
+    LOG_E("[KEYS] NVS open failed");
+    return KEYSTORE_FAILED;
+  }
+
+  bool any = false;
+  for (int r = 0; r < KEY_RECORDS; r++) {
+    size_t len = SLOTS[r].max;
+    if (nvs_get_blob(handle, SLOTS[r].key, cache + SLOTS[r].offset, &len) == ESP_OK && len > 0) {
+      length[r] = (uint16_t)len;
+      any = true;
+    }
+  }
+  if (any) return KEYSTORE_LOADED;
+
+  KeyStoreStatus status = migrateEeprom();
+  return status == KEYSTORE_EMPTY ? migrateOled() : status;
+}
+
+bool keystoreRead(KeyRecord rec, void* out, size_t len) {
+  if (rec >= KEY_RECORDS || length[rec] == 0 || length[rec] != len) return false;
+  memcpy(out, cache + SLOTS[rec].offset, len);
+  return true;
+}
+
+size_t keystoreReadUpTo(KeyRecord rec, void* out, size_t max) {
+  if (rec >= KEY_RECORDS || length[rec] == 0 || length[rec] > max) return 0;
+  memcpy(out, cache + SLOTS[rec].offset, length[rec]);
+  return length[rec];
+}
+
+void keystoreWrite(KeyRecord rec, const void* in, size_t len) {
+  if (rec >= KEY_RECORDS || len == 0 || len > SLOTS[rec].max) return;
+  uint8_t* slot = cache + SLOTS[rec].offset;
+  // Unchanged records cost no flash write at commit
+  if (length[rec] == len && memcmp(slot, in, len) == 0) return;
+  memcpy(slot, in, len);
+  length[rec] = (uint16_t)len;
+  dirty[rec] = true;
+}
+
+void keystoreErase(KeyRecord rec) {
+  if (rec >= KEY_RECORDS || length[rec] == 0) return;
+  wipe(cache + SLOTS[rec].offset, SLOTS[rec].max);
+  length[rec] = 0;
+  dirty[rec] = true;
+}
+
+bool keystoreDirty() {
+  for (int r = 0; r < KEY_RECORDS; r++) {
+    if (dirty[r]) return true;
+  }
+  return false;
+}
+
+bool keystoreCommit() {
+  if (!opened) return false;
+  if (!keystoreDirty()) return true;
+  bool ok = true;
+  int written = 0;
+  for (int r = 0; r < KEY_RECORDS; r++) {
+    if (!dirty[r]) continue;
+    esp_err_t err = length[r] ? nvs_set_blob(handle, SLOTS[r].key, cache + SLOTS[r].offset, length[r])
+                              : nvs_erase_key(handle, SLOTS[r].key);
+    if (err != ESP_OK && err != ESP_ERR_NVS_NOT_FOUND) {
+      LOG_E("[KEYS] Write %s failed: 0x%x", SLOTS[r].key, err);
+      ok = false;
+    }
+    written++;
+  }
+  if (nvs_commit(handle) != ESP_OK) {
+    LOG_E("[KEYS] Commit failed");
+    return false;
+  }
+  if (ok) memset(dirty, 0, sizeof(dirty));
+  LOG_I("[KEYS] Committed %d record(s)", written);
+  return ok;
+}
+
+bool keystoreWipe() {
+  wipe(cache, sizeof(cache));
+  memset(length, 0, sizeof(length));
+  memset(dirty, 0, sizeof(dirty));
+  if (!opened) return false;
+  return nvs_erase_all(handle) == ESP_OK && nvs_commit(handle) == ESP_OK;
+}
+
+const char* keystoreStatusName(KeyStoreStatus status) {
+  return status <= KEYSTORE_FAILED ? statusNames[status] : "?";
+}
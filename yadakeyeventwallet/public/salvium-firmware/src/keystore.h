@@ -0,0 +1,77 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==================== KEY STORE ====================
+//
+// Persistent wallet records for both firmware variants (main.cpp and
+// oled/), kept in the NVS namespace "wallet". keystoreBegin() reads every
+// record into RAM once; after that reads are memcpy from RAM and writes
+// only mark the record dirty. keystoreCommit() is the flush point: it
+// writes the dirty records and commits NVS once for all of them. Callers
+// commit after wallet generation, when a derived-cache rebuild finishes and
+// when leaving the key export screen.
+//
+// Records are typed by size: a read with a different length than the one
+// stored misses, so a changed layout reads as absent rather than garbage.
+//
+// On a device with no "wallet" namespace the previous layouts are
+// migrated once and then wiped:
+//
+//   CYD   EEPROM magic 0xCA57 at 0, YadaCoin key hex at 2, Salvium spend
+//         key hex at 66, rotation at 130 (the derived cache at 256 is not
+//         copied; it is rebuilt)
+//   OLED  Preferences namespace "salvium", 32-byte blob "spend_key"
+
+#define KEYSTORE_NAMESPACE    "wallet"
+#define KEYSTORE_DERIVED_BYTES 768  // Largest derived-cache record
+
+enum KeyRecord {
+  KEY_SAL_SPEND,     // uint8_t[32], as generated (not reduced)
+  KEY_YDA_KEY,       // char[64], hex after the "YDA" prefix
+  KEY_SAL_ROTATION,  // int32_t
+  KEY_DERIVED,       // Derived-data cache (derived.cpp), up to KEYSTORE_DERIVED_BYTES
+  KEY_TOUCH_CAL,     // TouchCal (touchcal.h), CYD only
+  KEY_YDA_ADDRESS,   // char[] up to 67, no NUL: the address ROTATE_KEY set, if any
+  KEY_SAL_ADDRESS,   // char[] up to 99, no NUL: likewise for Salvium
+  KEY_RECORDS
+};
+
+enum KeyStoreStatus {
+  KEYSTORE_EMPTY,     // Nothing stored anywhere
+  KEYSTORE_LOADED,    // Records read from the "wallet" namespace
+  KEYSTORE_MIGRATED,  // Imported from an old layout and committed
+  KEYSTORE_CORRUPT,   // Old layout present but unreadable; left untouched
+  KEYSTORE_FAILED     // NVS could not be opened
+};
+
+KeyStoreStatus keystoreBegin();
+
+// Copy the record into out. False if absent or stored with another length.
+bool keystoreRead(KeyRecord rec, void* out, size_t len);
+
+// Copy a record of any length up to max into out; its length, 0 if absent
+size_t keystoreReadUpTo(KeyRecord rec, void* out, size_t max);
+
+// Replace the record in RAM; reaches flash at the next keystoreCommit()
+void keystoreWrite(KeyRecord rec, const void* in, size_t len);
+void keystoreErase(KeyRecord rec);
+
+template <typename T> bool keystoreGet(KeyRecord rec, T& out) {
+  return keystoreRead(rec, &out, sizeof(T));
+}
+template <typename T> void keystorePut(KeyRecord rec, const T& in) {
+  keystoreWrite(rec, &in, sizeof(T));
+}
+
+bool keystoreDirty();
+
+// Write every dirty record with one NVS commit. False if any write failed
+// (the records stay dirty).
+bool keystoreCommit();
+
+// Drop every record, in RAM and in flash (committed)
+bool keystoreWipe();
+
+const char* keystoreStatusName(KeyStoreStatus status);
@@ -0,0 +1,298 @@
+#include "log.h"
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <atomic>
+
+#define LOG_DRAIN_STACK    3072
+#define LOG_DRAIN_PRIORITY 0   // Below the loop and the parallel workers
+#define LOG_DRAIN_CORE     0   // The loop runs on core 1
+#define LOG_DRAIN_POLL_MS  50  // Retry after a full UART buffer
+
+#define LOG_RING_MASK (LOG_RING_BYTES - 1)
+#define LOG_PAD       0xFF  // Level of the filler before a wrap
+
+static_assert((LOG_RING_BYTES & LOG_RING_MASK) == 0, "LOG_RING_BYTES must be a power of two");
+
+// Record, 4-byte aligned and never split by the end of the ring:
+//   u16 size | u8 level | u8 count | u32 ms | format pointer | arguments
+// Each argument is a type byte, then 8 bytes (int64 or double) or a length
+// byte and that many chars.
+#define RECORD_HEADER (8 + sizeof(const char*))
+
+static uint8_t ring[LOG_RING_BYTES];
+static std::atomic<uint32_t> head(0);  // Written by the producer only
+static std::atomic<uint32_t> tail(0);  // Written by the drain only
+static std::atomic<uint32_t> dropped(0);
+static uint32_t droppedReported = 0;
+
+static const char* argString(const LogArg& a) {
+  return a.s ? a.s : "(null)";
+}
+
+void logCommit(uint8_t level, const char* format, const LogArg* args, int count) {
+  size_t size = RECORD_HEADER;
+  for (int k = 0; k < count; k++) {
+    size += args[k].type == LOG_ARG_STRING ? 2 + strnlen(argString(args[k]), LOG_STRING_MAX) : 9;
+  }
+  size = (size + 3) & ~(size_t)3;
+
+  uint32_t h = head.load(std::memory_order_relaxed);
+  uint32_t offset = h & LOG_RING_MASK;
+  uint32_t toEnd = LOG_RING_BYTES - offset;
+  uint32_t needed = size + (toEnd < size ? toEnd : 0);
+  if (LOG_RING_BYTES - (h - tail.load(std::memory_order_acquire)) < needed) {
+    dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  if (toEnd < size) {
+    uint16_t pad = (uint16_t)toEnd;
+    memcpy(ring + offset, &pad, 2);
+    ring[offset + 2] = LOG_PAD;
+    h += toEnd;
+    offset = 0;
+  }
+
+  uint8_t* p = ring + offset;
+  uint16_t recordSize = (uint16_t)size;
+  uint32_t ms = millis();
+  memcpy(p, &recordSize, 2);
+  p[2] = level;
+  p[3] = (uint8_t)count;
+  memcpy(p + 4, &ms, 4);
+  memcpy(p + 8, &format, sizeof(format));
+  p += RECORD_HEADER;
+  for (int k = 0; k < count; k++) {
+    const LogArg& a = args[k];
+    *p++ = a.type;
+    if (a.type == LOG_ARG_STRING) {
+      const char* s = argString(a);
+      uint8_t len = (uint8_t)strnlen(s, LOG_STRING_MAX);
+      *p++ = len;
+      memcpy(p, s, len);
+      p += len;
+    } else {
+      memcpy(p, &a.i, 8);  // Or the double, same bytes
+      p += 8;
+    }
+  }
+
+  head.store(h + size, std::memory_order_release);
+}
+
+// ---- Formatting (drain side) ----
+
+struct ArgReader {
+  const uint8_t* p;
+  int left;
+  char text[LOG_STRING_MAX + 1];
+
+  LogArgType next(int64_t& i, double& f) {
+    i = 0;
+    f = 0;
+    text[0] = 0;
+    if (left <= 0) return LOG_ARG_INT;  // Format asks for more than was logged
+    left--;
+    LogArgType type = (LogArgType)*p++;
+    if (type == LOG_ARG_STRING) {
+      uint8_t len = *p++;
+      memcpy(text, p, len);
+      text[len] = 0;
+      p += len;
+    } else if (type == LOG_ARG_FLOAT) {
+      memcpy(&f, p, 8);
+      i = (int64_t)f;
+      p += 8;
+    } else {
+      memcpy(&i, p, 8);
+      f = (double)i;
+      p += 8;
+    }
+    return type;
+  }
+};
+
+// printf over the captured arguments. Length modifiers in the format are
+// replaced by the width the argument was stored at, so "%lu" is right
+// whatever size long has on the device that logged it.
+static size_t formatRecord(char* line, const uint8_t* rec) {
+  const size_t room = LOG_LINE_MAX - 1;  // Keep one for the newline
+  uint32_t ms;
+  const char* format;
+  memcpy(&ms, rec + 4, 4);
+  memcpy(&format, rec + 8, sizeof(format));
+  size_t n = snprintf(line, room, "#%c %lu ", "?EWID"[rec[2] <= LOG_LEVEL_DEBUG ? rec[2] : 0], (unsigned long)ms);
+
+  ArgReader args{rec + RECORD_HEADER, rec[3], {0}};
+  int64_t i;
+  double f;
+  const char* s = format;
+  while (*s && n < room - 1) {
+    if (*s != '%') {
+      line[n++] = *s++;
+      continue;
+    }
+    if (s[1] == '%') {
+      line[n++] = '%';
+      s += 2;
+      continue;
+    }
+
+    char spec[24];
+    int k = 0;
+    bool star = false;
+    spec[k++] = *s++;
+    while (*s && strchr("-+ #0", *s) && k < 8) spec[k++] = *s++;
+    if (*s == '*') {
+      star = true;
+      spec[k++] = *s++;
+    }
+    while (*s >= '0' && *s <= '9' && k < 12) spec[k++] = *s++;
+    if (*s == '.') {
+      spec[k++] = *s++;
+      if (*s == '*') {
+        star = true;
+        spec[k++] = *s++;
+      }
+      while (*s >= '0' && *s <= '9' && k < 16) spec[k++] = *s++;
+    }
+    while (*s && strchr("hlLqjzt", *s)) s++;
+    char conv = *s;
+    if (!conv) break;
+    s++;
+
+    int starValue = 0;
+    if (star) {
+      args.next(i, f);
+      starValue = (int)i;
+    }
+    LogArgType type = args.next(i, f);
+
+    int wrote;
+    switch (conv) {
+      case 'd':
+      case 'i':
+      case 'u':
+      case 'o':
+      case 'x':
+      case 'X':
+        if (type == LOG_ARG_INT32 && conv != 'd' && conv != 'i') i = (uint32_t)i;
+        spec[k++] = 'l';
+        spec[k++] = 'l';
+        spec[k++] = conv;
+        spec[k] = 0;
+        wrote = star ? snprintf(line + n, room - n, spec, starValue, (long long)i)
+                     : snprintf(line + n, room - n, spec, (long long)i);
+        break;
+      case 'c':
+        spec[k++] = 'c';
+        spec[k] = 0;
+        wrote = star ? snprintf(line + n, room - n, spec, starValue, (int)i) : snprintf(line + n, room - n, spec, (int)i);
+        break;
+      case 's':
+        spec[k++] = 's';
+        spec[k] = 0;
+        if (type != LOG_ARG_STRING) strcpy(args.text, "?");
+        wrote = star ? snprintf(line + n, room - n, spec, starValue, args.text)
+                     : snprintf(line + n, room - n, spec, args.text);
+        break;
+      default:  // e f g and friends
+        spec[k++] = conv;
+        spec[k] = 0;
+        wrote = star ? snprintf(line + n, room - n, spec, starValue, f) : snprintf(line + n, room - n, spec, f);
+        break;
+    }
+    if (wrote > 0) n += wrote;
+    if (n > room - 1) n = room - 1;
+  }
+  line[n++] = '\n';
+  return n;
+}
+
+// Write queued lines while the UART takes them (or all of them, blocking)
+static bool drain(bool block) {
+  char line[LOG_LINE_MAX];
+  for (;;) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) {
+      // What was dropped came after everything written so far
+      uint32_t lost = dropped.load(std::memory_order_relaxed);
+      if (lost == droppedReported) return true;
+      int n = snprintf(line, sizeof(line), "#W %lu [LOG] %lu record(s) dropped\n", millis(),
+                       (unsigned long)(lost - droppedReported));
+      if (!block && Serial.availableForWrite() < n) return false;
+      Serial.write((const uint8_t*)line, n);
+      droppedReported = lost;
+      continue;
+    }
+    const uint8_t* rec = ring + (t & LOG_RING_MASK);
+    uint16_t size;
+    memcpy(&size, rec, 2);
+    if (rec[2] != LOG_PAD) {
+      size_t n = formatRecord(line, rec);
+      if (!block && Serial.availableForWrite() < (int)n) return false;
+      Serial.write((const uint8_t*)line, n);
+    }
+    tail.store(t + size, std::memory_order_release);
+  }
+}
+
+uint32_t logDropped() {
+  return dropped.load(std::memory_order_relaxed);
+}
+
+void logFlush() {
+  drain(true);
+}
+
+#ifdef ARDUINO
+
+static SemaphoreHandle_t serialGate = nullptr;  // Held by whoever may write to Serial
+static TaskHandle_t drainTask = nullptr;
+
+static void drainLoop(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LOG_DRAIN_POLL_MS));
+    if (tail.load(std::memory_order_relaxed) == head.load(std::memory_order_acquire) &&
+        dropped.load(std::memory_order_relaxed) == droppedReported) {
+      continue;
+    }
+    xSemaphoreTake(serialGate, portMAX_DELAY);
+    drain(false);
+    xSemaphoreGive(serialGate);
+  }
+}
+
+void logBegin() {
+  if (serialGate) return;
+  serialGate = xSemaphoreCreateMutex();
+  xSemaphoreTake(serialGate, portMAX_DELAY);
+  xTaskCreatePinnedToCore(drainLoop, "log", LOG_DRAIN_STACK, nullptr, LOG_DRAIN_PRIORITY, &drainTask,
+                          LOG_DRAIN_CORE);
+}
+
+void logUnlockSerial() {
+  if (!serialGate) return;
+  xSemaphoreGive(serialGate);
+  xTaskNotifyGive(drainTask);
+}
+
+void logLockSerial() {
+  if (serialGate) xSemaphoreTake(serialGate, portMAX_DELAY);
+}
+
+#else
+
+// Host: no task, the loop drains at the same point instead
+void logBegin() {}
+
+void logUnlockSerial() {
+  drain(false);
+}
+
+void logLockSerial() {}
+
+#endif
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==================== LOGGING ====================
+//
+// Diagnostics go through LOG_E/W/I/D instead of Serial. A call below
+// LOG_LEVEL compiles to nothing: its arguments are type-checked but never
+// evaluated, and no format string is kept.
+//
+// An enabled call does not format anything. It copies a binary record (the
+// format string pointer, millis() and its arguments; strings up to
+// LOG_STRING_MAX chars) into a ring of LOG_RING_BYTES and returns. When the
+// ring is full the record is dropped and counted, so logging never blocks.
+//
+// The ring is drained by a low-priority task on the other core (inline on
+// the host), which formats each record into one line framed as
+//
+//   #<E|W|I|D> <ms> <text>
+//
+// Protocol replies never start with '#', so a host can tell the two apart.
+// Replies are often written in several prints, so the drain only writes
+// while the loop has handed over the serial port, between logUnlockSerial()
+// and logLockSerial() around its wait for input or the pause after a job
+// slice, and then only what the UART buffer takes without blocking. A reply
+// therefore never has a log line inside it, and its latency does not depend
+// on how much is logged.
+//
+// Only the loop task may log (the ring has one producer).
+
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_DEBUG 4  // Every touch, draw and UI action
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#define LOG_RING_BYTES 4096  // Power of two
+#define LOG_STRING_MAX 64    // Chars of a %s argument kept
+#define LOG_ARGS_MAX   8
+#define LOG_LINE_MAX   192   // Formatted line, longer ones are cut
+
+enum LogArgType : uint8_t { LOG_ARG_INT, LOG_ARG_INT32, LOG_ARG_FLOAT, LOG_ARG_STRING };
+
+// One argument, captured by type; the format string decides how it prints
+struct LogArg {
+  LogArgType type;
+  union {
+    int64_t i;
+    double f;
+    const char* s;
+  };
+  LogArg() : type(LOG_ARG_INT), i(0) {}
+  // 32-bit ones are marked so %x of a negative int prints 8 digits
+  LogArg(int v) : type(LOG_ARG_INT32), i(v) {}
+  LogArg(unsigned v) : type(LOG_ARG_INT32), i(v) {}
+  LogArg(long v) : type(sizeof(long) == 4 ? LOG_ARG_INT32 : LOG_ARG_INT), i(v) {}
+  LogArg(unsigned long v) : type(sizeof(long) == 4 ? LOG_ARG_INT32 : LOG_ARG_INT), i((int64_t)v) {}
+  LogArg(long long v) : type(LOG_ARG_INT), i(v) {}
+  LogArg(unsigned long long v) : type(LOG_ARG_INT), i((int64_t)v) {}
+  LogArg(double v) : type(LOG_ARG_FLOAT), f(v) {}
+  LogArg(const char* v) : type(LOG_ARG_STRING), s(v) {}
+};
+
+void logCommit(uint8_t level, const char* format, const LogArg* args, int count);
+
+template <class... Args>
+inline void logWrite(uint8_t level, const char* format, Args... args) {
+  static_assert(sizeof...(Args) <= LOG_ARGS_MAX, "too many log arguments");
+  const LogArg packed[sizeof...(Args) + 1] = {LogArg(args)...};
+  logCommit(level, format, packed, (int)sizeof...(Args));
+}
+
+#define LOG_DISABLED(...) \
+  do {                    \
+    if (0) logWrite(0, __VA_ARGS__); \
+  } while (0)
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_E(...) logWrite(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LOG_E(...) LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_W(...) logWrite(LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define LOG_W(...) LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_I(...) logWrite(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LOG_I(...) LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_D(...) logWrite(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LOG_D(...) LOG_DISABLED(__VA_ARGS__)
+#endif
+
+// Start the drain task. The caller (the loop task) holds the serial port.
+void logBegin();
+
+// Around the loop's wait for input and each job slice's pause: the drain
+// may write in between
+void logUnlockSerial();
+void logLockSerial();
+
+// Write out everything queued now, blocking; for before a halt or restart
+void logFlush();
+
+// Records dropped on a full ring since boot
+uint32_t logDropped();
@@ -3,11 +3,30 @@
 #include <XPT2046_Touchscreen.h>
 #include <ArduinoJson.h>
 #include <Crypto.h>
-#include <SHA256.h>
-#include <qrcode.h>
 #include "esp_task_wdt.h"
-#include <EEPROM.h>
 #include <esp_system.h>
+#include "addresses.h"
+#include "amount.h"
+#include "coins.h"
+#include "crypto/random.h"
+#include "derived.h"
+#include "fonts.h"
+#include "history.h"
+#include "touchcal.h"
+#include "txreview.h"
+#include "trace.h"
+#include "ui.h"
+#include "idle.h"
+#include "keystore.h"
+#include "jobs.h"
+#include "kel.h"
+#include "log.h"
+#include "ota.h"
+#include "parallel.h"
+#include "qr.h"
+#include "scanner.h"
+#include "signer.h"
+#include "wallet.h"
 
 // Hardware pins - ESP32-2432S028
 #define TFT_BL 21
@@ -18,24 +37,38 @@
 #define XPT2046_CS 33
 #define BOOT_BUTTON 0
 
+// Room for streamed replies (GET_ADDRESSES) so writes do not block the loop
+#define SERIAL_TX_BUFFER 4096
+// Room for a whole OTA_CHUNK line (1 KB of hex) while the loop is drawing
+#define SERIAL_RX_BUFFER 2048
+// Longest command: a SIGN_TX:SAL envelope of SIGN_MAX_INPUTS inputs with
+// rings of 16 (about 9 KB of signer hex plus the prefix)
+#define SERIAL_LINE_MAX 12288
+// Time for OTA:DONE to leave the UART before the restart
+#define OTA_RESTART_DELAY_MS 200
+
 // Display and Touch
 TFT_eSPI tft = TFT_eSPI();
 SPIClass touchscreenSpi = SPIClass(VSPI);
-XPT2046_Touchscreen touch(XPT2046_CS, XPT2046_IRQ);
+XPT2046_Touchscreen touch(XPT2046_CS);  // PENIRQ is owned by the idle manager
 
-// Touch calibration for ESP32-2432S028 (from official CYD examples)
+// Mapping for an uncalibrated ESP32-2432S028 (from official CYD examples)
 #define TOUCH_MIN_X 200
 #define TOUCH_MAX_X 3700
 #define TOUCH_MIN_Y 240
 #define TOUCH_MAX_Y 3800
 
-// EEPROM configuration for persistent key storage
-#define EEPROM_SIZE 512
-#define EEPROM_MAGIC 0xCA57  // Magic number to verify initialized EEPROM
-#define EEPROM_ADDR_MAGIC 0
-#define EEPROM_ADDR_YDA_KEY 2
-#define EEPROM_ADDR_SAL_KEY 66
-#define EEPROM_ADDR_SAL_ROT 130
+// Touch sampling (touchcal.h holds the raw -> screen transform)
+#define TOUCH_Z_MIN           400  // Weakest press without a calibration
+#define TOUCH_Z_FLOOR         150  // Weakest press a calibration may lower it to
+#define TOUCH_Z_MAX           4000
+#define TOUCH_SAMPLES_DEFAULT 5    // Readings averaged per touch, uncalibrated
+#define TOUCH_SAMPLES_CAL     2    // Same with a stored calibration
+#define TOUCH_EDGE_SLACK      16   // Pixels past the glass still clamped onto it
+#define TOUCH_CAL_SAMPLES     8    // Readings averaged per calibration tap
+#define TOUCH_CAL_VERIFY_PX   10   // Largest error on the check target
+
+TouchCal touchCal;  // Uncalibrated default until loadTouchCal()
 
 // Button state
 int menuSelection = 0;
@@ -43,6 +76,8 @@ unsigned long lastButtonPress = 0;
 bool buttonPressed = false;
 unsigned long lastTouchTime = 0;
 bool touchAvailable = false;
+bool touchWakeGuard = false;   // Touch that woke the screen, ignored until released
+bool buttonWakeGuard = false;  // Same for the BOOT button
 
 // Screens
 enum Screen { 
@@ -55,22 +90,22 @@ enum Screen {
   SCREEN_SALVIUM_RECEIVE,
   SCREEN_SALVIUM_SEND,
   SCREEN_SALVIUM_EXPORT,
-  SCREEN_SETTINGS 
+  SCREEN_SETTINGS,
+  SCREEN_ADDRESS_LIST,
+  SCREEN_HISTORY,
+  SCREEN_TOUCH_CAL,
+  SCREEN_TX_REVIEW,
+  SCREEN_COUNT
 };
 Screen currentScreen = SCREEN_SPLASH;
 
-// Wallet data
-String yadacoinAddress = "";
-String salviumAddress = "";
-String salviumPrivateSpendKey = "";  // For wallet import/export
-int salviumRotation = 0;               // Key rotation counter
-float yadacoinBalance = 0.0;
-float salviumBalance = 0.0;
+// Wallet data lives in the static arena (wallet.h)
 
 // Forward declarations for wallet functions
-void saveKeysToEEPROM();
-bool loadKeysFromEEPROM();
+void saveKeys();
+bool loadKeys(KeyStoreStatus status);
 void generateSecureWallets();
+void generateYadaAddress();
 
 // UI Colors
 #define COLOR_BG 0x0000
@@ -82,66 +117,244 @@ void generateSecureWallets();
 #define COLOR_GRAY 0x8410
 #define COLOR_BUTTON 0x2945
 
-// Button structure
-struct Button { int x, y, w, h; String label; uint16_t color; };
+// Job progress overlay (bottom strip) and its CANCEL button
+#define JOB_BAR_Y 200
+#define JOB_CANCEL_X 235
+
+// Address list: LIST_ROWS visible rows, derived lazily into a small cache
+#define LIST_ROWS       8
+#define LIST_ROW_H      20
+#define LIST_Y          40
+#define LIST_CACHE_ROWS 16   // Direct mapped on index, two pages
+#define LIST_BUTTON_X   262  // "All" button on the receive screens, "History" on Settings
+#define CAL_BUTTON_X    230  // "Calibrate" button on Settings
+#define CAL_BUTTON_Y    200
+
+// GET_HISTORY replies per request; a full page fits in SERIAL_TX_BUFFER
+#define HISTORY_PAGE_MAX 16
 
-// Menu
-const char* menuItems[] = {"YadaCoin Wallet", "Salvium Wallet", "Settings"};
-const int menuItemCount = 3;
 
 // Forward declarations
 void drawSplashScreen();
 void drawMainMenu();
-void drawYadaCoinScreen();
-void drawYadaCoinReceiveScreen();
-void drawYadaCoinSendScreen();
-void drawSalviumScreen();
-void drawSalviumReceiveScreen();
-void drawSalviumSendScreen();
+template <class C> void drawCoinScreen();
+template <class C> void drawReceiveScreen();
+template <class C> void drawSendScreen();
 void drawSalviumExportScreen();
 void drawSettingsScreen();
-void drawButton(Button btn);
+void drawCurrentScreen();
+void drawJobProgress(int id, const char* name, uint8_t progress);
 void handleTouch();
 void handleButton();
 void handleSerialCommands();
 void generateDemoAddresses();
+void submitSignJob(int coin, const char* txData);
+void submitScanJob(const char* outputs);
+void submitCacheRebuild();
+void submitOtaJob(const char* headerHex);
+void submitAddressJob(AddressCoin coin, uint32_t account, uint32_t from, uint32_t count);
+void openAddressList(AddressCoin coin);
+void drawAddressListScreen();
+void drawAddressRow(int row);
+void drawHistoryScreen();
+void drawHistoryRow(int row);
+void handleHistoryQuery(const char* query);
+void printKelRoot();
+void handleKelProof(const char* arg);
+void printTrace();
+void setUnixTime(uint32_t now);
+void recordHistory(HistoryKind kind, HistoryCoin coin, const uint8_t digest[32], int64_t amount, const char* destination);
+void drawQrBitmap(const QrBitmap& qr, int x, int y, int scale);
+void loadTouchCal();
+void startTouchCal();
+void touchCalTap(int rawX, int rawY, int z);
+void drawTouchCalScreen();
+void drawTxReviewScreen();
+void drawReviewStatus();
+void answerReview(bool confirm, const char* why);
+void checkReviewTimeout();
+int reviewPending();
+void showScreen(Screen next);
+void runAction(uint8_t action, uint8_t arg);
+void drawWidgets(Screen screen);
+
+// ==================== SCREEN TABLE ====================
+//
+// Every screen's buttons and touch regions (ui.h): drawn by drawWidgets(),
+// hit-tested through the compile-time grid, and what a touch on them, or on
+// nothing, does. Screen changes all go through showScreen(), which runs the
+// leave and enter hooks here, so handleTouch() has no per-screen code.
+
+enum UiAction : uint8_t {
+  ACT_NONE,
+  ACT_GO,            // arg: Screen
+  ACT_ADDRESS_LIST,  // arg: AddressCoin
+  ACT_LIST_BACK,     // To the receive screen the list was opened from
+  ACT_LIST_PAGE,     // arg: 0 back, 1 forward
+  ACT_HISTORY_PAGE,  // arg: 0 newer, 1 older
+  ACT_ROTATE,        // Next Salvium export key
+  ACT_REVIEW,        // arg: 0 reject, 1 confirm the SIGN_TX on screen
+};
+
+struct ScreenDef {
+  Screen id;
+  const char* name;
+  const Widget* widgets;
+  uint8_t count;
+  const UiHitGrid* grid;
+  void (*draw)();
+  uint8_t elsewhere;     // UiAction for a touch on no widget
+  uint8_t elsewhereArg;
+  void (*enter)();       // Before the first draw, or nullptr
+  void (*leave)();       // Before the next screen's enter, or nullptr
+};
+
+#define BACK_ARROW(action, arg) {0, 0, 30, 35, UI_BACK_ARROW, COLOR_TEXT, 0, nullptr, action, arg, 0}
+#define ALL_BUTTON(coin) {LIST_BUTTON_X, 6, 52, 24, UI_SMALL, COLOR_BUTTON, COLOR_TEXT, "All >", ACT_ADDRESS_LIST, coin, 4}
+#define LIST_HALF_H (LIST_ROWS * LIST_ROW_H / 2)
+#define PAGE_ZONES(action)                                                     \
+  {0, LIST_Y, 320, LIST_HALF_H, UI_ZONE, 0, 0, nullptr, action, 0, 0},          \
+  {0, LIST_Y + LIST_HALF_H, 320, LIST_HALF_H, UI_ZONE, 0, 0, nullptr, action, 1, 0}
+
+// Item order is the BOOT button's selection order
+constexpr Widget MENU_WIDGETS[] = {
+  {10, 40, 300, 55, UI_MENU_ITEM, COLOR_PRIMARY, COLOR_TEXT, "YadaCoin Wallet", ACT_GO, SCREEN_YADACOIN, 2},
+  {10, 100, 300, 55, UI_MENU_ITEM, COLOR_PRIMARY, COLOR_TEXT, "Salvium Wallet", ACT_GO, SCREEN_SALVIUM, 2},
+  {10, 160, 300, 55, UI_MENU_ITEM, COLOR_PRIMARY, COLOR_TEXT, "Settings", ACT_GO, SCREEN_SETTINGS, 2},
+};
+#define MENU_ITEMS (int)(sizeof(MENU_WIDGETS) / sizeof(MENU_WIDGETS[0]))
+
+constexpr Widget YADACOIN_WIDGETS[] = {
+  {20, 150, 130, 40, UI_BUTTON, COLOR_SUCCESS, COLOR_BG, "Receive", ACT_GO, SCREEN_YADACOIN_RECEIVE, UI_TOUCH_PAD},
+  {170, 150, 130, 40, UI_BUTTON, COLOR_DANGER, COLOR_BG, "Send", ACT_GO, SCREEN_YADACOIN_SEND, UI_TOUCH_PAD},
+};
+
+// 7 px apart, so less slack than usual
+constexpr Widget SALVIUM_WIDGETS[] = {
+  {10, 145, 95, 40, UI_BUTTON, COLOR_SUCCESS, COLOR_BG, "Receive", ACT_GO, SCREEN_SALVIUM_RECEIVE, 3},
+  {112, 145, 95, 40, UI_BUTTON, COLOR_DANGER, COLOR_BG, "Send", ACT_GO, SCREEN_SALVIUM_SEND, 3},
+  {215, 145, 95, 40, UI_BUTTON, COLOR_WARNING, COLOR_BG, "Export", ACT_GO, SCREEN_SALVIUM_EXPORT, 3},
+};
+
+constexpr Widget YADACOIN_RECEIVE_WIDGETS[] = {BACK_ARROW(ACT_GO, SCREEN_YADACOIN), ALL_BUTTON(YadaCoin::addressCoin)};
+constexpr Widget YADACOIN_SEND_WIDGETS[] = {BACK_ARROW(ACT_GO, SCREEN_YADACOIN)};
+constexpr Widget SALVIUM_RECEIVE_WIDGETS[] = {BACK_ARROW(ACT_GO, SCREEN_SALVIUM), ALL_BUTTON(Salvium::addressCoin)};
+constexpr Widget SALVIUM_SEND_WIDGETS[] = {BACK_ARROW(ACT_GO, SCREEN_SALVIUM)};
+
+constexpr Widget SALVIUM_EXPORT_WIDGETS[] = {
+  BACK_ARROW(ACT_GO, SCREEN_SALVIUM),
+  {200, 195, 110, 30, UI_SMALL, COLOR_SUCCESS, COLOR_BG, "[+] Next Key", ACT_ROTATE, 0, 0},
+};
+
+constexpr Widget SETTINGS_WIDGETS[] = {
+  {LIST_BUTTON_X - 8, 6, 60, 24, UI_SMALL, COLOR_BUTTON, COLOR_TEXT, "History", ACT_GO, SCREEN_HISTORY, 4},
+  {CAL_BUTTON_X, CAL_BUTTON_Y, 84, 24, UI_SMALL, COLOR_BUTTON, COLOR_TEXT, "Calibrate", ACT_GO, SCREEN_TOUCH_CAL, 4},
+};
+
+constexpr Widget TX_REVIEW_WIDGETS[] = {
+  {20, 190, 130, 40, UI_BUTTON, COLOR_DANGER, COLOR_BG, "Reject", ACT_REVIEW, 0, UI_TOUCH_PAD},
+  {170, 190, 130, 40, UI_BUTTON, COLOR_SUCCESS, COLOR_BG, "Confirm", ACT_REVIEW, 1, UI_TOUCH_PAD},
+};
+
+constexpr Widget ADDRESS_LIST_WIDGETS[] = {BACK_ARROW(ACT_LIST_BACK, 0), PAGE_ZONES(ACT_LIST_PAGE)};
+constexpr Widget HISTORY_WIDGETS[] = {BACK_ARROW(ACT_GO, SCREEN_SETTINGS), PAGE_ZONES(ACT_HISTORY_PAGE)};
+
+constexpr UiHitGrid MENU_GRID = uiBuildGrid(MENU_WIDGETS);
+constexpr UiHitGrid YADACOIN_GRID = uiBuildGrid(YADACOIN_WIDGETS);
+constexpr UiHitGrid SALVIUM_GRID = uiBuildGrid(SALVIUM_WIDGETS);
+constexpr UiHitGrid YADACOIN_RECEIVE_GRID = uiBuildGrid(YADACOIN_RECEIVE_WIDGETS);
+constexpr UiHitGrid YADACOIN_SEND_GRID = uiBuildGrid(YADACOIN_SEND_WIDGETS);
+constexpr UiHitGrid SALVIUM_RECEIVE_GRID = uiBuildGrid(SALVIUM_RECEIVE_WIDGETS);
+constexpr UiHitGrid SALVIUM_SEND_GRID = uiBuildGrid(SALVIUM_SEND_WIDGETS);
+constexpr UiHitGrid SALVIUM_EXPORT_GRID = uiBuildGrid(SALVIUM_EXPORT_WIDGETS);
+constexpr UiHitGrid SETTINGS_GRID = uiBuildGrid(SETTINGS_WIDGETS);
+constexpr UiHitGrid ADDRESS_LIST_GRID = uiBuildGrid(ADDRESS_LIST_WIDGETS);
+constexpr UiHitGrid HISTORY_GRID = uiBuildGrid(HISTORY_WIDGETS);
+constexpr UiHitGrid TX_REVIEW_GRID = uiBuildGrid(TX_REVIEW_WIDGETS);
+
+#define WIDGETS(table) table##_WIDGETS, (uint8_t)(sizeof(table##_WIDGETS) / sizeof(Widget)), &table##_GRID
+#define NO_WIDGETS nullptr, 0, &UI_EMPTY_GRID
+
+void menuEnter() { menuSelection = 0; }
+void historyEnter();
+void addressListEnter();
+void touchCalEnter();
+void exportLeave() { keystoreCommit(); }  // Repeated rotations cost one flash write
+void reviewLeave();
+
+constexpr ScreenDef SCREENS[SCREEN_COUNT] = {
+  {SCREEN_SPLASH, "splash", NO_WIDGETS, drawSplashScreen, ACT_GO, SCREEN_MENU, nullptr, nullptr},
+  {SCREEN_MENU, "menu", WIDGETS(MENU), drawMainMenu, ACT_NONE, 0, menuEnter, nullptr},
+  {SCREEN_YADACOIN, "yadacoin", WIDGETS(YADACOIN), drawCoinScreen<YadaCoin>, ACT_GO, SCREEN_MENU, nullptr, nullptr},
+  {SCREEN_YADACOIN_RECEIVE, "yadacoin_receive", WIDGETS(YADACOIN_RECEIVE), drawReceiveScreen<YadaCoin>, ACT_GO,
+   SCREEN_YADACOIN, nullptr, nullptr},
+  {SCREEN_YADACOIN_SEND, "yadacoin_send", WIDGETS(YADACOIN_SEND), drawSendScreen<YadaCoin>, ACT_GO, SCREEN_YADACOIN,
+   nullptr, nullptr},
+  {SCREEN_SALVIUM, "salvium", WIDGETS(SALVIUM), drawCoinScreen<Salvium>, ACT_GO, SCREEN_MENU, nullptr, nullptr},
+  {SCREEN_SALVIUM_RECEIVE, "salvium_receive", WIDGETS(SALVIUM_RECEIVE), drawReceiveScreen<Salvium>, ACT_GO,
+   SCREEN_SALVIUM, nullptr, nullptr},
+  {SCREEN_SALVIUM_SEND, "salvium_send", WIDGETS(SALVIUM_SEND), drawSendScreen<Salvium>, ACT_GO, SCREEN_SALVIUM,
+   nullptr, nullptr},
+  {SCREEN_SALVIUM_EXPORT, "salvium_export", WIDGETS(SALVIUM_EXPORT), drawSalviumExportScreen, ACT_GO,
+   SCREEN_SALVIUM, nullptr, exportLeave},
+  {SCREEN_SETTINGS, "settings", WIDGETS(SETTINGS), drawSettingsScreen, ACT_GO, SCREEN_MENU, nullptr, nullptr},
+  {SCREEN_ADDRESS_LIST, "address_list", WIDGETS(ADDRESS_LIST), drawAddressListScreen, ACT_LIST_BACK, 0,
+   addressListEnter, nullptr},
+  {SCREEN_HISTORY, "history", WIDGETS(HISTORY), drawHistoryScreen, ACT_GO, SCREEN_SETTINGS, historyEnter, nullptr},
+  {SCREEN_TOUCH_CAL, "touch_cal", NO_WIDGETS, drawTouchCalScreen, ACT_NONE, 0, touchCalEnter, nullptr},
+  {SCREEN_TX_REVIEW, "tx_review", WIDGETS(TX_REVIEW), drawTxReviewScreen, ACT_NONE, 0, nullptr, reviewLeave},
+};
+
+constexpr bool screensInOrder() {
+  for (int i = 0; i < SCREEN_COUNT; i++) {
+    if (SCREENS[i].id != i) return false;
+  }
+  return true;
+}
+static_assert(screensInOrder(), "SCREENS must be indexed by Screen");
+
+// A coin's screens (indexed by coin, coins.h) and where its titles sit
+struct CoinScreens {
+  Screen home, receive, send;
+  uint16_t titleColor;
+  int16_t titleX, receiveX, sendX;  // Centred by eye for FONT_SANS_24 / 16
+};
+
+constexpr CoinScreens COIN_SCREENS[COIN_COUNT] = {
+  {SCREEN_YADACOIN, SCREEN_YADACOIN_RECEIVE, SCREEN_YADACOIN_SEND, COLOR_WARNING, 20, 35, 45},
+  {SCREEN_SALVIUM, SCREEN_SALVIUM_RECEIVE, SCREEN_SALVIUM_SEND, COLOR_SUCCESS, 30, 45, 60},
+};
 
 void setup() {
-  // Disable watchdog during lengthy initialization
-  disableCore0WDT();
-  disableCore1WDT();
-  
   // Wait for power to stabilize after flashing
   delay(500);
   
+  Serial.setTxBufferSize(SERIAL_TX_BUFFER);
+  Serial.setRxBufferSize(SERIAL_RX_BUFFER);
   Serial.begin(115200);
+  logBegin();
   delay(100);
   Serial.println("\n========================================");
   Serial.println("  YadaCoin/Salvium Hardware Wallet");
   Serial.println("  ESP32-2432S028 Edition");
   Serial.println("  Firmware v0.1.0-TESTING");
   Serial.println("========================================");
-  Serial.println("[SECURITY] YadaCoin: Secure pre-rotation");
-  Serial.println("[WARNING] Salvium: UNPROTECTED export");
-  Serial.println("[WARNING] Salvium QR exposes private key!");
-  Serial.println("[WARNING] TEST AMOUNTS ONLY (<$10)");
-  Serial.println("========================================");
-  
-  pinMode(TFT_BL, OUTPUT);
-  digitalWrite(TFT_BL, LOW);  // Start with backlight off
+  LOG_I("[SECURITY] YadaCoin: Secure pre-rotation");
+  LOG_W("[WARNING] Salvium: UNPROTECTED export");
+  LOG_W("[WARNING] Salvium QR exposes private key!");
+  LOG_W("[WARNING] TEST AMOUNTS ONLY (<$10)");
   
-  pinMode(BOOT_BUTTON, INPUT_PULLUP);
+  // Backlight PWM (starts off) and touch/button/UART wake sources
+  idleBegin(TFT_BL, XPT2046_IRQ, BOOT_BUTTON, drawCurrentScreen);
   
   delay(200);  // Give hardware time to stabilize
   
   // Initialize display with retries and better error handling
-  Serial.println("[INFO] Initializing TFT display...");
+  LOG_I("[INFO] Initializing TFT display...");
   bool displayReady = false;
   
   for (int retry = 0; retry < 5; retry++) {
-    Serial.print("[INFO] Display init attempt ");
-    Serial.print(retry + 1);
-    Serial.println("/5...");
+    LOG_I("[INFO] Display init attempt %d/5...", retry + 1);
     
     tft.init();
     delay(100);
@@ -160,18 +373,18 @@ void setup() {
     delay(100);
     
     displayReady = true;
-    Serial.println("[OK] Display responding");
+    LOG_I("[OK] Display responding");
     break;
   }
   
   if (!displayReady) {
-    Serial.println("[ERROR] Display initialization failed!");
-    Serial.println("[INFO] Hardware may need power cycle");
+    LOG_E("[ERROR] Display initialization failed!");
+    LOG_I("[INFO] Hardware may need power cycle");
   }
   
-  digitalWrite(TFT_BL, HIGH);  // Turn on backlight after init
+  backlightSet(BACKLIGHT_FULL);  // Turn on backlight after init
   delay(100);
-  Serial.println("[OK] Display backlight enabled");
+  LOG_I("[OK] Display backlight enabled");
   
   // Initialize touchscreen SPI bus (VSPI)
   touchscreenSpi.begin(XPT2046_CLK, XPT2046_MISO, XPT2046_MOSI, XPT2046_CS);
@@ -180,36 +393,71 @@ void setup() {
   touchAvailable = touch.begin(touchscreenSpi);
   if (touchAvailable) {
     touch.setRotation(1);  // Rotation 1 to match display landscape
-    Serial.println("[OK] XPT2046 touch initialized");
-    Serial.println("[INFO] Touch + BOOT button navigation enabled");
+    LOG_I("[OK] XPT2046 touch initialized");
+    LOG_I("[INFO] Touch + BOOT button navigation enabled");
   } else {
-    Serial.println("[WARN] Touch not detected - using BOOT button only");
+    LOG_W("[WARN] Touch not detected - using BOOT button only");
   }
   
-  // Initialize EEPROM for persistent key storage
-  EEPROM.begin(EEPROM_SIZE);
-  Serial.println("[OK] EEPROM initialized");
+  // DRBG for keys and nonces. A source that fails its health tests gets no
+  // wallet generated from it.
+  if (randomBegin(esp_fill_random)) {
+    LOG_I("[OK] RNG health tests passed");
+  } else {
+    LOG_E("[ERROR] Hardware RNG failed its health tests - halted");
+    tft.setTextColor(COLOR_DANGER, COLOR_BG);
+    tft.setCursor(10, 110);
+    tft.println("Hardware RNG failed self-test");
+    logFlush();
+    while (true) delay(1000);
+  }
+  
+  // Wallet records into RAM; the old EEPROM layout is migrated on first boot
+  KeyStoreStatus keys = keystoreBegin();
+  LOG_I("[OK] Key store: %s", keystoreStatusName(keys));
+  loadTouchCal();
+  if (!kelBegin()) LOG_W("[WARN] No key event log - rotations will fail");
   
   // Try to load existing keys, generate new ones if not found
-  if (!loadKeysFromEEPROM()) {
-    Serial.println("[WALLET] No existing keys - generating new secure wallet");
+  if (!loadKeys(keys)) {
+    LOG_I("[WALLET] No existing keys - generating new secure wallet");
     generateSecureWallets();
   }
   
+  // A wallet from before the key event log starts it at its current address
+  if (kelCount() == 0 && wallet.yadacoinAddress[0]) {
+    kelAppend(KEL_INCEPTION, coinIndex<YadaCoin>(), "", wallet.yadacoinAddress);
+  }
+  LOG_I("[OK] Key event log: %lu events", (unsigned long)kelCount());
+  
   delay(100);
-  Serial.println("[INFO] Drawing splash screen...");
+  LOG_I("[INFO] Drawing splash screen...");
   drawSplashScreen();
   delay(2000);
   
-  Serial.println("[INFO] Switching to main menu...");
-  currentScreen = SCREEN_MENU;
-  drawMainMenu();
+  LOG_I("[INFO] Switching to main menu...");
+  showScreen(SCREEN_MENU);
+  
+  jobsSetProgressHook(drawJobProgress);
+  
+  // Curve tables first: the signing worker on core 0 reads them
+  ed25519_init();
+  parallelBegin();
+  
+  // Public keys, addresses and QR codes; rebuilt in the background if stale
+  if (!derivedLoad()) submitCacheRebuild();
+  
+  if (historyBegin()) {
+    LOG_I("[OK] History: %lu records", (unsigned long)historyCount());
+  } else {
+    LOG_W("[WARN] No history partition - history disabled");
+  }
   
-  // Re-enable watchdog after initialization complete
-  enableCore0WDT();
-  enableCore1WDT();
+  // Got this far: keep this image if it came from an update
+  otaConfirmBoot();
   
-  Serial.println("[OK] Hardware wallet ready");
+  LOG_I("[OK] Hardware wallet ready");
+  logFlush();  // Boot diagnostics ahead of the banner that ends them
   Serial.println("========================================");
 }
 
@@ -217,296 +465,1321 @@ void loop() {
   handleTouch();
   handleButton();
   handleSerialCommands();
-  delay(50);
+  checkReviewTimeout();
+  traceSettle(currentScreen, jobsPending());
+  
+  // Every reply is complete by now, so queued log lines go out while the
+  // loop waits: between job slices (jobsService() hands over the port for
+  // its tick) or in the idle wait below.
+
+  // Long crypto work runs in bounded slices between input checks, at full
+  // clock even with the screen off
+  idleSetBusy(jobsPending());
+  if (jobsPending()) {
+    jobsService();
+    return;
+  }
+  
+  // Block until the next touch/button/serial event or idle deadline; a
+  // pending review polls so its timeout fires on time.
+  bool inputActive = buttonPressed || digitalRead(XPT2046_IRQ) == LOW || currentScreen == SCREEN_TX_REVIEW;
+  logUnlockSerial();
+  idleWaitForEvent(inputActive);
+  logLockSerial();
 }
 
 // ==================== USB SERIAL COMMUNICATION ====================
 
+// Ticker up to the next ':' as a coin index (coins.h), rest just past that
+// colon. rest stays nullptr without a colon; an unknown ticker is COIN_NONE.
+static int parseCoinField(const char* field, const char** rest) {
+  const char* colon = strchr(field, ':');
+  if (!colon) return COIN_NONE;
+  *rest = colon + 1;
+  return coinFind(field, colon - field);
+}
+
+// Bytes received so far of the next command; a line is only handled once
+// its newline is in, so a slow host never blocks the loop
+static char serialLine[SERIAL_LINE_MAX + 1];
+static size_t serialLineLen = 0;
+static bool serialLineTooLong = false;
+
+static bool startsWith(const char* s, const char* prefix) {
+  return strncmp(s, prefix, strlen(prefix)) == 0;
+}
+
+static bool isBlank(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// Next whole line from Serial, trimmed, or nullptr while there is none. The
+// text stays valid until the next call.
+static const char* readSerialLine() {
+  while (Serial.available() > 0) {
+    int c = Serial.read();
+    if (c < 0) break;
+    if (c != '\n') {
+      if (serialLineLen < SERIAL_LINE_MAX) {
+        serialLine[serialLineLen++] = (char)c;
+      } else {
+        serialLineTooLong = true;
+      }
+      continue;
+    }
+    size_t len = serialLineLen;
+    bool tooLong = serialLineTooLong;
+    serialLineLen = 0;
+    serialLineTooLong = false;
+    if (tooLong) {
+      Serial.println("[ERROR] Command too long");
+      continue;
+    }
+    char* line = serialLine;
+    while (len > 0 && isBlank(line[len - 1])) len--;
+    line[len] = '\0';
+    while (isBlank(*line)) line++;
+    return line;
+  }
+  return nullptr;
+}
+
 void handleSerialCommands() {
-  if (Serial.available() > 0) {
-    String command = Serial.readStringUntil('\n');
-    command.trim();
+  const char* command = readSerialLine();
+  if (command) {
+    if (*command && strcmp(command, "GET_TRACE") != 0) traceCommand(command, currentScreen, micros());
     
-    if (command.startsWith("BALANCE:")) {
-      int firstColon = command.indexOf(':');
-      int secondColon = command.indexOf(':', firstColon + 1);
+    if (startsWith(command, "BALANCE:")) {
+      // Format: BALANCE:COIN:AMOUNT | BALANCE:COIN:ASSET:AMOUNT (other Salvium assets)
+      const char* amount = nullptr;
+      int coin = parseCoinField(command + 8, &amount);
       
-      if (secondColon > 0) {
-        String coin = command.substring(firstColon + 1, secondColon);
-        float balance = command.substring(secondColon + 1).toFloat();
-        
-        if (coin == "YDA") {
-          yadacoinBalance = balance;
-          Serial.printf("[OK] YadaCoin balance updated: %.4f\n", balance);
-        } else if (coin == "SAL") {
-          salviumBalance = balance;
-          Serial.printf("[OK] Salvium balance updated: %.4f\n", balance);
-        }
-        
-        if (currentScreen == SCREEN_YADACOIN && coin == "YDA") drawYadaCoinScreen();
-        if (currentScreen == SCREEN_SALVIUM && coin == "SAL") drawSalviumScreen();
+      if (amount) {
+        const char* asset = amount;
+        const char* colon = strchr(amount, ':');
+        size_t assetLen = colon ? (size_t)(colon - asset) : 0;
+        if (colon) amount = colon + 1;
+        bool known = withCoin(coin, [&](auto c) {
+          using C = decltype(c);
+          uint32_t tag = colon ? coinTag(asset, assetLen) : C::tag;
+          int64_t atomic;
+          if ((colon && (assetLen == 0 || assetLen > COIN_TICKER_MAX)) ||
+              !amountParse(amount, C::atomicDecimals, atomic)) {
+            Serial.println("[ERROR] Invalid balance");
+            return;
+          }
+          // A zero balance frees the slot of an asset other than the coin's own
+          WalletBalance* slot = coinBalance<C>(tag, atomic != 0);
+          if (!slot && atomic != 0) {
+            Serial.println(C::assets > 1 ? "[ERROR] No room for another asset" : "[ERROR] Unknown asset");
+            return;
+          }
+          if (slot) {
+            bool own = slot == &C::balances()[0];
+            slot->asset = own || atomic != 0 ? tag : 0;
+            slot->atomic = atomic;
+          }
+          char text[AMOUNT_TEXT_MAX], ticker[COIN_TICKER_MAX + 1];
+          amountFormat(text, sizeof(text), atomic, C::atomicDecimals);
+          coinTagText(tag, ticker);
+          Serial.printf("[OK] %s balance updated: %s %s\n", C::name, text, ticker);
+          if (currentScreen == COIN_SCREENS[coinIndex<C>()].home) drawCoinScreen<C>();
+        });
+        if (!known) Serial.println("[ERROR] Unknown coin");
+      }
+    }
+    else if (strcmp(command, "GET_ADDRESSES") == 0) {
+      Serial.printf("ADDRESS:YDA:%s\n", wallet.yadacoinAddress);
+      Serial.printf("ADDRESS:SAL:%s\n", wallet.salviumAddress);
+    }
+    else if (startsWith(command, "GET_ADDRESSES:")) {
+      // Format: GET_ADDRESSES:COIN:FROM:COUNT[:ACCOUNT] (account is Salvium only)
+      const char* range = nullptr;
+      int coin = parseCoinField(command + 14, &range);
+      unsigned long from = 0, count = 0, account = 0;
+      int fields = range ? 1 + sscanf(range, "%lu:%lu:%lu", &from, &count, &account) : 0;
+      bool yda = coin == coinIndex<YadaCoin>();
+      // Salvium stops where SCAN_OUTPUTS stops recognising subaddresses
+      bool scannable = yda || (account == 0 && from + count <= SCAN_SUBADDRESSES);
+      if (coin == COIN_NONE || fields < 3 || count == 0 || count > ADDR_MAX_RANGE ||
+          from > 0xFFFFFFFFUL - count || (yda && fields > 3) || !scannable) {
+        Serial.println("ADDRESSES:BAD_REQUEST");
+      } else {
+        submitAddressJob((AddressCoin)coin, account, from, count);
       }
     }
-    else if (command == "GET_ADDRESSES") {
-      Serial.println("ADDRESS:YDA:" + yadacoinAddress);
-      Serial.println("ADDRESS:SAL:" + salviumAddress);
+    else if (strcmp(command, "GET_TRACE") == 0) {
+      // TRACE:<ms>:<kind>:<a>:<b>:<from>:<to>:<handled_us>:<done_us>:<wake>[:<command>]
+      printTrace();
+    }
+    else if (strcmp(command, "TRACE:CLEAR") == 0) {
+      traceClear();
+      Serial.println("TRACE:CLEARED");
+    }
+    else if (startsWith(command, "GET_HISTORY:")) {
+      // Format: GET_HISTORY:<from>:<count> | GET_HISTORY:DIGEST:<hex> | GET_HISTORY:DEST:<addr>[:<skip>]
+      handleHistoryQuery(command + 12);
+    }
+    else if (startsWith(command, "SET_TIME:")) {
+      // Unix time from the host, used to stamp history records
+      setUnixTime(strtoul(command + 9, nullptr, 10));
+      Serial.println("TIME:OK");
+    }
+    else if (strcmp(command, "CANCEL_JOB") == 0 || startsWith(command, "CANCEL_JOB:")) {
+      // Cancel the running job, or a queued one by id
+      int id = command[10] == ':' ? atoi(command + 11) : -1;
+      Serial.println(jobCancel(id) ? "CANCEL:OK" : "CANCEL:NOT_FOUND");
     }
-    else if (command == "PING") {
+    else if (startsWith(command, "SCAN_OUTPUTS:")) {
+      // Format: SCAN_OUTPUTS:<hex tuples, see scanner.h>
+      submitScanJob(command + 13);
+    }
+    else if (strcmp(command, "GET_KEL_ROOT") == 0) {
+      printKelRoot();
+    }
+    else if (startsWith(command, "GET_KEL_PROOF:")) {
+      // Format: GET_KEL_PROOF:<n>, n counted from 0 = inception
+      handleKelProof(command + 14);
+    }
+    else if (strcmp(command, "PING") == 0) {
       Serial.println("PONG");
     }
-    else if (command == "GET_STATUS") {
+    else if (strcmp(command, "GET_STATUS") == 0) {
       // Return wallet status
       Serial.println("STATUS:READY");
       Serial.println("DEVICE:ESP32-2432S028");
-      Serial.println("TOUCH:" + String(touchAvailable ? "YES" : "NO"));
+      Serial.printf("TOUCH:%s\n", touchAvailable ? "YES" : "NO");
+      Serial.printf("TOUCH_CAL:%s:%d\n", touchCal.stored ? "STORED" : "DEFAULT", touchCal.samples);
       Serial.printf("SCREEN:%d\n", currentScreen);
+      uint32_t glyphHits, glyphMisses;
+      fontCacheStats(glyphHits, glyphMisses);
+      Serial.printf("GLYPH_CACHE:%lu/%lu\n", (unsigned long)glyphHits, (unsigned long)glyphMisses);
+      uint32_t wakeLast, wakeMax;
+      idleWakeLatency(wakeLast, wakeMax);
+      Serial.printf("IDLE:%d\n", idleStage());
+      Serial.printf("WAKE_LATENCY_US:%lu/%lu\n", (unsigned long)wakeLast, (unsigned long)wakeMax);
+      Serial.printf("HISTORY:%lu\n", (unsigned long)historyCount());
+      int bookUsed;
+      uint32_t bookDropped;
+      historyBookStats(bookUsed, bookDropped);
+      Serial.printf("HISTORY_BOOK:%d/%d:%lu\n", bookUsed, HISTORY_BOOK_ENTRIES, (unsigned long)bookDropped);
+      Serial.printf("KEL:%lu\n", (unsigned long)kelCount());
+      uint32_t reseeds, rngBytes;
+      randomStats(reseeds, rngBytes);
+      Serial.printf("RNG:%s:%lu:%lu\n", randomHealthy() ? "OK" : "FAIL", (unsigned long)reseeds,
+                    (unsigned long)rngBytes);
+      if (reviewPending() != COIN_NONE) Serial.printf("SIGN:REVIEW:%s\n", coinTicker(reviewPending()));
+      if (otaActive()) {
+        uint32_t written, total;
+        otaProgress(written, total);
+        Serial.printf("OTA:%lu/%lu\n", (unsigned long)written, (unsigned long)total);
+      }
+    }
+    else if (strcmp(command, "TOUCH_CAL") == 0) {
+      // Calibration screen, for a panel too far off to reach it from Settings
+      startTouchCal();
+      Serial.println("TOUCH_CAL:STARTED");
+    }
+    else if (strcmp(command, "TOUCH_CAL:RESET") == 0) {
+      keystoreErase(KEY_TOUCH_CAL);
+      keystoreCommit();
+      loadTouchCal();
+      Serial.println("TOUCH_CAL:DEFAULT");
+    }
+    else if (startsWith(command, "OTA_BEGIN:")) {
+      // Format: OTA_BEGIN:<signed delta header hex, see delta.h>, replies OTA:READY once the slot is open
+      submitOtaJob(command + 10);
+    }
+    else if (startsWith(command, "OTA_CHUNK:")) {
+      // Format: OTA_CHUNK:<seq>:<hex ops>, replies OTA:ACK:<seq>:<bytes written>
+      char* hex;
+      uint32_t seq = strtoul(command + 10, &hex, 10);
+      OtaError err = *hex == ':' ? otaChunk(seq, hex + 1) : OTA_BAD_CHUNK;
+      if (err == OTA_OK) {
+        uint32_t written, total;
+        otaProgress(written, total);
+        Serial.printf("OTA:ACK:%lu:%lu\n", (unsigned long)seq, (unsigned long)written);
+      } else {
+        otaAbort();
+        Serial.printf("OTA:ERROR:%s\n", otaErrorName(err));
+      }
     }
-    else if (command.startsWith("ROTATE_KEY:")) {
+    else if (strcmp(command, "OTA_END") == 0) {
+      OtaError err = otaEnd();
+      if (err == OTA_OK) {
+        Serial.println("OTA:DONE");
+        logFlush();
+        Serial.flush();
+        delay(OTA_RESTART_DELAY_MS);
+        esp_restart();
+      }
+      Serial.printf("OTA:ERROR:%s\n", otaErrorName(err));
+    }
+    else if (strcmp(command, "OTA_ABORT") == 0) {
+      otaAbort();
+      Serial.println("OTA:ABORTED");
+    }
+    else if (startsWith(command, "ROTATE_KEY:")) {
       // Key rotation request from web wallet
       // Format: ROTATE_KEY:COIN:OLD_ADDR:NEW_ADDR
-      int firstColon = command.indexOf(':');
-      int secondColon = command.indexOf(':', firstColon + 1);
-      int thirdColon = command.indexOf(':', secondColon + 1);
+      const char* ticker = command + 11;
+      const char* oldAddr = nullptr;
+      int coin = parseCoinField(ticker, &oldAddr);
+      const char* newAddr = oldAddr ? strchr(oldAddr, ':') : nullptr;
       
-      if (thirdColon > 0) {
-        String coin = command.substring(firstColon + 1, secondColon);
-        String oldAddr = command.substring(secondColon + 1, thirdColon);
-        String newAddr = command.substring(thirdColon + 1);
+      if (newAddr) {
+        newAddr++;
+        LOG_I("[KEY_ROTATION] Coin: %.*s", (int)(oldAddr - 1 - ticker), ticker);
+        LOG_I("[KEY_ROTATION] Old: %.*s", (int)(newAddr - 1 - oldAddr), oldAddr);
+        LOG_I("[KEY_ROTATION] New: %s", newAddr);
         
-        Serial.printf("[KEY_ROTATION] Coin: %s\n", coin.c_str());
-        Serial.printf("[KEY_ROTATION] Old: %s\n", oldAddr.c_str());
-        Serial.printf("[KEY_ROTATION] New: %s\n", newAddr.c_str());
+        // Update the address and commit it to the key store, then log the
+        // one actually replaced; a rotation the log cannot record is undone
+        bool stored = false, logged = false;
+        bool known = withCoin(coin, [&](auto c) {
+          using C = decltype(c);
+          char previous[KEL_ADDR_MAX + 1];
+          snprintf(previous, sizeof(previous), "%s", C::address());
+          stored = C::setAddress(newAddr);
+          if (!stored) return;
+          keystoreWrite(C::addressRecord, newAddr, strlen(newAddr));
+          logged = keystoreCommit() && kelAppend(KEL_ROTATION, coinIndex<C>(), previous, newAddr);
+          if (logged) {
+            LOG_I("[OK] %s address rotated", C::name);
+          } else {
+            C::setAddress(previous);
+            keystoreWrite(C::addressRecord, previous, strlen(previous));
+            keystoreCommit();
+          }
+        });
         
-        // Update the address
-        if (coin == "YDA") {
-          yadacoinAddress = newAddr;
-          Serial.println("[OK] YadaCoin address rotated");
-        } else if (coin == "SAL") {
-          salviumAddress = newAddr;
-          Serial.println("[OK] Salvium address rotated");
+        if (stored && logged) {
+          Serial.println("ROTATION:SUCCESS");
+        } else {
+          if (stored) {
+            LOG_E("[ERROR] Address or key event log write failed - rotation undone");
+          } else if (known) {
+            LOG_E("[ERROR] Address too long: %u chars", (unsigned)strlen(newAddr));
+          } else {
+            LOG_E("[ERROR] Unknown coin");
+          }
+          Serial.println("ROTATION:FAILED");
         }
-        
-        Serial.println("ROTATION:SUCCESS");
       }
     }
-    else if (command.startsWith("SIGN_TX:")) {
+    else if (startsWith(command, "SIGN_TX:")) {
       // Transaction signing request
       // Format: SIGN_TX:COIN:TX_DATA
-      int firstColon = command.indexOf(':');
-      int secondColon = command.indexOf(':', firstColon + 1);
+      const char* ticker = command + 8;
+      const char* txData = nullptr;
+      int coin = parseCoinField(ticker, &txData);
       
-      if (secondColon > 0) {
-        String coin = command.substring(firstColon + 1, secondColon);
-        String txData = command.substring(secondColon + 1);
-        
-        Serial.printf("[TX_SIGN] Coin: %s\n", coin.c_str());
-        Serial.printf("[TX_SIGN] Data: %s\n", txData.c_str());
+      if (txData) {
+        LOG_I("[TX_SIGN] Coin: %.*s", (int)(txData - 1 - ticker), ticker);
+        LOG_I("[TX_SIGN] Data: %u chars", (unsigned)strlen(txData));
         
-        // TODO: Implement actual signing with private key
-        // For now, return a placeholder signature
-        Serial.println("SIGNATURE:PLACEHOLDER_SIGNATURE_" + coin);
+        submitSignJob(coin, txData);
       }
     }
   }
 }
 
+// ==================== SIGNING JOBS ====================
+//
+// SIGN_TX is parsed for review (txreview.h), loaded and submitted as a
+// background job straight away, while SCREEN_TX_REVIEW waits for an
+// answer. The result (the signer's signatures) is held in RAM and nothing
+// of it goes out until Confirm is touched, so by
+// the time the user has read the screen the signature is usually ready and
+// Confirm releases it at once. Confirming while the job still runs releases
+// it when the job ends.
+//
+// Reject, the BOOT button, leaving the screen or TX_REVIEW_TIMEOUT_MS
+// without an answer cancels the job and wipes the request and any result.
+//
+// Per coin, overloaded on the coins.h traits type: loadCoinSign (parse the
+// payload), startCoinSign (submit the job), releaseCoinSign (print the
+// signature and record it) and dropCoinSign (wipe).
+
+static int signJobId = -1;         // Job in the scheduler, or -1
+static int signCoin = COIN_NONE;   // Request being signed or held, from review to release
+static bool signReady = false;     // Result held, waiting for Confirm
+
+#define TX_REVIEW_TIMEOUT_MS 60000
+
+static TxReview review;             // Request on the review screen, or last signed
+static int reviewCoin = COIN_NONE;  // Set while the review screen waits for an answer
+static unsigned long reviewStarted = 0;
+
+// First destination of the reviewed request, for the history record
+static const char* reviewDestination() {
+  return review.outputs > 0 ? review.out[0].to : nullptr;
+}
+
+void signJobEnded(JobStatus status);
+
+// Salvium: CLSAG over every input, see signer.h for the payload layout
+JobStatus salviumSignStep(void* ctx, uint8_t* progress) {
+  switch (signerStep(progress)) {
+    case SIGNER_RUNNING:
+      return JOB_RUNNING;
+    
+    case SIGNER_FAILED:
+      LOG_W("[TX_SIGN] Failed on input %d", signerErrorInput());
+      Serial.printf("SIGN:%s\n", signerErrorName(signerError()));
+      return JOB_FAILED;
+    
+    default:
+      return JOB_DONE;
+  }
+}
+
+void salviumSignFinish(void* ctx, JobStatus status) {
+  if (status != JOB_DONE) signerClear();
+  signJobEnded(status);
+}
+
+bool loadCoinSign(Salvium, const char* txData) {
+  uint8_t spendKey[32];
+  walletSalviumSpendKey(spendKey);
+  
+  // An envelope carries the payload in "sign"; otherwise it is the request
+  const char* hex = review.signLen ? txData + review.signAt : txData;
+  size_t length = review.signLen ? review.signLen : strlen(txData);
+  SignerError err = signerLoad(hex, length, spendKey);
+  memwipe(spendKey, sizeof(spendKey));
+  if (err != SIGNER_OK) {
+    Serial.printf("SIGN:%s\n", signerErrorName(err));
+    return false;
+  }
+  return true;
+}
+
+int startCoinSign(Salvium) {
+  return jobSubmit("SIGN_TX", salviumSignStep, salviumSignFinish, nullptr, true);
+}
+
+void releaseCoinSign(Salvium) {
+  // Per input, in input order: c1 | I | D | s[0..n-1]
+  Serial.print("SIGNATURE:");
+  char hex[65];
+  for (int k = 0; k < signerInputCount(); k++) {
+    const ClsagSignature& sig = signerSignature(k);
+    const uint8_t* keys[3] = {sig.c1, sig.I, sig.D};
+    for (int j = 0; j < 3 + signerRingSize(k); j++) {
+      const uint8_t* key = j < 3 ? keys[j] : sig.s[j - 3];
+      for (int b = 0; b < 32; b++) sprintf(hex + 2 * b, "%02x", key[b]);
+      Serial.print(hex);
+    }
+  }
+  Serial.println();
+  // Split requests share the message, so only the first part is recorded
+  recordHistory(HISTORY_SIGNED, Salvium::historyCoin, signerMessage(), review.total, reviewDestination());
+}
+
+void dropCoinSign(Salvium) {
+  signerClear();
+}
+
+// YadaCoin: the device holds no YadaCoin signing key (the address is not
+// derived from one), so a request is refused before the review screen opens
+bool loadCoinSign(YadaCoin, const char*) {
+  Serial.println("SIGN:UNSUPPORTED");
+  return false;
+}
+
+int startCoinSign(YadaCoin) {
+  return -1;  // Not reached, nothing is ever loaded
+}
+
+void releaseCoinSign(YadaCoin) {}
+
+void dropCoinSign(YadaCoin) {}
+
+// Wipe the request and whatever result is held; a running job wipes its
+// own state when it finishes cancelled
+static void signClear() {
+  int coin = signCoin;
+  signCoin = COIN_NONE;
+  signReady = false;
+  if (signJobId >= 0) {
+    jobCancel(signJobId);
+  } else {
+    withCoin(coin, [](auto c) { dropCoinSign(c); });
+  }
+}
+
+static void signRelease() {
+  withCoin(signCoin, [](auto c) {
+    releaseCoinSign(c);
+    dropCoinSign(c);
+  });
+  signCoin = COIN_NONE;
+  signReady = false;
+}
+
+template <class C>
+void reviewSign(C coin, const char* txData) {
+  TxReviewError err = txReviewParse(review, txData, C::atomicDecimals);
+  if (err != TX_REVIEW_OK) {
+    Serial.printf("SIGN:%s\n", txReviewErrorName(err));
+    return;
+  }
+  if (!loadCoinSign(coin, txData)) return;
+  
+  // Signing starts now, in the background, and is held until Confirm
+  signJobId = startCoinSign(coin);
+  if (signJobId < 0) {
+    dropCoinSign(coin);
+    Serial.println("SIGN:BUSY");
+    return;
+  }
+  signCoin = reviewCoin = coinIndex<C>();
+  signReady = false;
+  reviewStarted = millis();
+  LOG_I("[TX_SIGN] Review: %u outputs, %s", review.outputs,
+                review.verified ? "checked against message" : review.details ? "as declared" : "no details");
+  Serial.println("SIGN:REVIEW");
+  showScreen(SCREEN_TX_REVIEW);
+  idleNoteInput();  // Light the screen for the answer
+}
+
+void submitSignJob(int coin, const char* txData) {
+  if (signCoin != COIN_NONE || signJobId >= 0) {
+    Serial.println("SIGN:BUSY");
+    return;
+  }
+  if (!withCoin(coin, [&](auto c) { reviewSign(c, txData); })) Serial.println("SIGN:UNKNOWN_COIN");
+}
+
+// Finish hook of both sign jobs. A job that did not complete has already
+// wiped its state; a completed one holds the result for signRelease.
+void signJobEnded(JobStatus status) {
+  signJobId = -1;
+  if (signCoin == COIN_NONE) {
+    // Rejected while running: nothing may be held
+    for (int i = 0; i < COIN_COUNT; i++) withCoin(i, [](auto c) { dropCoinSign(c); });
+    return;
+  }
+  
+  if (status == JOB_DONE) {
+    signReady = true;
+    if (reviewCoin == COIN_NONE) {
+      signRelease();  // Confirmed while the job ran
+    } else if (currentScreen == SCREEN_TX_REVIEW) {
+      drawReviewStatus();
+    }
+    return;
+  }
+  
+  // Failed (reason already printed) or cancelled over serial
+  if (status == JOB_CANCELLED) Serial.println("SIGN:CANCELLED");
+  int coin = signCoin;
+  signCoin = COIN_NONE;
+  signReady = false;
+  if (reviewCoin != COIN_NONE) {
+    reviewCoin = COIN_NONE;
+    showScreen(COIN_SCREENS[coin].home);
+  }
+}
+
+static void dropReview(const char* why) {
+  reviewCoin = COIN_NONE;
+  signClear();
+  Serial.printf("SIGN:%s\n", why);
+}
+
+void reviewLeave() {
+  if (reviewCoin != COIN_NONE) dropReview("REJECTED");
+}
+
+void answerReview(bool confirm, const char* why) {
+  int coin = reviewCoin;
+  if (coin == COIN_NONE) return;
+  LOG_I("[TX_SIGN] %s%s", confirm ? "Confirmed" : why, confirm && !signReady ? ", still signing" : "");
+  if (confirm) {
+    reviewCoin = COIN_NONE;
+    if (signReady) signRelease();
+  } else {
+    dropReview(why);
+  }
+  showScreen(COIN_SCREENS[coin].home);
+}
+
+void checkReviewTimeout() {
+  if (reviewCoin != COIN_NONE && millis() - reviewStarted >= TX_REVIEW_TIMEOUT_MS) answerReview(false, "TIMEOUT");
+}
+
+// Coin of the request waiting on the review screen, or COIN_NONE
+int reviewPending() {
+  return reviewCoin;
+}
+
+// ==================== OUTPUT SCANNING ====================
+
+static bool scanJobBusy = false;
+
+// Owned outputs as SCAN:MATCH:<n>:<key image>:<subaddress index>, then SCAN:DONE:<outputs>:<matches>
+JobStatus scanStep(void* ctx, uint8_t* progress) {
+  if (scannerStep(progress) == SCANNER_RUNNING) return JOB_RUNNING;
+  
+  int matches = 0;
+  char hex[65];
+  for (int n = 0; n < scannerOutputCount(); n++) {
+    if (!scannerIsMatch(n)) continue;
+    const uint8_t* image = scannerKeyImage(n);
+    for (int b = 0; b < 32; b++) sprintf(hex + 2 * b, "%02x", image[b]);
+    Serial.printf("SCAN:MATCH:%d:%s:%lu\n", n, hex, (unsigned long)scannerSubaddress(n));
+    recordHistory(HISTORY_RECEIVED, Salvium::historyCoin, image, 0, nullptr);
+    matches++;
+  }
+  Serial.printf("SCAN:DONE:%d:%d\n", scannerOutputCount(), matches);
+  return JOB_DONE;
+}
+
+void scanFinish(void* ctx, JobStatus status) {
+  if (status == JOB_CANCELLED) Serial.println("SCAN:CANCELLED");
+  scannerClear();
+  scanJobBusy = false;
+}
+
+void submitScanJob(const char* outputs) {
+  if (scanJobBusy) {
+    Serial.println("SCAN:BUSY");
+    return;
+  }
+  
+  uint8_t spendKey[32];
+  walletSalviumSpendKey(spendKey);
+  ScannerError err = scannerLoad(outputs, spendKey);
+  memwipe(spendKey, sizeof(spendKey));
+  if (err != SCANNER_OK) {
+    Serial.printf("SCAN:%s\n", scannerErrorName(err));
+    return;
+  }
+  
+  if (jobSubmit("SCAN", scanStep, scanFinish, nullptr) >= 0) {
+    scanJobBusy = true;
+  } else {
+    scannerClear();
+  }
+}
+
+// ==================== DERIVED DATA CACHE ====================
+
+static bool cacheJobBusy = false;
+
+JobStatus cacheStep(void* ctx, uint8_t* progress) {
+  return derivedRebuildStep(progress) == DERIVED_DONE ? JOB_DONE : JOB_RUNNING;
+}
+
+void cacheFinish(void* ctx, JobStatus status) {
+  cacheJobBusy = false;
+  if (status != JOB_DONE) return;
+  LOG_I("[CACHE] Derived data rebuilt");
+  // Receive screens drawn meanwhile encoded their QR live or had no address
+  if (currentScreen == SCREEN_YADACOIN_RECEIVE || currentScreen == SCREEN_SALVIUM_RECEIVE) drawCurrentScreen();
+}
+
+void submitCacheRebuild() {
+  derivedInvalidate();
+  if (cacheJobBusy) return;  // A queued or running rebuild starts over from the first stage
+  if (jobSubmit("CACHE", cacheStep, cacheFinish, nullptr, true) >= 0) cacheJobBusy = true;
+}
+
+// ==================== FIRMWARE UPDATES ====================
+
+static bool otaJobBusy = false;
+
+// Hash the running image, open the slot, then OTA:READY
+JobStatus otaStep(void* ctx, uint8_t* progress) {
+  if (!otaActive()) return JOB_CANCELLED;  // OTA_ABORT meanwhile
+  OtaError err = otaPrepareStep(progress);
+  if (err != OTA_OK) {
+    Serial.printf("OTA:ERROR:%s\n", otaErrorName(err));
+    return JOB_FAILED;
+  }
+  if (!otaReady()) return JOB_RUNNING;
+  Serial.printf("OTA:READY:%d\n", OTA_CHUNK_MAX);
+  return JOB_DONE;
+}
+
+void otaFinish(void* ctx, JobStatus status) {
+  if (status == JOB_CANCELLED && otaActive()) {
+    otaAbort();
+    Serial.println("OTA:ABORTED");
+  }
+  otaJobBusy = false;
+}
+
+void submitOtaJob(const char* headerHex) {
+  OtaError err = otaBegin(headerHex);
+  if (err != OTA_OK) {
+    Serial.printf("OTA:ERROR:%s\n", otaErrorName(err));
+    return;
+  }
+  if (otaJobBusy) return;  // The queued or running job prepares the new session
+  if (jobSubmit("OTA", otaStep, otaFinish, nullptr, true) >= 0) {
+    otaJobBusy = true;
+  } else {
+    otaAbort();
+    Serial.printf("OTA:ERROR:%s\n", otaErrorName(OTA_BUSY));
+  }
+}
+
+// ==================== ADDRESS RANGES ====================
+
+// GET_ADDRESSES:<coin>:<from>:<count> export, one batch in flight
+struct AddressExport {
+  AddressContext ctx;
+  uint32_t first;
+  uint32_t next;       // First index not derived yet
+  uint32_t end;
+  int emitted;         // Lines of the current batch already written
+  bool busy;
+};
+
+static AddressExport addressExport;
+
+static int formatAddressLine(char* line, size_t size, const AddressContext& ctx, int k) {
+  uint32_t index = ctx.first + (uint32_t)k;
+  if (ctx.coin == ADDR_COIN_SAL) {
+    return snprintf(line, size, "ADDRESS:SAL:%lu/%lu:%s\n", (unsigned long)ctx.account, (unsigned long)index, ctx.out[k]);
+  }
+  return snprintf(line, size, "ADDRESS:YDA:%lu:%s\n", (unsigned long)index, ctx.out[k]);
+}
+
+// Derive a batch, then write its lines only as fast as the TX buffer drains
+JobStatus addressStep(void* ctx, uint8_t* progress) {
+  AddressExport& e = addressExport;
+  
+  if (e.emitted == e.ctx.count) {
+    if (e.next == e.end) {
+      Serial.printf("ADDRESSES:DONE:%lu\n", (unsigned long)(e.end - e.first));
+      return JOB_DONE;
+    }
+    int n = e.end - e.next < ADDR_BATCH ? (int)(e.end - e.next) : ADDR_BATCH;
+    addressesDerive(e.ctx, e.next, n);
+    e.next += n;
+    e.emitted = 0;
+  }
+  
+  char line[ADDR_MAX_LEN + 40];
+  while (e.emitted < e.ctx.count) {
+    int len = formatAddressLine(line, sizeof(line), e.ctx, e.emitted);
+    if (Serial.availableForWrite() < len) break;
+    Serial.write((const uint8_t*)line, len);
+    e.emitted++;
+  }
+  
+  uint32_t written = e.next - e.first - (uint32_t)(e.ctx.count - e.emitted);
+  *progress = (uint8_t)((written * 100ULL) / (e.end - e.first));
+  return JOB_RUNNING;
+}
+
+void addressFinish(void* ctx, JobStatus status) {
+  if (status == JOB_CANCELLED) Serial.println("ADDRESSES:CANCELLED");
+  addressesEnd(addressExport.ctx);
+  addressExport.busy = false;
+}
+
+void submitAddressJob(AddressCoin coin, uint32_t account, uint32_t from, uint32_t count) {
+  AddressExport& e = addressExport;
+  if (e.busy) {
+    Serial.println("ADDRESSES:BUSY");
+    return;
+  }
+  if (!addressesBegin(e.ctx, coin, account)) {
+    Serial.println("ADDRESSES:NO_KEY");
+    return;
+  }
+  e.first = from;
+  e.next = from;
+  e.end = from + count;
+  e.emitted = 0;
+  
+  if (jobSubmit("ADDRS", addressStep, addressFinish, nullptr) >= 0) {
+    e.busy = true;
+  } else {
+    addressesEnd(e.ctx);
+  }
+}
+
+// On-screen list: a background job derives the visible rows that are not
+// cached yet, a few per step, and paints each one as it lands
+struct ListRow {
+  uint32_t index;
+  bool ready;
+  char text[ADDR_MAX_LEN + 1];
+};
+
+static ListRow listCache[LIST_CACHE_ROWS];
+static AddressContext listCtx;
+static AddressCoin listCoin = ADDR_COIN_SAL;
+static uint32_t listTop = 0;
+static bool listJobBusy = false;
+
+ListRow* listRow(uint32_t index) {
+  ListRow& r = listCache[index % LIST_CACHE_ROWS];
+  return r.ready && r.index == index ? &r : nullptr;
+}
+
+JobStatus listStep(void* ctx, uint8_t* progress) {
+  if (currentScreen != SCREEN_ADDRESS_LIST) return JOB_DONE;
+  
+  // First run of missing rows on screen, at most one per core
+  int row = 0;
+  while (row < LIST_ROWS && listRow(listTop + row)) row++;
+  if (row == LIST_ROWS) return JOB_DONE;
+  int n = 0;
+  while (row + n < LIST_ROWS && n < parallelThreads() && !listRow(listTop + row + n)) n++;
+  
+  addressesDerive(listCtx, listTop + row, n);
+  for (int k = 0; k < n; k++) {
+    uint32_t index = listTop + row + k;
+    ListRow& r = listCache[index % LIST_CACHE_ROWS];
+    r.index = index;
+    r.ready = true;
+    memcpy(r.text, listCtx.out[k], sizeof(r.text));
+    drawAddressRow(row + k);
+  }
+  *progress = (uint8_t)(((row + n) * 100) / LIST_ROWS);
+  return JOB_RUNNING;
+}
+
+void listFinish(void* ctx, JobStatus status) {
+  addressesEnd(listCtx);
+  listJobBusy = false;
+}
+
+// Start deriving the visible rows; a running job picks up a new page by itself
+void requestListRows() {
+  if (listJobBusy) return;
+  if (!addressesBegin(listCtx, listCoin, 0)) return;
+  if (jobSubmit("LIST", listStep, listFinish, nullptr, true) >= 0) {
+    listJobBusy = true;
+  } else {
+    addressesEnd(listCtx);
+  }
+}
+
+void openAddressList(AddressCoin coin) {
+  listCoin = coin;
+  showScreen(SCREEN_ADDRESS_LIST);
+  requestListRows();
+}
+
+void addressListEnter() {
+  // Row 0 is the primary address, which ROTATE_KEY may have replaced
+  memset(listCache, 0, sizeof(listCache));
+  listTop = 0;
+}
+
+// ==================== HISTORY ====================
+
+// Wall clock from SET_TIME; 0 until the host has sent it
+static uint32_t timeBase = 0;
+static unsigned long timeBaseMillis = 0;
+static bool historyJobBusy = false;
+static uint32_t historyTop = 0;  // Newest-first index of the first row on screen
+
+void setUnixTime(uint32_t now) {
+  timeBase = now;
+  timeBaseMillis = millis();
+}
+
+static uint32_t unixTime() {
+  return timeBase ? timeBase + (millis() - timeBaseMillis) / 1000 : 0;
+}
+
+// Erases the next segment a sector per step so appends never wait on it
+JobStatus historyStep(void* ctx, uint8_t* progress) {
+  return historyMaintain() ? JOB_RUNNING : JOB_DONE;
+}
+
+void historyFinish(void* ctx, JobStatus status) {
+  historyJobBusy = false;
+}
+
+// Signing the same message again (split requests, retries) or rescanning
+// an output leaves the record that is already there
+void recordHistory(HistoryKind kind, HistoryCoin coin, const uint8_t digest[32], int64_t amount, const char* destination) {
+  HistoryRecord existing;
+  if (!historyReady() || historyFindDigest(digest, existing)) return;
+  int bookUsed;
+  uint32_t droppedBefore, dropped;
+  historyBookStats(bookUsed, droppedBefore);
+  if (!historyAppend(kind, coin, digest, amount, destination, unixTime())) {
+    LOG_E("[HISTORY] Append failed");
+    return;
+  }
+  historyBookStats(bookUsed, dropped);
+  if (dropped != droppedBefore) {
+    LOG_W("[HISTORY] Address book full - destination not stored (%lu so far)", (unsigned long)dropped);
+  }
+  if (!historyJobBusy && historyMaintenancePending() &&
+      jobSubmit("HISTORY", historyStep, historyFinish, nullptr, true) >= 0) {
+    historyJobBusy = true;
+  }
+}
+
+// HISTORY:<seq>:<kind>:<coin>:<time>:<amount>:<digest>:<destination or ->
+static void printHistoryRecord(const HistoryRecord& rec) {
+  char digest[65];
+  for (int b = 0; b < 32; b++) sprintf(digest + 2 * b, "%02x", rec.digest[b]);
+  char dest[HISTORY_DEST_MAX + 1];
+  if (!historyDestination(rec.destId, dest)) strcpy(dest, "-");
+  Serial.printf("HISTORY:%lu:%s:%s:%lu:%lld:%s:%s\n", (unsigned long)rec.seq,
+                rec.kind == HISTORY_RECEIVED ? "RECEIVED" : "SIGNED", coinTicker(rec.coin),
+                (unsigned long)rec.timestamp, (long long)rec.amount, digest, dest);
+}
+
+struct DestQuery {
+  uint32_t skip;
+  int printed;
+};
+
+static bool printDestRecord(const HistoryRecord& rec, void* ctx) {
+  DestQuery* q = (DestQuery*)ctx;
+  if (q->skip > 0) {
+    q->skip--;
+    return true;
+  }
+  printHistoryRecord(rec);
+  return ++q->printed < HISTORY_PAGE_MAX;
+}
+
+void handleHistoryQuery(const char* query) {
+  if (!historyReady()) {
+    Serial.println("HISTORY:UNAVAILABLE");
+    return;
+  }
+  
+  int printed = 0;
+  if (strncmp(query, "DIGEST:", 7) == 0) {
+    uint8_t digest[32];
+    const char* hex = query + 7;
+    if (strlen(hex) != 64) {
+      Serial.println("HISTORY:BAD_REQUEST");
+      return;
+    }
+    for (int b = 0; b < 32; b++) {
+      unsigned int v;
+      if (sscanf(hex + 2 * b, "%2x", &v) != 1) {
+        Serial.println("HISTORY:BAD_REQUEST");
+        return;
+      }
+      digest[b] = (uint8_t)v;
+    }
+    HistoryRecord rec;
+    if (historyFindDigest(digest, rec)) {
+      printHistoryRecord(rec);
+      printed = 1;
+    }
+  } else if (strncmp(query, "DEST:", 5) == 0) {
+    char dest[HISTORY_DEST_MAX + 1];
+    DestQuery q = {0, 0};
+    const char* addr = query + 5;
+    const char* colon = strchr(addr, ':');
+    size_t len = colon ? (size_t)(colon - addr) : strlen(addr);
+    if (len == 0 || len > HISTORY_DEST_MAX) {
+      Serial.println("HISTORY:BAD_REQUEST");
+      return;
+    }
+    memcpy(dest, addr, len);
+    dest[len] = '\0';
+    if (colon) q.skip = strtoul(colon + 1, nullptr, 10);
+    historyFindDestination(dest, printDestRecord, &q);
+    printed = q.printed;
+  } else {
+    // Newest first: from 0 is the latest record
+    unsigned long from = 0, count = 0;
+    if (sscanf(query, "%lu:%lu", &from, &count) != 2 || count == 0 || count > HISTORY_PAGE_MAX) {
+      Serial.println("HISTORY:BAD_REQUEST");
+      return;
+    }
+    HistoryRecord rec;
+    for (unsigned long n = from; n < from + count && n < historyCount(); n++) {
+      if (!historyRead(n, rec)) continue;  // Torn by a power cut while writing
+      printHistoryRecord(rec);
+      printed++;
+    }
+  }
+  Serial.printf("HISTORY:DONE:%d\n", printed);
+}
+
+void historyEnter() {
+  historyTop = 0;
+}
+
+// ==================== KEY EVENT LOG ====================
+
+static void printHex32(const uint8_t* bytes) {
+  char hex[65];
+  for (int b = 0; b < 32; b++) sprintf(hex + 2 * b, "%02x", bytes[b]);
+  Serial.print(hex);
+}
+
+// KEL_ROOT:<count>:<root>
+void printKelRoot() {
+  Serial.printf("KEL_ROOT:%lu:", (unsigned long)kelCount());
+  printHex32(kelRoot());
+  Serial.println();
+}
+
+// KEL_PROOF:<n>:<count>:<leaf>[:<sibling>...], siblings from level 0 up.
+// Levels past the last one sent have the empty-subtree hash as sibling.
+void handleKelProof(const char* arg) {
+  char* end;
+  unsigned long n = strtoul(arg, &end, 10);
+  if (end == arg || *end) {
+    Serial.println("KEL_PROOF:BAD_REQUEST");
+    return;
+  }
+  uint8_t leaf[32];
+  uint8_t siblings[KEL_DEPTH][32];
+  KelError err = kelProof(n, leaf, siblings);
+  if (err != KEL_OK) {
+    Serial.printf("KEL_PROOF:ERROR:%s\n", kelErrorName(err));
+    return;
+  }
+  Serial.printf("KEL_PROOF:%lu:%lu:", n, (unsigned long)kelCount());
+  printHex32(leaf);
+  for (int h = 0; h < kelProofLevels(); h++) {
+    Serial.print(':');
+    printHex32(siblings[h]);
+  }
+  Serial.println();
+}
+
+// ==================== INPUT TRACE ====================
+
+// Oldest first. Touch a/b are raw panel coordinates, button a is the press
+// length in ms (0 for a press that only woke the screen), serial a is the
+// command length and the command name comes last.
+void printTrace() {
+  uint16_t count = traceCount();
+  TraceEvent ev;
+  for (uint16_t n = 0; n < count; n++) {
+    if (!traceRead(n, ev)) break;
+    Serial.printf("TRACE:%lu:%s:%d:%d:%u:%u:%lu:%lu:%u", (unsigned long)ev.ms, traceKindName(ev.kind), ev.a, ev.b,
+                  ev.from, ev.to, (unsigned long)ev.handledUs, (unsigned long)ev.doneUs, ev.wake);
+    if (ev.kind == TRACE_SERIAL) Serial.printf(":%s", ev.command);
+    Serial.println();
+  }
+  Serial.printf("TRACE:DONE:%u\n", count);
+}
+
 // ==================== TOUCH HANDLING ====================
 
 void handleTouch() {
   if (!touchAvailable) return;
   
+  // PENIRQ is low only while the panel is pressed - skip the SPI read otherwise
+  if (digitalRead(XPT2046_IRQ) == HIGH) {
+    touchWakeGuard = false;
+    return;
+  }
+  if (touchWakeGuard) return;
+  
   // Check if screen is being touched
   if (!touch.touched()) return;
   
   unsigned long now = millis();
   if (now - lastTouchTime < 800) return; // Increased debounce to 800ms for stability
   
+  uint32_t startUs = micros();
   TS_Point p = touch.getPoint();
+  bool calibrating = currentScreen == SCREEN_TOUCH_CAL;
+  int zMin = calibrating ? TOUCH_Z_FLOOR : touchCal.zMin;
   
-  // Check if touch is valid
-  if (p.x < 100 || p.x >= 4000 || p.y < 100 || p.y >= 4000 || p.z < 400 || p.z > 4000) {
+  // Light presses read noisy positions; railed axes are no contact at all
+  if (p.z < zMin || p.z > TOUCH_Z_MAX || p.x <= 0 || p.x >= TOUCH_CAL_RAW_MAX || p.y <= 0 ||
+      p.y >= TOUCH_CAL_RAW_MAX) {
     return; // Silently ignore invalid touches
   }
   
-  // Wait for touch to stabilize - take average of 5 readings
-  delay(15);
-  TS_Point p2 = touch.getPoint();
-  delay(15);
-  TS_Point p3 = touch.getPoint();
-  delay(15);
-  TS_Point p4 = touch.getPoint();
-  delay(15);
-  TS_Point p5 = touch.getPoint();
+  // Off the glass by more than the slack: noise, not an edge tap (the
+  // calibration screen takes raw points wherever they land)
+  int x, y;
+  touchCalApply(touchCal, p.x, p.y, x, y);
+  if (!calibrating && (x < -TOUCH_EDGE_SLACK || x >= 320 + TOUCH_EDGE_SLACK || y < -TOUCH_EDGE_SLACK ||
+                       y >= 240 + TOUCH_EDGE_SLACK)) {
+    return;
+  }
   
-  int avgX = (p.x + p2.x + p3.x + p4.x + p5.x) / 5;
-  int avgY = (p.y + p2.y + p3.y + p4.y + p5.y) / 5;
+  // A touch on a dark screen only wakes it
+  bool wake = idleNoteInput();
+  traceInput(TRACE_TOUCH, p.x, p.y, currentScreen, startUs, wake);
+  if (wake) {
+    touchWakeGuard = true;
+    lastTouchTime = now;
+    return;
+  }
   
-  // Map touch coordinates to screen (landscape)
-  int x = map(avgX, TOUCH_MIN_X, TOUCH_MAX_X, 0, 320);
-  int y = map(avgY, TOUCH_MIN_Y, TOUCH_MAX_Y, 0, 240);
+  // Wait for touch to stabilize - average the readings taken while still
+  // pressed (fewer once the panel is calibrated)
+  int samples = calibrating ? TOUCH_CAL_SAMPLES : touchCal.samples;
+  long sumX = p.x, sumY = p.y;
+  int taken = 1, zLow = p.z;
+  for (int i = 1; i < samples; i++) {
+    delay(15);
+    TS_Point q = touch.getPoint();
+    if (q.z < zMin) continue;
+    sumX += q.x;
+    sumY += q.y;
+    zLow = min(zLow, (int)q.z);
+    taken++;
+  }
+  int avgX = sumX / taken;
+  int avgY = sumY / taken;
+  lastTouchTime = now;
   
-  // Constrain to screen bounds
+  if (calibrating) {
+    touchCalTap(avgX, avgY, zLow);
+    return;
+  }
+  
+  // Map touch coordinates to screen (landscape)
+  touchCalApply(touchCal, avgX, avgY, x, y);
   x = constrain(x, 0, 319);
   y = constrain(y, 0, 239);
   
-  lastTouchTime = now;
-  
-  Serial.printf("[TOUCH] Raw: avgX=%d avgY=%d -> Screen: x=%d y=%d (Screen=%d)\n", avgX, avgY, x, y, currentScreen);
+  LOG_D("[TOUCH] Raw: avgX=%d avgY=%d -> Screen: x=%d y=%d (Screen=%d)", avgX, avgY, x, y, currentScreen);
   
-  // Handle touches based on current screen
-  if (currentScreen == SCREEN_MENU) {
-    // Menu buttons are at y=40, y=100, y=160 with height 55px each
-    int touchedItem = -1;
-    
-    if (y >= 40 && y < 95) {
-      touchedItem = 0;  // YadaCoin (y: 40-95)
-    } else if (y >= 100 && y < 155) {
-      touchedItem = 1;  // Salvium (y: 100-155)
-    } else if (y >= 160 && y < 215) {
-      touchedItem = 2;  // Settings (y: 160-215)
-    }
-    
-    if (touchedItem >= 0) {
-      Serial.printf("[MENU] Touch y=%d -> item %d (%s)\n", y, touchedItem, menuItems[touchedItem]);
-      
-      switch (touchedItem) {
-        case 0: 
-          Serial.println("[MENU] -> YadaCoin Wallet");
-          currentScreen = SCREEN_YADACOIN; 
-          drawYadaCoinScreen(); 
-          break;
-        case 1: 
-          Serial.println("[MENU] -> Salvium Wallet");
-          currentScreen = SCREEN_SALVIUM; 
-          drawSalviumScreen(); 
-          break;
-        case 2: 
-          Serial.println("[MENU] -> Settings");
-          currentScreen = SCREEN_SETTINGS; 
-          drawSettingsScreen(); 
-          break;
-      }
-    }
+  // CANCEL on the job progress bar takes priority over the screen below it,
+  // but only while the bar is up: background jobs (cache, list, history,
+  // the review screen's signing) have none, and the zone overlaps buttons
+  if (jobsForegroundPending() && currentScreen != SCREEN_TX_REVIEW && x >= JOB_CANCEL_X && y >= JOB_BAR_Y) {
+    LOG_D("[JOB] CANCEL touched");
+    jobCancel(-1);
+    return;
   }
-  else if (currentScreen == SCREEN_YADACOIN) {
-    // Check for back arrow touch (top-left corner)
-    if (x <= 30 && y <= 30) {
-      Serial.println("[YADACOIN] Back arrow -> Menu");
-      currentScreen = SCREEN_MENU;
-      menuSelection = 0;
-      drawMainMenu();
-      return;
-    }
-    
-    // YadaCoin wallet screen - show Receive and Send buttons
-    Serial.printf("[YADACOIN] Touch x=%d y=%d\n", x, y);
-    
-    // Buttons are at y=150-190, but with better tolerance
-    if (y >= 140 && y <= 200) {
-      if (x >= 10 && x <= 155) {
-        // Receive button (left side)
-        Serial.println("[YADACOIN] -> Receive");
-        currentScreen = SCREEN_YADACOIN_RECEIVE;
-        drawYadaCoinReceiveScreen();
+  
+  // The widget under the finger, else whatever this screen does for a
+  // touch on nothing
+  const ScreenDef& screen = SCREENS[currentScreen];
+  int hit = uiHitTest(screen.widgets, *screen.grid, x, y);
+  if (hit >= 0) {
+    const Widget& w = screen.widgets[hit];
+    LOG_D("[UI] %s: %s", screen.name, w.label ? w.label : w.kind == UI_BACK_ARROW ? "back" : "zone");
+    runAction(w.action, w.arg);
+  } else {
+    runAction(screen.elsewhere, screen.elsewhereArg);
+  }
+}
+
+// ==================== SCREEN TRANSITIONS ====================
+
+void showScreen(Screen next) {
+  const ScreenDef& from = SCREENS[currentScreen];
+  if (from.leave && next != currentScreen) from.leave();
+  currentScreen = next;
+  const ScreenDef& to = SCREENS[next];
+  if (to.enter) to.enter();
+  to.draw();
+}
+
+void drawCurrentScreen() {
+  SCREENS[currentScreen].draw();
+}
+
+void runAction(uint8_t action, uint8_t arg) {
+  switch (action) {
+    case ACT_GO:
+      LOG_D("[UI] -> %s", SCREENS[arg].name);
+      showScreen((Screen)arg);
+      break;
+    case ACT_ADDRESS_LIST:
+      openAddressList((AddressCoin)arg);
+      break;
+    case ACT_LIST_BACK:
+      showScreen(COIN_SCREENS[listCoin].receive);
+      break;
+    case ACT_LIST_PAGE:
+      if (arg && (listCoin == ADDR_COIN_YDA || listTop + 2 * LIST_ROWS <= SCAN_SUBADDRESSES)) {
+        listTop += LIST_ROWS;
+      } else if (arg) {
         return;
-      }
-      else if (x >= 165 && x <= 310) {
-        // Send button (right side)
-        Serial.println("[YADACOIN] -> Send");
-        currentScreen = SCREEN_YADACOIN_SEND;
-        drawYadaCoinSendScreen();
+      } else if (listTop >= LIST_ROWS) {
+        listTop -= LIST_ROWS;
+      } else {
         return;
       }
-    }
-    
-    // Touch elsewhere - back to menu
-    Serial.println("[YADACOIN] -> Back to menu");
-    currentScreen = SCREEN_MENU;
-    menuSelection = 0;
-    drawMainMenu();
-  }
-  else if (currentScreen == SCREEN_SALVIUM) {
-    // Check for back arrow touch (top-left corner)
-    if (x <= 30 && y <= 30) {
-      Serial.println("[SALVIUM] Back arrow -> Menu");
-      currentScreen = SCREEN_MENU;
-      menuSelection = 0;
-      drawMainMenu();
-      return;
-    }
-    
-    // Salvium wallet screen - show Receive, Send, and Export buttons
-    Serial.printf("[SALVIUM] Touch x=%d y=%d\n", x, y);
-    
-    // Three buttons: Receive (10-105), Send (112-207), Export (215-310)
-    // All at y=145-185
-    if (y >= 140 && y <= 190) {
-      if (x >= 10 && x <= 105) {
-        // Receive button (left)
-        Serial.println("[SALVIUM] -> Receive");
-        currentScreen = SCREEN_SALVIUM_RECEIVE;
-        drawSalviumReceiveScreen();
+      LOG_D("[LIST] Page at %lu", (unsigned long)listTop);
+      drawAddressListScreen();
+      requestListRows();
+      break;
+    case ACT_HISTORY_PAGE:
+      if (arg) {
+        if (historyTop + LIST_ROWS >= historyCount()) return;
+        historyTop += LIST_ROWS;
+      } else if (historyTop >= LIST_ROWS) {
+        historyTop -= LIST_ROWS;
+      } else {
         return;
       }
-      else if (x >= 112 && x <= 207) {
-        // Send button (middle)
-        Serial.println("[SALVIUM] -> Send");
-        currentScreen = SCREEN_SALVIUM_SEND;
-        drawSalviumSendScreen();
-        return;
+      LOG_D("[HISTORY] Page at %lu", (unsigned long)historyTop);
+      drawHistoryScreen();
+      break;
+    case ACT_ROTATE:
+      wallet.salviumRotation++;
+      LOG_I("[SALVIUM] Rotation incremented to %d", (int)wallet.salviumRotation);
+      // Committed by the cache rebuild or on leaving this screen, whichever
+      // comes first, so repeated taps cost one flash write
+      keystorePut(KEY_SAL_ROTATION, wallet.salviumRotation);
+      submitCacheRebuild();
+      drawSalviumExportScreen();  // Refresh to show new QR
+      break;
+    case ACT_REVIEW:
+      answerReview(arg != 0, "REJECTED");
+      break;
+  }
+}
+
+// Table-drawn parts of a screen, over whatever its draw function put down
+void drawWidgets(Screen screen) {
+  const ScreenDef& def = SCREENS[screen];
+  for (int i = 0; i < def.count; i++) {
+    const Widget& w = def.widgets[i];
+    switch (w.kind) {
+      case UI_BUTTON: {
+        tft.fillRect(w.x, w.y, w.w, w.h, w.color);
+        int tx = w.x + (w.w - fontTextWidth(FONT_SANS_16, w.label)) / 2;
+        fontDrawString(tft, FONT_SANS_16, tx, w.y + (w.h - FONT_SANS_16.lineHeight) / 2, w.label, w.text, w.color);
+        break;
       }
-      else if (x >= 215 && x <= 310) {
-        // Export button (right)
-        Serial.println("[SALVIUM] -> Export Key");
-        currentScreen = SCREEN_SALVIUM_EXPORT;
-        drawSalviumExportScreen();
-        return;
+      case UI_SMALL:
+        tft.fillRect(w.x, w.y, w.w, w.h, w.color);
+        tft.setTextSize(1);
+        tft.setTextColor(w.text, w.color);
+        tft.setCursor(w.x + (w.w - 6 * (int)strlen(w.label)) / 2, w.y + (w.h - 8) / 2);
+        tft.print(w.label);
+        break;
+      case UI_MENU_ITEM: {
+        bool selected = screen == SCREEN_MENU && i == menuSelection;
+        uint16_t bg = selected ? COLOR_SUCCESS : COLOR_BG;
+        tft.drawRect(w.x, w.y, w.w, w.h, w.color);
+        if (selected) tft.fillRect(w.x + 1, w.y + 1, w.w - 2, w.h - 2, bg);
+        fontDrawString(tft, FONT_SANS_16, w.x + 10, w.y + 18, w.label, selected ? COLOR_BG : w.text, bg);
+        break;
+      }
+      case UI_BACK_ARROW: {
+        int cy = w.y + 20;
+        tft.fillTriangle(10, cy - 5, 10, cy + 5, 5, cy, w.color);
+        tft.fillRect(10, cy - 2, 15, 4, w.color);
+        break;
       }
+      case UI_ZONE:
+        break;
     }
-    
-    // Touch elsewhere - back to menu
-    Serial.println("[SALVIUM] -> Back to menu");
-    currentScreen = SCREEN_MENU;
-    menuSelection = 0;
-    drawMainMenu();
-  }
-  else if (currentScreen == SCREEN_YADACOIN_RECEIVE || currentScreen == SCREEN_YADACOIN_SEND) {
-    // Check for back arrow or anywhere touch to return
-    Serial.println("[YADACOIN SUB] -> Back to YadaCoin wallet");
-    currentScreen = SCREEN_YADACOIN;
-    drawYadaCoinScreen();
-  }
-  else if (currentScreen == SCREEN_SALVIUM_EXPORT) {
-    // Check for rotation increment button (bottom right)
-    if (x >= 200 && x <= 310 && y >= 195 && y <= 225) {
-      salviumRotation++;
-      Serial.printf("[SALVIUM] Rotation incremented to %d\n", salviumRotation);
-      // Save rotation to EEPROM for persistence
-      EEPROM.writeInt(EEPROM_ADDR_SAL_ROT, salviumRotation);
-      EEPROM.commit();
-      Serial.println("[EEPROM] Rotation saved");
-      drawSalviumExportScreen();  // Refresh to show new QR
-      return;
+  }
+}
+
+// ==================== TOUCH CALIBRATION ====================
+
+// Three targets spread over the glass, then a check at the centre
+static const int16_t calTargets[TOUCH_CAL_TARGETS][2] = {{32, 24}, {288, 120}, {160, 216}};
+#define CAL_CHECK_X 160
+#define CAL_CHECK_Y 120
+
+static int calStep = 0;  // Target being tapped; TOUCH_CAL_TARGETS = the check
+static int16_t calRaw[TOUCH_CAL_TARGETS][2];
+static int calZ = 0;     // Lightest press seen
+static TouchCal calResult;
+static const char* calMessage = nullptr;
+
+// Stored calibration, or the min/max mapping the board shipped with
+void loadTouchCal() {
+  if (keystoreGet(KEY_TOUCH_CAL, touchCal) && touchCalValid(touchCal)) {
+    LOG_I("[TOUCH] Calibrated: %d samples, pressure >= %d", touchCal.samples, touchCal.zMin);
+    return;
+  }
+  touchCalFromRange(touchCal, TOUCH_MIN_X, TOUCH_MAX_X, TOUCH_MIN_Y, TOUCH_MAX_Y, 320, 240);
+  touchCal.zMin = TOUCH_Z_MIN;
+  touchCal.samples = TOUCH_SAMPLES_DEFAULT;
+  touchCal.stored = 0;
+}
+
+void touchCalEnter() {
+  calStep = 0;
+  calZ = TOUCH_Z_MAX;
+  calMessage = nullptr;
+}
+
+void startTouchCal() {
+  showScreen(SCREEN_TOUCH_CAL);
+}
+
+void touchCalTap(int rawX, int rawY, int z) {
+  calZ = min(calZ, z);
+  if (calStep < TOUCH_CAL_TARGETS) {
+    LOG_I("[TOUCH_CAL] Target %d: raw %d,%d z=%d", calStep, rawX, rawY, z);
+    calRaw[calStep][0] = rawX;
+    calRaw[calStep][1] = rawY;
+    if (++calStep == TOUCH_CAL_TARGETS && !touchCalSolve(calRaw, calTargets, calResult)) {
+      LOG_I("[TOUCH_CAL] Taps do not fit a panel - again");
+      calMessage = "Missed a target - try again";
+      calStep = 0;
+      calZ = TOUCH_Z_MAX;
     }
-    
-    // Touch elsewhere - back to Salvium wallet
-    Serial.println("[SALVIUM EXPORT] -> Back to Salvium wallet");
-    currentScreen = SCREEN_SALVIUM;
-    drawSalviumScreen();
+    drawTouchCalScreen();
+    return;
+  }
+  
+  // The check target shows whether the fit holds away from the taps
+  int x, y;
+  touchCalApply(calResult, rawX, rawY, x, y);
+  int error = max(abs(x - CAL_CHECK_X), abs(y - CAL_CHECK_Y));
+  LOG_I("[TOUCH_CAL] Check: %d,%d (off by %d px)", x, y, error);
+  if (error > TOUCH_CAL_VERIFY_PX) {
+    calMessage = "Check tap missed - try again";
+    calStep = 0;
+    calZ = TOUCH_Z_MAX;
+    drawTouchCalScreen();
+    return;
   }
-  else if (currentScreen == SCREEN_SALVIUM_RECEIVE || currentScreen == SCREEN_SALVIUM_SEND) {
-    // Check for back arrow or anywhere touch to return
-    Serial.println("[SALVIUM SUB] -> Back to Salvium wallet");
-    currentScreen = SCREEN_SALVIUM;
-    drawSalviumScreen();
+  
+  // Half the lightest calibration press still reads a steady position
+  calResult.zMin = constrain(calZ / 2, TOUCH_Z_FLOOR, TOUCH_Z_MIN);
+  calResult.samples = TOUCH_SAMPLES_CAL;
+  calResult.stored = 1;
+  touchCal = calResult;
+  keystorePut(KEY_TOUCH_CAL, touchCal);
+  bool saved = keystoreCommit();
+  LOG_I("[TOUCH_CAL] %s: x = %ld*rx + %ld*ry + %ld, y = %ld*rx + %ld*ry + %ld (16.16)",
+                saved ? "Stored" : "Not stored", (long)touchCal.a, (long)touchCal.b, (long)touchCal.c,
+                (long)touchCal.d, (long)touchCal.e, (long)touchCal.f);
+  showScreen(SCREEN_SETTINGS);
+}
+
+void drawTouchCalScreen() {
+  tft.fillScreen(COLOR_BG);
+  
+  bool check = calStep >= TOUCH_CAL_TARGETS;
+  int tx = check ? CAL_CHECK_X : calTargets[calStep][0];
+  int ty = check ? CAL_CHECK_Y : calTargets[calStep][1];
+  uint16_t color = check ? COLOR_SUCCESS : COLOR_PRIMARY;
+  tft.drawFastHLine(tx - 12, ty, 25, color);
+  tft.drawFastVLine(tx, ty - 12, 25, color);
+  tft.drawRect(tx - 4, ty - 4, 9, 9, color);
+  
+  tft.setTextSize(1);
+  tft.setTextColor(COLOR_TEXT, COLOR_BG);
+  tft.setCursor(60, 80);
+  if (check) {
+    tft.print("Tap the centre cross to check");
+  } else {
+    tft.printf("Tap the cross and hold (%d of %d)", calStep + 1, TOUCH_CAL_TARGETS);
   }
-  else {
-    // Settings or other screens - touch anywhere returns to menu
-    Serial.println("[OTHER] -> Back to menu");
-    currentScreen = SCREEN_MENU;
-    menuSelection = 0;
-    drawMainMenu();
+  if (calMessage) {
+    tft.setTextColor(COLOR_DANGER, COLOR_BG);
+    tft.setCursor(60, 150);
+    tft.print(calMessage);
   }
+  tft.setTextColor(COLOR_GRAY, COLOR_BG);
+  tft.setCursor(60, 165);
+  tft.print("BOOT button: cancel");
 }
 
 // ==================== BUTTON NAVIGATION ====================
@@ -515,35 +1788,45 @@ void handleButton() {
   bool currentButtonState = (digitalRead(BOOT_BUTTON) == LOW);
   unsigned long now = millis();
   
+  if (buttonWakeGuard) {
+    if (!currentButtonState) buttonWakeGuard = false;
+    return;
+  }
+  
   if (currentButtonState && !buttonPressed && (now - lastButtonPress > 200)) {
+    // A press on a dark screen only wakes it
+    if (idleNoteInput()) {
+      traceInput(TRACE_BUTTON, 0, 0, currentScreen, micros(), true);
+      buttonWakeGuard = true;
+      return;
+    }
     buttonPressed = true;
     lastButtonPress = now;
   }
   else if (!currentButtonState && buttonPressed) {
     unsigned long pressDuration = now - lastButtonPress;
     buttonPressed = false;
+    traceInput(TRACE_BUTTON, (int16_t)min(pressDuration, 30000UL), 0, currentScreen, micros());
     
-    if (pressDuration < 1000) {
+    if (currentScreen == SCREEN_TX_REVIEW) {
+      // Either press rejects; only a touch on Confirm signs
+      answerReview(false, "REJECTED");
+    } else if (pressDuration < 1000) {
       // Short press - cycle through menu or go back
       if (currentScreen == SCREEN_MENU) {
-        menuSelection = (menuSelection + 1) % menuItemCount;
+        menuSelection = (menuSelection + 1) % MENU_ITEMS;
         drawMainMenu();
-        Serial.printf("[BUTTON] Menu item %d\n", menuSelection);
+        LOG_D("[BUTTON] Menu item %d", menuSelection);
       } else {
-        currentScreen = SCREEN_MENU;
-        menuSelection = 0;
-        drawMainMenu();
-        Serial.println("[BUTTON] Back to menu");
+        showScreen(SCREEN_MENU);
+        LOG_D("[BUTTON] Back to menu");
       }
     } else {
       // Long press - enter selected item
       if (currentScreen == SCREEN_MENU) {
-        switch (menuSelection) {
-          case 0: currentScreen = SCREEN_YADACOIN; drawYadaCoinScreen(); break;
-          case 1: currentScreen = SCREEN_SALVIUM; drawSalviumScreen(); break;
-          case 2: currentScreen = SCREEN_SETTINGS; drawSettingsScreen(); break;
-        }
-        Serial.printf("[BUTTON] Entered: %s\n", menuItems[menuSelection]);
+        const Widget& item = MENU_WIDGETS[menuSelection];
+        LOG_D("[BUTTON] Entered: %s", item.label);
+        runAction(item.action, item.arg);
       }
     }
   }
@@ -552,63 +1835,33 @@ void handleButton() {
 // ==================== DISPLAY FUNCTIONS ====================
 
 void drawSplashScreen() {
-  Serial.println("[DRAW] Splash screen start");
+  LOG_D("[DRAW] Splash screen start");
   
   tft.fillScreen(COLOR_BG);
   delay(50);  // Let the fill complete
   
-  Serial.println("[DRAW] Background filled");
-  
-  tft.setTextColor(COLOR_PRIMARY, COLOR_BG);
-  tft.setTextSize(3);
-  tft.setCursor(50, 60);
-  tft.println("YadaCoin");
+  LOG_D("[DRAW] Background filled");
   
-  tft.setTextColor(COLOR_SUCCESS, COLOR_BG);
-  tft.setCursor(50, 100);
-  tft.println("Salvium");
+  fontDrawString(tft, FONT_SANS_24, 50, 60, "YadaCoin", COLOR_PRIMARY, COLOR_BG);
+  fontDrawString(tft, FONT_SANS_24, 50, 100, "Salvium", COLOR_SUCCESS, COLOR_BG);
+  fontDrawString(tft, FONT_SANS_16, 30, 160, "Hardware Wallet", COLOR_TEXT, COLOR_BG);
   
   tft.setTextColor(COLOR_TEXT, COLOR_BG);
-  tft.setTextSize(2);
-  tft.setCursor(30, 160);
-  tft.println("Hardware Wallet");
-  
   tft.setTextSize(1);
   tft.setCursor(80, 220);
   tft.println("Loading...");
   
-  Serial.println("[DRAW] Splash screen complete");
+  LOG_D("[DRAW] Splash screen complete");
 }
 
 void drawMainMenu() {
-  Serial.println("[DRAW] Main menu start");
+  LOG_D("[DRAW] Main menu start");
   
   tft.fillScreen(COLOR_BG);
-  delay(50);
   
-  tft.setTextSize(2);
-  tft.setTextColor(COLOR_PRIMARY, COLOR_BG);
-  tft.setCursor(10, 10);
-  tft.println("MAIN MENU");
+  fontDrawString(tft, FONT_SANS_16, 10, 10, "MAIN MENU", COLOR_PRIMARY, COLOR_BG);
   
-  // Draw larger menu items with borders
-  for (int i = 0; i < menuItemCount; i++) {
-    int y = 40 + (i * 60);
-    
-    // Draw border
-    tft.drawRect(10, y, 300, 55, COLOR_PRIMARY);
-    
-    if (i == menuSelection) {
-      tft.fillRect(11, y + 1, 298, 53, COLOR_SUCCESS);
-      tft.setTextColor(COLOR_BG, COLOR_SUCCESS);
-    } else {
-      tft.setTextColor(COLOR_TEXT, COLOR_BG);
-    }
-    
-    tft.setTextSize(2);
-    tft.setCursor(20, y + 18);
-    tft.println(menuItems[i]);
-  }
+  drawWidgets(SCREEN_MENU);
   
   tft.setTextSize(1);
   tft.setTextColor(COLOR_GRAY, COLOR_BG);
@@ -616,87 +1869,36 @@ void drawMainMenu() {
   tft.println("Touch item or use BOOT button");
 }
 
-void drawYadaCoinScreen() {
+template <class C>
+void drawCoinScreen() {
+  constexpr const CoinScreens& ui = COIN_SCREENS[coinIndex<C>()];
   tft.fillScreen(COLOR_BG);
   
-  tft.setTextSize(3);
-  tft.setTextColor(COLOR_WARNING, COLOR_BG);
-  tft.setCursor(20, 20);
-  tft.println("YadaCoin");
-  
-  tft.setTextSize(2);
-  tft.setTextColor(COLOR_TEXT, COLOR_BG);
-  tft.setCursor(20, 70);
-  tft.println("Balance:");
-  
-  tft.setTextSize(2);
-  tft.setTextColor(COLOR_SUCCESS, COLOR_BG);
-  tft.setCursor(20, 100);
-  if (yadacoinBalance == 0.0) {
-    tft.println("0.0000 YDA");
-  } else {
-    tft.printf("%.4f YDA", yadacoinBalance);
-  }
-  
-  // Draw Receive button
-  tft.fillRect(20, 150, 130, 40, COLOR_SUCCESS);
-  tft.setTextSize(2);
-  tft.setTextColor(COLOR_BG, COLOR_SUCCESS);
-  tft.setCursor(30, 162);
-  tft.println("Receive");
+  fontDrawString(tft, FONT_SANS_24, ui.titleX, 20, C::name, ui.titleColor, COLOR_BG);
+  fontDrawString(tft, FONT_SANS_16, 20, 70, "Balance:", COLOR_TEXT, COLOR_BG);
   
-  // Draw Send button
-  tft.fillRect(170, 150, 130, 40, COLOR_DANGER);
-  tft.setTextColor(COLOR_BG, COLOR_DANGER);
-  tft.setCursor(195, 162);
-  tft.println("Send");
+  char balanceText[AMOUNT_TEXT_MAX + COIN_TICKER_MAX + 2];
+  coinFormat<C>(balanceText, sizeof(balanceText), C::balances()[0].atomic);
+  fontDrawString(tft, FONT_SANS_16, 20, 100, balanceText, COLOR_SUCCESS, COLOR_BG);
   
+  // Other assets, exact (they can be far below the display decimals), in two
+  // small columns between the balance and the buttons
   tft.setTextSize(1);
   tft.setTextColor(COLOR_GRAY, COLOR_BG);
-  tft.setCursor(10, 220);
-  tft.println("Touch button or tap elsewhere for menu");
-}
-
-void drawSalviumScreen() {
-  tft.fillScreen(COLOR_BG);
-  
-  tft.setTextSize(3);
-  tft.setTextColor(COLOR_SUCCESS, COLOR_BG);
-  tft.setCursor(30, 20);
-  tft.println("Salvium");
-  
-  tft.setTextSize(2);
-  tft.setTextColor(COLOR_TEXT, COLOR_BG);
-  tft.setCursor(20, 70);
-  tft.println("Balance:");
-  
-  tft.setTextSize(2);
-  tft.setTextColor(COLOR_SUCCESS, COLOR_BG);
-  tft.setCursor(20, 100);
-  if (salviumBalance == 0.0) {
-    tft.println("0.000000 SAL");
-  } else {
-    tft.printf("%.6f SAL", salviumBalance);
+  int shown = 0;
+  for (int i = 1; i < C::assets; i++) {
+    const WalletBalance& b = C::balances()[i];
+    if (!b.asset) continue;
+    char ticker[COIN_TICKER_MAX + 1];
+    coinTagText(b.asset, ticker);
+    int len = amountFormat(balanceText, sizeof(balanceText), b.atomic, C::atomicDecimals);
+    snprintf(balanceText + len, sizeof(balanceText) - len, " %s", ticker);
+    tft.setCursor(20 + (shown % 2) * 150, 122 + (shown / 2) * 11);
+    tft.print(balanceText);
+    shown++;
   }
   
-  // Draw Receive button
-  tft.fillRect(10, 145, 95, 40, COLOR_SUCCESS);
-  tft.setTextSize(2);
-  tft.setTextColor(COLOR_BG, COLOR_SUCCESS);
-  tft.setCursor(15, 157);
-  tft.println("Receive");
-  
-  // Draw Send button
-  tft.fillRect(112, 145, 95, 40, COLOR_DANGER);
-  tft.setTextColor(COLOR_BG, COLOR_DANGER);
-  tft.setCursor(127, 157);
-  tft.println("Send");
-  
-  // Draw Export button
-  tft.fillRect(215, 145, 95, 40, COLOR_WARNING);
-  tft.setTextColor(COLOR_BG, COLOR_WARNING);
-  tft.setCursor(220, 157);
-  tft.println("Export");
+  drawWidgets(ui.home);
   
   tft.setTextSize(1);
   tft.setTextColor(COLOR_GRAY, COLOR_BG);
@@ -704,62 +1906,57 @@ void drawSalviumScreen() {
   tft.println("Touch button or tap elsewhere for menu");
 }
 
-void drawYadaCoinReceiveScreen() {
+template <class C>
+void drawReceiveScreen() {
+  constexpr const CoinScreens& ui = COIN_SCREENS[coinIndex<C>()];
+  const char* address = C::address();
   tft.fillScreen(COLOR_BG);
   
-  // Back arrow
-  tft.fillTriangle(10, 15, 10, 25, 5, 20, COLOR_TEXT);
-  tft.fillRect(10, 18, 15, 4, COLOR_TEXT);
-  
-  tft.setTextSize(2);
-  tft.setTextColor(COLOR_SUCCESS, COLOR_BG);
-  tft.setCursor(35, 10);
-  tft.println("Receive YadaCoin");
+  drawWidgets(ui.receive);
+  char title[32];
+  snprintf(title, sizeof(title), "Receive %s", C::name);
+  fontDrawString(tft, FONT_SANS_16, ui.receiveX, 10, title, COLOR_SUCCESS, COLOR_BG);
   
   tft.setTextSize(1);
   tft.setTextColor(COLOR_TEXT, COLOR_BG);
   tft.setCursor(10, 40);
   tft.println("Address:");
   
+  // Rows of 50 chars (300 px): three for a 99-char Salvium address
   tft.setTextColor(COLOR_PRIMARY, COLOR_BG);
-  tft.setCursor(5, 55);
-  tft.println(yadacoinAddress.substring(0, 32));
-  tft.setCursor(5, 70);
-  tft.println(yadacoinAddress.substring(32));
+  size_t len = strlen(address);
+  for (size_t at = 0, y = 52; at < len; at += 50, y += 10) {
+    tft.setCursor(5, y);
+    tft.printf("%.50s", address + at);
+  }
   
   // Generate and display QR code - larger for better scanning
-  if (yadacoinAddress.length() > 0) {
-    QRCode qrcode;
-    uint8_t qrcodeData[qrcode_getBufferSize(5)];  // Version 5 for 67 char addresses
-    int result = qrcode_initText(&qrcode, qrcodeData, 5, ECC_LOW, yadacoinAddress.c_str());
-    
-    if (result != 0) {
-      Serial.printf("[ERROR] QR code generation failed: %d\n", result);
-      Serial.printf("[ERROR] Address length: %d chars\n", yadacoinAddress.length());
-      tft.setCursor(50, 120);
-      tft.setTextColor(COLOR_DANGER, COLOR_BG);
-      tft.println("QR Generation Failed");
-      return;
+  if (address[0] != '\0') {
+    // Cached bitmap when the cache holds this address, else encode it now
+    QrBitmap live;
+    const QrBitmap* qr = derivedQr(C::qr, address);
+    if (!qr) {
+      if (!qrEncode(live, address, C::qrVersion)) {
+        LOG_E("[ERROR] QR code generation failed");
+        LOG_E("[ERROR] Address length: %u chars", (unsigned)strlen(address));
+        tft.setCursor(50, 120);
+        tft.setTextColor(COLOR_DANGER, COLOR_BG);
+        tft.println("QR Generation Failed");
+        return;
+      }
+      qr = &live;
+      LOG_D("[OK] QR code generated: v%d, %dx%d modules", C::qrVersion, live.size, live.size);
     }
     
-    Serial.printf("[OK] QR code generated: v%d, %dx%d modules\n", 5, qrcode.size, qrcode.size);
-    
-    // QR code centered on screen - v5 has 37 modules
-    int scale = 3;  // Scale 3 gives 111px (37*3), fits well on screen
-    int qrSize = qrcode.size * scale;
+    // QR code centered on screen - v5 has 37 modules, v6 41
+    int scale = 3;  // Scale 3 gives 111-123px, fits well on screen
+    int qrSize = qr->size * scale;
     int qrX = (320 - qrSize) / 2;      // Center horizontally
     int qrY = 90;                       // Position below address
     
     // Draw white background with border
     tft.fillRect(qrX - 5, qrY - 5, qrSize + 10, qrSize + 10, TFT_WHITE);
-    
-    // Draw QR code with better contrast
-    for (uint8_t y = 0; y < qrcode.size; y++) {
-      for (uint8_t x = 0; x < qrcode.size; x++) {
-        uint16_t color = qrcode_getModule(&qrcode, x, y) ? TFT_BLACK : TFT_WHITE;
-        tft.fillRect(qrX + (x * scale), qrY + (y * scale), scale, scale, color);
-      }
-    }
+    drawQrBitmap(*qr, qrX, qrY, scale);
   } else {
     tft.drawRect(90, 90, 140, 140, COLOR_PRIMARY);
     tft.setCursor(110, 155);
@@ -771,17 +1968,15 @@ void drawYadaCoinReceiveScreen() {
   tft.println("Touch anywhere to return");
 }
 
-void drawYadaCoinSendScreen() {
+template <class C>
+void drawSendScreen() {
+  constexpr const CoinScreens& ui = COIN_SCREENS[coinIndex<C>()];
   tft.fillScreen(COLOR_BG);
   
-  // Back arrow
-  tft.fillTriangle(10, 25, 10, 35, 5, 30, COLOR_TEXT);
-  tft.fillRect(10, 28, 15, 4, COLOR_TEXT);
-  
-  tft.setTextSize(2);
-  tft.setTextColor(COLOR_DANGER, COLOR_BG);
-  tft.setCursor(45, 20);
-  tft.println("Send YadaCoin");
+  drawWidgets(ui.send);
+  char title[32];
+  snprintf(title, sizeof(title), "Send %s", C::name);
+  fontDrawString(tft, FONT_SANS_16, ui.sendX, 20, title, COLOR_DANGER, COLOR_BG);
   
   tft.setTextSize(1);
   tft.setTextColor(COLOR_TEXT, COLOR_BG);
@@ -804,117 +1999,108 @@ void drawYadaCoinSendScreen() {
   tft.println("Touch anywhere to return");
 }
 
-void drawSalviumReceiveScreen() {
-  tft.fillScreen(COLOR_BG);
-  
-  // Back arrow
-  tft.fillTriangle(10, 15, 10, 25, 5, 20, COLOR_TEXT);
-  tft.fillRect(10, 18, 15, 4, COLOR_TEXT);
-  
-  tft.setTextSize(2);
-  tft.setTextColor(COLOR_SUCCESS, COLOR_BG);
-  tft.setCursor(45, 10);
-  tft.println("Receive Salvium");
+// "1.25 SAL" from atomic units
+template <class C>
+void formatAtomic(char* out, size_t size, int64_t atomic) {
+  int n = amountFormat(out, size, atomic, C::atomicDecimals);
+  if (n > 0 && (size_t)n < size) snprintf(out + n, size - n, " %s", C::ticker);
+}
+
+template <class C>
+void drawReview() {
+  char title[32], amount[40];
+  snprintf(title, sizeof(title), "Send %s?", C::name);
+  fontDrawString(tft, FONT_SANS_16, 10, 5, title, COLOR_WARNING, COLOR_BG);
   
   tft.setTextSize(1);
-  tft.setTextColor(COLOR_TEXT, COLOR_BG);
-  tft.setCursor(10, 40);
-  tft.println("Address:");
-  
-  tft.setTextColor(COLOR_PRIMARY, COLOR_BG);
-  tft.setCursor(5, 55);
-  tft.println(salviumAddress.substring(0, 32));
-  tft.setCursor(5, 70);
-  tft.println(salviumAddress.substring(32));
+  int y = 32;
+  if (!review.details) {
+    tft.setTextColor(COLOR_WARNING, COLOR_BG);
+    tft.setCursor(10, y);
+    tft.println("No transaction details in request");
+    tft.setTextColor(COLOR_GRAY, COLOR_BG);
+    tft.setCursor(10, y + 14);
+    tft.printf("%u bytes - check them on the host", (unsigned)review.length);
+    return;
+  }
   
-  // Generate and display QR code - larger for better scanning
-  if (salviumAddress.length() > 0) {
-    QRCode qrcode;
-    uint8_t qrcodeData[qrcode_getBufferSize(6)];  // Version 6 for 95 char addresses
-    int result = qrcode_initText(&qrcode, qrcodeData, 6, ECC_LOW, salviumAddress.c_str());
-    
-    if (result != 0) {
-      Serial.printf("[ERROR] QR code generation failed: %d\n", result);
-      Serial.printf("[ERROR] Address length: %d chars\n", salviumAddress.length());
-      tft.setCursor(50, 120);
-      tft.setTextColor(COLOR_DANGER, COLOR_BG);
-      tft.println("QR Generation Failed");
-      return;
-    }
-    
-    Serial.printf("[OK] QR code generated: v%d, %dx%d modules\n", 6, qrcode.size, qrcode.size);
-    
-    // QR code centered on screen - v6 has 41 modules
-    int scale = 3;  // Scale 3 gives 123px (41*3), fits well on screen
-    int qrSize = qrcode.size * scale;
-    int qrX = (320 - qrSize) / 2;      // Center horizontally
-    int qrY = 90;                       // Position below address
-    
-    // Draw white background with border
-    tft.fillRect(qrX - 5, qrY - 5, qrSize + 10, qrSize + 10, TFT_WHITE);
-    
-    // Draw QR code with better contrast
-    for (uint8_t y = 0; y < qrcode.size; y++) {
-      for (uint8_t x = 0; x < qrcode.size; x++) {
-        uint16_t color = qrcode_getModule(&qrcode, x, y) ? TFT_BLACK : TFT_WHITE;
-        tft.fillRect(qrX + (x * scale), qrY + (y * scale), scale, scale, color);
-      }
+  int shown = review.outputs < TX_REVIEW_OUTPUTS ? review.outputs : TX_REVIEW_OUTPUTS;
+  for (int i = 0; i < shown; i++, y += 28) {
+    const TxOutput& o = review.out[i];
+    size_t len = strlen(o.to);
+    tft.setCursor(10, y);
+    tft.setTextColor(COLOR_GRAY, COLOR_BG);
+    tft.print("To ");
+    tft.setTextColor(COLOR_PRIMARY, COLOR_BG);
+    if (len > 40) {
+      tft.printf("%.24s...%s", o.to, o.to + len - 12);
+    } else {
+      tft.print(o.to);
     }
-  } else {
-    tft.drawRect(90, 90, 140, 140, COLOR_PRIMARY);
-    tft.setCursor(110, 155);
-    tft.println("No Address");
+    formatAtomic<C>(amount, sizeof(amount), o.amount);
+    tft.setCursor(28, y + 12);
+    tft.setTextColor(COLOR_TEXT, COLOR_BG);
+    tft.print(amount);
+  }
+  if (review.outputs > shown) {
+    tft.setCursor(10, y);
+    tft.setTextColor(COLOR_GRAY, COLOR_BG);
+    tft.printf("+%u more outputs", (unsigned)(review.outputs - shown));
+    y += 14;
   }
   
-  tft.setTextColor(COLOR_GRAY, COLOR_BG);
-  tft.setCursor(10, 225);
-  tft.println("Touch anywhere to return");
+  formatAtomic<C>(amount, sizeof(amount), review.total);
+  tft.setCursor(10, y);
+  tft.setTextColor(COLOR_SUCCESS, COLOR_BG);
+  tft.printf("Total %s", amount);
+  tft.setCursor(10, y + 12);
+  tft.setTextColor(COLOR_TEXT, COLOR_BG);
+  if (review.hasFee) {
+    formatAtomic<C>(amount, sizeof(amount), review.fee);
+    tft.printf("Fee   %s", amount);
+  } else {
+    tft.print("Fee   not stated");
+  }
+  y += 26;
+  if (review.unlockTime) {
+    tft.setCursor(10, y);
+    tft.setTextColor(COLOR_DANGER, COLOR_BG);
+    tft.printf("Locked until %llu", (unsigned long long)review.unlockTime);
+    y += 12;
+  }
+  tft.setCursor(10, y);
+  tft.setTextColor(review.verified ? COLOR_SUCCESS : COLOR_GRAY, COLOR_BG);
+  tft.print(review.verified ? "Fee and lock match the signed hash" : "Destinations as sent by the host");
 }
 
-void drawSalviumSendScreen() {
+void drawTxReviewScreen() {
   tft.fillScreen(COLOR_BG);
-  
-  // Back arrow
-  tft.fillTriangle(10, 25, 10, 35, 5, 30, COLOR_TEXT);
-  tft.fillRect(10, 28, 15, 4, COLOR_TEXT);
-  
-  tft.setTextSize(2);
-  tft.setTextColor(COLOR_DANGER, COLOR_BG);
-  tft.setCursor(60, 20);
-  tft.println("Send Salvium");
-  
+  withCoin(reviewCoin, [](auto c) { drawReview<decltype(c)>(); });
+  drawReviewStatus();
+  drawWidgets(SCREEN_TX_REVIEW);
+}
+
+// Top right: whether Confirm will release a signature at once
+void drawReviewStatus() {
   tft.setTextSize(1);
-  tft.setTextColor(COLOR_TEXT, COLOR_BG);
-  tft.setCursor(20, 80);
-  tft.println("Connect to web wallet via USB");
-  tft.setCursor(20, 100);
-  tft.println("to send transactions");
-  
-  tft.setCursor(20, 140);
-  tft.println("Web wallet will:");
-  tft.setCursor(30, 160);
-  tft.println("- Request transaction details");
-  tft.setCursor(30, 175);
-  tft.println("- Hardware wallet signs");
-  tft.setCursor(30, 190);
-  tft.println("- Transaction sent securely");
-  
-  tft.setTextColor(COLOR_GRAY, COLOR_BG);
-  tft.setCursor(10, 220);
-  tft.println("Touch anywhere to return");
+  tft.setTextColor(signReady ? COLOR_SUCCESS : COLOR_GRAY, COLOR_BG);
+  tft.setCursor(250, 10);
+  tft.print(signReady ? "Ready     " : "Signing...");
+}
+
+// Dark modules only; the caller paints the white background. One fillRect
+// (one address window) per run of dark modules rather than per module.
+void drawQrBitmap(const QrBitmap& qr, int x, int y, int scale) {
+  qrForEachRun(qr, [&](int mx, int my, int len) {
+    tft.fillRect(x + mx * scale, y + my * scale, len * scale, scale, TFT_BLACK);
+  });
 }
 
 void drawSalviumExportScreen() {
   tft.fillScreen(COLOR_BG);
   
-  // Back arrow
-  tft.fillTriangle(10, 15, 10, 25, 5, 20, COLOR_TEXT);
-  tft.fillRect(10, 18, 15, 4, COLOR_TEXT);
-  
-  tft.setTextSize(2);
-  tft.setTextColor(COLOR_WARNING, COLOR_BG);
-  tft.setCursor(25, 10);
-  tft.println("Export Wallet Key");
+  drawWidgets(SCREEN_SALVIUM_EXPORT);
+  fontDrawString(tft, FONT_SANS_16, 25, 10, "Export Wallet Key", COLOR_WARNING, COLOR_BG);
   
   tft.setTextSize(1);
   tft.setTextColor(COLOR_DANGER, COLOR_BG);
@@ -931,71 +2117,100 @@ void drawSalviumExportScreen() {
   tft.println("Scan to import to web wallet:");
   
   // Format: privateSpendKey|rotation|blockchain
-  String exportData = salviumPrivateSpendKey + "|" + String(salviumRotation) + "|sal";
+  char spendHex[WALLET_KEY_HEX_LEN + 1];
+  char exportData[WALLET_KEY_HEX_LEN + 20];
+  walletSalviumSpendHex(spendHex);
+  int exportLen = snprintf(exportData, sizeof(exportData), "%s|%d|sal", spendHex, (int)wallet.salviumRotation);
+  memwipe(spendHex, sizeof(spendHex));
   
-  Serial.println("[EXPORT] QR data: " + exportData);
-  Serial.printf("[EXPORT] Length: %d chars\n", exportData.length());
+  // Never echo the key itself to the serial log
+  LOG_D("[EXPORT] Length: %d chars", exportLen);
   
   // Generate and display QR code
-  if (exportData.length() > 0) {
-    QRCode qrcode;
+  {
     // Private key (64 hex) + "|0|sal" = ~70 chars, use version 5
-    uint8_t qrcodeData[qrcode_getBufferSize(5)];
-    int result = qrcode_initText(&qrcode, qrcodeData, 5, ECC_LOW, exportData.c_str());
+    QrBitmap qr;
+    bool encoded = qrEncode(qr, exportData, 5);
+    memwipe(exportData, sizeof(exportData));
     
-    if (result != 0) {
-      Serial.printf("[ERROR] Export QR generation failed: %d\n", result);
+    if (!encoded) {
+      LOG_E("[ERROR] Export QR generation failed");
       tft.setCursor(50, 120);
       tft.setTextColor(COLOR_DANGER, COLOR_BG);
       tft.println("QR Generation Failed");
       return;
     }
     
-    Serial.printf("[OK] Export QR: v%d, %dx%d modules\n", 5, qrcode.size, qrcode.size);
+    LOG_D("[OK] Export QR: v%d, %dx%d modules", 5, qr.size, qr.size);
     
     // QR code centered - v5 has 37 modules
     int scale = 3;  // Scale 3 gives 111px (37*3)
-    int qrSize = qrcode.size * scale;
+    int qrSize = qr.size * scale;
     int qrX = (320 - qrSize) / 2;
     int qrY = 75;
     
     // Draw white background with red warning border
     tft.fillRect(qrX - 5, qrY - 5, qrSize + 10, qrSize + 10, COLOR_DANGER);
     tft.fillRect(qrX - 3, qrY - 3, qrSize + 6, qrSize + 6, TFT_WHITE);
-    
-    // Draw QR code
-    for (uint8_t y = 0; y < qrcode.size; y++) {
-      for (uint8_t x = 0; x < qrcode.size; x++) {
-        uint16_t color = qrcode_getModule(&qrcode, x, y) ? TFT_BLACK : TFT_WHITE;
-        tft.fillRect(qrX + (x * scale), qrY + (y * scale), scale, scale, color);
-      }
-    }
+    drawQrBitmap(qr, qrX, qrY, scale);
+    memwipe(&qr, sizeof(qr));
   }
   
   // Rotation controls at bottom
   tft.setTextColor(COLOR_WARNING, COLOR_BG);
   tft.setCursor(5, 195);
-  tft.printf("Rotation: %d", salviumRotation);
-  
-  // Increment rotation button
-  tft.fillRect(200, 195, 110, 30, COLOR_SUCCESS);
-  tft.setTextSize(1);
-  tft.setTextColor(COLOR_BG, COLOR_SUCCESS);
-  tft.setCursor(215, 205);
-  tft.println("[+] Next Key");
+  tft.printf("Rotation: %d", (int)wallet.salviumRotation);
   
   tft.setTextColor(COLOR_GRAY, COLOR_BG);
   tft.setCursor(5, 225);
   tft.println("Touch [+] to rotate, or back to return");
 }
 
+// Only visible rows are drawn; rows not derived yet show a placeholder
+void drawAddressListScreen() {
+  tft.fillScreen(COLOR_BG);
+  
+  drawWidgets(SCREEN_ADDRESS_LIST);
+  char title[32];
+  snprintf(title, sizeof(title), "%s Addresses", coinName(listCoin));
+  fontDrawString(tft, FONT_SANS_16, 35, 10, title, COLOR_SUCCESS, COLOR_BG);
+  
+  for (int row = 0; row < LIST_ROWS; row++) drawAddressRow(row);
+  
+  tft.setTextSize(1);
+  tft.setTextColor(COLOR_GRAY, COLOR_BG);
+  tft.setCursor(10, 225);
+  tft.println("Top half: prev page  Bottom: next page");
+}
+
+void drawAddressRow(int row) {
+  uint32_t index = listTop + row;
+  int y = LIST_Y + row * LIST_ROW_H;
+  ListRow* r = listRow(index);
+  
+  tft.fillRect(0, y, 320, LIST_ROW_H - 1, COLOR_BG);
+  tft.setTextSize(1);
+  tft.setCursor(5, y + 6);
+  tft.setTextColor(COLOR_GRAY, COLOR_BG);
+  if (listCoin == ADDR_COIN_SAL) {
+    tft.printf("0/%-5lu ", (unsigned long)index);
+  } else {
+    tft.printf("%-7lu ", (unsigned long)index);
+  }
+  if (r) {
+    size_t len = strlen(r->text);
+    tft.setTextColor(COLOR_PRIMARY, COLOR_BG);
+    tft.printf("%.24s...%s", r->text, len > 8 ? r->text + len - 8 : "");
+  } else {
+    tft.print("deriving...");
+  }
+  tft.drawFastHLine(0, y + LIST_ROW_H - 1, 320, COLOR_BUTTON);
+}
+
 void drawSettingsScreen() {
   tft.fillScreen(COLOR_BG);
   
-  tft.setTextSize(2);
-  tft.setTextColor(COLOR_PRIMARY, COLOR_BG);
-  tft.setCursor(40, 10);
-  tft.println("SETTINGS");
+  fontDrawString(tft, FONT_SANS_16, 40, 10, "SETTINGS", COLOR_PRIMARY, COLOR_BG);
   
   tft.setTextSize(1);
   tft.setTextColor(COLOR_TEXT, COLOR_BG);
@@ -1021,128 +2236,211 @@ void drawSettingsScreen() {
   tft.setCursor(20, 185);
   tft.println("- QR code generation");
   
+  drawWidgets(SCREEN_SETTINGS);
+  
   tft.setTextColor(COLOR_GRAY, COLOR_BG);
   tft.setCursor(10, 220);
   tft.println("Touch to return to menu");
 }
 
-// ==================== WALLET FUNCTIONS ====================
+// Newest first, read straight from flash a page at a time
+void drawHistoryScreen() {
+  tft.fillScreen(COLOR_BG);
+  
+  drawWidgets(SCREEN_HISTORY);
+  fontDrawString(tft, FONT_SANS_16, 35, 10, "History", COLOR_PRIMARY, COLOR_BG);
+  
+  tft.setTextSize(1);
+  tft.setTextColor(COLOR_GRAY, COLOR_BG);
+  tft.setCursor(LIST_BUTTON_X - 30, 14);
+  tft.printf("%lu total", (unsigned long)historyCount());
+  
+  for (int row = 0; row < LIST_ROWS; row++) drawHistoryRow(row);
+  
+  tft.setTextColor(COLOR_GRAY, COLOR_BG);
+  tft.setCursor(10, 225);
+  tft.println("Top half: newer  Bottom: older");
+}
 
-void saveKeysToEEPROM() {
-  Serial.println("[EEPROM] Saving keys...");
+void drawHistoryRow(int row) {
+  uint32_t n = historyTop + row;
+  int y = LIST_Y + row * LIST_ROW_H;
   
-  // Write magic number
-  EEPROM.writeUShort(EEPROM_ADDR_MAGIC, EEPROM_MAGIC);
+  tft.fillRect(0, y, 320, LIST_ROW_H - 1, COLOR_BG);
+  if (n >= historyCount()) return;
   
-  // Save YadaCoin address (64 hex chars without "YDA" prefix)
-  String yadaKey = yadacoinAddress.substring(3);
-  for (int i = 0; i < 64 && i < yadaKey.length(); i++) {
-    EEPROM.write(EEPROM_ADDR_YDA_KEY + i, yadaKey[i]);
+  tft.setTextSize(1);
+  tft.setCursor(5, y + 6);
+  HistoryRecord rec;
+  if (!historyRead(n, rec)) {
+    tft.setTextColor(COLOR_DANGER, COLOR_BG);
+    tft.print("(damaged record)");
+  } else {
+    bool received = rec.kind == HISTORY_RECEIVED;
+    tft.setTextColor(COLOR_GRAY, COLOR_BG);
+    tft.printf("%-6lu ", (unsigned long)rec.seq);
+    tft.setTextColor(received ? COLOR_SUCCESS : COLOR_WARNING, COLOR_BG);
+    tft.printf("%s %s ", received ? "RECV" : "SIGN", coinTicker(rec.coin));
+    tft.setTextColor(COLOR_PRIMARY, COLOR_BG);
+    for (int b = 0; b < 8; b++) tft.printf("%02x", rec.digest[b]);
+    if (rec.amount != 0) {
+      char amount[AMOUNT_TEXT_MAX + COIN_TICKER_MAX + 2];
+      bool known = withCoin(rec.coin, [&](auto c) { coinFormat<decltype(c)>(amount, sizeof(amount), rec.amount); });
+      tft.setTextColor(COLOR_TEXT, COLOR_BG);
+      tft.printf(" %s", known ? amount : "?");
+    }
   }
-  
-  // Save Salvium private spend key (64 hex chars)
-  for (int i = 0; i < 64 && i < salviumPrivateSpendKey.length(); i++) {
-    EEPROM.write(EEPROM_ADDR_SAL_KEY + i, salviumPrivateSpendKey[i]);
+  tft.drawFastHLine(0, y + LIST_ROW_H - 1, 320, COLOR_BUTTON);
+}
+
+#ifndef ARDUINO
+// Simulator golden images (host/sim --screens): make Screen n current the way
+// the UI opens it, without counting on what it draws. Returns the screen's
+// name, or nullptr past the last one.
+const char* simSelectScreen(int n) {
+  if (n < 0 || n >= SCREEN_COUNT) return nullptr;
+  if (n == SCREEN_ADDRESS_LIST) listCoin = ADDR_COIN_SAL;
+  if (n == SCREEN_SALVIUM) {
+    wallet.salviumBalances[0] = {Salvium::tag, 123456789012};
+    wallet.salviumBalances[1] = {coinTag("SAL1", 4), 2500000000};
+    wallet.salviumBalances[2] = {coinTag("VSD", 3), 50};
+  }
+  if (n == SCREEN_TX_REVIEW) {
+    txReviewParse(review, "{\"fee\":0.001,\"outputs\":[{\"to\":\"1HqLEMkRnJbvWtkdDZQ4bV5RCzLyLPQmEo\","
+                          "\"value\":12.5},{\"to\":\"1BvBMSEYstWetqTFn5Au4m4GFg7xJaNVN2\",\"value\":0.75}]}",
+                  YadaCoin::atomicDecimals);
+    reviewCoin = coinIndex<YadaCoin>();
+  }
+  currentScreen = (Screen)n;
+  if (SCREENS[n].enter) SCREENS[n].enter();
+  return SCREENS[n].name;
+}
+
+// Simulator --confirm: tap Confirm on a request under review, as someone at
+// the panel would, so host tools can sign without a person
+void simConfirmReview() {
+  if (reviewCoin != COIN_NONE) answerReview(true, "");
+}
+#endif
+
+// Progress bar overlay along the bottom edge while a job runs
+void drawJobProgress(int id, const char* name, uint8_t progress) {
+  static int shownId = -1;
+  
+  if (!name) {
+    // Queue drained - restore the screen under the overlay
+    shownId = -1;
+    drawCurrentScreen();
+    return;
   }
   
-  // Save rotation counter
-  EEPROM.writeInt(EEPROM_ADDR_SAL_ROT, salviumRotation);
+  if (id != shownId) {
+    shownId = id;
+    tft.fillRect(0, JOB_BAR_Y, 320, 240 - JOB_BAR_Y, COLOR_BUTTON);
+    tft.setTextSize(1);
+    tft.setTextColor(COLOR_TEXT, COLOR_BUTTON);
+    tft.setCursor(5, JOB_BAR_Y + 4);
+    tft.println(name);
+    tft.drawRect(5, JOB_BAR_Y + 16, 222, 16, COLOR_TEXT);
+    
+    tft.fillRect(JOB_CANCEL_X, JOB_BAR_Y + 5, 315 - JOB_CANCEL_X, 30, COLOR_DANGER);
+    tft.setTextColor(COLOR_BG, COLOR_DANGER);
+    tft.setCursor(JOB_CANCEL_X + 22, JOB_BAR_Y + 16);
+    tft.println("CANCEL");
+  }
   
-  EEPROM.commit();
-  Serial.println("[OK] Keys saved to EEPROM");
+  // Bar only grows, so repaint the filled part without clearing
+  tft.fillRect(6, JOB_BAR_Y + 17, (220 * progress) / 100, 14, COLOR_SUCCESS);
 }
 
-bool loadKeysFromEEPROM() {
-  uint16_t magic = EEPROM.readUShort(EEPROM_ADDR_MAGIC);
-  
-  if (magic != EEPROM_MAGIC) {
-    Serial.println("[EEPROM] No valid keys found (magic mismatch)");
+// ==================== WALLET FUNCTIONS ====================
+
+void saveKeys() {
+  keystorePut(KEY_SAL_SPEND, wallet.secret.salviumSpendKey);
+  keystoreWrite(KEY_YDA_KEY, wallet.yadacoinAddress + 3, WALLET_KEY_HEX_LEN);
+  keystorePut(KEY_SAL_ROTATION, wallet.salviumRotation);
+  if (keystoreCommit()) {
+    LOG_I("[OK] Keys saved");
+  } else {
+    LOG_E("[ERROR] Keys not saved - they are lost on reset");
+  }
+}
+
+bool loadKeys(KeyStoreStatus status) {
+  if (status == KEYSTORE_CORRUPT) {
+    // Do not fall through to generateSecureWallets: that would overwrite it
+    LOG_E("[ERROR] Stored spend key is not valid hex - wallet locked");
+    walletWipe();
+    return true;
+  }
+  if (!keystoreGet(KEY_SAL_SPEND, wallet.secret.salviumSpendKey)) {
+    LOG_I("[KEYS] No stored wallet");
     return false;
   }
   
-  Serial.println("[EEPROM] Loading keys...");
-  
-  // Load YadaCoin address
-  yadacoinAddress = "YDA";
-  for (int i = 0; i < 64; i++) {
-    yadacoinAddress += (char)EEPROM.read(EEPROM_ADDR_YDA_KEY + i);
+  // Stores migrated from the OLED firmware hold only the Salvium key
+  char yadaKey[WALLET_KEY_HEX_LEN];
+  if (keystoreGet(KEY_YDA_KEY, yadaKey)) {
+    memcpy(wallet.yadacoinAddress, "YDA", 3);
+    memcpy(wallet.yadacoinAddress + 3, yadaKey, WALLET_KEY_HEX_LEN);
+    wallet.yadacoinAddress[WALLET_YDA_ADDR_LEN] = '\0';
+  } else {
+    generateYadaAddress();
+    saveKeys();
   }
-  
-  // Load Salvium private spend key
-  salviumPrivateSpendKey = "";
-  for (int i = 0; i < 64; i++) {
-    salviumPrivateSpendKey += (char)EEPROM.read(EEPROM_ADDR_SAL_KEY + i);
+  // An address set by ROTATE_KEY replaces the generated one
+  char rotated[WALLET_YDA_ADDR_LEN + 1];
+  size_t rotatedLen = keystoreReadUpTo(KEY_YDA_ADDRESS, rotated, WALLET_YDA_ADDR_LEN);
+  if (rotatedLen) {
+    rotated[rotatedLen] = '\0';
+    walletSetYadaAddress(rotated);
   }
   
-  // Load rotation counter
-  salviumRotation = EEPROM.readInt(EEPROM_ADDR_SAL_ROT);
+  int32_t rotation = 0;
+  keystoreGet(KEY_SAL_ROTATION, rotation);
+  wallet.salviumRotation = rotation;
   
-  // Generate Salvium address from private key (deterministic)
-  SHA256 sha256;
-  uint8_t hash[32];
-  sha256.reset();
-  sha256.update((uint8_t*)salviumPrivateSpendKey.c_str(), salviumPrivateSpendKey.length());
-  sha256.finalize(hash, 32);
-  
-  salviumAddress = "SC1";
-  const char base58Chars[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
-  for (int i = 0; i < 92; i++) {
-    salviumAddress += base58Chars[hash[i % 32] % 58];
-  }
-  
-  Serial.println("[OK] Keys loaded from EEPROM");
-  Serial.println("YadaCoin: " + yadacoinAddress.substring(0, 30) + "...");
-  Serial.println("Salvium: " + salviumAddress.substring(0, 30) + "...");
-  Serial.println("Rotation: " + String(salviumRotation));
+  // The Salvium address comes from the derived-data cache
+  LOG_I("[OK] Keys loaded");
+  LOG_I("YadaCoin: %.30s...", wallet.yadacoinAddress);
+  LOG_I("Rotation: %d", (int)wallet.salviumRotation);
   
   return true;
 }
 
-void generateSecureWallets() {
-  Serial.println("[WALLET] Generating PRODUCTION wallets...");
-  Serial.println("[SECURITY] Using ESP32 hardware RNG (esp_random)");
-  
-  uint8_t randomBytes[32];
-  
-  // Generate YadaCoin address using hardware RNG
-  esp_fill_random(randomBytes, 32);
-  yadacoinAddress = "YDA";
+void generateYadaAddress() {
+  uint8_t bytes[32];
+  randomBytes(bytes, 32);
+  memcpy(wallet.yadacoinAddress, "YDA", 3);
   for (int i = 0; i < 32; i++) {
-    char hex[3];
-    sprintf(hex, "%02x", randomBytes[i]);
-    yadacoinAddress += hex;
+    sprintf(wallet.yadacoinAddress + 3 + 2 * i, "%02x", bytes[i]);
   }
+  memwipe(bytes, sizeof(bytes));
+}
+
+void generateSecureWallets() {
+  LOG_I("[WALLET] Generating PRODUCTION wallets...");
+  LOG_I("[SECURITY] Using the DRBG, freshly reseeded from the hardware RNG");
+  randomReseed();
   
-  // Generate Salvium private spend key using hardware RNG
-  esp_fill_random(randomBytes, 32);
-  salviumPrivateSpendKey = "";
-  for (int i = 0; i < 32; i++) {
-    char hex[3];
-    sprintf(hex, "%02x", randomBytes[i]);
-    salviumPrivateSpendKey += hex;
-  }
+  // Generate YadaCoin address
+  generateYadaAddress();
   
-  // Generate Salvium address (deterministic from private key)
-  SHA256 sha256;
-  uint8_t hash[32];
-  sha256.reset();
-  sha256.update((uint8_t*)salviumPrivateSpendKey.c_str(), salviumPrivateSpendKey.length());
-  sha256.finalize(hash, 32);
+  // Generate Salvium private spend key
+  randomBytes(wallet.secret.salviumSpendKey, 32);
   
-  salviumAddress = "SC1";
-  const char base58Chars[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
-  for (int i = 0; i < 92; i++) {
-    salviumAddress += base58Chars[hash[i % 32] % 58];
-  }
+  wallet.salviumRotation = 0;  // Initial rotation
+  derivedInvalidate();         // Address and QR codes follow from the cache rebuild
+  keystoreErase(KEY_YDA_ADDRESS);  // No ROTATE_KEY yet
+  keystoreErase(KEY_SAL_ADDRESS);
   
-  salviumRotation = 0;  // Initial rotation
+  // Save to the key store for persistence
+  saveKeys();
   
-  // Save to EEPROM for persistence
-  saveKeysToEEPROM();
+  // A new wallet starts a new key event log (inception is appended in setup)
+  kelReset();
   
-  Serial.println("[OK] PRODUCTION wallets generated");
-  Serial.println("YadaCoin: " + yadacoinAddress.substring(0, 30) + "...");
-  Serial.println("Salvium: " + salviumAddress.substring(0, 30) + "...");
-  Serial.println("Salvium Key: " + salviumPrivateSpendKey.substring(0, 16) + "...");
-  Serial.println("[SECURITY] Keys are cryptographically secure and persistent");
+  LOG_I("[OK] PRODUCTION wallets generated");
+  LOG_I("YadaCoin: %.30s...", wallet.yadacoinAddress);
+  LOG_I("[SECURITY] Keys are cryptographically secure and persistent");
 }
@@ -15,8 +15,11 @@
 #include <Wire.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
-#include <Preferences.h>
-#include <qrcode.h>
+#include <esp_system.h>
+#include "../crypto/random.h"
+#include "../keystore.h"
+#include "../log.h"
+#include "../qr.h"
 
 // Display configuration
 #define SCREEN_WIDTH 128
@@ -30,9 +33,6 @@ Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
 #define BUTTON_UP 27
 #define BUTTON_DOWN 26
 
-// Secure storage
-Preferences preferences;
-
 // Salvium wallet keys (NEVER log or transmit these!)
 struct SalviumWallet {
   uint8_t privateSpendKey[32];
@@ -49,21 +49,16 @@ bool walletInitialized = false;
  * Generate Salvium wallet keys
  * 
  * TODO: Implement proper CryptoNote key generation:
- * 1. Generate random 32-byte private spend key
- * 2. Derive view key: view_key = Keccak256(spend_key)
- * 3. Compute public keys: pub = priv * G (curve25519 scalar mult)
- * 4. Encode address with base58 and checksum
+ * 1. Derive view key: view_key = Keccak256(spend_key)
+ * 2. Compute public keys: pub = priv * G (curve25519 scalar mult)
+ * 3. Encode address with base58 and checksum
  */
 void generateWallet() {
   Serial.println("Generating Salvium wallet...");
   
-  // TODO: Use ESP32 hardware RNG for secure random generation
-  // esp_fill_random(wallet.privateSpendKey, 32);
-  
-  // PLACEHOLDER: This is NOT secure!
-  for (int i = 0; i < 32; i++) {
-    wallet.privateSpendKey[i] = random(0, 256);
-  }
+  // DRBG shared with the CYD firmware, reseeded from the hardware RNG first
+  randomReseed();
+  randomBytes(wallet.privateSpendKey, 32);
   
   // TODO: Implement Keccak256 for view key derivation
   // keccak256(wallet.privateViewKey, wallet.privateSpendKey, 32);
@@ -79,11 +74,9 @@ void generateWallet() {
   
   walletInitialized = true;
   
-  // Save to secure storage
-  preferences.begin("salvium", false);
-  preferences.putBytes("spend_key", wallet.privateSpendKey, 32);
-  preferences.putBytes("view_key", wallet.privateViewKey, 32);
-  preferences.end();
+  // Save to secure storage (shared with the CYD firmware)
+  keystorePut(KEY_SAL_SPEND, wallet.privateSpendKey);
+  keystoreCommit();
   
   Serial.println("Wallet generated!");
 }
@@ -92,19 +85,15 @@ void generateWallet() {
  * Load wallet from secure storage
  */
 bool loadWallet() {
-  preferences.begin("salvium", true); // Read-only
+  // Migrates the old "salvium" Preferences namespace on first boot
+  KeyStoreStatus status = keystoreBegin();
+  Serial.printf("Key store: %s\n", keystoreStatusName(status));
   
-  size_t len = preferences.getBytesLength("spend_key");
-  if (len != 32) {
-    preferences.end();
+  if (!keystoreGet(KEY_SAL_SPEND, wallet.privateSpendKey)) {
     return false;
   }
   
-  preferences.getBytes("spend_key", wallet.privateSpendKey, 32);
-  preferences.getBytes("view_key", wallet.privateViewKey, 32);
-  preferences.end();
-  
-  // TODO: Recompute public keys and address
+  // TODO: Derive the view key, recompute public keys and address
   
   walletInitialized = true;
   return true;
@@ -112,25 +101,31 @@ bool loadWallet() {
 
 /**
  * Display QR code on screen
+ *
+ * Smallest version that holds the text (a 95-char address needs version 5),
+ * at the largest scale that fits the panel with its quiet zone. Modules are
+ * packed straight into the page buffer and the frame goes out in one
+ * display().
  */
 void displayQRCode(const char* data) {
   display.clearDisplay();
   
-  // Create QR code
-  QRCode qrcode;
-  uint8_t qrcodeData[qrcode_getBufferSize(3)];
-  qrcode_initText(&qrcode, qrcodeData, 3, 0, data);
-  
-  // Draw QR code
-  int scale = 2;
-  for (uint8_t y = 0; y < qrcode.size; y++) {
-    for (uint8_t x = 0; x < qrcode.size; x++) {
-      if (qrcode_getModule(&qrcode, x, y)) {
-        display.fillRect(x * scale, y * scale, scale, scale, SSD1306_WHITE);
-      }
-    }
+  QrBitmap qr;
+  uint8_t version = qrVersionFor(strlen(data));
+  if (version == 0 || !qrEncode(qr, data, version)) {
+    Serial.printf("[ERROR] QR code generation failed (%u chars)\n", (unsigned)strlen(data));
+    display.setCursor(0, 0);
+    display.println("QR too long");
+    display.display();
+    return;
   }
   
+  int scale = SCREEN_HEIGHT / qrSpan(qr, 1);
+  if (scale < 1) scale = 1;
+  int span = qrSpan(qr, scale);
+  qrPackPages(display.getBuffer(), SCREEN_WIDTH, SCREEN_HEIGHT, qr,
+              (SCREEN_WIDTH - span) / 2, (SCREEN_HEIGHT - span) / 2, scale);
+  
   display.display();
 }
 
@@ -171,6 +166,7 @@ void signTransaction(const char* txData) {
 
 void setup() {
   Serial.begin(115200);
+  logBegin();
   Serial.println("Salvium Hardware Wallet Starting...");
   
   // Initialize display
@@ -179,6 +175,16 @@ void setup() {
     for(;;);
   }
   
+  if (!randomBegin(esp_fill_random)) {
+    Serial.println("Hardware RNG failed its health tests");
+    display.clearDisplay();
+    display.setTextColor(SSD1306_WHITE);
+    display.setCursor(0, 0);
+    display.println("RNG self-test failed");
+    display.display();
+    for(;;);
+  }
+  
   display.clearDisplay();
   display.setTextSize(1);
   display.setTextColor(SSD1306_WHITE);
@@ -236,9 +242,7 @@ void loop() {
       signTransaction(txData.c_str());
     }
     else if (cmd == "reset") {
-      preferences.begin("salvium", false);
-      preferences.clear();
-      preferences.end();
+      keystoreWipe();
       Serial.println("Wallet reset. Restarting...");
       ESP.restart();
     }
@@ -255,5 +259,8 @@ void loop() {
     Serial.println("Button: CANCEL");
   }
   
+  // Key store diagnostics (src/log.h) go out between commands
+  logUnlockSerial();
   delay(100);
+  logLockSerial();
 }
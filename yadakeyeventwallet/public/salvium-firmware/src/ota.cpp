@@ -0,0 +1,184 @@
+#include "ota.h"
+#include <Arduino.h>
+#include <SHA256.h>
+#include <esp_ota_ops.h>
+#include <string.h>
+#include "crypto/cryptonote.h"
+#include "delta.h"
+#include "log.h"
+
+#define BASE_READ_BYTES 1024  // Running image hashed per esp_partition_read
+
+static const char* errorNames[] = {
+  "OK", "NO_RELEASE_KEY", "BAD_HEADER", "BAD_SIGNATURE", "WRONG_BASE", "TOO_LARGE", "NOT_STARTED",
+  "SEQUENCE", "BAD_CHUNK", "PATCH", "INCOMPLETE", "DIGEST", "FLASH", "BUSY",
+};
+
+static DeltaPatcher patcher;  // Holds the DELTA_WINDOW ring
+static DeltaHeader header;
+static SHA256 outputSha;
+static SHA256 baseSha;
+static uint32_t baseHashed = 0;  // Running image bytes hashed so far
+static const esp_partition_t* running = nullptr;
+static const esp_partition_t* target = nullptr;
+static esp_ota_handle_t handle = 0;
+static uint32_t nextSeq = 0;
+static bool active = false;
+static bool ready = false;  // Slot open, taking chunks
+
+static int hexNibble(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// Exactly len bytes of hex, nothing after
+static bool readHex(const char* p, uint8_t* out, size_t len) {
+  for (size_t k = 0; k < len; k++) {
+    int hi = hexNibble(p[0]);
+    int lo = hi < 0 ? -1 : hexNibble(p[1]);
+    if (lo < 0) return false;
+    out[k] = (uint8_t)((hi << 4) | lo);
+    p += 2;
+  }
+  return *p == '\0';
+}
+
+// ---- Patcher callbacks ----
+
+static bool readOld(void* ctx, uint32_t offset, uint8_t* buf, size_t len) {
+  return esp_partition_read(running, offset, buf, len) == ESP_OK;
+}
+
+static bool writeNew(void* ctx, const uint8_t* buf, size_t len) {
+  outputSha.update(buf, len);
+  return esp_ota_write(handle, buf, len) == ESP_OK;
+}
+
+// ---- Session ----
+
+static bool releaseKey(uint8_t pub[32]) {
+  const char* hex = OTA_RELEASE_KEY;
+  return strlen(hex) == 64 && readHex(hex, pub, 32);
+}
+
+static OtaError fail(OtaError err) {
+  otaAbort();
+  return err;
+}
+
+OtaError otaBegin(const char* headerHex) {
+  otaAbort();
+  uint8_t pub[32], raw[DELTA_HEADER_BYTES], hash[32];
+  if (!releaseKey(pub)) return OTA_NO_RELEASE_KEY;
+  if (!readHex(headerHex, raw, sizeof(raw)) || !deltaParseHeader(raw, header)) return OTA_BAD_HEADER;
+  deltaSignedHash(header, hash);
+  if (!check_signature(header.signature, hash, pub)) return OTA_BAD_SIGNATURE;
+
+  running = esp_ota_get_running_partition();
+  target = esp_ota_get_next_update_partition(nullptr);
+  if (!running || !target) return OTA_FLASH;
+  if (header.newSize > target->size) return OTA_TOO_LARGE;
+  if (header.oldSize > running->size) return OTA_WRONG_BASE;
+
+  baseSha.reset();
+  baseHashed = 0;
+  active = true;
+  LOG_I("[OTA] %lu -> %lu bytes into %s", (unsigned long)header.oldSize, (unsigned long)header.newSize,
+                target->label);
+  return OTA_OK;
+}
+
+OtaError otaPrepareStep(uint8_t* progress) {
+  if (!active) return OTA_NOT_STARTED;
+  if (ready) return OTA_OK;
+
+  if (baseHashed < header.oldSize) {
+    uint8_t buf[BASE_READ_BYTES];
+    uint32_t end = header.oldSize - baseHashed < OTA_HASH_STEP ? header.oldSize : baseHashed + OTA_HASH_STEP;
+    while (baseHashed < end) {
+      uint32_t n = end - baseHashed < BASE_READ_BYTES ? end - baseHashed : BASE_READ_BYTES;
+      if (esp_partition_read(running, baseHashed, buf, n) != ESP_OK) return fail(OTA_FLASH);
+      baseSha.update(buf, n);
+      baseHashed += n;
+    }
+    *progress = (uint8_t)((baseHashed * 99ULL) / header.oldSize);
+    return OTA_OK;
+  }
+
+  uint8_t digest[32];
+  baseSha.finalize(digest, sizeof(digest));
+  if (memcmp(digest, header.oldSha, 32) != 0) return fail(OTA_WRONG_BASE);
+  if (esp_ota_begin(target, OTA_WITH_SEQUENTIAL_WRITES, &handle) != ESP_OK) return fail(OTA_FLASH);
+  outputSha.reset();
+  deltaBegin(patcher, header, readOld, writeNew, nullptr);
+  nextSeq = 0;
+  ready = true;
+  *progress = 100;
+  return OTA_OK;
+}
+
+bool otaReady() {
+  return ready;
+}
+
+OtaError otaChunk(uint32_t seq, const char* hex) {
+  if (!ready) return OTA_NOT_STARTED;
+  if (seq != nextSeq) return fail(OTA_SEQUENCE);
+  size_t len = strlen(hex) / 2;
+  uint8_t buf[OTA_CHUNK_MAX];
+  if (len == 0 || len > OTA_CHUNK_MAX || !readHex(hex, buf, len)) return fail(OTA_BAD_CHUNK);
+
+  DeltaStatus status = deltaFeed(patcher, buf, len);
+  if (status != DELTA_RUNNING && status != DELTA_DONE) {
+    LOG_I("[OTA] Patch %s at %lu bytes", deltaStatusName(status), (unsigned long)patcher.written);
+    return fail(OTA_PATCH);
+  }
+  nextSeq++;
+  return OTA_OK;
+}
+
+OtaError otaEnd() {
+  if (!ready) return OTA_NOT_STARTED;
+  if (patcher.status != DELTA_DONE) return fail(OTA_INCOMPLETE);
+  uint8_t digest[32];
+  outputSha.finalize(digest, sizeof(digest));
+  if (memcmp(digest, header.newSha, 32) != 0) return fail(OTA_DIGEST);
+
+  active = false;
+  ready = false;
+  esp_err_t err = esp_ota_end(handle);  // Validates the image
+  if (err == ESP_OK) err = esp_ota_set_boot_partition(target);
+  if (err != ESP_OK) {
+    LOG_E("[OTA] Image rejected: 0x%x", err);
+    return OTA_FLASH;
+  }
+  LOG_I("[OTA] %s verified, boots next", target->label);
+  return OTA_OK;
+}
+
+void otaAbort() {
+  if (ready) esp_ota_abort(handle);
+  active = false;
+  ready = false;
+  outputSha.clear();
+  baseSha.clear();
+}
+
+bool otaActive() {
+  return active;
+}
+
+void otaProgress(uint32_t& written, uint32_t& total) {
+  written = ready ? patcher.written : 0;
+  total = active ? header.newSize : 0;
+}
+
+void otaConfirmBoot() {
+  esp_ota_mark_app_valid_cancel_rollback();
+}
+
+const char* otaErrorName(OtaError err) {
+  return err <= OTA_BUSY ? errorNames[err] : "?";
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==================== SERIAL FIRMWARE UPDATES ====================
+//
+// OTA_BEGIN / OTA_CHUNK / OTA_END apply a delta (delta.h) against the
+// running image into the inactive OTA slot while the wallet keeps serving:
+//
+//   otaBegin   parse the header and check the release signature
+//   otaPrepareStep
+//              a job: check that the patch was made for the running image
+//              (SHA-256 of its first oldSize bytes, OTA_HASH_STEP bytes per
+//              step), then open the other slot for sequential writes, so
+//              each sector is erased when the output reaches it rather than
+//              all newSize bytes up front
+//   otaChunk   hex ops in sequence; the output is written to the slot and
+//              hashed as it is produced
+//   otaEnd     the output digest must match the signed newSha, then
+//              esp_ota_end validates the image and the boot slot switches
+//
+// Any error abandons the session and leaves the running slot booting.
+// Patches come from src/host/ota, signed with the release key whose public
+// half is OTA_RELEASE_KEY.
+
+// Release signing key (64 hex digits, "ota keygen"), set per build:
+//   build_flags = -DOTA_RELEASE_KEY=\"<hex>\"
+// Without one every update is refused.
+#ifndef OTA_RELEASE_KEY
+#define OTA_RELEASE_KEY ""
+#endif
+
+#define OTA_CHUNK_MAX 512    // Op bytes per OTA_CHUNK line (1024 hex digits)
+#define OTA_HASH_STEP 16384  // Running image bytes hashed per otaPrepareStep
+
+enum OtaError {
+  OTA_OK,
+  OTA_NO_RELEASE_KEY,
+  OTA_BAD_HEADER,
+  OTA_BAD_SIGNATURE,
+  OTA_WRONG_BASE,     // Patch made for another image
+  OTA_TOO_LARGE,      // New image larger than the slot
+  OTA_NOT_STARTED,
+  OTA_SEQUENCE,       // Chunk out of order
+  OTA_BAD_CHUNK,      // Not hex, or longer than OTA_CHUNK_MAX
+  OTA_PATCH,          // Ops malformed, or a read or write failed
+  OTA_INCOMPLETE,     // OTA_END before the last op
+  OTA_DIGEST,         // Output does not match the signed digest
+  OTA_FLASH,          // esp_ota_* failed or the image did not validate
+  OTA_BUSY,           // No room in the job queue
+};
+
+OtaError otaBegin(const char* headerHex);
+
+// OTA_OK while there is more to do and once otaReady(); any other error
+// abandons the session
+OtaError otaPrepareStep(uint8_t* progress);
+bool otaReady();
+
+OtaError otaChunk(uint32_t seq, const char* hex);
+OtaError otaEnd();
+void otaAbort();
+
+// From otaBegin until the session ends, preparation included
+bool otaActive();
+void otaProgress(uint32_t& written, uint32_t& total);
+
+// Mark the running image good (no-op unless the bootloader has rollback)
+void otaConfirmBoot();
+
+const char* otaErrorName(OtaError err);
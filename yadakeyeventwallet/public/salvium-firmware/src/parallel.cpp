@@ -0,0 +1,148 @@
+#include "parallel.h"
+#include "log.h"
+#include <atomic>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+#define PARALLEL_WORKERS (PARALLEL_MAX_THREADS - 1)
+
+// The batch currently being run
+static ParallelFn batchFn = nullptr;
+static void* batchCtx = nullptr;
+static size_t batchCount = 0;
+static std::atomic<size_t> nextIndex(0);
+
+static int activeThreads = 1;
+static bool started = false;
+
+static void drain(int thread) {
+  for (;;) {
+    size_t index = nextIndex.fetch_add(1);
+    if (index >= batchCount) return;
+    batchFn(batchCtx, index, thread);
+  }
+}
+
+#ifdef ARDUINO
+
+static TaskHandle_t workers[PARALLEL_WORKERS > 0 ? PARALLEL_WORKERS : 1];
+static SemaphoreHandle_t workerDone = nullptr;
+
+static void workerTask(void* param) {
+  int thread = (int)(intptr_t)param;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    drain(thread);
+    xSemaphoreGive(workerDone);
+  }
+}
+
+void parallelBegin() {
+  if (started || PARALLEL_WORKERS == 0) return;
+  workerDone = xSemaphoreCreateCounting(PARALLEL_WORKERS, 0);
+  for (int k = 0; k < PARALLEL_WORKERS; k++) {
+    xTaskCreatePinnedToCore(workerTask, "parallel", PARALLEL_WORKER_STACK, (void*)(intptr_t)(k + 1),
+                            uxTaskPriorityGet(NULL), &workers[k], PARALLEL_WORKER_CORE);
+  }
+  started = true;
+  activeThreads = PARALLEL_MAX_THREADS;
+  LOG_I("[PARALLEL] %d worker(s) on core %d", PARALLEL_WORKERS, PARALLEL_WORKER_CORE);
+}
+
+static void wakeWorkers(int count) {
+  for (int k = 0; k < count; k++) xTaskNotifyGive(workers[k]);
+}
+
+static void waitWorkers(int count) {
+  for (int k = 0; k < count; k++) xSemaphoreTake(workerDone, portMAX_DELAY);
+}
+
+#else
+
+// Workers sleep on a generation counter; each batch bumps it once. The sync
+// objects are never destroyed: the detached workers still wait on them at
+// exit, and destroying a condition variable with waiters blocks.
+struct WorkerSync {
+  std::mutex lock;
+  std::condition_variable wake;
+  std::condition_variable done;
+  unsigned long generation = 0;
+  int wokenCount = 0;
+  int pendingWorkers = 0;
+};
+
+static WorkerSync* workerSync = nullptr;
+
+static void workerThread(int thread) {
+  unsigned long seen = 0;
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> guard(workerSync->lock);
+      workerSync->wake.wait(guard, [&] { return workerSync->generation != seen && thread <= workerSync->wokenCount; });
+      seen = workerSync->generation;
+    }
+    drain(thread);
+    std::lock_guard<std::mutex> guard(workerSync->lock);
+    if (--workerSync->pendingWorkers == 0) workerSync->done.notify_one();
+  }
+}
+
+void parallelBegin() {
+  if (started || PARALLEL_WORKERS == 0) return;
+  workerSync = new WorkerSync();
+  for (int k = 0; k < PARALLEL_WORKERS; k++) {
+    std::thread(workerThread, k + 1).detach();
+  }
+  started = true;
+  activeThreads = PARALLEL_MAX_THREADS;
+}
+
+static void wakeWorkers(int count) {
+  std::lock_guard<std::mutex> guard(workerSync->lock);
+  workerSync->wokenCount = count;
+  workerSync->pendingWorkers = count;
+  workerSync->generation++;
+  workerSync->wake.notify_all();
+}
+
+static void waitWorkers(int count) {
+  (void)count;
+  std::unique_lock<std::mutex> guard(workerSync->lock);
+  workerSync->done.wait(guard, [] { return workerSync->pendingWorkers == 0; });
+}
+
+#endif
+
+int parallelThreads() {
+  return activeThreads;
+}
+
+void parallelSetThreads(int threads) {
+  if (threads < 1) threads = 1;
+  if (!started) threads = 1;
+  if (threads > PARALLEL_MAX_THREADS) threads = PARALLEL_MAX_THREADS;
+  activeThreads = threads;
+}
+
+void parallelFor(size_t count, ParallelFn fn, void* ctx) {
+  if (count == 0) return;
+
+  batchFn = fn;
+  batchCtx = ctx;
+  batchCount = count;
+  nextIndex.store(0);
+
+  // No point waking more workers than there are items beyond the caller's
+  int helpers = activeThreads - 1;
+  if ((size_t)helpers > count - 1) helpers = (int)(count - 1);
+
+  if (helpers > 0) wakeWorkers(helpers);
+  drain(0);
+  if (helpers > 0) waitWorkers(helpers);
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stddef.h>
+
+// ==================== PARALLEL WORK SPLITTING ====================
+//
+// parallelFor runs fn(ctx, index, thread) for every index in [0, count) on
+// the calling task plus the worker threads, and returns when all are done.
+// Indices are handed out one at a time from a shared counter, so uneven items
+// balance themselves. Results must be written to per-index slots; the caller
+// reads them back in index order afterwards, which keeps the output
+// independent of the schedule.
+//
+// On the ESP32 the single worker is pinned to core 0 (the Arduino loop runs on
+// core 1). Under the native build the workers are std::threads; set
+// PARALLEL_MAX_THREADS to use more of them.
+
+#ifndef PARALLEL_MAX_THREADS
+#define PARALLEL_MAX_THREADS 2  // Including the caller
+#endif
+
+#define PARALLEL_WORKER_STACK 6144
+#define PARALLEL_WORKER_CORE  0
+
+// thread is 0 for the caller and 1..N-1 for workers; use it to pick scratch space
+typedef void (*ParallelFn)(void* ctx, size_t index, int thread);
+
+// Start the workers. Call once at boot.
+void parallelBegin();
+
+// Threads used by parallelFor, including the caller
+int parallelThreads();
+
+// Limit the threads used (1 = run everything on the caller). For benchmarks.
+void parallelSetThreads(int threads);
+
+void parallelFor(size_t count, ParallelFn fn, void* ctx);
@@ -0,0 +1,64 @@
+#include "qr.h"
+#include <qrcode.h>
+#include <string.h>
+
+// Byte-mode capacity at ECC level L, versions 1..QR_MAX_VERSION
+static const uint8_t CAPACITY[QR_MAX_VERSION] = {17, 32, 53, 78, 106, 134};
+
+// The encoder's module buffer can hold secrets (the key export QR)
+static void wipe(void* p, size_t len) {
+  volatile uint8_t* b = (volatile uint8_t*)p;
+  while (len--) *b++ = 0;
+}
+
+bool qrEncode(QrBitmap& out, const char* text, uint8_t version) {
+  QRCode qrcode;
+  uint8_t qrcodeData[qrcode_getBufferSize(QR_MAX_VERSION)];
+  memset(&out, 0, sizeof(out));
+  if (version < 1 || version > QR_MAX_VERSION) return false;
+  if (qrcode_initText(&qrcode, qrcodeData, version, ECC_LOW, text) != 0) {
+    wipe(qrcodeData, sizeof(qrcodeData));
+    return false;
+  }
+
+  out.size = qrcode.size;
+  for (uint8_t y = 0; y < qrcode.size; y++) {
+    for (uint8_t x = 0; x < qrcode.size; x++) {
+      if (!qrcode_getModule(&qrcode, x, y)) continue;
+      int bit = y * qrcode.size + x;
+      out.bits[bit >> 3] |= (uint8_t)(0x80 >> (bit & 7));
+    }
+  }
+  wipe(qrcodeData, sizeof(qrcodeData));
+  return true;
+}
+
+uint8_t qrVersionFor(size_t len) {
+  for (uint8_t v = 1; v <= QR_MAX_VERSION; v++) {
+    if (len <= CAPACITY[v - 1]) return v;
+  }
+  return 0;
+}
+
+void qrPackPages(uint8_t* pages, int width, int height, const QrBitmap& qr, int x, int y, int scale) {
+  int span = qrSpan(qr, scale);
+  int x0 = x < 0 ? 0 : x;
+  int x1 = x + span > width ? width : x + span;
+
+  for (int py = y < 0 ? 0 : y; py < y + span && py < height; py++) {
+    uint8_t* line = pages + (py >> 3) * width;
+    uint8_t mask = (uint8_t)(1 << (py & 7));
+    int my = (py - y) / scale - QR_QUIET;
+
+    // Light row first, then clear the dark runs
+    for (int px = x0; px < x1; px++) line[px] |= mask;
+    if (my < 0 || my >= qr.size) continue;
+    int left = x + QR_QUIET * scale;
+    for (int mx = 0; mx < qr.size; mx++) {
+      if (!qrModule(qr, mx, my)) continue;
+      for (int px = left + mx * scale, end = px + scale; px < end; px++) {
+        if (px >= 0 && px < width) line[px] &= (uint8_t)~mask;
+      }
+    }
+  }
+}
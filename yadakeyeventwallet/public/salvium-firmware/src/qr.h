@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==================== QR CODES ====================
+//
+// Encoding and drawing shared by both display targets, the CYD's ILI9341
+// (main.cpp) and the 128x64 SSD1306 build (oled/). A code is encoded once
+// into a QrBitmap (derived.cpp caches the receive-screen ones) and each
+// target draws it with the operation its panel is cheap at:
+//
+//   qrForEachRun   one callback per horizontal run of dark modules, for a
+//                  display that pays per rectangle (TFT_eSPI::fillRect
+//                  costs an address window each)
+//   qrPackPages    sets and clears bits straight in a 1-bpp SSD1306 page
+//                  buffer; the caller sends the frame with one display()
+//
+// Error correction is always level L. Byte-mode capacity per version:
+// 17, 32, 53, 78, 106, 134 characters for versions 1-6.
+
+#define QR_MAX_VERSION 6
+#define QR_MAX_MODULES 41  // Version 6
+#define QR_BYTES       ((QR_MAX_MODULES * QR_MAX_MODULES + 7) / 8)
+#define QR_QUIET       4   // Light modules a scanner needs around the code
+
+// Modules packed row-major, MSB first
+struct QrBitmap {
+  uint8_t size;  // Modules per side, 0 if empty
+  uint8_t bits[QR_BYTES];
+};
+
+// Encode text into out. False if it does not fit the version.
+bool qrEncode(QrBitmap& out, const char* text, uint8_t version);
+
+// Smallest version that holds len characters, 0 if none up to QR_MAX_VERSION
+uint8_t qrVersionFor(size_t len);
+
+inline bool qrModule(const QrBitmap& qr, int x, int y) {
+  int bit = y * qr.size + x;
+  return (qr.bits[bit >> 3] >> (7 - (bit & 7))) & 1;
+}
+
+// run(x, y, length) in modules, row by row
+template <typename Run>
+void qrForEachRun(const QrBitmap& qr, Run run) {
+  for (int y = 0; y < qr.size; y++) {
+    int x = 0;
+    while (x < qr.size) {
+      if (!qrModule(qr, x, y)) {
+        x++;
+        continue;
+      }
+      int start = x;
+      while (x < qr.size && qrModule(qr, x, y)) x++;
+      run(start, y, x - start);
+    }
+  }
+}
+
+// Side in pixels of the code plus its quiet zone
+inline int qrSpan(const QrBitmap& qr, int scale) {
+  return (qr.size + 2 * QR_QUIET) * scale;
+}
+
+// Write the code with its quiet zone into an SSD1306 page buffer (width
+// columns, byte (y / 8) * width + x holds pixel y at bit y % 8). The quiet
+// zone's top-left corner goes at (x, y). Light modules are lit pixels so the
+// code reads dark-on-light like print. Pixels off the buffer are skipped.
+void qrPackPages(uint8_t* pages, int width, int height, const QrBitmap& qr, int x, int y, int scale);
@@ -0,0 +1,329 @@
+#include "scanner.h"
+#include "addresses.h"
+#include "parallel.h"
+#include <stdlib.h>
+#include <string.h>
+
+struct ScanOutput {
+  uint8_t txPub[32];
+  uint32_t index;
+  uint8_t key[32];
+  int8_t firstWithTxPub;  // Earlier output with the same R, or -1
+  bool txPubValid;
+  bool match;
+  uint16_t subaddress;
+  uint8_t keyImage[32];
+};
+
+// Spend key lookup: first 4 bytes of each D (little endian) and its index
+struct SubaddressKey {
+  uint32_t prefix;
+  uint16_t index;
+};
+
+static ScanOutput outputs[SCAN_MAX_OUTPUTS];
+static uint8_t derivations[SCAN_MAX_OUTPUTS][32];
+static uint8_t scalars[SCAN_MAX_OUTPUTS][32];   // Hs(D || index)
+static int outputCount = 0;
+static int nextOutput = 0;
+static bool loaded = false;
+
+// Per request
+static int8_t viewDigits[64];
+static uint8_t viewSecret[32];
+static uint8_t spendSecret[32];
+static ge_p3 spendPoint;
+static ge_cached spendPub;
+
+// Kept across requests for the keys in tableOwner (B, encoded)
+static SubaddressKey table[SCAN_SUBADDRESSES];
+static int tableCount = 0;  // Derived so far; sorted once complete
+static int tableStart = 0;  // tableCount when this request was loaded
+static uint8_t tableOwner[32];
+
+// Per step: one slot per output in the step
+static ge_p3 points[SCAN_STEP_OUTPUTS];
+static int8_t pointOutput[SCAN_STEP_OUTPUTS];
+static fe zinv[SCAN_STEP_OUTPUTS];
+static fe scratch[SCAN_STEP_OUTPUTS];
+static uint8_t encoded[SCAN_STEP_OUTPUTS][32];
+static int pointCount = 0;
+
+static const char* errorNames[] = {"OK", "MALFORMED", "TOO_LARGE"};
+
+static int hexNibble(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+static bool readHex(const char*& p, uint8_t* out, size_t len) {
+  for (size_t k = 0; k < len; k++) {
+    int hi = hexNibble(p[0]);
+    int lo = hi < 0 ? -1 : hexNibble(p[1]);
+    if (lo < 0) return false;
+    out[k] = (uint8_t)((hi << 4) | lo);
+    p += 2;
+  }
+  return true;
+}
+
+// ---- Stage workers: index is a slot in points[] ----
+
+// 8 * a * R, left projective for the batched encode
+static void derivePoint(void* ctx, size_t slot, int thread) {
+  (void)ctx;
+  (void)thread;
+  ScanOutput& out = outputs[pointOutput[slot]];
+  ge_p3 R;
+  out.txPubValid = ge_frombytes_vartime(R, out.txPub);
+  if (!out.txPubValid) {
+    ge_identity(points[slot]);
+    return;
+  }
+  ge_scalarmult_signed(points[slot], viewDigits, R);
+  ge_mul8(points[slot], points[slot]);
+}
+
+// Spend key of subaddress (0, index): B, or B + m*G
+static void subaddressPoint(ge_p3& D, uint32_t index) {
+  if (index == 0) {
+    D = spendPoint;
+    return;
+  }
+  uint8_t m[32];
+  subaddressScalar(m, viewSecret, 0, index);
+  ge_scalarmult_base(D, m);
+  ge_add(D, D, spendPub);
+}
+
+// One table entry per slot, from tableCount
+static void tableKey(void* ctx, size_t slot, int thread) {
+  (void)ctx;
+  (void)thread;
+  subaddressPoint(points[slot], (uint32_t)(tableCount + slot));
+}
+
+// P - Hs(D || index) * G, the spend key the output was sent to if it is ours
+static void spendKeyOf(void* ctx, size_t slot, int thread) {
+  (void)ctx;
+  (void)thread;
+  int n = pointOutput[slot];
+  derivation_to_scalar(scalars[n], derivations[n], outputs[n].index);
+  ge_p3 S, P;
+  ge_cached s;
+  if (!ge_frombytes_vartime(P, outputs[n].key)) {
+    ge_identity(points[slot]);  // Not a point; matches no table entry
+    return;
+  }
+  ge_scalarmult_base(S, scalars[n]);
+  ge_to_cached(s, S);
+  ge_sub(points[slot], P, s);
+}
+
+// (Hs(..) + b + m) * Hp(P), only for owned outputs
+static void keyImage(void* ctx, size_t slot, int thread) {
+  (void)ctx;
+  (void)thread;
+  ScanOutput& out = outputs[pointOutput[slot]];
+  uint8_t x[32];
+  sc_add(x, scalars[pointOutput[slot]], spendSecret);
+  if (out.subaddress) {
+    uint8_t m[32];
+    subaddressScalar(m, viewSecret, 0, out.subaddress);
+    sc_add(x, x, m);
+  }
+  generate_key_image(out.keyImage, out.key, x);
+  memwipe(x, sizeof(x));
+}
+
+static uint32_t keyPrefix(const uint8_t key[32]) {
+  return (uint32_t)key[0] | ((uint32_t)key[1] << 8) | ((uint32_t)key[2] << 16) | ((uint32_t)key[3] << 24);
+}
+
+// Subaddress index whose spend key is key, or -1. A prefix hit is derived
+// again and compared in full.
+static int findSubaddress(const uint8_t key[32]) {
+  uint32_t prefix = keyPrefix(key);
+  int lo = 0, hi = SCAN_SUBADDRESSES;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (table[mid].prefix < prefix) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  for (; lo < SCAN_SUBADDRESSES && table[lo].prefix == prefix; lo++) {
+    ge_p3 D;
+    uint8_t candidate[32];
+    subaddressPoint(D, table[lo].index);
+    ge_tobytes(candidate, D);
+    if (memcmp(candidate, key, 32) == 0) return table[lo].index;
+  }
+  return -1;
+}
+
+// Next SCAN_STEP_OUTPUTS table entries; sorts the table after the last
+static void buildTableStep() {
+  int n = SCAN_SUBADDRESSES - tableCount;
+  if (n > SCAN_STEP_OUTPUTS) n = SCAN_STEP_OUTPUTS;
+  parallelFor(n, tableKey, nullptr);
+  ge_tobytes_batch(encoded, points, zinv, scratch, n);
+  for (int k = 0; k < n; k++) {
+    table[tableCount + k].prefix = keyPrefix(encoded[k]);
+    table[tableCount + k].index = (uint16_t)(tableCount + k);
+  }
+  tableCount += n;
+  if (tableCount < SCAN_SUBADDRESSES) return;
+  qsort(table, SCAN_SUBADDRESSES, sizeof(SubaddressKey), [](const void* a, const void* b) -> int {
+    uint32_t x = ((const SubaddressKey*)a)->prefix, y = ((const SubaddressKey*)b)->prefix;
+    return x < y ? -1 : x > y;
+  });
+}
+
+// ---- Public API ----
+
+ScannerError scannerLoad(const char* hex, const uint8_t spendKey[32]) {
+  scannerClear();
+
+  size_t len = strlen(hex);
+  const size_t tupleChars = 2 * (32 + 4 + 32);
+  if (len == 0 || len % tupleChars != 0) return SCANNER_MALFORMED;
+  if (len / tupleChars > SCAN_MAX_OUTPUTS) return SCANNER_TOO_LARGE;
+
+  outputCount = (int)(len / tupleChars);
+  const char* p = hex;
+  for (int n = 0; n < outputCount; n++) {
+    ScanOutput& out = outputs[n];
+    uint8_t le[4];
+    if (!readHex(p, out.txPub, 32) || !readHex(p, le, 4) || !readHex(p, out.key, 32)) {
+      scannerClear();
+      return SCANNER_MALFORMED;
+    }
+    out.index = (uint32_t)le[0] | ((uint32_t)le[1] << 8) | ((uint32_t)le[2] << 16) | ((uint32_t)le[3] << 24);
+
+    // Outputs of one transaction share R; derive it once
+    out.firstWithTxPub = -1;
+    for (int m = 0; m < n; m++) {
+      if (memcmp(outputs[m].txPub, out.txPub, 32) == 0) {
+        out.firstWithTxPub = (int8_t)m;
+        break;
+      }
+    }
+  }
+
+  uint8_t owner[32];
+  memcpy(spendSecret, spendKey, 32);
+  derive_view_key(viewSecret, spendSecret);
+  sc_recode_signed(viewDigits, viewSecret);
+  ge_scalarmult_base(spendPoint, spendSecret);
+  ge_to_cached(spendPub, spendPoint);
+
+  // Another wallet's table is rebuilt from the start
+  ge_tobytes(owner, spendPoint);
+  if (memcmp(owner, tableOwner, 32) != 0) {
+    memcpy(tableOwner, owner, 32);
+    tableCount = 0;
+  }
+  tableStart = tableCount;
+
+  nextOutput = 0;
+  loaded = true;
+  return SCANNER_OK;
+}
+
+ScannerStatus scannerStep(uint8_t* progress) {
+  if (!loaded) return SCANNER_FAILED;
+
+  int work = SCAN_SUBADDRESSES - tableStart + outputCount;
+  if (tableCount < SCAN_SUBADDRESSES) {
+    buildTableStep();
+    *progress = (uint8_t)(((tableCount - tableStart) * 100) / work);
+    return SCANNER_RUNNING;
+  }
+
+  int first = nextOutput;
+  int last = first + SCAN_STEP_OUTPUTS;
+  if (last > outputCount) last = outputCount;
+
+  // Derivations for the distinct tx public keys in this step
+  pointCount = 0;
+  for (int n = first; n < last; n++) {
+    if (outputs[n].firstWithTxPub < 0) pointOutput[pointCount++] = (int8_t)n;
+  }
+  parallelFor(pointCount, derivePoint, nullptr);
+  ge_tobytes_batch(encoded, points, zinv, scratch, pointCount);
+  for (int k = 0; k < pointCount; k++) memcpy(derivations[pointOutput[k]], encoded[k], 32);
+  for (int n = first; n < last; n++) {
+    ScanOutput& out = outputs[n];
+    if (out.firstWithTxPub < 0) continue;
+    out.txPubValid = outputs[out.firstWithTxPub].txPubValid;
+    memcpy(derivations[n], derivations[out.firstWithTxPub], 32);
+  }
+
+  // Spend keys the outputs were sent to, looked up in encoded form
+  pointCount = 0;
+  for (int n = first; n < last; n++) {
+    if (outputs[n].txPubValid) pointOutput[pointCount++] = (int8_t)n;
+  }
+  parallelFor(pointCount, spendKeyOf, nullptr);
+  ge_tobytes_batch(encoded, points, zinv, scratch, pointCount);
+  int matches = 0;
+  for (int k = 0; k < pointCount; k++) {
+    ScanOutput& out = outputs[pointOutput[k]];
+    int index = findSubaddress(encoded[k]);
+    out.match = index >= 0;
+    out.subaddress = out.match ? (uint16_t)index : 0;
+    if (out.match) pointOutput[matches++] = pointOutput[k];
+  }
+
+  parallelFor(matches, keyImage, nullptr);
+
+  for (int n = first; n < last; n++) memwipe(scalars[n], 32);
+  nextOutput = last;
+  *progress = (uint8_t)(((SCAN_SUBADDRESSES - tableStart + nextOutput) * 100) / work);
+  if (nextOutput < outputCount) return SCANNER_RUNNING;
+
+  // Keep the results, drop the keys
+  memwipe(viewDigits, sizeof(viewDigits));
+  memwipe(viewSecret, sizeof(viewSecret));
+  memwipe(spendSecret, sizeof(spendSecret));
+  memwipe(derivations, sizeof(derivations));
+  return SCANNER_DONE;
+}
+
+const char* scannerErrorName(ScannerError err) {
+  return errorNames[err];
+}
+
+int scannerOutputCount() {
+  return outputCount;
+}
+
+bool scannerIsMatch(int output) {
+  return outputs[output].match;
+}
+
+const uint8_t* scannerKeyImage(int output) {
+  return outputs[output].keyImage;
+}
+
+uint32_t scannerSubaddress(int output) {
+  return outputs[output].subaddress;
+}
+
+void scannerClear() {
+  memwipe(outputs, sizeof(outputs));
+  memwipe(derivations, sizeof(derivations));
+  memwipe(scalars, sizeof(scalars));
+  memwipe(viewDigits, sizeof(viewDigits));
+  memwipe(viewSecret, sizeof(viewSecret));
+  memwipe(spendSecret, sizeof(spendSecret));
+  memwipe(points, sizeof(points));
+  outputCount = 0;
+  nextOutput = 0;
+  pointCount = 0;
+  loaded = false;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "crypto/cryptonote.h"
+
+// ==================== OUTPUT SCANNER ====================
+//
+// Ownership test for SCAN_OUTPUTS. The payload is hex, one tuple per output:
+//
+//   txPubKey[32]  outputIndex u32 LE  outputKey[32]
+//
+// An output is ours when P - Hs(8*a*R || index)*G is the spend key of one of
+// the wallet's addresses: B for the primary one, D = B + m*G for subaddress
+// (0, i) with 0 < i < SCAN_SUBADDRESSES (addresses.h). For those the key
+// image (Hs(..) + b + m) * Hp(P) is computed as well, m being 0 for B.
+//
+// The spend keys are looked up in a table of 4-byte prefixes of every D,
+// sorted, and a prefix hit is confirmed by deriving that D again. The table
+// is built in the first steps of the first scan after the keys change
+// (SCAN_STEP_OUTPUTS subaddresses per step) and kept for later requests.
+// Subaddresses outside the window are never matched, so GET_ADDRESSES and
+// the on-screen list stop at SCAN_SUBADDRESSES in account 0.
+//
+// The view key is recoded once per request and reused for every derivation,
+// derivations are computed once per distinct tx public key, and points are
+// encoded SCAN_STEP_OUTPUTS at a time with a single field inversion. Each
+// stage of a step is split across cores with parallelFor.
+
+#define SCAN_MAX_OUTPUTS  32
+#define SCAN_STEP_OUTPUTS 8     // Outputs per step (and per batched inversion)
+#define SCAN_SUBADDRESSES 1024  // Account 0 indices recognised, 0 being the primary address
+
+enum ScannerStatus { SCANNER_RUNNING, SCANNER_DONE, SCANNER_FAILED };
+
+enum ScannerError { SCANNER_OK, SCANNER_MALFORMED, SCANNER_TOO_LARGE };
+
+// spendKey is the reduced private spend key
+ScannerError scannerLoad(const char* hex, const uint8_t spendKey[32]);
+
+ScannerStatus scannerStep(uint8_t* progress);
+
+const char* scannerErrorName(ScannerError err);
+
+int scannerOutputCount();
+bool scannerIsMatch(int output);
+const uint8_t* scannerKeyImage(int output);
+
+// Subaddress index (account 0) a matched output was sent to, 0 for the primary address
+uint32_t scannerSubaddress(int output);
+
+// Wipe keys and results
+void scannerClear();
@@ -0,0 +1,317 @@
+#include "signer.h"
+#include "parallel.h"
+#include <string.h>
+
+enum SignerStage { STAGE_IDLE, STAGE_DERIVE, STAGE_PRECOMPUTE, STAGE_BEGIN, STAGE_ROUNDS, STAGE_DONE };
+
+struct SignerInput {
+  ClsagContext clsag;
+  uint8_t txPub[32];
+  uint32_t outputIndex;
+  bool ok;        // Result of the current stage
+  bool walked;    // Ring walk complete
+  uint8_t rounds; // Decoy iterations done
+};
+
+static SignerInput inputs[SIGN_MAX_INPUTS];
+static ClsagScratch scratch[PARALLEL_MAX_THREADS];
+static uint8_t message[32];
+static uint8_t spendSecret[32];
+static uint8_t viewSecret[32];
+static int inputCount = 0;
+static SignerStage stage = STAGE_IDLE;
+static SignerError lastError = SIGNER_OK;
+static int lastErrorInput = -1;
+
+// Ring members are numbered across all inputs for the precompute stage
+static int memberTotal = 0;
+static int memberNext = 0;
+
+static int unitsTotal = 0;
+static int unitsDone = 0;
+
+static const char* errorNames[] = {
+  "OK", "MALFORMED", "TOO_MANY_INPUTS", "BAD_RING", "BAD_POINT", "KEY_MISMATCH", "COMMITMENT_MISMATCH",
+};
+
+// ---- Hex payload reader ----
+
+struct HexReader {
+  const char* p;
+  const char* end;
+  bool ok;
+};
+
+static int hexNibble(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+static void readBytes(HexReader& r, uint8_t* out, size_t len) {
+  for (size_t k = 0; k < len && r.ok; k++) {
+    if (r.end - r.p < 2) {
+      r.ok = false;
+      return;
+    }
+    int hi = hexNibble(r.p[0]);
+    int lo = hi < 0 ? -1 : hexNibble(r.p[1]);
+    if (lo < 0) {
+      r.ok = false;
+      return;
+    }
+    out[k] = (uint8_t)((hi << 4) | lo);
+    r.p += 2;
+  }
+}
+
+static uint8_t readU8(HexReader& r) {
+  uint8_t v = 0;
+  readBytes(r, &v, 1);
+  return v;
+}
+
+static uint32_t readU32(HexReader& r) {
+  uint8_t b[4] = {0};
+  readBytes(r, b, 4);
+  return (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+}
+
+static void fail(SignerError err, int input) {
+  lastError = err;
+  lastErrorInput = input;
+  stage = STAGE_IDLE;
+}
+
+// First failed input in input order, so the reported error does not depend
+// on which thread got there first
+static int firstFailed() {
+  for (int k = 0; k < inputCount; k++) {
+    if (!inputs[k].ok) return k;
+  }
+  return -1;
+}
+
+// ---- Stage workers (run on any thread) ----
+
+static void deriveInput(void* ctx, size_t index, int thread) {
+  (void)ctx;
+  (void)thread;
+  SignerInput& in = inputs[index];
+  uint8_t derivation[32], pub[32];
+  in.ok = false;
+  if (!generate_key_derivation(derivation, in.txPub, viewSecret)) return;
+  derive_secret_key(in.clsag.p, derivation, in.outputIndex, spendSecret);
+  secret_to_public(pub, in.clsag.p);
+  in.ok = memcmp(pub, in.clsag.P[in.clsag.l], 32) == 0;
+  memwipe(derivation, sizeof(derivation));
+}
+
+static void precomputeMember(void* ctx, size_t index, int thread) {
+  (void)ctx;
+  (void)thread;
+  int member = memberNext + (int)index;
+  for (int k = 0; k < inputCount; k++) {
+    ClsagContext& c = inputs[k].clsag;
+    if (member < c.n) {
+      if (!clsagPrecomputeMember(c, member)) inputs[k].ok = false;
+      return;
+    }
+    member -= c.n;
+  }
+}
+
+static void beginInput(void* ctx, size_t index, int thread) {
+  (void)ctx;
+  inputs[index].ok = clsagBegin(inputs[index].clsag, scratch[thread]);
+}
+
+static void walkInput(void* ctx, size_t index, int thread) {
+  (void)ctx;
+  SignerInput& in = inputs[index];
+  for (int k = 0; k < SIGN_ROUNDS_PER_STEP && !in.walked; k++) {
+    in.walked = clsagRound(in.clsag, scratch[thread]);
+    if (in.clsag.n > 1) in.rounds++;  // A ring of one has no decoys
+  }
+}
+
+// ---- Public API ----
+
+SignerError signerLoad(const char* hex, const uint8_t spendKey[32]) {
+  return signerLoad(hex, strlen(hex), spendKey);
+}
+
+SignerError signerLoad(const char* hex, size_t len, const uint8_t spendKey[32]) {
+  signerClear();
+  lastError = SIGNER_OK;
+  lastErrorInput = -1;
+
+  HexReader r = {hex, hex + len, true};
+  readBytes(r, message, 32);
+  inputCount = readU8(r);
+  if (!r.ok || inputCount == 0) {
+    fail(SIGNER_MALFORMED, -1);
+    return lastError;
+  }
+  if (inputCount > SIGN_MAX_INPUTS) {
+    fail(SIGNER_TOO_MANY_INPUTS, -1);
+    return lastError;
+  }
+
+  memberTotal = 0;
+  for (int k = 0; k < inputCount; k++) {
+    SignerInput& in = inputs[k];
+    ClsagContext& c = in.clsag;
+    c.message = message;
+    c.n = readU8(r);
+    c.l = readU8(r);
+    readBytes(r, in.txPub, 32);
+    in.outputIndex = readU32(r);
+    readBytes(r, c.z, 32);
+    readBytes(r, c.Coffset, 32);
+    if (!r.ok) break;
+    if (c.n == 0 || c.n > CLSAG_MAX_RING || c.l >= c.n) {
+      fail(SIGNER_BAD_RING, k);
+      return lastError;
+    }
+    for (int m = 0; m < c.n; m++) {
+      readBytes(r, c.P[m], 32);
+      readBytes(r, c.C[m], 32);
+    }
+    sc_reduce32(c.z);
+    memberTotal += c.n;
+  }
+  if (!r.ok || r.p != r.end) {
+    fail(SIGNER_MALFORMED, -1);
+    return lastError;
+  }
+
+  memcpy(spendSecret, spendKey, 32);
+  derive_view_key(viewSecret, spendSecret);
+
+  // All nonces are derived here, on one task, in input order
+  unitsTotal = memberTotal + 2 * inputCount;
+  for (int k = 0; k < inputCount; k++) {
+    clsagDrawNonces(inputs[k].clsag, spendSecret);
+    unitsTotal += inputs[k].clsag.n - 1;
+  }
+
+  memberNext = 0;
+  unitsDone = 0;
+  stage = STAGE_DERIVE;
+  return SIGNER_OK;
+}
+
+SignerStatus signerStep(uint8_t* progress) {
+  int failed;
+
+  switch (stage) {
+    case STAGE_DERIVE:
+      parallelFor(inputCount, deriveInput, nullptr);
+      memwipe(viewSecret, sizeof(viewSecret));
+      memwipe(spendSecret, sizeof(spendSecret));
+      failed = firstFailed();
+      if (failed >= 0) {
+        fail(SIGNER_KEY_MISMATCH, failed);
+        break;
+      }
+      unitsDone += inputCount;
+      stage = STAGE_PRECOMPUTE;
+      break;
+
+    case STAGE_PRECOMPUTE: {
+      int batch = memberTotal - memberNext;
+      if (batch > SIGN_PRECOMPUTE_BATCH) batch = SIGN_PRECOMPUTE_BATCH;
+      parallelFor(batch, precomputeMember, nullptr);
+      memberNext += batch;
+      unitsDone += batch;
+      failed = firstFailed();
+      if (failed >= 0) {
+        fail(SIGNER_BAD_POINT, failed);
+        break;
+      }
+      if (memberNext == memberTotal) stage = STAGE_BEGIN;
+      break;
+    }
+
+    case STAGE_BEGIN:
+      parallelFor(inputCount, beginInput, nullptr);
+      failed = firstFailed();
+      if (failed >= 0) {
+        fail(SIGNER_COMMITMENT_MISMATCH, failed);
+        break;
+      }
+      unitsDone += inputCount;
+      stage = STAGE_ROUNDS;
+      break;
+
+    case STAGE_ROUNDS: {
+      parallelFor(inputCount, walkInput, nullptr);
+      bool walked = true;
+      int rounds = 0;
+      for (int k = 0; k < inputCount; k++) {
+        walked = walked && inputs[k].walked;
+        rounds += inputs[k].rounds;
+      }
+      unitsDone = memberTotal + 2 * inputCount + rounds;
+      if (!walked) break;
+
+      for (int k = 0; k < inputCount; k++) clsagFinish(inputs[k].clsag);
+      stage = STAGE_DONE;
+      break;
+    }
+
+    default:
+      break;
+  }
+
+  if (stage == STAGE_IDLE) {
+    *progress = 0;
+    signerClear();
+    return SIGNER_FAILED;
+  }
+  *progress = unitsTotal ? (uint8_t)((unitsDone * 100) / unitsTotal) : 100;
+  return stage == STAGE_DONE ? SIGNER_DONE : SIGNER_RUNNING;
+}
+
+SignerError signerError() {
+  return lastError;
+}
+
+int signerErrorInput() {
+  return lastErrorInput;
+}
+
+const char* signerErrorName(SignerError err) {
+  return errorNames[err];
+}
+
+int signerInputCount() {
+  return stage == STAGE_DONE ? inputCount : 0;
+}
+
+int signerRingSize(int input) {
+  return inputs[input].clsag.n;
+}
+
+const ClsagSignature& signerSignature(int input) {
+  return inputs[input].clsag.sig;
+}
+
+const uint8_t* signerMessage() {
+  return message;
+}
+
+void signerClear() {
+  memwipe(inputs, sizeof(inputs));
+  memwipe(scratch, sizeof(scratch));
+  memwipe(spendSecret, sizeof(spendSecret));
+  memwipe(viewSecret, sizeof(viewSecret));
+  inputCount = 0;
+  memberTotal = 0;
+  memberNext = 0;
+  unitsTotal = 0;
+  unitsDone = 0;
+  stage = STAGE_IDLE;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "crypto/clsag.h"
+
+// ==================== SALVIUM TRANSACTION SIGNER ====================
+//
+// Signs every input of a SIGN_TX:SAL request with CLSAG. The payload is hex:
+//
+//   message[32]            pre-signature hash of the transaction
+//   inputCount u8
+//   per input:
+//     ringSize u8, realIndex u8
+//     txPubKey[32]         R of the transaction that created the real output
+//     outputIndex u32 LE
+//     zMask[32]            commitment mask difference (input - pseudo-out)
+//     pseudoOut[32]        C_offset
+//     ring: ringSize x (outputKey[32], commitment[32])
+//
+// The one-time key of each input is derived on device from the spend key and
+// checked against ring[realIndex]. Transactions with more than
+// SIGN_MAX_INPUTS inputs are sent as several requests with the same message.
+//
+// Work is done in stages by signerStep, each split across parallelFor:
+//   derive      per input    one-time key from R and the output index
+//   precompute  per member   point decompression and Hp(P), all rings at once
+//   begin       per input    key images and the initial challenge
+//   rounds      per input    SIGN_ROUNDS_PER_STEP decoy iterations per step
+// then the closing responses are computed in input order.
+
+#define SIGN_MAX_INPUTS       4
+#define SIGN_PRECOMPUTE_BATCH 8  // Ring members per step
+#define SIGN_ROUNDS_PER_STEP  4  // Decoy iterations per input per step
+
+enum SignerStatus { SIGNER_RUNNING, SIGNER_DONE, SIGNER_FAILED };
+
+enum SignerError {
+  SIGNER_OK,
+  SIGNER_MALFORMED,
+  SIGNER_TOO_MANY_INPUTS,
+  SIGNER_BAD_RING,
+  SIGNER_BAD_POINT,
+  SIGNER_KEY_MISMATCH,
+  SIGNER_COMMITMENT_MISMATCH,
+};
+
+// Parse a request and draw the nonces. spendKey is the reduced private spend key.
+SignerError signerLoad(const char* hex, const uint8_t spendKey[32]);
+// The same for len hex digits within a longer string (a SIGN_TX envelope)
+SignerError signerLoad(const char* hex, size_t len, const uint8_t spendKey[32]);
+
+// Do one bounded step of work. *progress is 0-100.
+SignerStatus signerStep(uint8_t* progress);
+
+// Why the last load or step failed, and the input it failed on
+SignerError signerError();
+int signerErrorInput();
+const char* signerErrorName(SignerError err);
+
+int signerInputCount();
+int signerRingSize(int input);
+const ClsagSignature& signerSignature(int input);
+
+// Pre-signature hash of the loaded request
+const uint8_t* signerMessage();
+
+// Wipe keys, nonces and results
+void signerClear();
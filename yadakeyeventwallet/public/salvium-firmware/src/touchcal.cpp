@@ -0,0 +1,55 @@
+#include "touchcal.h"
+#include <stdlib.h>
+
+// num / det in 16.16, rounded to nearest
+static int64_t fixedDiv(int64_t num, int64_t det) {
+  int64_t scaled = num * 65536;
+  if (det < 0) {
+    scaled = -scaled;
+    det = -det;
+  }
+  return scaled >= 0 ? (scaled + det / 2) / det : -((-scaled + det / 2) / det);
+}
+
+bool touchCalSolve(const int16_t raw[TOUCH_CAL_TARGETS][2], const int16_t screen[TOUCH_CAL_TARGETS][2],
+                   TouchCal& out) {
+  int64_t x0 = raw[0][0], x1 = raw[1][0], x2 = raw[2][0];
+  int64_t y0 = raw[0][1], y1 = raw[1][1], y2 = raw[2][1];
+  int64_t det = (x0 - x2) * (y1 - y2) - (x1 - x2) * (y0 - y2);
+  if (llabs(det) < TOUCH_CAL_MIN_DET) return false;
+
+  int64_t coef[6];
+  for (int axis = 0; axis < 2; axis++) {
+    int64_t s0 = screen[0][axis], s1 = screen[1][axis], s2 = screen[2][axis];
+    coef[3 * axis] = fixedDiv((s0 - s2) * (y1 - y2) - (s1 - s2) * (y0 - y2), det);
+    coef[3 * axis + 1] = fixedDiv((x0 - x2) * (s1 - s2) - (s0 - s2) * (x1 - x2), det);
+    coef[3 * axis + 2] =
+        fixedDiv(y0 * (x2 * s1 - x1 * s2) + y1 * (x0 * s2 - x2 * s0) + y2 * (x1 * s0 - x0 * s1), det);
+  }
+  for (int i = 0; i < 6; i++) {
+    int64_t limit = i % 3 == 2 ? TOUCH_CAL_MAX_OFFSET : TOUCH_CAL_MAX_GAIN;
+    if (llabs(coef[i]) > limit) return false;
+  }
+  out.a = (int32_t)coef[0];
+  out.b = (int32_t)coef[1];
+  out.c = (int32_t)coef[2];
+  out.d = (int32_t)coef[3];
+  out.e = (int32_t)coef[4];
+  out.f = (int32_t)coef[5];
+  return true;
+}
+
+void touchCalFromRange(TouchCal& out, int minX, int maxX, int minY, int maxY, int width, int height) {
+  out.a = (int32_t)fixedDiv(width, maxX - minX);
+  out.b = 0;
+  out.c = -out.a * minX;
+  out.d = 0;
+  out.e = (int32_t)fixedDiv(height, maxY - minY);
+  out.f = -out.e * minY;
+}
+
+bool touchCalValid(const TouchCal& cal) {
+  return abs(cal.a) <= TOUCH_CAL_MAX_GAIN && abs(cal.b) <= TOUCH_CAL_MAX_GAIN && abs(cal.d) <= TOUCH_CAL_MAX_GAIN &&
+         abs(cal.e) <= TOUCH_CAL_MAX_GAIN && abs(cal.c) <= TOUCH_CAL_MAX_OFFSET && abs(cal.f) <= TOUCH_CAL_MAX_OFFSET &&
+         cal.samples > 0;
+}
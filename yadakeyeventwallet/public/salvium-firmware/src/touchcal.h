@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdint.h>
+
+// ==================== TOUCH CALIBRATION ====================
+//
+// Raw XPT2046 readings (12 bit) map to screen pixels through an affine
+// transform in 16.16 fixed point:
+//
+//   x = (a * rx + b * ry + c) >> 16
+//   y = (d * rx + e * ry + f) >> 16
+//
+// which takes in scale, offset, swapped axes and the skew between panel and
+// glass that per-axis min/max constants cannot. touchCalSolve fits the six
+// coefficients to three taps on known targets (Cramer's rule, exact for
+// three points); touchCalFromRange builds the old min/max mapping for
+// boards that were never calibrated. Applying it is four multiply-adds.
+//
+// The calibration screen (main.cpp) taps TOUCH_CAL_TARGETS, checks the
+// result on a fourth target at the centre and stores the matrix in the key
+// store (KEY_TOUCH_CAL).
+
+#define TOUCH_CAL_TARGETS    3
+#define TOUCH_CAL_RAW_MAX    4095
+#define TOUCH_CAL_MIN_DET    100000     // Taps closer than this are one spot
+#define TOUCH_CAL_MAX_GAIN   (1 << 17)  // |a|, |b|, |d|, |e|: 2 px per raw step
+#define TOUCH_CAL_MAX_OFFSET (1 << 28)  // |c|, |f|
+
+struct TouchCal {
+  int32_t a, b, c;  // x row, 16.16
+  int32_t d, e, f;  // y row, 16.16
+  int16_t zMin;     // Weakest press accepted (from the calibration taps)
+  uint8_t samples;  // Readings averaged per touch
+  uint8_t stored;   // 1 if from the calibration screen
+};
+
+// Raw (rx, ry) at screen (sx, sy) for each target. False if the taps are
+// collinear or the fit is out of range (a slipped finger).
+bool touchCalSolve(const int16_t raw[TOUCH_CAL_TARGETS][2], const int16_t screen[TOUCH_CAL_TARGETS][2],
+                   TouchCal& out);
+
+// Linear map of [minX, maxX] x [minY, maxY] onto width x height
+void touchCalFromRange(TouchCal& out, int minX, int maxX, int minY, int maxY, int width, int height);
+
+// Coefficients within the ranges above (a stored record may be stale)
+bool touchCalValid(const TouchCal& cal);
+
+// Within those ranges each product fits 29 bits, so the sums stay in int32
+inline void touchCalApply(const TouchCal& cal, int rx, int ry, int& x, int& y) {
+  if (rx < 0) rx = 0;
+  if (rx > TOUCH_CAL_RAW_MAX) rx = TOUCH_CAL_RAW_MAX;
+  if (ry < 0) ry = 0;
+  if (ry > TOUCH_CAL_RAW_MAX) ry = TOUCH_CAL_RAW_MAX;
+  x = (cal.a * rx + cal.b * ry + cal.c + 0x8000) >> 16;
+  y = (cal.d * rx + cal.e * ry + cal.f + 0x8000) >> 16;
+}
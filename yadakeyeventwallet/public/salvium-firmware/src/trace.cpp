@@ -0,0 +1,79 @@
+#include "trace.h"
+#include <Arduino.h>
+#include <string.h>
+
+static TraceEvent ring[TRACE_EVENTS];
+static uint32_t total = 0;              // Events ever opened; slot is total % TRACE_EVENTS
+static TraceEvent* current = nullptr;  // Event still being timed
+static uint32_t currentStartUs = 0;
+static bool waitingForJobs = false;
+
+static const char* kindNames[] = {"TOUCH", "BUTTON", "SERIAL"};
+
+static TraceEvent& begin(TraceKind kind, uint8_t screen, uint32_t startUs) {
+  // A new input closes the previous event even if its jobs are still running
+  TraceEvent& ev = ring[total++ % TRACE_EVENTS];
+  memset(&ev, 0, sizeof(ev));
+  ev.ms = millis();
+  ev.kind = kind;
+  ev.from = screen;
+  ev.to = screen;
+  current = &ev;
+  currentStartUs = startUs;
+  waitingForJobs = false;
+  return ev;
+}
+
+void traceInput(TraceKind kind, int16_t a, int16_t b, uint8_t screen, uint32_t startUs, bool wake) {
+  TraceEvent& ev = begin(kind, screen, startUs);
+  ev.a = a;
+  ev.b = b;
+  ev.wake = wake;
+}
+
+void traceCommand(const char* command, uint8_t screen, uint32_t startUs) {
+  TraceEvent& ev = begin(TRACE_SERIAL, screen, startUs);
+  size_t len = strlen(command);
+  ev.a = len > 0x7FFF ? 0x7FFF : (int16_t)len;
+
+  const char* second = strchr(command, ':');
+  if (second) second = strchr(second + 1, ':');
+  size_t keep = second ? (size_t)(second - command) + 1 : len;
+  if (keep > TRACE_COMMAND_CHARS - 1) keep = TRACE_COMMAND_CHARS - 1;
+  memcpy(ev.command, command, keep);
+}
+
+void traceSettle(uint8_t screen, bool jobsBusy) {
+  if (!current) return;
+  uint32_t elapsed = micros() - currentStartUs;
+  current->to = screen;
+  if (!waitingForJobs) {
+    current->handledUs = elapsed;
+    waitingForJobs = jobsBusy;
+  } else if (!jobsBusy) {
+    current->doneUs = elapsed;
+    waitingForJobs = false;
+  }
+  if (!waitingForJobs) current = nullptr;
+}
+
+uint16_t traceCount() {
+  return total < TRACE_EVENTS ? total : TRACE_EVENTS;
+}
+
+bool traceRead(uint16_t n, TraceEvent& ev) {
+  if (n >= traceCount()) return false;
+  uint32_t first = total - traceCount();
+  ev = ring[(first + n) % TRACE_EVENTS];
+  return true;
+}
+
+void traceClear() {
+  total = 0;
+  current = nullptr;
+  waitingForJobs = false;
+}
+
+const char* traceKindName(uint8_t kind) {
+  return kind <= TRACE_SERIAL ? kindNames[kind] : "?";
+}
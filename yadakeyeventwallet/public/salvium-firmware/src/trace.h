@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+
+// ==================== INPUT TRACE ====================
+//
+// Always-on ring of the last TRACE_EVENTS inputs the firmware acted on:
+// touches that passed the debounce and validity checks, BOOT button
+// presses, and serial commands. Each event records the screen before and
+// after, how long the handler ran, and, when it queued jobs, how long until
+// the job queue drained. A slow session can be dumped with GET_TRACE right
+// after it happens and replayed in the simulator (src/host/sim --replay).
+//
+// Serial commands keep only their name up to the second ':' (at most
+// TRACE_COMMAND_CHARS - 1 characters) and their length: transaction data
+// and addresses never enter the trace.
+
+#define TRACE_EVENTS        128
+#define TRACE_COMMAND_CHARS 20
+
+enum TraceKind { TRACE_TOUCH, TRACE_BUTTON, TRACE_SERIAL };
+
+struct TraceEvent {
+  uint32_t ms;         // millis() when the input was accepted
+  uint32_t handledUs;  // Handler run time
+  uint32_t doneUs;     // Until the job queue drained; 0 if no job was left or
+                       // another input arrived first
+  int16_t a;           // Touch: raw panel x. Button: press ms. Serial: length.
+  int16_t b;           // Touch: raw panel y
+  uint8_t kind;
+  uint8_t from;        // Screen before
+  uint8_t to;          // Screen after
+  uint8_t wake;        // The input only woke the screen
+  char command[TRACE_COMMAND_CHARS];
+};
+
+// Open an event. The handler's run time counts from startUs (micros()).
+void traceInput(TraceKind kind, int16_t a, int16_t b, uint8_t screen, uint32_t startUs, bool wake = false);
+void traceCommand(const char* command, uint8_t screen, uint32_t startUs);
+
+// Once per loop() pass after the input handlers; closes the open event
+// when its handler has returned and the job queue is idle
+void traceSettle(uint8_t screen, bool jobsBusy);
+
+uint16_t traceCount();
+
+// n-th oldest event still in the ring
+bool traceRead(uint16_t n, TraceEvent& ev);
+
+void traceClear();
+
+const char* traceKindName(uint8_t kind);
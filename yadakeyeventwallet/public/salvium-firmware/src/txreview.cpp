@@ -0,0 +1,552 @@
+#include "txreview.h"
+#include "amount.h"
+#include <string.h>
+
+// ---- Filter ----
+
+// Paths the parser captures. An entry matches a key in an object tagged
+// with its parent; array elements carry the array's tag.
+enum TxField : uint8_t {
+  F_NONE,
+  F_ROOT,
+  F_OUTPUTS,
+  F_TO,
+  F_VALUE,
+  F_FEE,
+  F_PREFIX,
+  F_RCT_BASE,
+  F_PRUNABLE,
+  F_SIGN,
+  F_COUNT
+};
+
+struct TxFilter {
+  uint8_t parent;
+  const char* key;
+};
+
+static const TxFilter TX_FILTER[F_COUNT] = {
+  {F_NONE, ""},
+  {F_NONE, ""},
+  {F_ROOT, "outputs"},
+  {F_OUTPUTS, "to"},
+  {F_OUTPUTS, "value"},
+  {F_ROOT, "fee"},
+  {F_ROOT, "prefix"},
+  {F_ROOT, "rct_base"},
+  {F_ROOT, "prunable_hash"},
+  {F_ROOT, "sign"},
+};
+
+#define FIELD_MASK 0x3F
+#define ITEM_BIT   0x40  // Object that is one element of outputs[]
+#define ARRAY_BIT  0x80
+
+#define TX_HAVE_PREFIX   0x01
+#define TX_HAVE_RCT      0x02
+#define TX_HAVE_PRUNABLE 0x04
+#define TX_HAVE_SIGN     0x08
+#define TX_HAVE_HASHES   (TX_HAVE_PREFIX | TX_HAVE_RCT | TX_HAVE_PRUNABLE)
+
+#define PREFIX_VARINTS 2  // version, unlock_time
+#define RCT_VARINTS    2  // type, txnFee
+
+enum JsonState : uint8_t {
+  J_START,
+  J_RAW,          // Not an envelope: counted, not parsed
+  J_FIRST_KEY,    // After '{': a key or '}'
+  J_KEY_START,    // After ',' in an object
+  J_KEY,
+  J_KEY_ESCAPE,
+  J_COLON,
+  J_FIRST_VALUE,  // After '[': a value or ']'
+  J_VALUE,
+  J_STRING,
+  J_ESCAPE,
+  J_BARE,         // Number or literal
+  J_AFTER,        // ',' or a closing bracket
+  J_END,
+  J_FAILED,
+};
+
+static const char* errorNames[] = {
+  "OK", "MALFORMED", "TOO_DEEP", "DUPLICATE", "BAD_AMOUNT", "BAD_HEX", "TOO_LONG", "INCOMPLETE", "MISMATCH",
+};
+
+static void fail(TxReview& r, TxReviewError err) {
+  if (r.error == TX_REVIEW_OK) r.error = err;
+  r.state = J_FAILED;
+}
+
+static int hexNibble(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+static bool isBare(char c) {
+  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '.' || c == '-' ||
+         c == '+';
+}
+
+static bool isSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static uint8_t top(const TxReview& r) {
+  return r.depth ? r.stack[r.depth - 1] : (uint8_t)F_NONE;
+}
+
+// ---- Captured values ----
+
+static TxOutput* currentOutput(TxReview& r) {
+  return r.outputs > 0 && r.outputs <= TX_REVIEW_OUTPUTS ? &r.out[r.outputs - 1] : nullptr;
+}
+
+static void beginValue(TxReview& r, uint8_t field, size_t at) {
+  r.field = field;
+  r.textLen = 0;
+  r.numberLen = 0;
+  r.hexHigh = -1;
+  r.varint = 0;
+  r.varintShift = 0;
+  r.varintValue = 0;
+  if (field == F_PREFIX || field == F_RCT_BASE) keccak_init(r.keccak);
+  if (field == F_SIGN) r.signAt = at;
+  if (field == F_TO) {
+    TxOutput* o = currentOutput(r);
+    if (o) o->to[0] = '\0';
+  }
+}
+
+// Leading varints of the prefix (version, unlock_time) and RingCT base
+// (type, txnFee); the rest is only hashed
+static void varintByte(TxReview& r, uint8_t b) {
+  uint8_t wanted = r.field == F_PREFIX ? PREFIX_VARINTS : RCT_VARINTS;
+  if (r.varint >= wanted) return;
+  if (r.varintShift > 63) {
+    fail(r, TX_REVIEW_MALFORMED);
+    return;
+  }
+  r.varintValue |= (uint64_t)(b & 0x7F) << r.varintShift;
+  if (b & 0x80) {
+    r.varintShift += 7;
+    return;
+  }
+  uint64_t v = r.varintValue;
+  r.varintValue = 0;
+  r.varintShift = 0;
+  if (r.field == F_PREFIX) {
+    if (r.varint == 1) r.unlockTime = v;
+  } else if (r.varint == 0 && v == 0) {
+    r.rctFee = 0;  // RCTTypeNull: no fee field
+    r.varint = RCT_VARINTS;
+    return;
+  } else if (r.varint == 1) {
+    if (v > (uint64_t)INT64_MAX) {
+      fail(r, TX_REVIEW_BAD_AMOUNT);
+      return;
+    }
+    r.rctFee = (int64_t)v;
+  }
+  r.varint++;
+}
+
+static void hexByte(TxReview& r, uint8_t b) {
+  size_t index = r.textLen / 2 - 1;
+  switch (r.field) {
+    case F_PREFIX:
+    case F_RCT_BASE:
+      keccak_update(r.keccak, &b, 1);
+      varintByte(r, b);
+      break;
+    case F_PRUNABLE:
+      if (index >= 32) {
+        fail(r, TX_REVIEW_BAD_HEX);
+        return;
+      }
+      r.prunableHash[index] = b;
+      break;
+    case F_SIGN:
+      if (index < 32) r.message[index] = b;
+      break;
+  }
+}
+
+static void stringChar(TxReview& r, char c) {
+  r.textLen++;
+  switch (r.field) {
+    case F_TO: {
+      if (r.textLen > TX_DEST_MAX) {
+        fail(r, TX_REVIEW_TOO_LONG);
+        return;
+      }
+      TxOutput* o = currentOutput(r);
+      if (o) {
+        o->to[r.textLen - 1] = c;
+        o->to[r.textLen] = '\0';
+      }
+      break;
+    }
+    case F_VALUE:
+    case F_FEE:
+      if (r.numberLen >= TX_NUMBER_MAX) {
+        fail(r, TX_REVIEW_BAD_AMOUNT);
+        return;
+      }
+      r.number[r.numberLen++] = c;
+      break;
+    case F_PREFIX:
+    case F_RCT_BASE:
+    case F_PRUNABLE:
+    case F_SIGN: {
+      int v = hexNibble(c);
+      if (v < 0) {
+        fail(r, TX_REVIEW_BAD_HEX);
+        return;
+      }
+      if (r.hexHigh < 0) {
+        r.hexHigh = v;
+      } else {
+        hexByte(r, (uint8_t)((r.hexHigh << 4) | v));
+        r.hexHigh = -1;
+      }
+      break;
+    }
+  }
+}
+
+static void endAmount(TxReview& r) {
+  r.number[r.numberLen] = '\0';
+  int64_t v;
+  if (!amountParse(r.number, r.decimals, v)) {
+    fail(r, TX_REVIEW_BAD_AMOUNT);
+    return;
+  }
+  if (r.field == F_FEE) {
+    r.fee = v;
+    r.hasFee = true;
+    return;
+  }
+  if (v > INT64_MAX - r.total) {
+    fail(r, TX_REVIEW_BAD_AMOUNT);
+    return;
+  }
+  r.total += v;
+  TxOutput* o = currentOutput(r);
+  if (o) o->amount = v;
+}
+
+static void endValue(TxReview& r, bool quoted) {
+  uint8_t field = r.field;
+  bool hex = field == F_PREFIX || field == F_RCT_BASE || field == F_PRUNABLE || field == F_SIGN;
+  r.state = J_AFTER;
+
+  if (hex && (!quoted || r.hexHigh >= 0 || r.textLen == 0)) {
+    fail(r, TX_REVIEW_BAD_HEX);
+  } else if (field == F_TO && (!quoted || r.textLen == 0)) {
+    fail(r, TX_REVIEW_MALFORMED);
+  } else {
+    switch (field) {
+      case F_VALUE:
+      case F_FEE:
+        endAmount(r);
+        break;
+      case F_PREFIX:
+        if (r.varint < PREFIX_VARINTS) fail(r, TX_REVIEW_MALFORMED);
+        keccak_final(r.keccak, r.prefixHash);
+        r.seen |= TX_HAVE_PREFIX;
+        break;
+      case F_RCT_BASE:
+        if (r.varint < RCT_VARINTS) fail(r, TX_REVIEW_MALFORMED);
+        keccak_final(r.keccak, r.rctHash);
+        r.seen |= TX_HAVE_RCT;
+        break;
+      case F_PRUNABLE:
+        if (r.textLen != 64) fail(r, TX_REVIEW_BAD_HEX);
+        r.seen |= TX_HAVE_PRUNABLE;
+        break;
+      case F_SIGN:
+        if (r.textLen < 64) fail(r, TX_REVIEW_BAD_HEX);
+        r.signLen = r.textLen;
+        r.seen |= TX_HAVE_SIGN;
+        break;
+    }
+  }
+  r.field = F_NONE;
+}
+
+// ---- Structure ----
+
+static void push(TxReview& r, uint8_t tag) {
+  if (r.depth >= TX_JSON_MAX_DEPTH) {
+    fail(r, TX_REVIEW_TOO_DEEP);
+    return;
+  }
+  r.stack[r.depth++] = tag;
+}
+
+static void pop(TxReview& r, bool array) {
+  uint8_t tag = top(r);
+  if (!r.depth || ((tag & ARRAY_BIT) != 0) != array) {
+    fail(r, TX_REVIEW_MALFORMED);
+    return;
+  }
+  const uint16_t needed = (1 << F_TO) | (1 << F_VALUE);
+  if ((tag & ITEM_BIT) && (r.itemSeen & needed) != needed) {
+    fail(r, TX_REVIEW_MALFORMED);
+    return;
+  }
+  r.depth--;
+  r.state = r.depth ? J_AFTER : J_END;
+}
+
+static void beginKey(TxReview& r) {
+  uint8_t parent = top(r) & FIELD_MASK;
+  r.candidates = 0;
+  r.keyLen = 0;
+  if (parent == F_NONE) return;
+  for (int i = 0; i < F_COUNT; i++) {
+    if (TX_FILTER[i].parent == parent) r.candidates |= (uint16_t)(1 << i);
+  }
+}
+
+static void keyChar(TxReview& r, char c) {
+  for (uint16_t m = r.candidates; m; m &= m - 1) {
+    int i = __builtin_ctz(m);
+    if (TX_FILTER[i].key[r.keyLen] != c) r.candidates &= (uint16_t)~(1 << i);
+  }
+  if (r.candidates) r.keyLen++;
+}
+
+static void endKey(TxReview& r) {
+  r.field = F_NONE;
+  for (uint16_t m = r.candidates; m; m &= m - 1) {
+    int i = __builtin_ctz(m);
+    if (TX_FILTER[i].key[r.keyLen] == '\0') r.field = (uint8_t)i;
+  }
+  r.state = J_COLON;
+  if (r.field == F_NONE) return;
+
+  uint16_t& seen = (top(r) & ITEM_BIT) ? r.itemSeen : r.rootSeen;
+  if (seen & (1 << r.field)) {
+    fail(r, TX_REVIEW_DUPLICATE);
+    return;
+  }
+  seen |= (uint16_t)(1 << r.field);
+}
+
+// First char of a value; at is its offset in the request
+static void beginAnyValue(TxReview& r, char c, size_t at) {
+  uint8_t t = top(r);
+  uint8_t field = (t & ARRAY_BIT) ? (t & FIELD_MASK) : r.field;
+  bool scalarField = field >= F_TO;
+
+  if (c == '{' || c == '[') {
+    bool array = c == '[';
+    if (scalarField) {
+      fail(r, field >= F_PREFIX ? TX_REVIEW_BAD_HEX : field == F_TO ? TX_REVIEW_MALFORMED : TX_REVIEW_BAD_AMOUNT);
+      return;
+    }
+    uint8_t tag = F_NONE;
+    if (field == F_OUTPUTS && array && !(t & ARRAY_BIT)) {
+      tag = F_OUTPUTS | ARRAY_BIT;
+    } else if (field == F_OUTPUTS && !array && (t & ARRAY_BIT)) {
+      if (r.outputs == UINT16_MAX) {
+        fail(r, TX_REVIEW_MALFORMED);
+        return;
+      }
+      r.outputs++;
+      r.itemSeen = 0;
+      TxOutput* o = currentOutput(r);
+      if (o) {
+        o->to[0] = '\0';
+        o->amount = 0;
+      }
+      tag = F_OUTPUTS | ITEM_BIT;
+    } else if (array) {
+      tag = ARRAY_BIT;
+    }
+    r.field = F_NONE;
+    push(r, tag);
+    if (r.state != J_FAILED) r.state = array ? J_FIRST_VALUE : J_FIRST_KEY;
+    return;
+  }
+
+  beginValue(r, scalarField ? field : (uint8_t)F_NONE, at + 1);
+  if (c == '"') {
+    r.state = J_STRING;
+  } else if (isBare(c)) {
+    r.state = J_BARE;
+    if (r.field == F_VALUE || r.field == F_FEE) stringChar(r, c);
+  } else {
+    fail(r, TX_REVIEW_MALFORMED);
+  }
+}
+
+static void feedChar(TxReview& r, char c, size_t at) {
+  switch (r.state) {
+    case J_START:
+      if (isSpace(c)) return;
+      if (c != '{') {
+        r.state = J_RAW;
+        return;
+      }
+      r.details = true;
+      push(r, F_ROOT);
+      r.state = J_FIRST_KEY;
+      return;
+
+    case J_RAW:
+    case J_FAILED:
+      return;
+
+    case J_FIRST_KEY:
+    case J_KEY_START:
+      if (isSpace(c)) return;
+      if (c == '}' && r.state == J_FIRST_KEY) {
+        pop(r, false);
+      } else if (c == '"') {
+        beginKey(r);
+        r.state = J_KEY;
+      } else {
+        fail(r, TX_REVIEW_MALFORMED);
+      }
+      return;
+
+    case J_KEY:
+      if (c == '"') {
+        endKey(r);
+      } else if (c == '\\') {
+        r.candidates = 0;  // No filtered key is escaped
+        r.state = J_KEY_ESCAPE;
+      } else {
+        keyChar(r, c);
+      }
+      return;
+
+    case J_KEY_ESCAPE:
+      r.state = J_KEY;
+      return;
+
+    case J_COLON:
+      if (isSpace(c)) return;
+      if (c == ':') {
+        r.state = J_VALUE;
+      } else {
+        fail(r, TX_REVIEW_MALFORMED);
+      }
+      return;
+
+    case J_FIRST_VALUE:
+    case J_VALUE:
+      if (isSpace(c)) return;
+      if (c == ']' && r.state == J_FIRST_VALUE) {
+        pop(r, true);
+        return;
+      }
+      beginAnyValue(r, c, at);
+      return;
+
+    case J_STRING:
+      if (c == '"') {
+        endValue(r, true);
+      } else if (c == '\\') {
+        // Captured fields are addresses, decimals and hex: never escaped
+        if (r.field != F_NONE) {
+          fail(r, TX_REVIEW_MALFORMED);
+          return;
+        }
+        r.state = J_ESCAPE;
+      } else if ((uint8_t)c < 0x20) {
+        fail(r, TX_REVIEW_MALFORMED);
+      } else if (r.field != F_NONE) {
+        stringChar(r, c);
+      }
+      return;
+
+    case J_ESCAPE:
+      r.state = J_STRING;
+      return;
+
+    case J_BARE:
+      if (isBare(c)) {
+        if (r.field == F_VALUE || r.field == F_FEE) stringChar(r, c);
+        return;
+      }
+      endValue(r, false);
+      if (r.state == J_FAILED) return;
+      feedChar(r, c, at);  // The delimiter, in J_AFTER
+      return;
+
+    case J_AFTER:
+      if (isSpace(c)) return;
+      if (c == ',') {
+        r.state = (top(r) & ARRAY_BIT) ? J_VALUE : J_KEY_START;
+      } else if (c == '}' || c == ']') {
+        pop(r, c == ']');
+      } else {
+        fail(r, TX_REVIEW_MALFORMED);
+      }
+      return;
+
+    case J_END:
+      if (!isSpace(c)) fail(r, TX_REVIEW_MALFORMED);
+      return;
+  }
+}
+
+// ---- API ----
+
+void txReviewBegin(TxReview& r, uint8_t decimals) {
+  memset(&r, 0, sizeof(r));
+  r.decimals = decimals;
+  r.state = J_START;
+  r.hexHigh = -1;
+}
+
+void txReviewFeed(TxReview& r, const char* data, size_t len) {
+  for (size_t i = 0; i < len && r.state != J_FAILED; i++) feedChar(r, data[i], r.length + i);
+  r.length += len;
+}
+
+TxReviewError txReviewEnd(TxReview& r) {
+  if (r.error != TX_REVIEW_OK) return r.error;
+  if (!r.details) return TX_REVIEW_OK;
+  if (r.state != J_END) {
+    fail(r, TX_REVIEW_MALFORMED);
+    return r.error;
+  }
+
+  // Signed-message check: all of the hashed parts, or none
+  if (r.seen & TX_HAVE_HASHES) {
+    if ((r.seen & (TX_HAVE_HASHES | TX_HAVE_SIGN)) != (TX_HAVE_HASHES | TX_HAVE_SIGN)) {
+      fail(r, TX_REVIEW_INCOMPLETE);
+      return r.error;
+    }
+    uint8_t hashes[96], message[32];
+    memcpy(hashes, r.prefixHash, 32);
+    memcpy(hashes + 32, r.rctHash, 32);
+    memcpy(hashes + 64, r.prunableHash, 32);
+    keccak256(hashes, sizeof(hashes), message);
+    if (memcmp(message, r.message, 32) != 0 || (r.hasFee && r.fee != r.rctFee)) {
+      fail(r, TX_REVIEW_MISMATCH);
+      return r.error;
+    }
+    r.fee = r.rctFee;
+    r.hasFee = true;
+    r.verified = true;
+  }
+  return TX_REVIEW_OK;
+}
+
+TxReviewError txReviewParse(TxReview& r, const char* request, uint8_t decimals) {
+  txReviewBegin(r, decimals);
+  txReviewFeed(r, request, strlen(request));
+  return txReviewEnd(r);
+}
+
+const char* txReviewErrorName(TxReviewError err) {
+  return err <= TX_REVIEW_MISMATCH ? errorNames[err] : "?";
+}
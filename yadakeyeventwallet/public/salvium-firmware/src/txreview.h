@@ -0,0 +1,111 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "crypto/keccak.h"
+
+// ==================== TRANSACTION REVIEW ====================
+//
+// Every SIGN_TX request is read once, a byte at a time, before anything is
+// signed, for what the confirmation screen shows. Only the fields below are
+// kept, so parsing is linear in the request and uses sizeof(TxReview) of RAM
+// whatever its size; no DOM is built.
+//
+// A request starting with '{' is a JSON envelope. The parser keeps one byte
+// per open container (TX_JSON_MAX_DEPTH), tagged with the filter entry its
+// key matched (TX_FILTER, txreview.cpp). Keys are matched against the
+// filter as they stream past, and only values on these paths are captured:
+//
+//   outputs[].to      destination address
+//   outputs[].value   amount, decimal
+//   fee               decimal
+//   prefix            hex CryptoNote transaction prefix     Salvium only
+//   rct_base          hex RingCT base (type, fee, ...)
+//   prunable_hash     hex, 32 bytes
+//   sign              hex signer payload (signer.h)
+//
+// A key on a filtered path that appears twice in one object is refused, so
+// the screen cannot show one value while the signer uses the other.
+//
+// The prefix and RingCT base are Keccak-hashed and their leading varints
+// decoded while the hex streams past. For Salvium the device checks
+//
+//   message == H(H(prefix) || H(rct_base) || prunable_hash)
+//
+// against the message the signer payload signs, and then shows the fee and
+// unlock time from those signed bytes. RingCT hides output amounts, so the
+// destinations and amounts remain as declared by the host. YadaCoin
+// requests are parsed the same way and then refused with SIGN:UNSUPPORTED,
+// as the device holds no YadaCoin signing key (main.cpp, loadCoinSign).
+//
+// Any other request (a bare signer payload, a message that is not JSON)
+// reviews with details = false, and the screen says so.
+
+#define TX_REVIEW_OUTPUTS 3    // Destinations kept for the screen; all are totalled
+#define TX_DEST_MAX       114  // As HISTORY_DEST_MAX
+#define TX_JSON_MAX_DEPTH 8
+#define TX_NUMBER_MAX     31   // Chars of a captured amount
+
+enum TxReviewError {
+  TX_REVIEW_OK,
+  TX_REVIEW_MALFORMED,   // Not JSON, or an output without to/value
+  TX_REVIEW_TOO_DEEP,
+  TX_REVIEW_DUPLICATE,   // A filtered key twice in one object
+  TX_REVIEW_BAD_AMOUNT,  // Not a plain decimal, or out of range
+  TX_REVIEW_BAD_HEX,
+  TX_REVIEW_TOO_LONG,    // Destination longer than TX_DEST_MAX
+  TX_REVIEW_INCOMPLETE,  // Some but not all of prefix/rct_base/prunable_hash/sign
+  TX_REVIEW_MISMATCH,    // Prefix and RingCT hashes do not give the signed message
+};
+
+struct TxOutput {
+  char to[TX_DEST_MAX + 1];
+  int64_t amount;  // Atomic units
+};
+
+struct TxReview {
+  // ---- Result ----
+  bool details;          // JSON envelope; false: nothing to show but the size
+  bool verified;         // Fee and unlock time taken from the signed message
+  bool hasFee;
+  uint16_t outputs;      // Outputs seen; the first TX_REVIEW_OUTPUTS are in out[]
+  int64_t total;         // Sum over all outputs
+  int64_t fee;
+  uint64_t unlockTime;   // From the prefix, 0 if none
+  size_t length;         // Request bytes
+  size_t signAt, signLen;  // Signer payload within the request (signLen 0: none)
+  TxOutput out[TX_REVIEW_OUTPUTS];
+
+  // ---- Parser ----
+  uint8_t decimals;
+  uint8_t state;
+  uint8_t depth;
+  uint8_t stack[TX_JSON_MAX_DEPTH];  // Filter entry per open container
+  uint8_t field;         // Filter entry of the value being read
+  uint16_t candidates;   // Filter entries the key read so far still matches
+  uint8_t keyLen;
+  uint16_t rootSeen, itemSeen;  // Filtered keys already seen in this object
+  char number[TX_NUMBER_MAX + 1];
+  uint8_t numberLen;
+  size_t textLen;        // Chars of the captured string so far
+  int hexHigh;           // Pending high nibble, or -1
+  uint8_t varint;        // Leading varints decoded so far
+  uint8_t varintShift;
+  uint64_t varintValue;
+  uint8_t seen;          // TX_HAVE_* for the hashed fields
+  int64_t rctFee;
+  KeccakState keccak;    // Over the prefix or RingCT base being read
+  uint8_t prefixHash[32], rctHash[32], prunableHash[32], message[32];
+  TxReviewError error;
+};
+
+// Parse a whole request. decimals: atomic units per coin (coins.h).
+TxReviewError txReviewParse(TxReview& r, const char* request, uint8_t decimals);
+
+// The same in pieces, for requests that arrive in parts
+void txReviewBegin(TxReview& r, uint8_t decimals);
+void txReviewFeed(TxReview& r, const char* data, size_t len);
+TxReviewError txReviewEnd(TxReview& r);
+
+const char* txReviewErrorName(TxReviewError err);
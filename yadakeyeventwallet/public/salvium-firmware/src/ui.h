@@ -0,0 +1,88 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==================== SCREEN LAYOUT ====================
+//
+// Each screen's tappable and drawn-by-table elements are one constexpr
+// Widget array (main.cpp, SCREEN TABLE). The same rectangle is drawn and
+// hit-tested; a touch counts within `pad` pixels of it, so a finger that
+// lands on the border of a button still presses it.
+//
+// Hit-testing goes through a grid of UI_CELL-pixel cells built from the
+// array at compile time (uiBuildGrid). Each cell holds a bitmask of the
+// widgets that reach into it, so a touch looks at one cell and checks at
+// most the few widgets in it, however many screens and widgets there are.
+// Where widgets overlap, the earlier one in the array wins.
+
+#define UI_WIDTH       320
+#define UI_HEIGHT      240
+#define UI_CELL        20
+#define UI_GRID_COLS   (UI_WIDTH / UI_CELL)
+#define UI_GRID_ROWS   (UI_HEIGHT / UI_CELL)
+#define UI_MAX_WIDGETS 16  // Bits in a cell mask
+#define UI_TOUCH_PAD   6   // Default slack around a button
+
+enum WidgetKind : uint8_t {
+  UI_BUTTON,      // Filled, FONT_SANS_16 label centred
+  UI_SMALL,       // Filled, size-1 label centred
+  UI_MENU_ITEM,   // Outlined; filled while it is the BOOT selection
+  UI_BACK_ARROW,  // Arrow in the top-left corner
+  UI_ZONE,        // Not drawn: a region of content drawn by the screen
+};
+
+struct Widget {
+  int16_t x, y, w, h;
+  WidgetKind kind;
+  uint16_t color;  // Fill, or outline for a menu item
+  uint16_t text;   // Label
+  const char* label;
+  uint8_t action;  // UiAction (main.cpp)
+  uint8_t arg;     // Target screen, coin or item, by action
+  uint8_t pad;
+};
+
+struct UiHitGrid {
+  uint16_t cells[UI_GRID_ROWS][UI_GRID_COLS];
+};
+
+constexpr int uiClamp(int v, int lo, int hi) {
+  return v < lo ? lo : v > hi ? hi : v;
+}
+
+template <size_t N>
+constexpr UiHitGrid uiBuildGrid(const Widget (&widgets)[N]) {
+  static_assert(N <= UI_MAX_WIDGETS, "more widgets than a cell mask holds");
+  UiHitGrid grid{};
+  for (size_t i = 0; i < N; i++) {
+    const Widget& w = widgets[i];
+    int c0 = uiClamp(w.x - w.pad, 0, UI_WIDTH - 1) / UI_CELL;
+    int c1 = uiClamp(w.x + w.w - 1 + w.pad, 0, UI_WIDTH - 1) / UI_CELL;
+    int r0 = uiClamp(w.y - w.pad, 0, UI_HEIGHT - 1) / UI_CELL;
+    int r1 = uiClamp(w.y + w.h - 1 + w.pad, 0, UI_HEIGHT - 1) / UI_CELL;
+    for (int r = r0; r <= r1; r++) {
+      for (int c = c0; c <= c1; c++) grid.cells[r][c] |= (uint16_t)(1u << i);
+    }
+  }
+  return grid;
+}
+
+// Empty screens (splash, calibration) have nothing to hit
+constexpr UiHitGrid UI_EMPTY_GRID{};
+
+inline bool uiContains(const Widget& w, int x, int y) {
+  return x >= w.x - w.pad && x < w.x + w.w + w.pad && y >= w.y - w.pad && y < w.y + w.h + w.pad;
+}
+
+// Index of the widget at (x, y), on-screen coordinates, or -1
+inline int uiHitTest(const Widget* widgets, const UiHitGrid& grid, int x, int y) {
+  if (x < 0 || x >= UI_WIDTH || y < 0 || y >= UI_HEIGHT) return -1;
+  uint16_t mask = grid.cells[y / UI_CELL][x / UI_CELL];
+  while (mask) {
+    int i = __builtin_ctz(mask);
+    if (uiContains(widgets[i], x, y)) return i;
+    mask &= mask - 1;
+  }
+  return -1;
+}
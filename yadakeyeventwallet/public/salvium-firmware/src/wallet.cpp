@@ -0,0 +1,68 @@
+#include "wallet.h"
+#include "crypto/cryptonote.h"
+#include <string.h>
+
+WalletArena wallet;
+
+static_assert(sizeof(WalletSecrets) % WALLET_ALIGN == 0, "secrets must fill whole cache lines");
+
+static int hexNibble(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+static bool setAddress(char* dst, size_t cap, const char* addr) {
+  size_t len = strlen(addr);
+  if (len >= cap) return false;
+  memcpy(dst, addr, len);
+  memset(dst + len, 0, cap - len);
+  return true;
+}
+
+bool walletSetYadaAddress(const char* addr) {
+  return setAddress(wallet.yadacoinAddress, sizeof(wallet.yadacoinAddress), addr);
+}
+
+bool walletSetSalviumAddress(const char* addr) {
+  return setAddress(wallet.salviumAddress, sizeof(wallet.salviumAddress), addr);
+}
+
+bool walletSetSalviumSpendHex(const char* hex) {
+  uint8_t key[32];
+  for (int i = 0; i < 32; i++) {
+    int hi = hexNibble(hex[2 * i]);
+    int lo = hi < 0 ? -1 : hexNibble(hex[2 * i + 1]);
+    if (lo < 0) {
+      memwipe(key, sizeof(key));
+      return false;
+    }
+    key[i] = (uint8_t)((hi << 4) | lo);
+  }
+  memcpy(wallet.secret.salviumSpendKey, key, 32);
+  memwipe(key, sizeof(key));
+  return true;
+}
+
+void walletSalviumSpendHex(char out[WALLET_KEY_HEX_LEN + 1]) {
+  static const char digits[] = "0123456789abcdef";
+  for (int i = 0; i < 32; i++) {
+    out[2 * i] = digits[wallet.secret.salviumSpendKey[i] >> 4];
+    out[2 * i + 1] = digits[wallet.secret.salviumSpendKey[i] & 0x0f];
+  }
+  out[WALLET_KEY_HEX_LEN] = '\0';
+}
+
+void walletSalviumSpendKey(uint8_t out[32]) {
+  memcpy(out, wallet.secret.salviumSpendKey, 32);
+  sc_reduce32(out);
+}
+
+void walletWipeSecrets() {
+  memwipe(&wallet.secret, sizeof(wallet.secret));
+}
+
+void walletWipe() {
+  memwipe(&wallet, sizeof(wallet));
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==================== WALLET STATE ====================
+//
+// Everything the wallet keeps between requests lives in one statically
+// allocated arena: fixed-size arrays, no String, no heap. The spend key sits
+// on its own cache lines at the front so it can be wiped without touching
+// anything else, and it is never kept in hex form; callers that need hex
+// (export QR) format into a stack buffer and wipe it afterwards.
+
+#define WALLET_ALIGN        32  // ESP32 cache line
+#define WALLET_KEY_HEX_LEN  64
+#define WALLET_YDA_ADDR_LEN 67  // "YDA" + 64 hex
+#define WALLET_SAL_ADDR_LEN 99  // "SaLv" primary address, base58 of 72 bytes
+#define WALLET_SAL_ASSETS   4   // Salvium balances: SAL, then other assets as reported
+
+// One asset's balance in atomic units (amount.h). asset is the ticker packed
+// like a coin tag (coins.h); 0 marks a free slot.
+struct WalletBalance {
+  uint32_t asset;
+  int64_t atomic;
+};
+
+struct alignas(WALLET_ALIGN) WalletSecrets {
+  uint8_t salviumSpendKey[32];  // As generated/stored, not reduced
+};
+
+struct alignas(WALLET_ALIGN) WalletArena {
+  WalletSecrets secret;
+  char yadacoinAddress[WALLET_YDA_ADDR_LEN + 1];
+  char salviumAddress[WALLET_SAL_ADDR_LEN + 1];
+  int32_t salviumRotation;  // Key rotation counter
+  WalletBalance yadacoinBalance;
+  WalletBalance salviumBalances[WALLET_SAL_ASSETS];
+};
+
+extern WalletArena wallet;
+
+// Copy an address into the arena. False (and unchanged) if it does not fit.
+bool walletSetYadaAddress(const char* addr);
+bool walletSetSalviumAddress(const char* addr);
+
+// Spend key from/to 64 hex chars. out gets a NUL; wipe it after use.
+bool walletSetSalviumSpendHex(const char* hex);
+void walletSalviumSpendHex(char out[WALLET_KEY_HEX_LEN + 1]);
+
+// Private spend key as a reduced scalar; wipe after use
+void walletSalviumSpendKey(uint8_t out[32]);
+
+// Wipe the spend key only, or the whole arena
+void walletWipeSecrets();
+void walletWipe();
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""
+Smooth font generator for the Salvium/YadaCoin hardware wallet.
+
+Pre-renders anti-aliased glyphs (4 bits per pixel) for the pixel sizes the
+firmware actually draws and writes them to src/fonts_data.cpp as flash-resident
+PROGMEM tables, plus src/fonts_data.h with the per-font cache cell sizes.
+Only printable ASCII (0x20-0x7E) is emitted.
+
+Usage:
+    pip install pillow
+    python tools/fontgen.py path/to/Lato-Regular.ttf
+
+Re-run this whenever the font or the size list changes; the output is checked in
+so normal firmware builds do not need Python.
+"""
+
+import os
+import sys
+
+from PIL import Image, ImageDraw, ImageFont
+
+# (symbol, pixel size) - keep in sync with the FONT_* declarations in fonts.h
+SIZES = [("FONT_SANS_16", 16), ("FONT_SANS_24", 24)]
+FIRST_CHAR = 0x20
+LAST_CHAR = 0x7E
+
+SRC_DIR = os.path.join(os.path.dirname(__file__), "..", "src")
+OUT_PATH = os.path.join(SRC_DIR, "fonts_data.cpp")
+HDR_PATH = os.path.join(SRC_DIR, "fonts_data.h")
+
+
+def render_font(path, size):
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+    line_height = ascent + descent
+
+    bitmap = bytearray()
+    glyphs = []
+    max_cell = 0
+
+    for code in range(FIRST_CHAR, LAST_CHAR + 1):
+        ch = chr(code)
+        advance = int(round(font.getlength(ch)))
+        left, top, right, bottom = font.getbbox(ch)
+        width = max(0, right - left)
+        height = max(0, bottom - top)
+
+        offset = len(bitmap)
+        if width and height:
+            img = Image.new("L", (width, height), 0)
+            ImageDraw.Draw(img).text((-left, -top), ch, font=font, fill=255)
+            px = img.load()
+            # Rows are packed two pixels per byte (high nibble first), each row
+            # starting on a byte boundary so a row can be expanded on its own.
+            for y in range(height):
+                for x in range(0, width, 2):
+                    hi = px[x, y] >> 4
+                    lo = px[x + 1, y] >> 4 if x + 1 < width else 0
+                    bitmap.append((hi << 4) | lo)
+
+        glyphs.append((offset, width, height, left, top, advance))
+        # Glyphs are drawn into advance-wide cells (overhang is clipped)
+        max_cell = max(max_cell, advance * line_height)
+
+    return {
+        "bitmap": bitmap,
+        "glyphs": glyphs,
+        "line_height": line_height,
+        "ascent": ascent,
+        "max_cell": max_cell,
+    }
+
+
+def emit(out, symbol, data):
+    name = symbol.lower()
+    out.write("static const uint8_t %s_bitmap[] PROGMEM = {\n" % name)
+    bm = data["bitmap"]
+    for i in range(0, len(bm), 16):
+        out.write("  " + ", ".join("0x%02x" % b for b in bm[i:i + 16]) + ",\n")
+    out.write("};\n\n")
+
+    out.write("static const GlyphInfo %s_glyphs[] PROGMEM = {\n" % name)
+    for code, g in zip(range(FIRST_CHAR, LAST_CHAR + 1), data["glyphs"]):
+        label = chr(code) if chr(code) not in "\\" else "backslash"
+        out.write("  { %5d, %2d, %2d, %3d, %3d, %2d },  // '%s'\n" % (g + (label,)))
+    out.write("};\n\n")
+
+    out.write("const SmoothFont %s = {\n" % symbol)
+    out.write("  %s_bitmap, %s_glyphs, 0x%02X, 0x%02X, %d, %d, %d\n"
+              % (name, name, FIRST_CHAR, LAST_CHAR,
+                 data["line_height"], data["ascent"], data["max_cell"]))
+    out.write("};\n\n")
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(__doc__)
+        sys.exit(1)
+    ttf = sys.argv[1]
+
+    banner = ("// GENERATED by tools/fontgen.py from %s - do not edit.\n"
+              "// Lato is licensed under the SIL Open Font License 1.1.\n\n"
+              % os.path.basename(ttf))
+    rendered = [(symbol, render_font(ttf, size)) for symbol, size in SIZES]
+
+    with open(HDR_PATH, "w") as hdr:
+        hdr.write(banner)
+        hdr.write("#pragma once\n\n")
+        hdr.write("// Largest glyph cell (advance x line height) per font, in pixels.\n")
+        hdr.write("// Used to size the RAM glyph cache at compile time.\n")
+        for symbol, data in rendered:
+            hdr.write("#define %s_MAX_CELL %d\n" % (symbol, data["max_cell"]))
+
+    with open(OUT_PATH, "w") as out:
+        out.write(banner)
+        out.write("#include \"fonts.h\"\n\n")
+        for symbol, data in rendered:
+            emit(out, symbol, data)
+            print("%s: %d bytes bitmap, line %d, max cell %d px"
+                  % (symbol, len(data["bitmap"]), data["line_height"], data["max_cell"]))
+
+
+if __name__ == "__main__":
+    main()